@@ -0,0 +1,201 @@
+﻿#include "FrameProfilerAddon.hpp"
+#include "Common/AssetManagement.hpp"
+#include "Common/FsUtils.hpp"
+
+namespace
+{
+	using FrameProfiler::Section;
+
+	constexpr std::size_t kNumSections = static_cast<std::size_t>(Section::kNumSections);
+
+	// グラフの縦軸の最大値
+	constexpr double kGraphMaxMs = 33.3;
+
+	// 目標フレーム時間(60FPS)
+	constexpr double kTargetFrameMs = 1000.0 / 60.0;
+
+	constexpr Size kGraphSize = { 480, 160 };
+
+	constexpr Point kGraphPos = { 8, 8 };
+
+	// 区間ごとの描画色(kNoneはどの区間にも含まれない時間として使用)
+	constexpr std::array<ColorF, kNumSections> kSectionColors = {
+		ColorF{ 0.5, 0.5, 0.5 }, // kNone
+		ColorF{ 0.5, 0.5, 0.5 }, // kFrame
+		ColorF{ 0.3, 0.6, 1.0 }, // kGameUpdateStatus
+		ColorF{ 1.0, 0.5, 0.2 }, // kGameJudgment
+		ColorF{ 0.7, 0.4, 1.0 }, // kGameAudioEffect
+		ColorF{ 1.0, 0.9, 0.3 }, // kGameSE
+		ColorF{ 0.3, 0.9, 0.5 }, // kGameGraphicsUpdate
+		ColorF{ 0.2, 0.8, 0.8 }, // kGameGraphicsDraw
+		ColorF{ 1.0, 0.4, 0.6 }, // kSelectItemConstruction
+	};
+
+	constexpr double NsToMs(int64 ns)
+	{
+		return static_cast<double>(ns) / 1000000.0;
+	}
+}
+
+void FrameProfilerAddon::aggregateFrame(int64 frameBeginNs, int64 frameEndNs)
+{
+	FrameSample& sample = m_samples[m_sampleHead];
+	sample = FrameSample{ .frameMs = NsToMs(frameEndNs - frameBeginNs) };
+
+	// メインスレッド以外の計測結果もフレーム内に終了したものは合算する
+	// (区間の時間から、その区間を親とする子区間の時間を差し引いて排他時間とする)
+	for (const FrameProfiler::Event& event : FrameProfiler::Snapshot())
+	{
+		if (event.section == Section::kFrame || event.endNs <= m_lastAggregatedEndNs || event.endNs > frameEndNs)
+		{
+			continue;
+		}
+
+		const double durationMs = NsToMs(event.durationNs());
+		sample.exclusiveMs[static_cast<std::size_t>(event.section)] += durationMs;
+		if (event.parent != Section::kNone)
+		{
+			sample.exclusiveMs[static_cast<std::size_t>(event.parent)] -= durationMs;
+		}
+	}
+	m_lastAggregatedEndNs = frameEndNs;
+
+	m_sampleHead = (m_sampleHead + 1U) % kNumGraphFrames;
+	m_numSamples = Min(m_numSamples + 1U, kNumGraphFrames);
+}
+
+void FrameProfilerAddon::exportTrace() const
+{
+	const FilePath dirPath = FileSystem::PathAppend(FsUtils::AppDataDirectoryPath(), U"profile");
+	if (!FileSystem::Exists(dirPath) && !FileSystem::CreateDirectories(dirPath))
+	{
+		Logger << U"[ksm warning] FrameProfilerAddon: Could not create directory (path:'{}')"_fmt(dirPath);
+		return;
+	}
+
+	const FilePath filePath = FileSystem::PathAppend(dirPath, U"trace_{}.json"_fmt(DateTime::Now().format(U"yyyyMMdd_HHmmss")));
+	if (FrameProfiler::ExportChromeTrace(filePath))
+	{
+		Logger << U"[ksm info] FrameProfilerAddon: Exported trace (path:'{}')"_fmt(filePath);
+	}
+}
+
+bool FrameProfilerAddon::update()
+{
+	if (!FrameProfiler::IsEnabled())
+	{
+		// 計測が無効の場合は記録がないため、オーバーレイの表示・書き出しも行わない
+		m_frameBeginNs = 0;
+		m_isOverlayVisible = false;
+		return true;
+	}
+
+	if (KeyF8.down())
+	{
+		m_isOverlayVisible = !m_isOverlayVisible;
+	}
+
+	if (KeyF9.down())
+	{
+		exportTrace();
+	}
+
+	// 前フレームの開始から今フレームの開始までを1フレームとして記録
+	const int64 nowNs = FrameProfiler::NowNs();
+	if (m_frameBeginNs != 0)
+	{
+		FrameProfiler::Record(FrameProfiler::Event{
+			.section = Section::kFrame,
+			.beginNs = m_frameBeginNs,
+			.endNs = nowNs,
+		});
+
+		if (m_isOverlayVisible)
+		{
+			aggregateFrame(m_frameBeginNs, nowNs);
+		}
+	}
+	m_frameBeginNs = nowNs;
+
+	if (!m_isOverlayVisible)
+	{
+		m_numSamples = 0U;
+		m_lastAggregatedEndNs = nowNs;
+	}
+
+	return true;
+}
+
+void FrameProfilerAddon::draw() const
+{
+	if (!m_isOverlayVisible)
+	{
+		return;
+	}
+
+	const Rect graphRect{ kGraphPos, kGraphSize };
+	graphRect.draw(ColorF{ 0.0, 0.7 });
+
+	const double pxPerMs = kGraphSize.y / kGraphMaxMs;
+	const double barWidth = static_cast<double>(kGraphSize.x) / kNumGraphFrames;
+
+	// 古いフレームから順に左から描画
+	std::array<double, kNumSections> sumMs = {};
+	for (std::size_t i = 0U; i < m_numSamples; ++i)
+	{
+		const std::size_t sampleIdx = (m_sampleHead + kNumGraphFrames - m_numSamples + i) % kNumGraphFrames;
+		const FrameSample& sample = m_samples[sampleIdx];
+		const double x = graphRect.x + barWidth * (kNumGraphFrames - m_numSamples + i);
+
+		double y = graphRect.bottomY();
+		double measuredMs = 0.0;
+		for (std::size_t sectionIdx = static_cast<std::size_t>(Section::kFrame) + 1U; sectionIdx < kNumSections; ++sectionIdx)
+		{
+			const double ms = Max(sample.exclusiveMs[sectionIdx], 0.0);
+			if (ms > 0.0)
+			{
+				const double height = ms * pxPerMs;
+				RectF{ x, y - height, barWidth, height }.draw(kSectionColors[sectionIdx]);
+				y -= height;
+			}
+			measuredMs += ms;
+			sumMs[sectionIdx] += ms;
+		}
+
+		// 計測区間外の時間(描画の反映やVsync待ちなどを含む)
+		const double otherMs = Max(sample.frameMs - measuredMs, 0.0);
+		const double otherHeight = Min(otherMs * pxPerMs, y - graphRect.y);
+		RectF{ x, y - otherHeight, barWidth, otherHeight }.draw(kSectionColors[static_cast<std::size_t>(Section::kNone)]);
+		sumMs[static_cast<std::size_t>(Section::kNone)] += otherMs;
+	}
+
+	// 目標フレーム時間のライン
+	const double targetY = graphRect.bottomY() - kTargetFrameMs * pxPerMs;
+	Line{ graphRect.x, targetY, graphRect.rightX(), targetY }.draw(1.0, ColorF{ 1.0, 0.3, 0.3 });
+
+	// 凡例(表示中のフレームの平均)
+	if (m_numSamples == 0U)
+	{
+		return;
+	}
+	const Font& font = AssetManagement::SystemFont();
+	Vec2 legendPos{ graphRect.x, graphRect.bottomY() + 4 };
+	for (std::size_t sectionIdx = 0U; sectionIdx < kNumSections; ++sectionIdx)
+	{
+		if (sectionIdx == static_cast<std::size_t>(Section::kFrame))
+		{
+			continue;
+		}
+
+		const double avgMs = sumMs[sectionIdx] / m_numSamples;
+		if (sectionIdx != static_cast<std::size_t>(Section::kNone) && avgMs <= 0.0)
+		{
+			continue;
+		}
+
+		const StringView name = sectionIdx == static_cast<std::size_t>(Section::kNone) ? U"Other" : FrameProfiler::SectionName(static_cast<Section>(sectionIdx));
+		RectF{ legendPos + Vec2{ 0, 4 }, 10, 10 }.draw(kSectionColors[sectionIdx]);
+		font(U"{}: {:.2f}ms"_fmt(name, avgMs)).draw(14, legendPos + Vec2{ 16, 0 }, Palette::White);
+		legendPos.y += 18;
+	}
+}
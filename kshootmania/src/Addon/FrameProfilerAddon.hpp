@@ -0,0 +1,49 @@
+﻿#pragma once
+#include "Common/FrameProfiler.hpp"
+
+/// @brief フレーム時間の計測とプロファイルのオーバーレイ表示を行うアドオン
+/// @details F8キーでオーバーレイの表示切り替え、F9キーでChrome Trace Event形式のJSONを書き出す。
+///          config.iniのframe_profilerが0の場合は計測自体を無効にする
+class FrameProfilerAddon : public IAddon
+{
+public:
+	static constexpr StringView kAddonName = U"FrameProfiler";
+
+	/// @brief オーバーレイに表示するフレーム数
+	static constexpr std::size_t kNumGraphFrames = 240U;
+
+private:
+	/// @brief 1フレーム分の区間ごとの時間(子区間の時間を除く)
+	struct FrameSample
+	{
+		std::array<double, static_cast<std::size_t>(FrameProfiler::Section::kNumSections)> exclusiveMs = {};
+
+		double frameMs = 0.0;
+	};
+
+	int64 m_frameBeginNs = 0;
+
+	bool m_isOverlayVisible = false;
+
+	/// @brief 前フレームまでに集計済みの計測結果の終了時刻
+	int64 m_lastAggregatedEndNs = 0;
+
+	std::array<FrameSample, kNumGraphFrames> m_samples = {};
+
+	std::size_t m_sampleHead = 0U;
+
+	std::size_t m_numSamples = 0U;
+
+	void aggregateFrame(int64 frameBeginNs, int64 frameEndNs);
+
+	void exportTrace() const;
+
+public:
+	FrameProfilerAddon() = default;
+
+	virtual ~FrameProfilerAddon() = default;
+
+	virtual bool update() override;
+
+	virtual void draw() const override;
+};
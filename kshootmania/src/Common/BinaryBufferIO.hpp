@@ -0,0 +1,121 @@
+﻿#pragma once
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/// @brief バイナリファイルの内容をメモリ上のバッファへ書き込む
+/// @remark 値はメモリ上の表現のまま(リトルエンディアン前提で)書き込まれる
+class BinaryBufferWriter
+{
+private:
+	std::string m_buffer;
+
+public:
+	template <typename T>
+	void write(const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	void writeBytes(const void* data, std::size_t size)
+	{
+		m_buffer.append(static_cast<const char*>(data), size);
+	}
+
+	void writeString(const std::string& str)
+	{
+		write(static_cast<uint32>(str.size()));
+		m_buffer.append(str);
+	}
+
+	void writeString(StringView str)
+	{
+		writeString(Unicode::ToUTF8(str));
+	}
+
+	void reserve(std::size_t size)
+	{
+		m_buffer.reserve(size);
+	}
+
+	const std::string& buffer() const
+	{
+		return m_buffer;
+	}
+};
+
+/// @brief メモリ上のバッファからBinaryBufferWriterで書き込んだ値を読み込む
+/// @remark 範囲外の読み込みを行った場合はfailed()がtrueになり、以降の読み込みは全て既定値を返す
+class BinaryBufferReader
+{
+private:
+	const char* m_pos;
+
+	const char* m_end;
+
+	bool m_failed = false;
+
+public:
+	BinaryBufferReader(const void* data, std::size_t size)
+		: m_pos(static_cast<const char*>(data))
+		, m_end(static_cast<const char*>(data) + size)
+	{
+	}
+
+	template <typename T>
+	T read()
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		T value{};
+		if (m_failed || static_cast<std::size_t>(m_end - m_pos) < sizeof(T))
+		{
+			m_failed = true;
+			return value;
+		}
+		std::memcpy(&value, m_pos, sizeof(T));
+		m_pos += sizeof(T);
+		return value;
+	}
+
+	std::string readString()
+	{
+		const uint32 size = read<uint32>();
+		if (m_failed || static_cast<std::size_t>(m_end - m_pos) < size)
+		{
+			m_failed = true;
+			return std::string{};
+		}
+		std::string str(m_pos, size);
+		m_pos += size;
+		return str;
+	}
+
+	/// @brief 指定したバイト数を読み飛ばす
+	void skip(std::size_t size)
+	{
+		if (m_failed || static_cast<std::size_t>(m_end - m_pos) < size)
+		{
+			m_failed = true;
+			return;
+		}
+		m_pos += size;
+	}
+
+	/// @brief 次に読み込む位置
+	const char* currentPos() const
+	{
+		return m_pos;
+	}
+
+	bool failed() const
+	{
+		return m_failed;
+	}
+
+	/// @brief 未読み込みのバイト数
+	std::size_t remainingSize() const
+	{
+		return static_cast<std::size_t>(m_end - m_pos);
+	}
+};
@@ -0,0 +1,25 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+
+/// @brief バックグラウンド処理の中断要求を伝えるためのトークン
+/// @remark コピーしたトークン同士は状態を共有する。ワーカースレッドへはコピーを渡し、定期的にisCancelled()を確認させる
+class CancellationToken
+{
+private:
+	std::shared_ptr<std::atomic<bool>> m_cancelled = std::make_shared<std::atomic<bool>>(false);
+
+public:
+	CancellationToken() = default;
+
+	void cancel()
+	{
+		m_cancelled->store(true, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]]
+	bool isCancelled() const
+	{
+		return m_cancelled->load(std::memory_order_relaxed);
+	}
+};
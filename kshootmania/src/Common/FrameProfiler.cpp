@@ -0,0 +1,214 @@
+﻿#include "FrameProfiler.hpp"
+#include <bit>
+
+namespace FrameProfiler
+{
+	namespace
+	{
+		static_assert(std::has_single_bit(kCapacity), "kCapacity must be a power of two");
+
+		constexpr std::size_t kIdxMask = kCapacity - 1U;
+
+		// 書き込み中の読み込みを検出するため、シーケンス番号で挟んで読み書きする(seqlock)
+		// シーケンス番号: 0=未使用, 奇数=書き込み中, 偶数=書き込み完了(書き込み位置から一意に決まる)
+		struct Slot
+		{
+			std::atomic<uint64> sequence = 0U;
+
+			// section | parent << 8 | threadIdx << 16
+			std::atomic<uint32> packed = 0U;
+
+			std::atomic<int64> beginNs = 0;
+
+			std::atomic<int64> endNs = 0;
+		};
+
+		std::array<Slot, kCapacity> s_slots;
+
+		std::atomic<uint64> s_writePos = 0U;
+
+		std::atomic<bool> s_enabled = true;
+
+		std::atomic<uint16> s_nextThreadIdx = 0U;
+
+		// 現在のスレッドで計測中の最も内側の区間
+		thread_local Section t_currentSection = Section::kNone;
+
+		uint16 CurrentThreadIdx()
+		{
+			thread_local const uint16 threadIdx = s_nextThreadIdx.fetch_add(1U, std::memory_order_relaxed);
+			return threadIdx;
+		}
+
+		constexpr uint64 CompletedSequence(uint64 writePos)
+		{
+			return (writePos + 1U) * 2U;
+		}
+	}
+
+	void Record(const Event& event)
+	{
+		const uint64 writePos = s_writePos.fetch_add(1U, std::memory_order_relaxed);
+		Slot& slot = s_slots[writePos & kIdxMask];
+
+		slot.sequence.store(CompletedSequence(writePos) - 1U, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		slot.packed.store(
+			static_cast<uint32>(event.section) | (static_cast<uint32>(event.parent) << 8) | (static_cast<uint32>(event.threadIdx) << 16),
+			std::memory_order_relaxed);
+		slot.beginNs.store(event.beginNs, std::memory_order_relaxed);
+		slot.endNs.store(event.endNs, std::memory_order_relaxed);
+
+		slot.sequence.store(CompletedSequence(writePos), std::memory_order_release);
+	}
+
+	bool IsEnabled()
+	{
+		return s_enabled.load(std::memory_order_relaxed);
+	}
+
+	void SetEnabled(bool enabled)
+	{
+		s_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	Array<Event> Snapshot()
+	{
+		const uint64 writePos = s_writePos.load(std::memory_order_acquire);
+		const uint64 firstPos = writePos > kCapacity ? writePos - kCapacity : 0U;
+
+		Array<Event> events;
+		events.reserve(static_cast<std::size_t>(writePos - firstPos));
+		for (uint64 pos = firstPos; pos < writePos; ++pos)
+		{
+			const Slot& slot = s_slots[pos & kIdxMask];
+			const uint64 sequence = slot.sequence.load(std::memory_order_acquire);
+			if (sequence != CompletedSequence(pos))
+			{
+				// 書き込み中、または既に新しい計測結果で上書きされている
+				continue;
+			}
+
+			const uint32 packed = slot.packed.load(std::memory_order_relaxed);
+			const int64 beginNs = slot.beginNs.load(std::memory_order_relaxed);
+			const int64 endNs = slot.endNs.load(std::memory_order_relaxed);
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+			{
+				continue;
+			}
+
+			events.push_back(Event{
+				.section = static_cast<Section>(packed & 0xFFU),
+				.parent = static_cast<Section>((packed >> 8) & 0xFFU),
+				.threadIdx = static_cast<uint16>(packed >> 16),
+				.beginNs = beginNs,
+				.endNs = endNs,
+			});
+		}
+		return events;
+	}
+
+	StringView SectionName(Section section)
+	{
+		switch (section)
+		{
+		case Section::kFrame:
+			return U"Frame";
+		case Section::kGameUpdateStatus:
+			return U"GameMain::updateStatus";
+		case Section::kGameJudgment:
+			return U"Judgment";
+		case Section::kGameAudioEffect:
+			return U"AudioEffectMain::update";
+		case Section::kGameSE:
+			return U"SE update";
+		case Section::kGameGraphicsUpdate:
+			return U"GraphicsMain::update";
+		case Section::kGameGraphicsDraw:
+			return U"GraphicsMain::draw";
+		case Section::kSelectItemConstruction:
+			return U"SelectMenuSongItem construction";
+		default:
+			return U"Unknown";
+		}
+	}
+
+	bool ExportChromeTrace(FilePathView filePath)
+	{
+		const Array<Event> events = Snapshot();
+		if (events.empty())
+		{
+			return false;
+		}
+
+		const int64 originNs = std::min_element(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.beginNs < b.beginNs; })->beginNs;
+
+		String json;
+		json.reserve(events.size() * 96U + 256U);
+		json += U"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		// フレームを記録したスレッドをメインスレッドとして名前を付ける
+		bool isFirst = true;
+		const auto itrFrame = std::find_if(events.begin(), events.end(), [](const Event& event) { return event.section == Section::kFrame; });
+		if (itrFrame != events.end())
+		{
+			json += U"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"Main\"}}}}"_fmt(itrFrame->threadIdx);
+			isFirst = false;
+		}
+
+		for (const Event& event : events)
+		{
+			if (!isFirst)
+			{
+				json += U',';
+			}
+			isFirst = false;
+
+			// 完了イベント(ph:X)。時刻はマイクロ秒単位
+			json += U"{{\"name\":\"{}\",\"cat\":\"ksm\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}"_fmt(
+				SectionName(event.section),
+				event.threadIdx,
+				static_cast<double>(event.beginNs - originNs) / 1000.0,
+				static_cast<double>(event.durationNs()) / 1000.0);
+		}
+		json += U"]}";
+
+		TextWriter writer{ filePath, TextEncoding::UTF8_NoBOM };
+		if (!writer)
+		{
+			Logger << U"[ksm warning] FrameProfiler::ExportChromeTrace: Could not open file (path:'{}')"_fmt(filePath);
+			return false;
+		}
+		writer.write(json);
+		return true;
+	}
+
+	ScopedTimer::ScopedTimer(Section section)
+		: m_section(section)
+		, m_parent(t_currentSection)
+		, m_beginNs(IsEnabled() ? NowNs() : 0)
+	{
+		t_currentSection = section;
+	}
+
+	ScopedTimer::~ScopedTimer()
+	{
+		t_currentSection = m_parent;
+
+		if (m_beginNs == 0 || !IsEnabled())
+		{
+			return;
+		}
+
+		Record(Event{
+			.section = m_section,
+			.parent = m_parent,
+			.threadIdx = CurrentThreadIdx(),
+			.beginNs = m_beginNs,
+			.endNs = NowNs(),
+		});
+	}
+}
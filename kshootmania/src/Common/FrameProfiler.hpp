@@ -0,0 +1,108 @@
+﻿#pragma once
+#include <atomic>
+#include <chrono>
+
+/// @brief ゲームループの区間ごとの処理時間を記録するプロファイラ
+/// @details 計測結果はロックフリーのリングバッファに記録され、古いものから上書きされる。
+///          計測1回あたりのコストは時刻の取得2回とアトミック操作数回のみのため、リリースビルドでも常に有効にしておける
+namespace FrameProfiler
+{
+	/// @brief 計測区間
+	enum class Section : uint8
+	{
+		/// @brief 計測区間なし(最も外側の区間の親として使用)
+		kNone = 0,
+
+		/// @brief 1フレーム全体(FrameProfilerAddonが前フレームの開始から次フレームの開始までを記録)
+		kFrame,
+
+		kGameUpdateStatus,
+		kGameJudgment,
+		kGameAudioEffect,
+		kGameSE,
+		kGameGraphicsUpdate,
+		kGameGraphicsDraw,
+		kSelectItemConstruction,
+
+		kNumSections,
+	};
+
+	/// @brief 計測結果
+	struct Event
+	{
+		Section section = Section::kNone;
+
+		/// @brief 同じスレッドで計測中だった外側の区間
+		Section parent = Section::kNone;
+
+		/// @brief 計測したスレッドの番号(スレッドごとに初回計測時に0から順に割り当て)
+		uint16 threadIdx = 0;
+
+		int64 beginNs = 0;
+
+		int64 endNs = 0;
+
+		[[nodiscard]]
+		int64 durationNs() const
+		{
+			return endNs - beginNs;
+		}
+	};
+
+	/// @brief リングバッファに保持する計測結果の最大数
+	inline constexpr std::size_t kCapacity = 16384;
+
+	/// @brief 計測に使用する時刻を取得
+	/// @return 時刻(ナノ秒, steady_clock基準)
+	[[nodiscard]]
+	inline int64 NowNs()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/// @brief 計測結果を記録
+	/// @remark 任意のスレッドから呼び出してよい
+	void Record(const Event& event);
+
+	/// @brief 計測が有効かどうか
+	[[nodiscard]]
+	bool IsEnabled();
+
+	/// @brief 計測の有効・無効を設定
+	void SetEnabled(bool enabled);
+
+	/// @brief リングバッファ内の計測結果を記録順に取得
+	/// @remark 取得中に上書きされた要素は含まれない
+	[[nodiscard]]
+	Array<Event> Snapshot();
+
+	/// @brief 区間の表示名を取得
+	[[nodiscard]]
+	StringView SectionName(Section section);
+
+	/// @brief リングバッファ内の計測結果をChrome Trace Event形式のJSONで書き出す
+	/// @param filePath 出力先のファイルパス
+	/// @return 書き出しに成功した場合はtrue
+	/// @remark chrome://tracing や Perfetto UI で読み込める
+	bool ExportChromeTrace(FilePathView filePath);
+
+	/// @brief スコープの開始から終了までを計測区間として記録する
+	class ScopedTimer
+	{
+	private:
+		const Section m_section;
+
+		const Section m_parent;
+
+		const int64 m_beginNs;
+
+	public:
+		explicit ScopedTimer(Section section);
+
+		~ScopedTimer();
+
+		ScopedTimer(const ScopedTimer&) = delete;
+
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+	};
+}
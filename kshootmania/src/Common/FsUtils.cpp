@@ -1,15 +1,94 @@
 ﻿#include "FsUtils.hpp"
 #include "../Ini/ConfigIni.hpp"
+#include <cstdio>
+#include <filesystem>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace FsUtils
 {
-#if defined(__linux__)
 	namespace
 	{
+#if defined(__linux__)
 		// OpenSiv3D 0.6.16 Linux版でModulePathが相対パスになる現象の回避用
 		FilePath g_moduleAbsolutePath;
+#endif
+
+		std::filesystem::path ToFsPath(FilePathView path)
+		{
+#ifdef _WIN32
+			return std::filesystem::path{ path.toWstr() };
+#else
+			return std::filesystem::path{ Unicode::ToUTF8(path) };
+#endif
+		}
+
+		std::FILE* OpenFile(FilePathView path, bool append)
+		{
+#ifdef _WIN32
+			return _wfopen(path.toWstr().c_str(), append ? L"ab" : L"wb");
+#else
+			return std::fopen(Unicode::ToUTF8(path).c_str(), append ? "ab" : "wb");
+#endif
+		}
+
+		// ファイルの内容をディスクへ書き込み終えるまで待つ
+		bool SyncFile(std::FILE* fp)
+		{
+			if (std::fflush(fp) != 0)
+			{
+				return false;
+			}
+#ifdef _WIN32
+			return _commit(_fileno(fp)) == 0;
+#else
+			return fsync(fileno(fp)) == 0;
+#endif
+		}
+
+		// リネーム結果をディスクへ反映する(POSIXではディレクトリエントリのfsyncが別途必要)
+		void SyncParentDirectory([[maybe_unused]] FilePathView path)
+		{
+#ifndef _WIN32
+			const int fd = open(Unicode::ToUTF8(FileSystem::ParentPath(path)).c_str(), O_RDONLY);
+			if (fd >= 0)
+			{
+				fsync(fd);
+				close(fd);
+			}
+#endif
+		}
+
+		int64 ToStampTime(const DateTime& dateTime)
+		{
+			// 比較にしか使用しないため、単調増加する整数に詰めるだけで十分
+			int64 value = dateTime.year;
+			value = value * 12 + dateTime.month;
+			value = value * 31 + dateTime.day;
+			value = value * 24 + dateTime.hour;
+			value = value * 60 + dateTime.minute;
+			value = value * 60 + dateTime.second;
+			value = value * 1000 + dateTime.milliseconds;
+			return value;
+		}
+
+		bool WriteAndSyncFile(FilePathView path, const void* data, std::size_t size, bool append)
+		{
+			std::FILE* fp = OpenFile(path, append);
+			if (fp == nullptr)
+			{
+				return false;
+			}
+			const bool succeeded = std::fwrite(data, 1, size, fp) == size && SyncFile(fp);
+			return std::fclose(fp) == 0 && succeeded;
+		}
 	}
 
+#if defined(__linux__)
 	void InitModulePathForLinux()
 	{
 		g_moduleAbsolutePath = FileSystem::FullPath(FileSystem::ModulePath());
@@ -65,6 +144,11 @@ namespace FsUtils
 		return FileSystem::PathAppend(AppDataDirectoryPath(), U"score");
 	}
 
+	FilePath CacheDirectoryPath()
+	{
+		return FileSystem::PathAppend(AppDataDirectoryPath(), U"cache");
+	}
+
 	FilePath SongsDirectoryPath()
 	{
 		const StringView configuredPath = ConfigIni::GetString(ConfigIni::Key::kSongsDirectoryPath);
@@ -101,6 +185,25 @@ namespace FsUtils
 		return FileSystem::FileName(endsWithSlash ? directoryPath.substr(0, directoryPath.size() - 1) : directoryPath);
 	}
 
+	Array<FilePath> SubDirectoriesSortedByName(FilePathView directoryPath)
+	{
+		Array<FilePath> directories =
+			FileSystem::DirectoryContents(directoryPath, Recursive::No)
+				.filter(
+					[](FilePathView p)
+					{
+						return FileSystem::IsDirectory(p);
+					});
+
+		// フォルダ名(小文字変換)の昇順でソート
+		directories.sort_by([](const FilePath& a, const FilePath& b)
+		{
+			return DirectoryNameByDirectoryPath(a).lowercased() < DirectoryNameByDirectoryPath(b).lowercased();
+		});
+
+		return directories;
+	}
+
 	String EliminateExtension(FilePathView path)
 	{
 		if (path.empty())
@@ -119,4 +222,43 @@ namespace FsUtils
 	{
 		return FileSystem::RelativePath(fullPath, SongsDirectoryPath());
 	}
+
+	FileStamp GetFileStamp(FilePathView path)
+	{
+		const Optional<DateTime> writeTime = FileSystem::WriteTime(path);
+		if (!writeTime.has_value())
+		{
+			return FileStamp{};
+		}
+
+		return FileStamp{
+			.writeTime = ToStampTime(*writeTime),
+			.size = FileSystem::FileSize(path),
+		};
+	}
+
+	bool WriteFileDurably(FilePathView path, const void* data, std::size_t size)
+	{
+		const FilePath tempPath = U"{}.tmp"_fmt(path);
+		if (!WriteAndSyncFile(tempPath, data, size, false))
+		{
+			FileSystem::Remove(tempPath);
+			return false;
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(ToFsPath(tempPath), ToFsPath(path), ec);
+		if (ec)
+		{
+			FileSystem::Remove(tempPath);
+			return false;
+		}
+		SyncParentDirectory(path);
+		return true;
+	}
+
+	bool AppendFileDurably(FilePathView path, const void* data, std::size_t size)
+	{
+		return WriteAndSyncFile(path, data, size, true);
+	}
 }
@@ -3,6 +3,16 @@
 /// @brief ファイルシステム関連の関数群
 namespace FsUtils
 {
+	/// @brief ファイルの変更検出用の更新日時とサイズ
+	struct FileStamp
+	{
+		int64 writeTime = 0;
+
+		int64 size = -1;
+
+		bool operator==(const FileStamp&) const = default;
+	};
+
 #if defined(__linux__)
 	/// @brief FsUtils用のModulePathを初期化(Linux用)
 	/// @remark プログラム起動直後のカレントディレクトリが未変更のタイミングで一度だけ呼び出す
@@ -33,6 +43,12 @@ namespace FsUtils
 	[[nodiscard]]
 	FilePath ScoreDirectoryPath();
 
+	/// @brief cacheフォルダのフルパスを取得
+	/// @details 楽曲ライブラリのインデックス等、削除しても再生成される一時データの保存先
+	/// @return フルパス
+	[[nodiscard]]
+	FilePath CacheDirectoryPath();
+
 	/// @brief songsフォルダのフルパスを取得
 	/// @return フルパス
 	[[nodiscard]]
@@ -66,6 +82,13 @@ namespace FsUtils
 	[[nodiscard]]
 	String DirectoryNameByDirectoryPath(FilePathView directoryPath);
 
+	/// @brief 直下のサブディレクトリをフォルダ名(小文字変換)の昇順で取得
+	/// @param directoryPath ディレクトリパス
+	/// @return サブディレクトリのパスの配列
+	/// @remark ConfigIniにアクセスしないため、ワーカースレッドから呼び出してよい
+	[[nodiscard]]
+	Array<FilePath> SubDirectoriesSortedByName(FilePathView directoryPath);
+
 	/// @brief ファイルパスから拡張子を除去
 	/// @param path ファイルパス
 	/// @return 拡張子を除去したファイルパス
@@ -77,4 +100,26 @@ namespace FsUtils
 	/// @return songsフォルダからの相対パス
 	[[nodiscard]]
 	String RelativePathFromSongsDir(FilePathView fullPath);
+
+	/// @brief ファイルの変更検出用の更新日時とサイズを取得
+	/// @param path ファイルパス
+	/// @return 更新日時とサイズ(ファイルが存在しない場合は既定値)
+	/// @remark 値は比較にのみ使用できる
+	[[nodiscard]]
+	FileStamp GetFileStamp(FilePathView path);
+
+	/// @brief ファイルの内容を電源断に対して安全に置き換える
+	/// @param path ファイルパス
+	/// @param data 書き込む内容
+	/// @param size 書き込むバイト数
+	/// @return 書き込みに成功した場合はtrue
+	/// @remark 一時ファイルへ書き込んでfsyncした後にリネームするため、書き込み途中で終了しても元のファイルか新しいファイルのどちらかが必ず残る
+	bool WriteFileDurably(FilePathView path, const void* data, std::size_t size);
+
+	/// @brief ファイルの末尾へ追記し、ディスクへの書き込み完了を待つ
+	/// @param path ファイルパス(存在しない場合は作成)
+	/// @param data 追記する内容
+	/// @param size 追記するバイト数
+	/// @return 追記に成功した場合はtrue
+	bool AppendFileDurably(FilePathView path, const void* data, std::size_t size);
 }
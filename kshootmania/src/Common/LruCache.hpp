@@ -0,0 +1,117 @@
+﻿#pragma once
+#include <list>
+
+/// @brief 合計コストと要素数に上限を持つLRUキャッシュ
+/// @details 上限を超えた場合は最後に使用されてから最も時間が経っている要素から破棄する。
+///          find()で取得した要素のポインタは、その要素が破棄されるまで(insert()・clear()を呼ぶまで)有効
+/// @tparam Key キーの型
+/// @tparam Value 値の型
+template <typename Key, typename Value>
+class LruCache
+{
+private:
+	struct Entry
+	{
+		Key key;
+
+		Value value;
+
+		std::size_t cost;
+	};
+
+	// 先頭ほど最近使用した要素
+	// Note: 要素のアドレスが変わらないようstd::listにしている
+	std::list<Entry> m_entries;
+
+	HashTable<Key, typename std::list<Entry>::iterator> m_entryByKey;
+
+	std::size_t m_maxTotalCost;
+
+	std::size_t m_maxCount;
+
+	std::size_t m_totalCost = 0U;
+
+	void evict(const Entry* pKeepEntry)
+	{
+		while ((m_totalCost > m_maxTotalCost || m_entries.size() > m_maxCount) && !m_entries.empty() && &m_entries.back() != pKeepEntry)
+		{
+			m_totalCost -= m_entries.back().cost;
+			m_entryByKey.erase(m_entries.back().key);
+			m_entries.pop_back();
+		}
+	}
+
+public:
+	/// @brief コンストラクタ
+	/// @param maxTotalCost 合計コストの上限
+	/// @param maxCount 要素数の上限
+	LruCache(std::size_t maxTotalCost, std::size_t maxCount)
+		: m_maxTotalCost(maxTotalCost)
+		, m_maxCount(maxCount)
+	{
+	}
+
+	/// @brief 要素を取得し、最近使用した要素として扱う
+	/// @param key キー
+	/// @return 要素のポインタ(存在しない場合はnullptr)
+	[[nodiscard]]
+	Value* find(const Key& key)
+	{
+		const auto it = m_entryByKey.find(key);
+		if (it == m_entryByKey.end())
+		{
+			return nullptr;
+		}
+		m_entries.splice(m_entries.begin(), m_entries, it->second);
+		return &it->second->value;
+	}
+
+	[[nodiscard]]
+	bool contains(const Key& key) const
+	{
+		return m_entryByKey.contains(key);
+	}
+
+	/// @brief 要素を追加(既に存在する場合は置き換え)し、上限を超えた分の要素を破棄する
+	/// @param key キー
+	/// @param value 値
+	/// @param cost コスト
+	/// @return 追加した要素
+	/// @remark 追加した要素自体は、単体で上限を超える場合も破棄しない
+	Value& insert(const Key& key, Value value, std::size_t cost)
+	{
+		if (const auto it = m_entryByKey.find(key); it != m_entryByKey.end())
+		{
+			m_totalCost -= it->second->cost;
+			m_entries.erase(it->second);
+			m_entryByKey.erase(it);
+		}
+
+		m_entries.push_front(Entry{ .key = key, .value = std::move(value), .cost = cost });
+		m_entryByKey.emplace(key, m_entries.begin());
+		m_totalCost += cost;
+
+		evict(&m_entries.front());
+
+		return m_entries.front().value;
+	}
+
+	void clear()
+	{
+		m_entries.clear();
+		m_entryByKey.clear();
+		m_totalCost = 0U;
+	}
+
+	[[nodiscard]]
+	std::size_t size() const
+	{
+		return m_entries.size();
+	}
+
+	[[nodiscard]]
+	std::size_t totalCost() const
+	{
+		return m_totalCost;
+	}
+};
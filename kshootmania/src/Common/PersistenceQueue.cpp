@@ -0,0 +1,127 @@
+﻿#include "PersistenceQueue.hpp"
+
+namespace
+{
+	std::unique_ptr<PersistenceQueue> g_sharedPersistenceQueue;
+
+	std::mutex g_sharedPersistenceQueueMutex;
+}
+
+PersistenceQueue::PersistenceQueue()
+	: m_thread([this] { workerMain(); })
+{
+}
+
+PersistenceQueue::~PersistenceQueue()
+{
+	{
+		std::lock_guard lock(m_mutex);
+		m_stopRequested = true;
+	}
+	m_wakeCondition.notify_all();
+
+	if (m_thread.joinable())
+	{
+		m_thread.join();
+	}
+}
+
+void PersistenceQueue::workerMain()
+{
+	while (true)
+	{
+		PendingWrite pendingWrite;
+		{
+			std::unique_lock lock(m_mutex);
+			m_wakeCondition.wait(lock, [this] { return m_stopRequested || !m_pendingKeys.empty(); });
+			if (m_pendingKeys.empty())
+			{
+				// 終了要求があり、かつ全て書き込み済み
+				break;
+			}
+
+			const String key = std::move(m_pendingKeys.front());
+			m_pendingKeys.pop_front();
+
+			const auto it = m_pendingWrites.find(key);
+			pendingWrite = std::move(it->second);
+			m_pendingWrites.erase(it);
+			m_isWriting = true;
+		}
+
+		bool succeeded = false;
+		try
+		{
+			succeeded = pendingWrite.write();
+		}
+		catch (const Error& e)
+		{
+			Logger << U"[ksm warning] PersistenceQueue: Uncaught exception in write ({})"_fmt(e.what());
+		}
+		catch (const std::exception& e)
+		{
+			Logger << U"[ksm warning] PersistenceQueue: Uncaught exception in write ({})"_fmt(Unicode::Widen(e.what()));
+		}
+		pendingWrite.promise->set_value(succeeded);
+
+		{
+			std::lock_guard lock(m_mutex);
+			m_isWriting = false;
+		}
+		m_idleCondition.notify_all();
+	}
+}
+
+std::shared_future<bool> PersistenceQueue::enqueue(StringView key, WriteFunc write)
+{
+	std::lock_guard lock(m_mutex);
+
+	const String keyStr{ key };
+	if (const auto it = m_pendingWrites.find(keyStr); it != m_pendingWrites.end())
+	{
+		// 実行前の書き込みがある場合は内容のみ差し替える
+		// (実行中の書き込みはm_pendingWritesに含まれないため、実行中の書き込みとは合体せず後から実行される)
+		it->second.write = std::move(write);
+		return it->second.future;
+	}
+
+	auto promise = std::make_shared<std::promise<bool>>();
+	std::shared_future<bool> future = promise->get_future().share();
+	m_pendingWrites.emplace(keyStr, PendingWrite{
+		.write = std::move(write),
+		.promise = std::move(promise),
+		.future = future,
+	});
+	m_pendingKeys.push_back(keyStr);
+	m_wakeCondition.notify_one();
+
+	return future;
+}
+
+void PersistenceQueue::flush()
+{
+	std::unique_lock lock(m_mutex);
+	m_idleCondition.wait(lock, [this] { return m_pendingKeys.empty() && !m_isWriting; });
+}
+
+PersistenceQueue& PersistenceQueue::Shared()
+{
+	std::lock_guard lock(g_sharedPersistenceQueueMutex);
+	if (g_sharedPersistenceQueue == nullptr)
+	{
+		g_sharedPersistenceQueue = std::make_unique<PersistenceQueue>();
+	}
+	return *g_sharedPersistenceQueue;
+}
+
+void PersistenceQueue::TerminateShared()
+{
+	// 書き込み処理がShared()を呼んでもデッドロックしないよう、破棄はロックの外で行う
+	// (デストラクタで残りの書き込みを全て実行してから終了する)
+	std::unique_ptr<PersistenceQueue> persistenceQueue;
+	{
+		std::lock_guard lock(g_sharedPersistenceQueueMutex);
+		persistenceQueue = std::move(g_sharedPersistenceQueue);
+	}
+	persistenceQueue.reset();
+}
@@ -0,0 +1,77 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <future>
+
+/// @brief ファイルへの書き込みを専用のワーカースレッドで順に実行するキュー
+/// @details 書き込みはキーごとに合体され、実行前の書き込みがあるキーに新たな書き込みを投入した場合は後から投入した内容のみが実行される。
+///          同じキーへの書き込みは投入した順に実行される。
+///          シーン遷移時の保存処理(fsyncを含む)でメインスレッドが止まらないようにするためのもの。
+class PersistenceQueue
+{
+public:
+	/// @brief 書き込み処理
+	/// @return 書き込みに成功した場合はtrue
+	using WriteFunc = std::function<bool()>;
+
+private:
+	struct PendingWrite
+	{
+		WriteFunc write;
+
+		std::shared_ptr<std::promise<bool>> promise;
+
+		std::shared_future<bool> future;
+	};
+
+	std::mutex m_mutex;
+
+	std::condition_variable m_wakeCondition;
+
+	std::condition_variable m_idleCondition;
+
+	// 実行前の書き込み(キー:投入時に指定したキー)
+	HashTable<String, PendingWrite> m_pendingWrites;
+
+	// 実行前の書き込みのキーを投入順に並べたもの
+	std::deque<String> m_pendingKeys;
+
+	bool m_isWriting = false;
+
+	bool m_stopRequested = false;
+
+	std::thread m_thread;
+
+	void workerMain();
+
+public:
+	PersistenceQueue();
+
+	/// @brief デストラクタ
+	/// @remark キューに残っている書き込みを全て実行し終えてからワーカースレッドを終了する
+	~PersistenceQueue();
+
+	PersistenceQueue(const PersistenceQueue&) = delete;
+
+	PersistenceQueue& operator=(const PersistenceQueue&) = delete;
+
+	/// @brief 書き込みを投入
+	/// @param key 書き込み先を表すキー(通常はファイルパス)
+	/// @param write 書き込み処理(ワーカースレッドで実行される)
+	/// @return 書き込みの完了を待つためのfuture(合体された場合は合体先と同じfutureを返す)
+	std::shared_future<bool> enqueue(StringView key, WriteFunc write);
+
+	/// @brief 投入済みの書き込みが全て完了するまで待つ
+	void flush();
+
+	/// @brief アプリケーション全体で共有するキューを取得
+	/// @remark 初回呼び出し時に生成される
+	[[nodiscard]]
+	static PersistenceQueue& Shared();
+
+	/// @brief 共有キューの書き込みを全て完了させてから破棄
+	/// @remark 終了処理時に、全ての保存処理を投入し終えてから呼び出す
+	static void TerminateShared();
+};
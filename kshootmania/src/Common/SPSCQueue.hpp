@@ -0,0 +1,7 @@
+﻿#pragma once
+#include "ksmaudio/detail/SPSCQueue.hpp"
+
+/// @brief 書き込み側・読み込み側それぞれ1スレッドで使用する固定長のロックフリーキュー
+/// @note ミキサーへの効果音の予約にも使用するため、実装はksmaudio側にある
+template <typename T, std::size_t Capacity>
+using SPSCQueue = ksmaudio::detail::SPSCQueue<T, Capacity>;
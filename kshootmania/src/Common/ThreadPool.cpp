@@ -0,0 +1,169 @@
+﻿#include "ThreadPool.hpp"
+
+namespace
+{
+	// 現在のスレッドがワーカースレッドの場合、所属するスレッドプールとワーカー番号
+	thread_local const ThreadPool* t_pCurrentPool = nullptr;
+	thread_local std::size_t t_currentWorkerIdx = 0;
+
+	std::unique_ptr<ThreadPool> g_sharedThreadPool;
+
+	std::mutex g_sharedThreadPoolMutex;
+}
+
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+	if (numThreads == 0)
+	{
+		// メインスレッドの分を1つ空けておく
+		const std::size_t hardwareConcurrency = static_cast<std::size_t>(std::thread::hardware_concurrency());
+		numThreads = hardwareConcurrency > 1 ? hardwareConcurrency - 1 : 1;
+	}
+
+	m_queues.reserve(numThreads);
+	for (std::size_t i = 0; i < numThreads; ++i)
+	{
+		m_queues.push_back(std::make_unique<WorkerQueue>());
+	}
+
+	m_threads.reserve(numThreads);
+	for (std::size_t i = 0; i < numThreads; ++i)
+	{
+		m_threads.emplace_back([this, i] { workerMain(i); });
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock(m_wakeMutex);
+		m_stopRequested = true;
+	}
+	m_wakeCondition.notify_all();
+
+	for (auto& thread : m_threads)
+	{
+		if (thread.joinable())
+		{
+			thread.join();
+		}
+	}
+}
+
+void ThreadPool::workerMain(std::size_t workerIdx)
+{
+	t_pCurrentPool = this;
+	t_currentWorkerIdx = workerIdx;
+
+	while (true)
+	{
+		std::function<void()> task;
+		if (tryPopTask(workerIdx, &task))
+		{
+			try
+			{
+				task();
+			}
+			catch (const Error& e)
+			{
+				Logger << U"[ksm warning] ThreadPool: Uncaught exception in task ({})"_fmt(e.what());
+			}
+			catch (const std::exception& e)
+			{
+				Logger << U"[ksm warning] ThreadPool: Uncaught exception in task ({})"_fmt(Unicode::Widen(e.what()));
+			}
+			continue;
+		}
+
+		std::unique_lock lock(m_wakeMutex);
+		m_wakeCondition.wait(lock, [this] { return m_stopRequested || m_numQueuedTasks.load() > 0; });
+		if (m_stopRequested && m_numQueuedTasks.load() == 0)
+		{
+			break;
+		}
+	}
+
+	t_pCurrentPool = nullptr;
+}
+
+bool ThreadPool::tryPopTask(std::size_t workerIdx, std::function<void()>* pTask)
+{
+	// 自分のキューの先頭から取り出す
+	// (選曲画面の譜面スキャンのように、投入した順に結果を利用する用途があるため投入順に実行する)
+	{
+		WorkerQueue& queue = *m_queues[workerIdx];
+		std::lock_guard lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			*pTask = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			--m_numQueuedTasks;
+			return true;
+		}
+	}
+
+	// 他のワーカーのキューの末尾から奪う
+	// (持ち主が次に実行するタスクとの競合を避けるため、持ち主とは反対側から取り出す)
+	const std::size_t numQueues = m_queues.size();
+	for (std::size_t i = 1; i < numQueues; ++i)
+	{
+		WorkerQueue& queue = *m_queues[(workerIdx + i) % numQueues];
+		std::lock_guard lock(queue.mutex);
+		if (!queue.tasks.empty())
+		{
+			*pTask = std::move(queue.tasks.back());
+			queue.tasks.pop_back();
+			--m_numQueuedTasks;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+	// ワーカースレッドからの投入はそのワーカー自身のキューへ、それ以外は順番に振り分ける
+	const std::size_t queueIdx = (t_pCurrentPool == this)
+		? t_currentWorkerIdx
+		: m_nextQueueIdx.fetch_add(1) % m_queues.size();
+
+	++m_numQueuedTasks;
+	{
+		WorkerQueue& queue = *m_queues[queueIdx];
+		std::lock_guard lock(queue.mutex);
+		queue.tasks.push_back(std::move(task));
+	}
+
+	// 待機中のワーカーが条件を確認している最中に通知が失われないよう、一度ロックを取得してから通知する
+	{
+		std::lock_guard lock(m_wakeMutex);
+	}
+	m_wakeCondition.notify_one();
+}
+
+std::size_t ThreadPool::numThreads() const
+{
+	return m_threads.size();
+}
+
+ThreadPool& ThreadPool::Shared()
+{
+	std::lock_guard lock(g_sharedThreadPoolMutex);
+	if (g_sharedThreadPool == nullptr)
+	{
+		g_sharedThreadPool = std::make_unique<ThreadPool>();
+	}
+	return *g_sharedThreadPool;
+}
+
+void ThreadPool::TerminateShared()
+{
+	// 実行中のタスクがShared()を呼んでもデッドロックしないよう、破棄はロックの外で行う
+	std::unique_ptr<ThreadPool> threadPool;
+	{
+		std::lock_guard lock(g_sharedThreadPoolMutex);
+		threadPool = std::move(g_sharedThreadPool);
+	}
+	threadPool.reset();
+}
@@ -0,0 +1,66 @@
+﻿#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+/// @brief ワークスティーリング方式のスレッドプール
+/// @details ワーカーごとにタスクキューを持ち、自分のキューが空になったワーカーは他のワーカーのキューの末尾からタスクを奪って実行する。
+///          ワーカースレッド内から投入したタスクはそのワーカー自身のキューに積まれる。
+class ThreadPool
+{
+private:
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+
+		std::deque<std::function<void()>> tasks;
+	};
+
+	Array<std::unique_ptr<WorkerQueue>> m_queues;
+
+	Array<std::thread> m_threads;
+
+	std::mutex m_wakeMutex;
+
+	std::condition_variable m_wakeCondition;
+
+	std::atomic<std::size_t> m_numQueuedTasks = 0;
+
+	std::atomic<std::size_t> m_nextQueueIdx = 0;
+
+	bool m_stopRequested = false;
+
+	void workerMain(std::size_t workerIdx);
+
+	bool tryPopTask(std::size_t workerIdx, std::function<void()>* pTask);
+
+public:
+	/// @brief コンストラクタ
+	/// @param numThreads ワーカースレッド数(0の場合は論理コア数-1、最低1)
+	explicit ThreadPool(std::size_t numThreads = 0);
+
+	/// @brief デストラクタ
+	/// @remark キューに残っているタスクを全て実行し終えてからワーカースレッドを終了する
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	/// @brief タスクを投入
+	/// @param task タスク
+	void submit(std::function<void()> task);
+
+	[[nodiscard]]
+	std::size_t numThreads() const;
+
+	/// @brief アプリケーション全体で共有するスレッドプールを取得
+	/// @remark 初回呼び出し時に生成される
+	[[nodiscard]]
+	static ThreadPool& Shared();
+
+	/// @brief 共有スレッドプールを破棄
+	/// @remark 終了処理時に、ksmaudio等のライブラリ終了前に呼び出す
+	static void TerminateShared();
+};
@@ -4,6 +4,7 @@
 #include "Common/FrameRateLimit.hpp"
 #include "Common/IMEUtils.hpp"
 #include "Common/AssetManagement.hpp"
+#include "Common/PersistenceQueue.hpp"
 #include "Addon/AutoMuteAddon.hpp"
 #include "Addon/CommonSEAddon.hpp"
 #include "ksmaudio/ksmaudio.hpp"
@@ -191,7 +192,9 @@ void EditorMain()
 	}
 
 	// config.iniを保存
+	// (書き込みはワーカースレッドで行われるため、完了を待ってから終了する)
 	ConfigIni::Save();
+	PersistenceQueue::TerminateShared();
 
 	// 音声のバックエンドを終了
 	ksmaudio::Terminate();
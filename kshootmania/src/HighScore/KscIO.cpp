@@ -1,5 +1,7 @@
 ﻿#include "KscIO.hpp"
+#include "ScoreDatabase.hpp"
 #include "Common/FsUtils.hpp"
+#include "Common/PersistenceQueue.hpp"
 #include "Ini/ConfigIni.hpp"
 #include "Course/CoursePlayState.hpp"
 #include "Course/CoursePlayResult.hpp"
@@ -8,48 +10,31 @@ namespace KscIO
 {
 	namespace
 	{
-		bool TryConvertChartFilePathToKscPath(FilePathView chartFilePath, FilePath* pFilePath)
+		// songsフォルダからの譜面ファイルの相対パス(拡張子なし)を取得
+		Optional<String> ChartRelativePathWithoutExtension(FilePathView chartFilePath, const KscPathContext& context)
 		{
-			if (pFilePath == nullptr)
-			{
-				assert(false && "pFilePath must not be NULL");
-				return false;
-			}
-
 			const auto extension = FileSystem::Extension(chartFilePath);
 			if (extension != U"ksh")
 			{
-				return false;
+				return none;
 			}
 
-			// サブフォルダの存在を考慮する必要があるため、songsフォルダからの相対パスを使用してkscファイルのパスを生成
-			const auto relativeChartFilePath = FsUtils::RelativePathFromSongsDir(chartFilePath); // TODO: songsフォルダ以外が指定可能になったら要修正
-			const String currentPlayer{ ConfigIni::GetString(ConfigIni::Key::kCurrentPlayer) };
-			*pFilePath = FileSystem::PathAppend(FsUtils::ScoreDirectoryPath(), U"{}/{}.ksc"_fmt(currentPlayer, FsUtils::EliminateExtension(relativeChartFilePath)));
-			return true;
+			// サブフォルダの存在を考慮する必要があるため、songsフォルダからの相対パスを使用
+			const auto relativeChartFilePath = FileSystem::RelativePath(chartFilePath, context.songsDirectoryPath); // TODO: songsフォルダ以外が指定可能になったら要修正
+			return FsUtils::EliminateExtension(relativeChartFilePath);
 		}
 
-		bool TryConvertCourseFilePathToKscPath(FilePathView courseFilePath, FilePath* pFilePath)
+		// coursesフォルダ(またはsongsフォルダ)からのコースファイルの相対パス(拡張子なし)を取得
+		Optional<String> CourseRelativePathWithoutExtension(FilePathView courseFilePath)
 		{
-			if (pFilePath == nullptr)
-			{
-				assert(false && "pFilePath must not be NULL");
-				return false;
-			}
-
 			const auto extension = FileSystem::Extension(courseFilePath);
 			if (extension != U"kco")
 			{
-				return false;
+				return none;
 			}
 
-			const String currentPlayer{ ConfigIni::GetString(ConfigIni::Key::kCurrentPlayer) };
-			const FilePath coursesDir = FsUtils::CoursesDirectoryPath();
-			const FilePath songsDir = FsUtils::SongsDirectoryPath();
-			const FilePath courseScoreDir = FsUtils::CourseScoreDirectoryPath();
-
 			// coursesフォルダからの相対パスを試す
-			auto relativePath = FileSystem::RelativePath(courseFilePath, coursesDir);
+			auto relativePath = FileSystem::RelativePath(courseFilePath, FsUtils::CoursesDirectoryPath());
 			if (relativePath.isEmpty() || relativePath.starts_with(U".."))
 			{
 				// coursesフォルダ内にない場合はsongsフォルダからの相対パスを試す
@@ -57,424 +42,164 @@ namespace KscIO
 				if (relativePath.isEmpty() || relativePath.starts_with(U".."))
 				{
 					// どちらのフォルダにも属していない
-					return false;
+					return none;
 				}
 			}
 
-			*pFilePath = FileSystem::PathAppend(courseScoreDir, U"{}/{}.ksc"_fmt(currentPlayer, FsUtils::EliminateExtension(relativePath)));
-			return true;
+			return FsUtils::EliminateExtension(relativePath);
 		}
 
-		// kscファイルの行からgaugeType文字列部分を除去したキーを取得
-		// (選曲画面表示時はゲージタイプは合算して表示するため)
-		Optional<String> GetKeyWithoutGaugeTypeFromLine(StringView line)
+		ScoreDatabase& CurrentPlayerDatabase()
 		{
-			const size_t eqPos = line.indexOf(U'=');
-			if (eqPos == String::npos)
-			{
-				return none;
-			}
-			const StringView keyPart = line.substr(0, eqPos);
-			const size_t commaPos = keyPart.indexOf(U',');
-			if (commaPos == String::npos)
-			{
-				return none;
-			}
-			return String{ keyPart.substr(commaPos + 1) };
+			return ScoreDatabase::OfPlayer(ConfigIni::GetString(ConfigIni::Key::kCurrentPlayer));
 		}
 
-		// kscファイルの行からgaugeType文字列を取得
-		Optional<StringView> GetGaugeTypeStrFromLine(StringView line)
+		std::shared_future<bool> MakeReadyFuture(bool value)
 		{
-			const size_t commaPos = line.indexOf(U',');
-			if (commaPos == String::npos)
-			{
-				return none;
-			}
-			return line.substr(0, commaPos);
+			std::promise<bool> promise;
+			promise.set_value(value);
+			return promise.get_future().share();
 		}
 
-		// kscファイルの行からvalue文字列を取得
-		Optional<StringView> GetValueStrFromLine(StringView line)
+		// メモリ上へ反映した上で、ログへの追記をワーカースレッドで行う
+		// (プレイヤーごとにキーを分けているため、連続して書き込んだ場合は1回の追記・fsyncにまとめられる)
+		std::shared_future<bool> StageAndEnqueue(ScoreDatabase::OwnerKey ownerKey, const KscKey& condition, const KscValue& kscValue)
 		{
-			const size_t eqPos = line.indexOf(U'=');
-			if (eqPos == String::npos)
-			{
-				return none;
-			}
-			return line.substr(eqPos + 1);
-		}
-
-		void ReadAllHighScoreInfoFromKscFile(FilePathView kscFilePath, HashTable<String, HighScoreInfo>* pHighScoreInfoMap)
-		{
-			pHighScoreInfoMap->clear();
-
-			if (!FileSystem::Exists(kscFilePath))
-			{
-				return;
-			}
-
-			TextReader reader(kscFilePath);
-			if (!reader)
-			{
-				return;
-			}
-
-			String line;
-			while (reader.readLine(line))
-			{
-				const auto keyWithoutGauge = GetKeyWithoutGaugeTypeFromLine(line);
-				if (!keyWithoutGauge)
-				{
-					continue;
-				}
-
-				const auto gaugeTypeStr = GetGaugeTypeStrFromLine(line);
-				const auto valueStr = GetValueStrFromLine(line);
-				if (!gaugeTypeStr || !valueStr)
-				{
-					continue;
-				}
-
-				HighScoreInfo& info = (*pHighScoreInfoMap)[*keyWithoutGauge];
-				const KscValue kscValue = KscValue::FromString(String{ *valueStr });
-
-				if (*gaugeTypeStr == U"easy")
-				{
-					info.easyGauge = kscValue;
-				}
-				else if (*gaugeTypeStr == U"normal")
-				{
-					info.normalGauge = kscValue;
-				}
-				else if (*gaugeTypeStr == U"hard")
-				{
-					info.hardGauge = kscValue;
-				}
-			}
-		}
-
-		bool TryReadHighScoreInfo(FilePathView kscFilePath, const KscKey& condition, HighScoreInfo* pHighScoreInfo)
-		{
-			if (pHighScoreInfo == nullptr)
-			{
-				assert(false && "pHighScoreInfo must not be NULL");
-				return false;
-			}
-
-			if (!FileSystem::Exists(kscFilePath))
-			{
-				return false;
-			}
-
-			TextReader reader(kscFilePath);
-			if (!reader)
-			{
-				return false;
-			}
-
-			const String searchEasy = condition.withGaugeType(GaugeType::kEasyGauge).toString() + U"=";
-			const String searchNormal = condition.withGaugeType(GaugeType::kNormalGauge).toString() + U"=";
-			const String searchHard = condition.withGaugeType(GaugeType::kHardGauge).toString() + U"=";
-
-			String line;
-			while (reader.readLine(line))
-			{
-				if (line.starts_with(searchEasy))
-				{
-					const String valueStr = line.substr(searchEasy.length());
-					pHighScoreInfo->easyGauge = KscValue::FromString(valueStr);
-				}
-
-				if (line.starts_with(searchNormal))
-				{
-					const String valueStr = line.substr(searchNormal.length());
-					pHighScoreInfo->normalGauge = KscValue::FromString(valueStr);
-				}
-
-				if (line.starts_with(searchHard))
-				{
-					const String valueStr = line.substr(searchHard.length());
-					pHighScoreInfo->hardGauge = KscValue::FromString(valueStr);
-				}
-			}
-			return true;
+			const StringView currentPlayer = ConfigIni::GetString(ConfigIni::Key::kCurrentPlayer);
+			ScoreDatabase& database = ScoreDatabase::OfPlayer(currentPlayer);
+			database.stage(ownerKey, condition, kscValue);
+			return PersistenceQueue::Shared().enqueue(U"ScoreDatabase:{}"_fmt(currentPlayer), [&database] { return database.flushStaged(); });
 		}
+	}
 
-		bool CreateNewKscFile(FilePathView kscFilePath, const MusicGame::PlayResult& playResult, const KscKey& condition)
+	HighScoreInfo ReadHighScoreInfo(FilePathView chartFilePath, const KscKey& condition)
+	{
+		const Optional<String> relativePath = ChartRelativePathWithoutExtension(chartFilePath, CurrentKscPathContext());
+		if (!relativePath.has_value())
 		{
-			TextWriter writer(kscFilePath, TextEncoding::UTF8_NO_BOM);
-			if (!writer)
-			{
-				return false;
-			}
-			const KscValue kscValue = KscValue{}.applyPlayResult(playResult);
-			writer.write(U"{}={}\n"_fmt(condition.toString(), kscValue.toString()));
-			return true;
+			return HighScoreInfo{};
 		}
 
-		bool UpdateExistingKscFile(FilePathView kscFilePath, const MusicGame::PlayResult& playResult, const KscKey& condition)
-		{
-			assert(playResult.playOption.gaugeType == condition.gaugeType && "Gauge type mismatch");
-			const GaugeType gaugeType = playResult.playOption.gaugeType;
-
-			// 既存のkscファイルを読み込んで、今回のプレイ結果を反映したkscファイルの文字列を生成
-			String newKscFileContent;
-			{
-				const String search = condition.toString() + U"=";
-				HighScoreInfo origHighScoreInfo;
-				if (!TryReadHighScoreInfo(kscFilePath, condition, &origHighScoreInfo))
-				{
-					return false;
-				}
-				const KscValue& origKscValue = origHighScoreInfo.kscValueOf(gaugeType);
-				const KscValue newKscValue = playResult.playOption.gameMode == MusicGame::GameMode::kCourseMode
-					? origKscValue.applyPlayResultForCourse(playResult)
-					: origKscValue.applyPlayResult(playResult);
-				const String replace = search + newKscValue.toString();
-
-				TextReader reader(kscFilePath);
-				if (!reader)
-				{
-					return false;
-				}
-
-				bool found = false;
-				String line;
-				while (reader.readLine(line))
-				{
-					if (line.empty())
-					{
-						// 空行は除去
-						continue;
-					}
-
-					// 対象の行を新しいハイスコア情報で置換
-					if (line.starts_with(search))
-					{
-						newKscFileContent += replace + U"\n";
-						found = true;
-					}
-					else
-					{
-						newKscFileContent += line + U"\n";
-					}
-				}
-
-				if (!found)
-				{
-					// 対象の行が見つからなかった場合は新しい行にハイスコア情報を追記
-					newKscFileContent += replace + U"\n";
-				}
-			}
+		return CurrentPlayerDatabase().read(ScoreDatabase::ChartOwnerKey(*relativePath), condition);
+	}
 
-			// 既存のkscファイルを上書き
-			{
-				TextWriter writer(kscFilePath, TextEncoding::UTF8_NO_BOM);
-				if (!writer)
-				{
-					return false;
-				}
-				writer.write(newKscFileContent);
-			}
+	void ReadAllHighScoreInfo(FilePathView chartFilePath, HashTable<String, HighScoreInfo>* pHighScoreInfoMap)
+	{
+		ReadAllHighScoreInfo(chartFilePath, CurrentKscPathContext(), pHighScoreInfoMap);
+	}
 
-			return true;
-		}
+	KscPathContext CurrentKscPathContext()
+	{
+		return KscPathContext{
+			.songsDirectoryPath = FsUtils::SongsDirectoryPath(),
+			.currentPlayer = String{ ConfigIni::GetString(ConfigIni::Key::kCurrentPlayer) },
+		};
 	}
 
-	HighScoreInfo ReadHighScoreInfo(FilePathView chartFilePath, const KscKey& condition)
+	Optional<FilePath> ChartKscFilePath(FilePathView chartFilePath)
 	{
-		FilePath kscFilePath;
-		if (!TryConvertChartFilePathToKscPath(chartFilePath, &kscFilePath))
-		{
-			return HighScoreInfo{};
-		}
+		return ChartKscFilePath(chartFilePath, CurrentKscPathContext());
+	}
 
-		HighScoreInfo highScoreInfo;
-		if (!TryReadHighScoreInfo(kscFilePath, condition, &highScoreInfo))
+	Optional<FilePath> ChartKscFilePath(FilePathView chartFilePath, const KscPathContext& context)
+	{
+		const Optional<String> relativePath = ChartRelativePathWithoutExtension(chartFilePath, context);
+		if (!relativePath.has_value())
 		{
-			return HighScoreInfo{};
+			return none;
 		}
-
-		return highScoreInfo;
+		return FileSystem::PathAppend(FsUtils::ScoreDirectoryPath(), U"{}/{}.ksc"_fmt(context.currentPlayer, *relativePath));
 	}
 
-	void ReadAllHighScoreInfo(FilePathView chartFilePath, HashTable<String, HighScoreInfo>* pHighScoreInfoMap)
+	void ReadAllHighScoreInfo(FilePathView chartFilePath, const KscPathContext& context, HashTable<String, HighScoreInfo>* pHighScoreInfoMap)
 	{
-		FilePath kscFilePath;
-		if (!TryConvertChartFilePathToKscPath(chartFilePath, &kscFilePath))
+		const Optional<String> relativePath = ChartRelativePathWithoutExtension(chartFilePath, context);
+		if (!relativePath.has_value())
 		{
 			pHighScoreInfoMap->clear();
 			return;
 		}
 
-		ReadAllHighScoreInfoFromKscFile(kscFilePath, pHighScoreInfoMap);
+		ScoreDatabase::OfPlayer(context.currentPlayer).readAll(ScoreDatabase::ChartOwnerKey(*relativePath), pHighScoreInfoMap);
 	}
 
-	bool WriteHighScoreInfo(FilePathView chartFilePath, const MusicGame::PlayResult& playResult, const KscKey& condition)
+	std::shared_future<bool> WriteHighScoreInfo(FilePathView chartFilePath, const MusicGame::PlayResult& playResult, const KscKey& condition)
 	{
-		FilePath kscFilePath;
-		if (!TryConvertChartFilePathToKscPath(chartFilePath, &kscFilePath))
+		const Optional<String> relativePath = ChartRelativePathWithoutExtension(chartFilePath, CurrentKscPathContext());
+		if (!relativePath.has_value())
 		{
-			return false;
+			return MakeReadyFuture(false);
 		}
 
 		if (playResult.playOption.gaugeType != condition.gaugeType)
 		{
 			// ゲージの種類は必ず一致するはず
 			assert(false && "Gauge type mismatch");
-			return false;
+			return MakeReadyFuture(false);
 		}
 
-		const bool kscFileExists = FileSystem::IsFile(kscFilePath);
-		if (kscFileExists)
-		{
-			// ファイルが存在する場合は既存のファイルを更新する
-			return UpdateExistingKscFile(kscFilePath, playResult, condition);
-		}
-		else
-		{
-			// ファイルが存在しない場合は今回のプレイ結果を新しいファイルとして書き込む
-			return CreateNewKscFile(kscFilePath, playResult, condition);
-		}
+		// 既存のハイスコア情報に今回のプレイ結果を反映
+		const ScoreDatabase& database = CurrentPlayerDatabase();
+		const ScoreDatabase::OwnerKey ownerKey = ScoreDatabase::ChartOwnerKey(*relativePath);
+		const KscValue origKscValue = database.read(ownerKey, condition).kscValueOf(condition.gaugeType);
+		const KscValue newKscValue = playResult.playOption.gameMode == MusicGame::GameMode::kCourseMode
+			? origKscValue.applyPlayResultForCourse(playResult)
+			: origKscValue.applyPlayResult(playResult);
+
+		return StageAndEnqueue(ownerKey, condition, newKscValue);
 	}
 
 	HighScoreInfo ReadCourseHighScoreInfo(FilePathView courseFilePath, const KscKey& condition)
 	{
-		FilePath kscFilePath;
-		if (!TryConvertCourseFilePathToKscPath(courseFilePath, &kscFilePath))
-		{
-			return HighScoreInfo{};
-		}
-
-		HighScoreInfo highScoreInfo;
-		if (!TryReadHighScoreInfo(kscFilePath, condition, &highScoreInfo))
+		const Optional<String> relativePath = CourseRelativePathWithoutExtension(courseFilePath);
+		if (!relativePath.has_value())
 		{
 			return HighScoreInfo{};
 		}
 
-		return highScoreInfo;
+		return CurrentPlayerDatabase().read(ScoreDatabase::CourseOwnerKey(*relativePath), condition);
 	}
 
 	void ReadAllCourseHighScoreInfo(FilePathView courseFilePath, HashTable<String, HighScoreInfo>* pHighScoreInfoMap)
 	{
-		FilePath kscFilePath;
-		if (!TryConvertCourseFilePathToKscPath(courseFilePath, &kscFilePath))
+		const Optional<String> relativePath = CourseRelativePathWithoutExtension(courseFilePath);
+		if (!relativePath.has_value())
 		{
 			pHighScoreInfoMap->clear();
 			return;
 		}
 
-		ReadAllHighScoreInfoFromKscFile(kscFilePath, pHighScoreInfoMap);
+		CurrentPlayerDatabase().readAll(ScoreDatabase::CourseOwnerKey(*relativePath), pHighScoreInfoMap);
 	}
 
-	bool WriteCourseHighScoreInfo(FilePathView courseFilePath, const CoursePlayState& courseState)
+	std::shared_future<bool> WriteCourseHighScoreInfo(FilePathView courseFilePath, const CoursePlayState& courseState)
 	{
-		FilePath kscFilePath;
-		if (!TryConvertCourseFilePathToKscPath(courseFilePath, &kscFilePath))
+		const Optional<String> relativePath = CourseRelativePathWithoutExtension(courseFilePath);
+		if (!relativePath.has_value())
 		{
-			return false;
+			return MakeReadyFuture(false);
 		}
 
 		const CoursePlayResult playResult = courseState.coursePlayResult();
 		const KscKey& condition = courseState.kscKey();
 
-		// 既存のkscファイルを読み込んで、今回のプレイ結果を反映したkscファイルの文字列を生成
-		String newKscFileContent;
-		{
-			const String search = condition.toString() + U"=";
-
-			// 既存のハイスコア情報を読み込み
-			KscValue origKscValue;
-			if (FileSystem::Exists(kscFilePath))
-			{
-				TextReader reader(kscFilePath);
-				if (reader)
-				{
-					String line;
-					while (reader.readLine(line))
-					{
-						if (line.starts_with(search))
-						{
-							const String valueStr = line.substr(search.length());
-							origKscValue = KscValue::FromString(valueStr);
-							break;
-						}
-					}
-				}
-			}
-
-			// 新しいハイスコア情報を生成
-			const KscValue newKscValue
-			{
-				.score = Max(origKscValue.score, playResult.avgScore),
-				.achievement = Max(origKscValue.achievement, playResult.achievement()),
-				.grade = Max(origKscValue.grade, Grade::kNoGrade),
-				.percent = Max(origKscValue.percent, playResult.gaugePercentForHighScore()),
-				.maxCombo = Max(origKscValue.maxCombo, playResult.maxCombo),
-				.playCount = origKscValue.playCount + 1,
-				.clearCount = origKscValue.clearCount + (playResult.achievement() >= Achievement::kCleared ? 1 : 0),
-				.fullComboCount = origKscValue.fullComboCount + (playResult.achievement() >= Achievement::kFullCombo ? 1 : 0),
-				.perfectCount = origKscValue.perfectCount + (playResult.achievement() >= Achievement::kPerfect ? 1 : 0),
-			};
-			const String replace = search + newKscValue.toString();
-
-			// ファイルが存在する場合は既存の内容を更新
-			bool found = false;
-			if (FileSystem::Exists(kscFilePath))
-			{
-				TextReader reader(kscFilePath);
-				if (!reader)
-				{
-					return false;
-				}
-
-				String line;
-				while (reader.readLine(line))
-				{
-					if (line.empty())
-					{
-						// 空行は除去
-						continue;
-					}
-
-					// 対象の行を新しいハイスコア情報で置換
-					if (line.starts_with(search))
-					{
-						newKscFileContent += replace + U"\n";
-						found = true;
-					}
-					else
-					{
-						newKscFileContent += line + U"\n";
-					}
-				}
-			}
-
-			if (!found)
-			{
-				// 対象の行が見つからなかった場合は新しい行にハイスコア情報を追記
-				newKscFileContent += replace + U"\n";
-			}
-		}
-
-		// ディレクトリが存在しない場合は作成
-		const FilePath kscDir = FileSystem::ParentPath(kscFilePath);
-		if (!FileSystem::Exists(kscDir))
-		{
-			FileSystem::CreateDirectories(kscDir);
-		}
-
-		// ファイルを書き込み
-		{
-			TextWriter writer(kscFilePath, TextEncoding::UTF8_NO_BOM);
-			if (!writer)
-			{
-				return false;
-			}
-			writer.write(newKscFileContent);
-		}
-
-		return true;
+		// 既存のハイスコア情報に今回のプレイ結果を反映
+		const ScoreDatabase& database = CurrentPlayerDatabase();
+		const ScoreDatabase::OwnerKey ownerKey = ScoreDatabase::CourseOwnerKey(*relativePath);
+		const KscValue origKscValue = database.read(ownerKey, condition).kscValueOf(condition.gaugeType);
+		const KscValue newKscValue
+		{
+			.score = Max(origKscValue.score, playResult.avgScore),
+			.achievement = Max(origKscValue.achievement, playResult.achievement()),
+			.grade = Max(origKscValue.grade, Grade::kNoGrade),
+			.percent = Max(origKscValue.percent, playResult.gaugePercentForHighScore()),
+			.maxCombo = Max(origKscValue.maxCombo, playResult.maxCombo),
+			.playCount = origKscValue.playCount + 1,
+			.clearCount = origKscValue.clearCount + (playResult.achievement() >= Achievement::kCleared ? 1 : 0),
+			.fullComboCount = origKscValue.fullComboCount + (playResult.achievement() >= Achievement::kFullCombo ? 1 : 0),
+			.perfectCount = origKscValue.perfectCount + (playResult.achievement() >= Achievement::kPerfect ? 1 : 0),
+		};
+
+		return StageAndEnqueue(ownerKey, condition, newKscValue);
 	}
 }
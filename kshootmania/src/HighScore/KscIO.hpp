@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <future>
 #include "HighScoreInfo.hpp"
 #include "KscKey.hpp"
 
@@ -18,12 +19,49 @@ namespace KscIO
 	/// @param pHighScoreInfoMap 読み込んだ全エントリのハイスコア情報(キー:gaugeType部分を除いたKscKey文字列)
 	void ReadAllHighScoreInfo(FilePathView chartFilePath, HashTable<String, HighScoreInfo>* pHighScoreInfoMap);
 
+	/// @brief ハイスコア情報の保存先を求めるのに必要な設定値
+	/// @remark ConfigIniの値をコピーして保持するため、ワーカースレッドからも参照できる
+	struct KscPathContext
+	{
+		FilePath songsDirectoryPath;
+
+		String currentPlayer;
+	};
+
+	/// @brief 現在の設定値からKscPathContextを作成
+	/// @return KscPathContext
+	[[nodiscard]]
+	KscPathContext CurrentKscPathContext();
+
+	/// @brief 譜面ファイルに対応するkscファイルのパスを取得
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @return kscファイルのパス(ksh形式の譜面でない場合はnone)
+	/// @remark ハイスコア情報自体はScoreDatabaseに保存される。このパスはリプレイファイルの保存先の基準として使用する
+	[[nodiscard]]
+	Optional<FilePath> ChartKscFilePath(FilePathView chartFilePath);
+
+	/// @brief 譜面ファイルに対応するkscファイルのパスを取得
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @param context kscファイルのパスを求めるのに必要な設定値
+	/// @return kscファイルのパス(ksh形式の譜面でない場合はnone)
+	/// @remark ConfigIniにアクセスしないため、ワーカースレッドから呼び出してよい
+	[[nodiscard]]
+	Optional<FilePath> ChartKscFilePath(FilePathView chartFilePath, const KscPathContext& context);
+
+	/// @brief ハイスコア情報を全て読み込む
+	/// @param chartFilePath 譜面ファイルのパス(kscファイルのパスではないので注意)
+	/// @param context ハイスコア情報の保存先を求めるのに必要な設定値
+	/// @param pHighScoreInfoMap 読み込んだ全エントリのハイスコア情報(キー:gaugeType部分を除いたKscKey文字列)
+	/// @remark ConfigIniにアクセスしないため、ワーカースレッドから呼び出してよい
+	void ReadAllHighScoreInfo(FilePathView chartFilePath, const KscPathContext& context, HashTable<String, HighScoreInfo>* pHighScoreInfoMap);
+
 	/// @brief ハイスコア情報を書き込む
 	/// @param chartFilePath 譜面ファイルのパス(kscファイルのパスではないので注意)
 	/// @param playResult プレイ結果
 	/// @param condition 書き込むハイスコア情報の条件
-	/// @return 書き込みに成功した場合はtrue, そうでなければfalse
-	bool WriteHighScoreInfo(FilePathView chartFilePath, const MusicGame::PlayResult& playResult, const KscKey& condition);
+	/// @return 書き込みの完了を待つためのfuture(書き込みに成功した場合はtrue, そうでなければfalse)
+	/// @remark ハイスコア情報は即座に読み込み結果へ反映される。ディスクへの書き込みはPersistenceQueueのワーカースレッドで行う
+	std::shared_future<bool> WriteHighScoreInfo(FilePathView chartFilePath, const MusicGame::PlayResult& playResult, const KscKey& condition);
 
 	/// @brief コースのハイスコア情報を読み込む
 	/// @param courseFilePath コースファイル(.kco)のパス(kscファイルのパスではないので注意)
@@ -40,6 +78,7 @@ namespace KscIO
 	/// @brief コースのハイスコア情報を書き込む
 	/// @param courseFilePath コースファイル(.kco)のパス(kscファイルのパスではないので注意)
 	/// @param courseState コースプレイ状態
-	/// @return 書き込みに成功した場合はtrue, そうでなければfalse
-	bool WriteCourseHighScoreInfo(FilePathView courseFilePath, const CoursePlayState& courseState);
+	/// @return 書き込みの完了を待つためのfuture(書き込みに成功した場合はtrue, そうでなければfalse)
+	/// @remark ハイスコア情報は即座に読み込み結果へ反映される。ディスクへの書き込みはPersistenceQueueのワーカースレッドで行う
+	std::shared_future<bool> WriteCourseHighScoreInfo(FilePathView courseFilePath, const CoursePlayState& courseState);
 }
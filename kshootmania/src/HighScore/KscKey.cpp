@@ -2,22 +2,6 @@
 
 namespace
 {
-	StringView GaugeTypeStr(GaugeType gaugeType)
-	{
-		switch (gaugeType)
-		{
-		case GaugeType::kEasyGauge:
-			return U"easy";
-		case GaugeType::kNormalGauge:
-			return U"normal";
-		case GaugeType::kHardGauge:
-			return U"hard";
-		default:
-			assert(false && "Unknown gauge type");
-			return U"?";
-		}
-	}
-
 	StringView TurnModeStr(TurnMode turnMode)
 	{
 		switch (turnMode)
@@ -91,3 +75,32 @@ KscKey KscKey::withGaugeType(GaugeType newGaugeType) const
 	result.gaugeType = newGaugeType;
 	return result;
 }
+
+StringView KscKey::GaugeTypeStr(GaugeType gaugeType)
+{
+	switch (gaugeType)
+	{
+	case GaugeType::kEasyGauge:
+		return U"easy";
+	case GaugeType::kNormalGauge:
+		return U"normal";
+	case GaugeType::kHardGauge:
+		return U"hard";
+	default:
+		assert(false && "Unknown gauge type");
+		return U"?";
+	}
+}
+
+Optional<GaugeType> KscKey::ParseGaugeType(StringView str)
+{
+	for (int32 i = 0; i < kNumGaugeTypes; ++i)
+	{
+		const GaugeType gaugeType = static_cast<GaugeType>(i);
+		if (str == GaugeTypeStr(gaugeType))
+		{
+			return gaugeType;
+		}
+	}
+	return none;
+}
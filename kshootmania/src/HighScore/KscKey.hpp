@@ -23,4 +23,12 @@ struct KscKey
 	String toStringWithoutGaugeType() const;
 
 	KscKey withGaugeType(GaugeType newGaugeType) const;
+
+	// キー文字列のgaugeType部分を取得
+	[[nodiscard]]
+	static StringView GaugeTypeStr(GaugeType gaugeType);
+
+	// キー文字列のgaugeType部分を解析
+	[[nodiscard]]
+	static Optional<GaugeType> ParseGaugeType(StringView str);
 };
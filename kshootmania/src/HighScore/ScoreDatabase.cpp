@@ -0,0 +1,527 @@
+﻿#include "ScoreDatabase.hpp"
+#include <bit>
+#include <utility>
+#include "Common/FsUtils.hpp"
+#include "Common/BinaryBufferIO.hpp"
+
+namespace
+{
+	constexpr std::array<char, 8> kSnapshotMagic = { 'K', 'S', 'M', 'S', 'C', 'D', 'B', '\0' };
+
+	constexpr std::array<char, 8> kLogMagic = { 'K', 'S', 'M', 'S', 'C', 'L', 'G', '\0' };
+
+	// フォーマットを変更した場合はインクリメントすること
+	constexpr uint32 kFormatVersion = 1;
+
+	// 1レコードの最大サイズ(これを超えるサイズが記録されている場合は壊れているとみなす)
+	constexpr uint32 kMaxRecordSize = 4096U;
+
+	uint32 Crc32(const void* data, std::size_t size)
+	{
+		static const std::array<uint32, 256> table = []
+		{
+			std::array<uint32, 256> t{};
+			for (uint32 i = 0U; i < 256U; ++i)
+			{
+				uint32 c = i;
+				for (int32 k = 0; k < 8; ++k)
+				{
+					c = (c & 1U) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
+				}
+				t[i] = c;
+			}
+			return t;
+		}();
+
+		uint32 crc = 0xFFFFFFFFU;
+		const auto* p = static_cast<const uint8*>(data);
+		for (std::size_t i = 0U; i < size; ++i)
+		{
+			crc = table[(crc ^ p[i]) & 0xFFU] ^ (crc >> 8);
+		}
+		return crc ^ 0xFFFFFFFFU;
+	}
+
+	uint64 HashOwnerPath(StringView prefix, StringView relativePathWithoutExtension)
+	{
+		// FNV-1a 64bit
+		// Note: Windowsの区切り文字でも同じキーになるよう'/'に統一する
+		const std::string str = Unicode::ToUTF8(prefix) + Unicode::ToUTF8(relativePathWithoutExtension);
+		uint64 hash = 14695981039346656037ULL;
+		for (const char c : str)
+		{
+			hash ^= static_cast<uint8>(c == '\\' ? '/' : c);
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	void WriteKscValue(BinaryBufferWriter& writer, const KscValue& kscValue)
+	{
+		writer.write(static_cast<int32>(kscValue.score));
+		writer.write(static_cast<int32>(kscValue.achievement));
+		writer.write(static_cast<int32>(kscValue.grade));
+		writer.write(static_cast<int32>(kscValue.percent));
+		writer.write(static_cast<int32>(kscValue.maxCombo));
+		writer.write(static_cast<int32>(kscValue.playCount));
+		writer.write(static_cast<int32>(kscValue.clearCount));
+		writer.write(static_cast<int32>(kscValue.fullComboCount));
+		writer.write(static_cast<int32>(kscValue.perfectCount));
+	}
+
+	KscValue ReadKscValue(BinaryBufferReader& reader)
+	{
+		KscValue kscValue;
+		kscValue.score = reader.read<int32>();
+		kscValue.achievement = static_cast<Achievement>(reader.read<int32>());
+		kscValue.grade = static_cast<Grade>(reader.read<int32>());
+		kscValue.percent = reader.read<int32>();
+		kscValue.maxCombo = reader.read<int32>();
+		kscValue.playCount = reader.read<int32>();
+		kscValue.clearCount = reader.read<int32>();
+		kscValue.fullComboCount = reader.read<int32>();
+		kscValue.perfectCount = reader.read<int32>();
+		return kscValue;
+	}
+
+	// レコード: OwnerKey, KscKey文字列(kscファイルの行の"="より前と同じ形式), KscValue
+	void WriteRecord(BinaryBufferWriter& writer, ScoreDatabase::OwnerKey ownerKey, StringView kscKeyStr, const KscValue& kscValue)
+	{
+		writer.write(ownerKey);
+		writer.writeString(kscKeyStr);
+		WriteKscValue(writer, kscValue);
+	}
+
+	std::string LogHeader()
+	{
+		BinaryBufferWriter writer;
+		writer.write(kLogMagic);
+		writer.write(kFormatVersion);
+		return writer.buffer();
+	}
+
+	std::string ReadFileContent(FilePathView path)
+	{
+		if (!FileSystem::IsFile(path))
+		{
+			return std::string{};
+		}
+
+		MemoryMappedFileView file{ path };
+		if (!file)
+		{
+			return std::string{};
+		}
+		const auto mapped = file.mapAll();
+		return std::string{ static_cast<const char*>(mapped.data), mapped.size };
+	}
+}
+
+ScoreDatabase::ScoreDatabase(FilePathView directoryPath)
+	: m_directoryPath(directoryPath)
+{
+	loadSnapshot();
+	replayLog();
+
+	if (m_numLogRecords > 0)
+	{
+		compactLockedFile();
+	}
+}
+
+void ScoreDatabase::loadSnapshot()
+{
+	const FilePath snapshotFilePath = FileSystem::PathAppend(m_directoryPath, kSnapshotFilename);
+	const std::string content = ReadFileContent(snapshotFilePath);
+	if (content.empty())
+	{
+		return;
+	}
+
+	// 末尾4バイトはそれより前の全体のチェックサム
+	const std::size_t bodySize = content.size() > sizeof(uint32) ? content.size() - sizeof(uint32) : 0U;
+	bool valid = bodySize > 0U;
+	if (valid)
+	{
+		uint32 storedCrc;
+		std::memcpy(&storedCrc, content.data() + bodySize, sizeof(uint32));
+		valid = storedCrc == Crc32(content.data(), bodySize);
+	}
+
+	BinaryBufferReader reader{ content.data(), bodySize };
+	if (valid)
+	{
+		const auto magic = reader.read<std::array<char, 8>>();
+		const uint32 formatVersion = reader.read<uint32>();
+		valid = !reader.failed() && magic == kSnapshotMagic && formatVersion == kFormatVersion;
+	}
+	if (!valid)
+	{
+		// Note: スナップショットはリネームで置き換えるため通常は壊れない
+		//       統合時に上書きされないよう、壊れたファイルは別名で退避しておく
+		Logger << U"[ksm error] ScoreDatabase: Snapshot file is corrupted (path:'{}')"_fmt(snapshotFilePath);
+		FileSystem::Rename(snapshotFilePath, U"{}.broken"_fmt(snapshotFilePath));
+		return;
+	}
+
+	const uint32 numRecords = reader.read<uint32>();
+	for (uint32 i = 0U; i < numRecords && !reader.failed(); ++i)
+	{
+		const OwnerKey ownerKey = reader.read<OwnerKey>();
+		const String kscKeyStr = Unicode::FromUTF8(reader.readString());
+		const KscValue kscValue = ReadKscValue(reader);
+		if (!reader.failed())
+		{
+			applyRecord(ownerKey, kscKeyStr, kscValue);
+		}
+	}
+}
+
+void ScoreDatabase::replayLog()
+{
+	const FilePath logFilePath = FileSystem::PathAppend(m_directoryPath, kLogFilename);
+	const std::string content = ReadFileContent(logFilePath);
+	if (content.empty())
+	{
+		return;
+	}
+
+	BinaryBufferReader reader{ content.data(), content.size() };
+	const auto magic = reader.read<std::array<char, 8>>();
+	const uint32 formatVersion = reader.read<uint32>();
+	if (reader.failed() || magic != kLogMagic || formatVersion != kFormatVersion)
+	{
+		Logger << U"[ksm error] ScoreDatabase: Log file is corrupted (path:'{}')"_fmt(logFilePath);
+
+		// 統合時に作り直されるよう、未統合のレコードがあるものとして扱う
+		m_numLogRecords = 1;
+		return;
+	}
+
+	// レコード: サイズ, 本体, 本体のチェックサム
+	while (reader.remainingSize() > 0U)
+	{
+		const uint32 recordSize = reader.read<uint32>();
+		if (reader.failed() || recordSize > kMaxRecordSize || reader.remainingSize() < recordSize + sizeof(uint32))
+		{
+			// 追記中に終了した場合は末尾のレコードが途切れている
+			Logger << U"[ksm warning] ScoreDatabase: Discarded truncated log record (path:'{}')"_fmt(logFilePath);
+			++m_numLogRecords;
+			break;
+		}
+
+		const char* recordData = reader.currentPos();
+		BinaryBufferReader recordReader{ recordData, recordSize };
+		const OwnerKey ownerKey = recordReader.read<OwnerKey>();
+		const String kscKeyStr = Unicode::FromUTF8(recordReader.readString());
+		const KscValue kscValue = ReadKscValue(recordReader);
+
+		reader.skip(recordSize);
+		const uint32 storedCrc = reader.read<uint32>();
+		if (recordReader.failed() || storedCrc != Crc32(recordData, recordSize))
+		{
+			Logger << U"[ksm warning] ScoreDatabase: Discarded broken log record (path:'{}')"_fmt(logFilePath);
+			++m_numLogRecords;
+			break;
+		}
+
+		// Note: レコードは差分ではなく更新後の値そのものなので、統合済みのレコードを再度適用しても結果は変わらない
+		applyRecord(ownerKey, kscKeyStr, kscValue);
+		++m_numLogRecords;
+	}
+}
+
+void ScoreDatabase::applyRecord(OwnerKey ownerKey, StringView kscKeyStr, const KscValue& kscValue)
+{
+	// KscKey文字列の先頭はgaugeType
+	const std::size_t commaPos = kscKeyStr.indexOf(U',');
+	if (commaPos == StringView::npos)
+	{
+		return;
+	}
+	const Optional<GaugeType> gaugeType = KscKey::ParseGaugeType(kscKeyStr.substr(0, commaPos));
+	if (!gaugeType.has_value())
+	{
+		return;
+	}
+
+	Entry& entry = m_entries[ownerKey][String{ kscKeyStr.substr(commaPos + 1) }];
+	entry.highScoreInfo.kscValueOf(*gaugeType) = kscValue;
+	entry.gaugeTypeMask |= static_cast<uint8>(1U << static_cast<int32>(*gaugeType));
+}
+
+bool ScoreDatabase::compactLockedFile()
+{
+	BinaryBufferWriter writer;
+	writer.write(kSnapshotMagic);
+	writer.write(kFormatVersion);
+	{
+		std::lock_guard lock(m_mutex);
+
+		uint32 numRecords = 0U;
+		for (const auto& [ownerKey, entries] : m_entries)
+		{
+			for (const auto& [keyWithoutGaugeType, entry] : entries)
+			{
+				numRecords += static_cast<uint32>(std::popcount(entry.gaugeTypeMask));
+			}
+		}
+		writer.write(numRecords);
+
+		for (const auto& [ownerKey, entries] : m_entries)
+		{
+			for (const auto& [keyWithoutGaugeType, entry] : entries)
+			{
+				for (int32 i = 0; i < kNumGaugeTypes; ++i)
+				{
+					if ((entry.gaugeTypeMask & (1U << i)) == 0U)
+					{
+						continue;
+					}
+					const GaugeType gaugeType = static_cast<GaugeType>(i);
+					const String kscKeyStr = U"{},{}"_fmt(KscKey::GaugeTypeStr(gaugeType), keyWithoutGaugeType);
+					WriteRecord(writer, ownerKey, kscKeyStr, entry.highScoreInfo.kscValueOf(gaugeType));
+				}
+			}
+		}
+	}
+
+	// Note: スナップショットにはログへ未追記の予約済みレコードの内容も含まれるが、後から追記されても結果は変わらない
+	std::string content = writer.buffer();
+	const uint32 crc = Crc32(content.data(), content.size());
+	content.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+	return writeSnapshotAndResetLog(content);
+}
+
+bool ScoreDatabase::writeSnapshotAndResetLog(const std::string& snapshotContent)
+{
+	if (!FileSystem::Exists(m_directoryPath) && !FileSystem::CreateDirectories(m_directoryPath))
+	{
+		Logger << U"[ksm error] ScoreDatabase: Could not create directory (path:'{}')"_fmt(m_directoryPath);
+		return false;
+	}
+
+	const FilePath snapshotFilePath = FileSystem::PathAppend(m_directoryPath, kSnapshotFilename);
+	if (!FsUtils::WriteFileDurably(snapshotFilePath, snapshotContent.data(), snapshotContent.size()))
+	{
+		Logger << U"[ksm error] ScoreDatabase: Could not write snapshot file (path:'{}')"_fmt(snapshotFilePath);
+		return false;
+	}
+
+	// Note: ここで終了した場合は統合済みのレコードがログに残るが、次回起動時に再度適用されても結果は変わらない
+	const FilePath logFilePath = FileSystem::PathAppend(m_directoryPath, kLogFilename);
+	const std::string logHeader = LogHeader();
+	if (!FsUtils::WriteFileDurably(logFilePath, logHeader.data(), logHeader.size()))
+	{
+		Logger << U"[ksm error] ScoreDatabase: Could not reset log file (path:'{}')"_fmt(logFilePath);
+		return false;
+	}
+
+	m_numLogRecords = 0;
+	return true;
+}
+
+ScoreDatabase::OwnerKey ScoreDatabase::ChartOwnerKey(StringView relativePathWithoutExtension)
+{
+	return HashOwnerPath(U"chart:", relativePathWithoutExtension);
+}
+
+ScoreDatabase::OwnerKey ScoreDatabase::CourseOwnerKey(StringView relativePathWithoutExtension)
+{
+	return HashOwnerPath(U"course:", relativePathWithoutExtension);
+}
+
+HighScoreInfo ScoreDatabase::read(OwnerKey ownerKey, const KscKey& condition) const
+{
+	std::lock_guard lock(m_mutex);
+
+	const auto itOwner = m_entries.find(ownerKey);
+	if (itOwner == m_entries.end())
+	{
+		return HighScoreInfo{};
+	}
+
+	const auto it = itOwner->second.find(condition.toStringWithoutGaugeType());
+	if (it == itOwner->second.end())
+	{
+		return HighScoreInfo{};
+	}
+	return it->second.highScoreInfo;
+}
+
+void ScoreDatabase::readAll(OwnerKey ownerKey, HashTable<String, HighScoreInfo>* pHighScoreInfoMap) const
+{
+	pHighScoreInfoMap->clear();
+
+	std::lock_guard lock(m_mutex);
+
+	const auto itOwner = m_entries.find(ownerKey);
+	if (itOwner == m_entries.end())
+	{
+		return;
+	}
+
+	pHighScoreInfoMap->reserve(itOwner->second.size());
+	for (const auto& [keyWithoutGaugeType, entry] : itOwner->second)
+	{
+		pHighScoreInfoMap->emplace(keyWithoutGaugeType, entry.highScoreInfo);
+	}
+}
+
+void ScoreDatabase::stage(OwnerKey ownerKey, const KscKey& condition, const KscValue& kscValue)
+{
+	std::lock_guard lock(m_mutex);
+
+	const String kscKeyStr = condition.toString();
+
+	BinaryBufferWriter recordWriter;
+	WriteRecord(recordWriter, ownerKey, kscKeyStr, kscValue);
+	const std::string& record = recordWriter.buffer();
+
+	BinaryBufferWriter writer;
+	writer.write(static_cast<uint32>(record.size()));
+	writer.writeBytes(record.data(), record.size());
+	writer.write(Crc32(record.data(), record.size()));
+	m_stagedLog += writer.buffer();
+	++m_numStagedRecords;
+
+	applyRecord(ownerKey, kscKeyStr, kscValue);
+}
+
+bool ScoreDatabase::flushStaged()
+{
+	std::lock_guard fileLock(m_fileMutex);
+
+	// fsync中もメモリ上の内容を読めるよう、予約済みのレコードを取り出してからロックを外す
+	std::string stagedLog;
+	int32 numStagedRecords;
+	{
+		std::lock_guard lock(m_mutex);
+		stagedLog = std::move(m_stagedLog);
+		m_stagedLog.clear();
+		numStagedRecords = std::exchange(m_numStagedRecords, 0);
+	}
+	if (numStagedRecords == 0)
+	{
+		return true;
+	}
+
+	std::string content;
+	const FilePath logFilePath = FileSystem::PathAppend(m_directoryPath, kLogFilename);
+	if (!FileSystem::IsFile(logFilePath))
+	{
+		if (!FileSystem::Exists(m_directoryPath))
+		{
+			FileSystem::CreateDirectories(m_directoryPath);
+		}
+		content = LogHeader();
+	}
+	content += stagedLog;
+
+	// fsyncが完了するまで戻らないため、ここでtrueを返した時点でハイスコアはディスク上に記録されている
+	if (!FsUtils::AppendFileDurably(logFilePath, content.data(), content.size()))
+	{
+		Logger << U"[ksm error] ScoreDatabase: Could not append to log file (path:'{}')"_fmt(logFilePath);
+
+		// 次回の呼び出しで再度書き込む
+		std::lock_guard lock(m_mutex);
+		m_stagedLog.insert(0, stagedLog);
+		m_numStagedRecords += numStagedRecords;
+		return false;
+	}
+
+	m_numLogRecords += numStagedRecords;
+	if (m_numLogRecords >= kCompactionThreshold)
+	{
+		compactLockedFile();
+	}
+	return true;
+}
+
+bool ScoreDatabase::commit(OwnerKey ownerKey, const KscKey& condition, const KscValue& kscValue)
+{
+	stage(ownerKey, condition, kscValue);
+	return flushStaged();
+}
+
+int32 ScoreDatabase::importKscDirectory(FilePathView kscDirectoryPath, bool isCourse)
+{
+	if (!FileSystem::IsDirectory(kscDirectoryPath))
+	{
+		return 0;
+	}
+
+	std::lock_guard lock(m_mutex);
+
+	int32 numImported = 0;
+	for (const FilePath& kscFilePath : FileSystem::DirectoryContents(kscDirectoryPath, Recursive::Yes))
+	{
+		if (FileSystem::Extension(kscFilePath) != U"ksc")
+		{
+			continue;
+		}
+
+		TextReader reader{ kscFilePath };
+		if (!reader)
+		{
+			Logger << U"[ksm warning] ScoreDatabase: Could not open ksc file (path:'{}')"_fmt(kscFilePath);
+			continue;
+		}
+
+		// kscファイルのパスは譜面・コースファイルの相対パスの拡張子をkscに置き換えたもの
+		const String relativePath = FsUtils::EliminateExtension(FileSystem::RelativePath(kscFilePath, kscDirectoryPath));
+		const OwnerKey ownerKey = isCourse ? CourseOwnerKey(relativePath) : ChartOwnerKey(relativePath);
+
+		String line;
+		while (reader.readLine(line))
+		{
+			const std::size_t eqPos = line.indexOf(U'=');
+			if (eqPos == String::npos)
+			{
+				continue;
+			}
+			applyRecord(ownerKey, line.substrView(0, eqPos), KscValue::FromString(line.substr(eqPos + 1)));
+		}
+		++numImported;
+	}
+	return numImported;
+}
+
+bool ScoreDatabase::compact()
+{
+	std::lock_guard fileLock(m_fileMutex);
+	return compactLockedFile();
+}
+
+ScoreDatabase& ScoreDatabase::OfPlayer(StringView playerName)
+{
+	static std::mutex s_mutex;
+	static HashTable<String, std::unique_ptr<ScoreDatabase>> s_databases;
+
+	std::lock_guard lock(s_mutex);
+
+	const String playerNameKey{ playerName };
+	if (const auto it = s_databases.find(playerNameKey); it != s_databases.end())
+	{
+		return *it->second;
+	}
+
+	const FilePath directoryPath = FileSystem::PathAppend(FsUtils::ScoreDirectoryPath(), playerNameKey);
+	const bool exists = FileSystem::IsFile(FileSystem::PathAppend(directoryPath, kSnapshotFilename)) || FileSystem::IsFile(FileSystem::PathAppend(directoryPath, kLogFilename));
+
+	auto pDatabase = std::make_unique<ScoreDatabase>(directoryPath);
+	if (!exists)
+	{
+		// 初回のみ既存のkscファイルをインポート
+		// (kscファイルは削除せず残すが、以降は更新されない)
+		const int32 numCharts = pDatabase->importKscDirectory(directoryPath, false);
+		const int32 numCourses = pDatabase->importKscDirectory(FileSystem::PathAppend(FsUtils::CourseScoreDirectoryPath(), playerNameKey), true);
+		if (numCharts > 0 || numCourses > 0)
+		{
+			Logger << U"[ksm info] ScoreDatabase: Imported ksc files (player:'{}', charts:{}, courses:{})"_fmt(playerNameKey, numCharts, numCourses);
+		}
+		pDatabase->compact();
+	}
+
+	return *s_databases.emplace(playerNameKey, std::move(pDatabase)).first->second;
+}
@@ -0,0 +1,134 @@
+﻿#pragma once
+#include <mutex>
+#include "HighScoreInfo.hpp"
+#include "KscKey.hpp"
+
+/// @brief プレイヤー1人分の全譜面・全コースのハイスコア情報を保持するデータベース
+/// @details スナップショットファイル(scores.db)と追記専用のログファイル(scores.log)の2ファイルで構成する。
+///          書き込みはログへの1レコードの追記とfsyncで完了し、ログのレコード数が一定数を超えるとスナップショットへ統合(コンパクション)する。
+///          ログの各レコードにはチェックサムが付いており、書き込み途中で電源が落ちた場合も末尾の壊れたレコードのみが破棄される。
+///          全レコードは起動後の初回アクセス時に一括でメモリ上へ読み込まれるため、検索はファイルアクセスを伴わない。
+class ScoreDatabase
+{
+public:
+	/// @brief ハイスコア情報の対象(譜面またはコース)を識別するキー
+	using OwnerKey = uint64;
+
+	static constexpr FilePathView kSnapshotFilename = U"scores.db";
+
+	static constexpr FilePathView kLogFilename = U"scores.log";
+
+	/// @brief ログのレコード数がこの数に達したらスナップショットへ統合する
+	static constexpr int32 kCompactionThreshold = 256;
+
+private:
+	struct Entry
+	{
+		HighScoreInfo highScoreInfo;
+
+		/// @brief 記録が存在するゲージの種類(GaugeTypeの値のビットの論理和)
+		uint8 gaugeTypeMask = 0U;
+	};
+
+	const FilePath m_directoryPath;
+
+	// メモリ上の内容(m_entries, m_stagedLog, m_numStagedRecords)の保護用
+	mutable std::mutex m_mutex;
+
+	// ファイルへの書き込み(m_numLogRecordsを含む)の保護用
+	// Note: ロックの順番はm_fileMutex→m_mutexとすること
+	std::mutex m_fileMutex;
+
+	// キー: OwnerKey → gaugeType部分を除いたKscKey文字列
+	HashTable<OwnerKey, HashTable<String, Entry>> m_entries;
+
+	int32 m_numLogRecords = 0;
+
+	// メモリ上には反映済みでログへ未追記のレコード
+	std::string m_stagedLog;
+
+	int32 m_numStagedRecords = 0;
+
+	void loadSnapshot();
+
+	void replayLog();
+
+	void applyRecord(OwnerKey ownerKey, StringView kscKeyStr, const KscValue& kscValue);
+
+	// Note: 呼び出し元でm_fileMutexをロックしておくこと
+	bool compactLockedFile();
+
+	bool writeSnapshotAndResetLog(const std::string& snapshotContent);
+
+public:
+	/// @brief データベースを開く
+	/// @param directoryPath スナップショット・ログファイルを置くフォルダのパス
+	/// @remark ログに未統合のレコードがある場合は開いた時点でスナップショットへ統合する
+	explicit ScoreDatabase(FilePathView directoryPath);
+
+	ScoreDatabase(const ScoreDatabase&) = delete;
+
+	ScoreDatabase& operator=(const ScoreDatabase&) = delete;
+
+	/// @brief 譜面のOwnerKeyを取得
+	/// @param relativePathWithoutExtension songsフォルダからの譜面ファイルの相対パス(拡張子なし)
+	[[nodiscard]]
+	static OwnerKey ChartOwnerKey(StringView relativePathWithoutExtension);
+
+	/// @brief コースのOwnerKeyを取得
+	/// @param relativePathWithoutExtension コースファイルの相対パス(拡張子なし)
+	[[nodiscard]]
+	static OwnerKey CourseOwnerKey(StringView relativePathWithoutExtension);
+
+	/// @brief ハイスコア情報を取得
+	/// @param ownerKey 対象の譜面・コース
+	/// @param condition 取得するハイスコア情報の条件(gaugeTypeは無視される)
+	/// @return ハイスコア情報(記録がない場合は既定値)
+	[[nodiscard]]
+	HighScoreInfo read(OwnerKey ownerKey, const KscKey& condition) const;
+
+	/// @brief 全条件のハイスコア情報を取得
+	/// @param ownerKey 対象の譜面・コース
+	/// @param pHighScoreInfoMap 全条件のハイスコア情報(キー:gaugeType部分を除いたKscKey文字列)
+	void readAll(OwnerKey ownerKey, HashTable<String, HighScoreInfo>* pHighScoreInfoMap) const;
+
+	/// @brief ハイスコア情報をメモリ上に反映し、ログへの追記を予約する
+	/// @param ownerKey 対象の譜面・コース
+	/// @param condition 書き込むハイスコア情報の条件
+	/// @param kscValue 書き込むハイスコア情報
+	/// @remark 以降のread・readAllには即座に反映される。ファイルへの書き込みはflushStagedで行う
+	void stage(OwnerKey ownerKey, const KscKey& condition, const KscValue& kscValue);
+
+	/// @brief 予約済みのレコードをまとめてログへ追記する
+	/// @return ログへの追記とfsyncに成功した場合(または予約済みのレコードがない場合)はtrue
+	/// @remark 失敗した場合、レコードは予約済みのまま残り次回の呼び出しで再度書き込まれる。
+	///         ワーカースレッドから呼び出してよい
+	bool flushStaged();
+
+	/// @brief ハイスコア情報を書き込む
+	/// @param ownerKey 対象の譜面・コース
+	/// @param condition 書き込むハイスコア情報の条件
+	/// @param kscValue 書き込むハイスコア情報
+	/// @return ログへの追記とfsyncに成功した場合はtrue
+	/// @remark stageとflushStagedを続けて呼び出すのと同じ
+	bool commit(OwnerKey ownerKey, const KscKey& condition, const KscValue& kscValue);
+
+	/// @brief kscファイルのフォルダからハイスコア情報をインポートする
+	/// @param kscDirectoryPath kscファイルを置いたフォルダのパス(サブフォルダも含めて読み込む)
+	/// @param isCourse コースのハイスコア情報の場合はtrue
+	/// @return インポートしたkscファイルの数
+	/// @remark インポート結果はスナップショットへ統合した時点で保存される
+	int32 importKscDirectory(FilePathView kscDirectoryPath, bool isCourse);
+
+	/// @brief ログをスナップショットへ統合する
+	/// @return 成功した場合はtrue
+	bool compact();
+
+	/// @brief プレイヤーのデータベースを取得
+	/// @param playerName プレイヤー名
+	/// @return データベース
+	/// @remark 初回呼び出し時に読み込みを行う。データベースが存在しない場合は既存のkscファイルからインポートする。
+	///         任意のスレッドから呼び出してよい
+	[[nodiscard]]
+	static ScoreDatabase& OfPlayer(StringView playerName);
+};
@@ -3,6 +3,7 @@
 #include "Input/KeyConfig.hpp"
 #include "MusicGame/Scroll/HispeedSetting.hpp"
 #include "Common/FsUtils.hpp"
+#include "Common/PersistenceQueue.hpp"
 
 namespace
 {
@@ -280,9 +281,14 @@ void ConfigIni::Load()
 	}
 }
 
-void ConfigIni::Save()
+std::shared_future<bool> ConfigIni::Save()
 {
-	s_configIniData.save(GetConfigIniFilePath());
+	// 保存前に再度変更されても影響しないよう、設定値はコピーして渡す
+	const FilePath configIniPath = GetConfigIniFilePath();
+	return PersistenceQueue::Shared().enqueue(configIniPath, [configIniData = s_configIniData, configIniPath]
+	{
+		return configIniData.save(configIniPath);
+	});
 }
 
 bool ConfigIni::HasValue(StringView key)
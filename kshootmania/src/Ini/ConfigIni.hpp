@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <future>
 
 namespace MusicGame
 {
@@ -83,6 +84,8 @@ namespace ConfigIni
 
 		constexpr StringView kMuteAudioInInactiveWindow = U"automaticmute";
 
+		constexpr StringView kFrameProfiler = U"frame_profiler";
+
 		constexpr StringView kExportPNG = U"output";
 		constexpr StringView kExportPNGPath = U"output_path";
 		constexpr StringView kExportPNGDownscale = U"output_downscale";
@@ -155,7 +158,10 @@ namespace ConfigIni
 
 	void Load();
 
-	void Save();
+	/// @brief config.iniを保存する
+	/// @return 保存の完了を待つためのfuture(保存に成功した場合はtrue)
+	/// @remark 呼び出し時点の設定値をコピーし、ファイルへの書き込みはPersistenceQueueのワーカースレッドで行う
+	std::shared_future<bool> Save();
 
 	[[nodiscard]]
 	bool HasValue(StringView key);
@@ -1,5 +1,6 @@
 ﻿#include "KSMIniData.hpp"
 #include <ranges>
+#include "Common/FsUtils.hpp"
 
 KSMIniData::KSMIniData(FilePathView path)
 {
@@ -37,7 +38,7 @@ void KSMIniData::load(FilePathView path)
 	}
 }
 
-void KSMIniData::save(FilePathView path) const
+bool KSMIniData::save(FilePathView path) const
 {
 	constexpr std::size_t kReserveSize = 4096;
 
@@ -104,15 +105,13 @@ void KSMIniData::save(FilePathView path) const
 	}
 
 	// ファイルへ書き込み
-	TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
-	if (writer)
-	{
-		writer.write(ini);
-	}
-	else
+	const std::string iniUTF8 = Unicode::ToUTF8(ini);
+	if (!FsUtils::WriteFileDurably(path, iniUTF8.data(), iniUTF8.size()))
 	{
 		Logger << U"[ksm error] Could not save INI file '{}'!"_fmt(path);
+		return false;
 	}
+	return true;
 }
 
 bool KSMIniData::hasValue(StringView key) const
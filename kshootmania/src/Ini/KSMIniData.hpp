@@ -13,7 +13,10 @@ public:
 
 	void load(FilePathView path);
 
-	void save(FilePathView path) const;
+	/// @brief ファイルへ保存する
+	/// @return 保存に成功した場合はtrue
+	/// @remark 一時ファイルへ書き込んでfsyncした後にリネームするため、保存中に電源が落ちても元のファイルは壊れない
+	bool save(FilePathView path) const;
 
 	[[nodiscard]]
 	bool hasValue(StringView key) const;
@@ -0,0 +1,48 @@
+﻿#pragma once
+#include <chrono>
+
+/// @brief 入力スレッドで監視するボタンの数(kButtonBT_A〜kButtonFX_R)
+constexpr std::size_t kNumButtonEventButtons = static_cast<std::size_t>(kButtonFX_R) + 1U;
+
+/// @brief 入力スレッドで検出したボタンの押下・解放
+struct ButtonEvent
+{
+	Button button = kUnspecifiedButton;
+
+	bool isDown = false;
+
+	// 検出時刻(入力スレッドのポーリング時刻)
+	std::chrono::steady_clock::time_point time;
+};
+
+/// @brief ボタンの押下状態の変化からButtonEventを生成する
+class ButtonEventDetector
+{
+private:
+	uint32 m_prevPressedBits = 0U;
+
+public:
+	/// @brief 押下状態を更新
+	/// @param pressedBits 押下中のボタンのビット(kButtonBT_A〜kButtonFX_Rの順に下位ビットから)
+	/// @param time 押下状態を取得した時刻
+	/// @param onEvent 押下状態が変化したボタンごとに呼び出される関数
+	template <typename F>
+	void update(uint32 pressedBits, std::chrono::steady_clock::time_point time, F onEvent)
+	{
+		const uint32 changedBits = pressedBits ^ m_prevPressedBits;
+		if (changedBits == 0U)
+		{
+			return;
+		}
+
+		for (std::size_t i = 0U; i < kNumButtonEventButtons; ++i)
+		{
+			const uint32 mask = 1U << i;
+			if (changedBits & mask)
+			{
+				onEvent(ButtonEvent{ .button = static_cast<Button>(i), .isDown = (pressedBits & mask) != 0U, .time = time });
+			}
+		}
+		m_prevPressedBits = pressedBits;
+	}
+};
@@ -0,0 +1,46 @@
+﻿#include "ButtonEventThread.hpp"
+
+ButtonEventThread::ButtonEventThread(std::unique_ptr<IButtonStateSource>&& source, std::chrono::microseconds pollInterval)
+	: m_source(std::move(source))
+	, m_pollInterval(pollInterval)
+	, m_thread([this] { threadMain(); })
+{
+}
+
+ButtonEventThread::~ButtonEventThread()
+{
+	m_stopRequested.store(true, std::memory_order_relaxed);
+	m_thread.join();
+}
+
+void ButtonEventThread::threadMain()
+{
+	ButtonEventDetector detector;
+	auto nextPollTime = std::chrono::steady_clock::now();
+	while (!m_stopRequested.load(std::memory_order_relaxed))
+	{
+		const auto now = std::chrono::steady_clock::now();
+		detector.update(m_source->pressedButtonBits(), now, [this](const ButtonEvent& event)
+		{
+			if (!m_queue.tryPush(event))
+			{
+				m_numDroppedEvents.fetch_add(1U, std::memory_order_relaxed);
+			}
+		});
+
+		// ポーリング間隔を一定に保つため、前回の予定時刻を基準に次の時刻を決める
+		// (処理が遅れて予定時刻を過ぎている場合は、遅れを取り戻そうとせず現在時刻を基準にする)
+		nextPollTime = std::max(nextPollTime + m_pollInterval, now);
+		std::this_thread::sleep_until(nextPollTime);
+	}
+}
+
+bool ButtonEventThread::tryPop(ButtonEvent* pEvent)
+{
+	return m_queue.tryPop(pEvent);
+}
+
+std::size_t ButtonEventThread::numDroppedEvents() const
+{
+	return m_numDroppedEvents.load(std::memory_order_relaxed);
+}
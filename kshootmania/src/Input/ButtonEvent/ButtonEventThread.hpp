@@ -0,0 +1,51 @@
+﻿#pragma once
+#include <thread>
+#include "Common/SPSCQueue.hpp"
+#include "ButtonEvent.hpp"
+#include "IButtonStateSource.hpp"
+
+/// @brief 描画フレームとは独立した高頻度のポーリングでボタンの押下・解放を検出し、時刻付きで通知するスレッド
+/// @details 検出したイベントはロックフリーのキューを介してメインスレッドへ渡す。
+///          フレームレートに関係なく、押下時刻の精度はポーリング間隔程度になる
+class ButtonEventThread
+{
+public:
+	static constexpr std::chrono::microseconds kDefaultPollInterval{ 250 };
+
+private:
+	// 数フレーム分取り出されなくても溢れない程度の容量
+	static constexpr std::size_t kQueueCapacity = 256U;
+
+	const std::unique_ptr<IButtonStateSource> m_source;
+
+	const std::chrono::microseconds m_pollInterval;
+
+	SPSCQueue<ButtonEvent, kQueueCapacity> m_queue;
+
+	std::atomic<bool> m_stopRequested = false;
+
+	// キューが満杯で破棄したイベントの数
+	std::atomic<std::size_t> m_numDroppedEvents = 0U;
+
+	std::thread m_thread;
+
+	void threadMain();
+
+public:
+	/// @param source ボタン入力元
+	/// @param pollInterval ポーリング間隔
+	explicit ButtonEventThread(std::unique_ptr<IButtonStateSource>&& source, std::chrono::microseconds pollInterval = kDefaultPollInterval);
+
+	~ButtonEventThread();
+
+	ButtonEventThread(const ButtonEventThread&) = delete;
+
+	ButtonEventThread& operator=(const ButtonEventThread&) = delete;
+
+	/// @brief 検出したイベントを古い順に1つ取り出す(メインスレッドからのみ呼び出すこと)
+	/// @return 取り出せた場合はtrue
+	bool tryPop(ButtonEvent* pEvent);
+
+	[[nodiscard]]
+	std::size_t numDroppedEvents() const;
+};
@@ -0,0 +1,14 @@
+﻿#pragma once
+
+/// @brief 入力スレッドから押下状態を取得するボタン入力元のインタフェース
+/// @remark pressedButtonBits()は入力スレッドから呼び出されるため、Siv3Dの入力状態(フレーム単位でしか更新されない)ではなくOSの入力状態を直接参照すること
+class IButtonStateSource
+{
+public:
+	virtual ~IButtonStateSource() = default;
+
+	/// @brief 現在の押下状態を取得
+	/// @return 押下中のボタンのビット(kButtonBT_A〜kButtonFX_Rの順に下位ビットから)
+	[[nodiscard]]
+	virtual uint32 pressedButtonBits() = 0;
+};
@@ -0,0 +1,53 @@
+﻿#include "KeyboardButtonStateSource.hpp"
+#include "Input/KeyConfig.hpp"
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+KeyboardButtonStateSource::KeyboardButtonStateSource()
+{
+	for (std::size_t i = 0U; i < kNumButtonEventButtons; ++i)
+	{
+		m_keyCodes[i] = KeyConfig::KeyboardKeyCodes(static_cast<Button>(i));
+	}
+}
+
+uint32 KeyboardButtonStateSource::pressedButtonBits()
+{
+	uint32 bits = 0U;
+#ifdef _WIN32
+	for (std::size_t i = 0U; i < kNumButtonEventButtons; ++i)
+	{
+		for (const uint8 keyCode : m_keyCodes[i])
+		{
+			// Siv3DのキーボードのキーコードはWindowsの仮想キーコードと同一
+			// (GetAsyncKeyStateはメッセージループを経由しないため、任意のスレッドから呼び出せる)
+			if (GetAsyncKeyState(keyCode) & 0x8000)
+			{
+				bits |= 1U << i;
+				break;
+			}
+		}
+	}
+#endif
+	return bits;
+}
+
+bool IsKeyboardButtonStateSourceSupported()
+{
+#ifdef _WIN32
+	return true;
+#else
+	return false;
+#endif
+}
+
+std::unique_ptr<IButtonStateSource> CreateKeyboardButtonStateSource()
+{
+	if (!IsKeyboardButtonStateSourceSupported())
+	{
+		return nullptr;
+	}
+	return std::make_unique<KeyboardButtonStateSource>();
+}
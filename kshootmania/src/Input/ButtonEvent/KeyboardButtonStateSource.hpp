@@ -0,0 +1,27 @@
+﻿#pragma once
+#include "ButtonEvent.hpp"
+#include "IButtonStateSource.hpp"
+
+/// @brief キーボードの押下状態をOSから直接取得するボタン入力元
+/// @remark キーコードは生成時のキーコンフィグから取得するため、キーコンフィグを変更した場合は作り直すこと
+class KeyboardButtonStateSource : public IButtonStateSource
+{
+private:
+	// ボタンごとの割り当てキー(FXの場合はLR両押しキーも含む)
+	std::array<Array<uint8>, kNumButtonEventButtons> m_keyCodes;
+
+public:
+	KeyboardButtonStateSource();
+
+	[[nodiscard]]
+	uint32 pressedButtonBits() override;
+};
+
+/// @brief 現在のプラットフォームで入力スレッドからキーボードの押下状態を取得できるかどうか
+[[nodiscard]]
+bool IsKeyboardButtonStateSourceSupported();
+
+/// @brief 入力スレッド用のキーボード入力元を生成
+/// @return 生成した入力元(現在のプラットフォームで未対応の場合はnullptr)
+[[nodiscard]]
+std::unique_ptr<IButtonStateSource> CreateKeyboardButtonStateSource();
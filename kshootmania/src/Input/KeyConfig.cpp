@@ -703,6 +703,36 @@ bool KeyConfig::Up(Button button)
 	return false;
 }
 
+Array<uint8> KeyConfig::KeyboardKeyCodes(Button button)
+{
+	Array<uint8> keyCodes;
+	if (button == kUnspecifiedButton)
+	{
+		return keyCodes;
+	}
+
+	const auto fnAddKeyCode = [&keyCodes](const Input& input)
+	{
+		if (input.deviceType() == InputDeviceType::Keyboard && !keyCodes.contains(input.code()))
+		{
+			keyCodes.push_back(input.code());
+		}
+	};
+
+	for (const auto& configSet : s_configSetArray)
+	{
+		fnAddKeyCode(GetConfigSetInputApplyingSwap(configSet, button));
+
+		// FXの場合はLR両押しキーも含める
+		if (button == kButtonFX_L || button == kButtonFX_R)
+		{
+			fnAddKeyCode(configSet[kButtonFX_LR]);
+		}
+	}
+
+	return keyCodes;
+}
+
 bool KeyConfig::IsLaserInputDigital()
 {
 	const int32 laserInputType = ConfigIni::GetInt(ConfigIni::Key::kLaserInputType, ConfigIni::Value::LaserInputType::kKeyboard);
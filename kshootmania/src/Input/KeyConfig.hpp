@@ -65,6 +65,13 @@ namespace KeyConfig
 
 	bool Up(Button button);
 
+	/// @brief ボタンに割り当てられたキーボードのキーコードを取得
+	/// @param button ボタン
+	/// @return キーコードの配列(FXの場合はLR両押しキーも含む)
+	/// @remark 入力スレッドなどSiv3Dの入力状態を参照できない箇所で、OSから押下状態を直接取得するために使用する
+	[[nodiscard]]
+	Array<uint8> KeyboardKeyCodes(Button button);
+
 	template <class C>
 	bool AnyButtonPressed(const C& buttons, NeedStartButtonHoldForNonArrowKeyYN needStartButtonHoldForNonArrowKey = NeedStartButtonHoldForNonArrowKeyYN::No)
 	{
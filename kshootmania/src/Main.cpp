@@ -7,6 +7,7 @@
 #include "Addon/AutoMuteAddon.hpp"
 #include "Addon/CommonSEAddon.hpp"
 #include "Addon/DisableIMEAddon.hpp"
+#include "Addon/FrameProfilerAddon.hpp"
 #include "ksmaudio/ksmaudio.hpp"
 #include <ksmaxis/ksmaxis.hpp>
 #include "RuntimeConfig.hpp"
@@ -15,6 +16,10 @@
 #include "Input/InputUtils.hpp"
 #include "Hardware/Lighting/LightingManager.hpp"
 #include "Debug/LightingOverlay.hpp"
+#include "SongLibrary/SongLibraryIndex.hpp"
+#include "SongLibrary/JacketThumbnailCache.hpp"
+#include "Common/ThreadPool.hpp"
+#include "Common/PersistenceQueue.hpp"
 
 #ifdef __APPLE__
 #include <ksmplatform_macos/input_method.h>
@@ -298,6 +303,10 @@ void KSMMain()
 	// ハイスコアのバックアップを作成
 	CreateHighScoreBackup();
 
+	// 楽曲ライブラリのインデックスを読み込み
+	SongLibraryIndex::Load();
+	JacketThumbnailCache::Load();
+
 	// 画面サイズ反映
 	Window::SetToggleFullscreenEnabled(false); // Alt+Enter無効化
 	ApplyScreenSizeConfig();
@@ -319,6 +328,10 @@ void KSMMain()
 
 	Addon::Register(CommonSEAddon::kAddonName, std::make_unique<CommonSEAddon>(), 2);
 
+	// フレーム時間の計測(オーバーレイが他の描画より手前に表示されるよう最後に描画)
+	FrameProfiler::SetEnabled(ConfigIni::GetBool(ConfigIni::Key::kFrameProfiler, true));
+	Addon::Register(FrameProfilerAddon::kAddonName, std::make_unique<FrameProfilerAddon>(), 4);
+
 #if defined(_WIN32) || defined(__APPLE__)
 	Addon::Register(DisableIMEAddon::kAddonName, std::make_unique<DisableIMEAddon>(), 3);
 #endif
@@ -403,9 +416,20 @@ void KSMMain()
 		}
 	}
 
+	// バックグラウンド処理を終了
+	// (譜面スキャン等のタスクが楽曲ライブラリのインデックスを更新し終えてから保存するため、保存より先に行う)
+	ThreadPool::TerminateShared();
+
 	// config.iniを保存
 	ConfigIni::Save();
 
+	// ハイスコア・config.iniの書き込みを全て完了させる
+	PersistenceQueue::TerminateShared();
+
+	// 楽曲ライブラリのインデックスを保存
+	SongLibraryIndex::Save();
+	JacketThumbnailCache::Save();
+
 	lightingManager.shutdown();
 
 #ifdef __APPLE__
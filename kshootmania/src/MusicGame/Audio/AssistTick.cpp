@@ -1,5 +1,4 @@
 ﻿#include "AssistTick.hpp"
-#include "AudioDefines.hpp"
 
 namespace MusicGame::Audio
 {
@@ -25,14 +24,19 @@ namespace MusicGame::Audio
 	{
 	}
 
-	void AssistTick::update(const kson::ChartData& chartData, const kson::TimingCache& timingCache, double currentTimeSec)
+	void AssistTick::update(const kson::ChartData& chartData, const kson::TimingCache& timingCache, BGM& bgm)
 	{
 		if (m_mode == AssistTickMode::kOff)
 		{
 			return;
 		}
 
-		const kson::Pulse currentPulseForAssistTick = kson::SecToPulse(currentTimeSec + kSELatencySec, chartData.beat, timingCache);
+		// 先読みした範囲のノーツのアシストティックをBGMに渡し、ノーツの時間ちょうどに鳴らす
+		const kson::Pulse currentPulseForAssistTick = kson::SecToPulse((bgm.posSec() + bgm.seLookahead()).count(), chartData.beat, timingCache);
+		const auto fnNoteTimeSec = [&](kson::Pulse pulse)
+		{
+			return SecondsF{ kson::PulseToSec(pulse, chartData.beat, timingCache) };
+		};
 
 		// BT
 		for (std::size_t i = 0; i < kson::kNumBTLanesSZ; ++i)
@@ -41,7 +45,7 @@ namespace MusicGame::Audio
 			if (currentNotePulse > m_btPlayedPulses[i])
 			{
 				// BTの場合はチップノーツとロングノーツの両方で鳴らす
-				m_btTickSound.play();
+				bgm.playSE(m_btTickSound, fnNoteTimeSec(currentNotePulse), 1.0);
 				m_btPlayedPulses[i] = currentNotePulse;
 			}
 		}
@@ -55,7 +59,7 @@ namespace MusicGame::Audio
 				if (chartData.note.fx[i].contains(currentNotePulse) && chartData.note.fx[i].at(currentNotePulse).length == 0)
 				{
 					// FXの場合はチップノーツのみ鳴らす
-					m_fxTickSound.play();
+					bgm.playSE(m_fxTickSound, fnNoteTimeSec(currentNotePulse), 1.0);
 				}
 				m_fxPlayedPulses[i] = currentNotePulse;
 			}
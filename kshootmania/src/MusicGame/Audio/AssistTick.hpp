@@ -3,6 +3,7 @@
 #include "kson/ChartData.hpp"
 #include "kson/Util/TimingUtils.hpp"
 #include "ksmaudio/ksmaudio.hpp"
+#include "BGM.hpp"
 
 namespace MusicGame::Audio
 {
@@ -19,6 +20,6 @@ namespace MusicGame::Audio
 	public:
 		explicit AssistTick(AssistTickMode mode);
 
-		void update(const kson::ChartData& chartData, const kson::TimingCache& timingCache, double currentTimeSec);
+		void update(const kson::ChartData& chartData, const kson::TimingCache& timingCache, BGM& bgm);
 	};
 }
@@ -0,0 +1,88 @@
+﻿#include "AudioClock.hpp"
+
+namespace MusicGame::Audio
+{
+	namespace
+	{
+		// PLLの固有角周波数(rad/s)と減衰係数
+		// (再生位置の量子化によるばらつきを平滑化しつつ、再生開始時のずれが2秒程度で収束する値)
+		constexpr double kNaturalFrequency = 0.5;
+		constexpr double kDampingRatio = 1.0;
+
+		// 推定値からのずれがこれ以上の場合はシークなどによる不連続とみなし、補正せずに再同期する
+		constexpr double kResyncThresholdSec = 0.1;
+
+		// 推定する速さの範囲(オーディオデバイスのクロックのずれとしてあり得る範囲)
+		constexpr double kMinRate = 0.99;
+		constexpr double kMaxRate = 1.01;
+	}
+
+	double AudioClock::estimate(double steadySec) const
+	{
+		return m_phaseSec + m_stats.rate * (steadySec - m_phaseSteadySec);
+	}
+
+	void AudioClock::reset(double audioPosSec, double steadySec)
+	{
+		m_isInitialized = true;
+		m_phaseSec = audioPosSec;
+		m_phaseSteadySec = steadySec;
+		m_lastAudioPosSec = audioPosSec;
+		m_lastNowSec = audioPosSec;
+	}
+
+	void AudioClock::update(double audioPosSec, double steadySec)
+	{
+		if (!m_isInitialized)
+		{
+			reset(audioPosSec, steadySec);
+			return;
+		}
+
+		if (audioPosSec == m_lastAudioPosSec)
+		{
+			return;
+		}
+		m_lastAudioPosSec = audioPosSec;
+
+		const double predictedSec = estimate(steadySec);
+		const double errorSec = audioPosSec - predictedSec;
+		if (Abs(errorSec) >= kResyncThresholdSec)
+		{
+			m_phaseSec = audioPosSec;
+			m_phaseSteadySec = steadySec;
+			m_lastNowSec = audioPosSec;
+			++m_stats.numResyncs;
+			return;
+		}
+
+		// 2次のPLL(位相は比例、速さは積分で補正)
+		const double deltaSteadySec = Max(steadySec - m_phaseSteadySec, 0.0);
+		const double phaseGain = Min(2.0 * kDampingRatio * kNaturalFrequency * deltaSteadySec, 1.0);
+		const double rateGain = kNaturalFrequency * kNaturalFrequency * deltaSteadySec;
+		m_phaseSec = predictedSec + phaseGain * errorSec;
+		m_phaseSteadySec = steadySec;
+		m_stats.rate = Clamp(m_stats.rate + rateGain * errorSec, kMinRate, kMaxRate);
+
+		++m_stats.numSamples;
+		m_stats.lastErrorSec = errorSec;
+		m_stats.maxAbsErrorSec = Max(m_stats.maxAbsErrorSec, Abs(errorSec));
+		m_stats.sumSquaredErrorSec += errorSec * errorSec;
+	}
+
+	double AudioClock::now(double steadySec)
+	{
+		m_lastNowSec = Max(estimate(steadySec), m_lastNowSec);
+		return m_lastNowSec;
+	}
+
+	bool AudioClock::isInitialized() const
+	{
+		return m_isInitialized;
+	}
+
+	const AudioClockStats& AudioClock::stats() const
+	{
+		return m_stats;
+	}
+}
@@ -0,0 +1,91 @@
+﻿#pragma once
+
+namespace MusicGame::Audio
+{
+	/// @brief AudioClockの推定状況の統計
+	struct AudioClockStats
+	{
+		// 推定の補正に使用した再生位置の数
+		int64 numSamples = 0;
+
+		// 再生位置の不連続により推定をやり直した回数
+		int64 numResyncs = 0;
+
+		// 推定した再生位置の進む速さ(経過時間1秒あたりの再生位置の秒数)
+		double rate = 1.0;
+
+		// 直近の再生位置の、補正前の推定値からのずれ(秒)
+		double lastErrorSec = 0.0;
+
+		// 再生位置の、補正前の推定値からのずれの最大値(秒、絶対値)
+		double maxAbsErrorSec = 0.0;
+
+		// 再生位置の、補正前の推定値からのずれの二乗和
+		double sumSquaredErrorSec = 0.0;
+
+		/// @brief 経過時間に対する再生位置のずれの割合(ppm)
+		[[nodiscard]]
+		double driftPPM() const
+		{
+			return (rate - 1.0) * 1e6;
+		}
+
+		/// @brief 再生位置の、補正前の推定値からのずれの二乗平均平方根(秒)
+		[[nodiscard]]
+		double rmsErrorSec() const
+		{
+			return numSamples > 0 ? std::sqrt(sumSquaredErrorSec / static_cast<double>(numSamples)) : 0.0;
+		}
+	};
+
+	/// @brief 音声の再生位置と経過時間(steady_clock)を組み合わせ、滑らかで高分解能な再生位置を推定する
+	/// @details 音声の再生位置はミキサーの更新単位でしか進まないため、そのまま使用するとフレームごとにばらつく。
+	///          位相(再生位置)と速さの2つを補正する2次のPLLで、再生位置に追従する直線を経過時間から求める
+	/// @remark 時刻はいずれも秒単位で、経過時間は単調増加する任意の基準からの値でよい
+	class AudioClock
+	{
+	private:
+		bool m_isInitialized = false;
+
+		// 推定の基準となる再生位置と、その経過時間
+		double m_phaseSec = 0.0;
+		double m_phaseSteadySec = 0.0;
+
+		// 最後に補正に使用した再生位置
+		double m_lastAudioPosSec = 0.0;
+
+		// 最後にnow()で返した値(単調増加にするため)
+		double m_lastNowSec = 0.0;
+
+		AudioClockStats m_stats;
+
+		[[nodiscard]]
+		double estimate(double steadySec) const;
+
+	public:
+		AudioClock() = default;
+
+		/// @brief 推定を指定の再生位置からやり直す
+		/// @param audioPosSec 再生位置
+		/// @param steadySec 再生位置を取得した経過時間
+		/// @remark シーク時や再生開始時に呼び出す。推定した速さは引き継ぐ
+		void reset(double audioPosSec, double steadySec);
+
+		/// @brief 取得した再生位置で推定を補正
+		/// @param audioPosSec 再生位置
+		/// @param steadySec 再生位置を取得した経過時間
+		/// @remark 再生位置が前回から進んでいない場合(ミキサーの更新待ちや再生終了後)は補正に使用せず、推定した速さで進める
+		void update(double audioPosSec, double steadySec);
+
+		/// @brief 指定の経過時間における再生位置の推定値を取得
+		/// @param steadySec 経過時間
+		/// @return 再生位置の推定値(reset()や不連続による再同期の直後を除き、前回の値から減少しない)
+		double now(double steadySec);
+
+		[[nodiscard]]
+		bool isInitialized() const;
+
+		[[nodiscard]]
+		const AudioClockStats& stats() const;
+	};
+}
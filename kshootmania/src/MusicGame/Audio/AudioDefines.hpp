@@ -3,8 +3,13 @@
 namespace MusicGame::Audio
 {
 	// 効果音は35ms早めのタイミングで再生する
+	// (BGMのミキサーで位置を合わせて鳴らせない場合のみ)
 	constexpr double kSELatencySec = 0.035;
 
+	// BGMのミキサーで効果音を鳴らす場合に、出力バッファの長さに加えて先読みして予約しておく時間
+	// (1フレームの間にミキサーの処理が進んでも予約が間に合うようにするため)
+	constexpr double kSEScheduleMarginSec = 0.05;
+
 	// LASER直角音の最大同時再生数
 	// (旧バージョンの譜面では別の値を使う)
 	constexpr uint32 kLaserSlamSEMaxPolyphony = 1U;
@@ -1,4 +1,5 @@
 ﻿#include "BGM.hpp"
+#include "AudioDefines.hpp"
 
 namespace MusicGame::Audio
 {
@@ -30,9 +31,13 @@ namespace MusicGame::Audio
 
 	namespace
 	{
-		constexpr Duration kBlendTime = 5s;
 		constexpr Duration kManualUpdateInterval = 0.005s;
 
+		double SteadyClockSec()
+		{
+			return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
 		void EmplaceAudioEffectToBus(
 			ksmaudio::AudioEffect::AudioEffectBus* pAudioEffectBus,
 			const std::string& name,
@@ -327,6 +332,10 @@ namespace MusicGame::Audio
 		, m_legacyAudioFPStream{ .mode = legacyMode }
 	{
 		m_legacyAudioFPStream.load(chartData, parentPath, volume, offset, playbackSpeed);
+
+		// 効果音をサンプル単位で位置を合わせて鳴らすため、メインのストリームにミキサーを登録する
+		// (SwitchAudioやレガシーf音源でメインのストリームがミュートされても効果音は鳴る)
+		m_stream.enableScheduledSampleMixer();
 	}
 
 	void BGM::update()
@@ -352,13 +361,19 @@ namespace MusicGame::Audio
 				m_legacyAudioFPStream.updateManually();
 				m_manualUpdateStopwatch.restart();
 			}
-			m_timeSec = m_stream.posSec() - m_offset;
 
-			if (m_timeSec + m_offset < m_duration - kBlendTime)
+			// 再生位置はミキサーの更新単位でしか進まないため、経過時間で補間した値を使用する
+			// (再生終了後は再生位置が進まないため、補正せずに経過時間で進める)
+			const double steadySec = SteadyClockSec();
+			const SecondsF streamPosSec = m_stream.posSec();
+			if (streamPosSec < m_duration)
 			{
-				// ストップウォッチの時間を同期
-				m_stopwatch.set(SecondsF{ m_timeSec });
+				m_audioClock.update((streamPosSec - m_offset).count(), steadySec);
 			}
+			m_timeSec = SecondsF{ m_audioClock.now(steadySec) };
+
+			// ストップウォッチの時間を同期
+			m_stopwatch.set(SecondsF{ m_timeSec });
 		}
 		else
 		{
@@ -380,6 +395,7 @@ namespace MusicGame::Audio
 				}
 				m_legacyAudioFPStream.seekPosSec(m_timeSec + m_offset);
 				m_legacyAudioFPStream.play();
+				m_audioClock.reset(m_timeSec.count(), SteadyClockSec());
 				m_isStreamStarted = true;
 			}
 		}
@@ -477,34 +493,22 @@ namespace MusicGame::Audio
 		}
 		m_timeSec = posSec;
 		m_stopwatch.set(posSec);
-	}
-
-	SecondsF BGM::posSec() const
-	{
-		// 開始・終了地点でノーツの動きが一瞬止まるのを防ぐため、最初と最後は再生位置に対してストップウォッチの時間を混ぜる
-		// TODO: うまく効いていないようなので見直す
 		if (m_isStreamStarted)
 		{
-			const SecondsF timeSecWithOffset = m_timeSec + m_offset;
-			if (0s <= timeSecWithOffset && timeSecWithOffset < kBlendTime)
-			{
-				const double lerpRate = timeSecWithOffset / kBlendTime;
-				return Math::Lerp(m_stopwatch.elapsed(), m_timeSec, lerpRate);
-			}
-			else if (m_duration - kBlendTime <= timeSecWithOffset && timeSecWithOffset < m_duration)
-			{
-				const double lerpRate = (timeSecWithOffset - (m_duration - kBlendTime)) / kBlendTime;
-				return Math::Lerp(m_timeSec, m_stopwatch.elapsed(), lerpRate);
-			}
-			else if (m_duration - m_offset <= m_stopwatch.elapsed())
-			{
-				return m_stopwatch.elapsed();
-			}
+			m_audioClock.reset((posSec - m_offset).count(), SteadyClockSec());
 		}
+	}
 
+	SecondsF BGM::posSec() const
+	{
 		return m_timeSec;
 	}
 
+	const AudioClockStats& BGM::audioClockStats() const
+	{
+		return m_audioClock.stats();
+	}
+
 	Duration BGM::duration() const
 	{
 		return m_duration;
@@ -515,6 +519,30 @@ namespace MusicGame::Audio
 		return m_stream.latency();
 	}
 
+	Duration BGM::seLookahead() const
+	{
+		// ミキサーは出力バッファの分だけ再生位置より先の音声を処理するため、それより先にある効果音を予約しておく
+		const Duration scheduleLookahead = latency() + Duration{ kSEScheduleMarginSec };
+		if (m_isStreamStarted && !m_isPaused && m_timeSec + m_offset + scheduleLookahead < m_duration)
+		{
+			return scheduleLookahead;
+		}
+
+		// ミキサーを使用できない場合は即座に鳴らすため、従来通り少し早めのタイミングで鳴らす
+		return Duration{ kSELatencySec };
+	}
+
+	void BGM::playSE(const ksmaudio::Sample& sample, SecondsF timeSec, double volume)
+	{
+		const bool canSchedule = m_isStreamStarted && !m_isPaused && m_timeSec + latency() <= timeSec && timeSec + m_offset < m_duration;
+		if (canSchedule && m_stream.scheduleSample(sample, timeSec + m_offset, volume))
+		{
+			return;
+		}
+
+		sample.play(volume);
+	}
+
 	void BGM::emplaceAudioEffectFX(const std::string& name, const kson::AudioEffectDef& def, const std::unordered_map<std::string, std::map<float, std::string>>& paramChanges, const std::set<float>& updateTriggerTiming)
 	{
 		emplaceAudioEffectImpl(true, name, def, paramChanges, updateTriggerTiming);
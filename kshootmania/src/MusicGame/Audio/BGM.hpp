@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "ksmaudio/ksmaudio.hpp"
 #include "kson/Audio/AudioEffect.hpp"
+#include "AudioClock.hpp"
 
 namespace MusicGame::Audio
 {
@@ -84,6 +85,9 @@ namespace MusicGame::Audio
 		Stopwatch m_stopwatch;
 		Stopwatch m_manualUpdateStopwatch;
 
+		// 再生位置を経過時間で補間して滑らかにするためのクロック
+		AudioClock m_audioClock;
+
 		// SwitchAudio音声のストリーム
 		std::vector<std::unique_ptr<SwitchAudioStream>> m_switchAudioStreamsFX;
 		std::vector<std::unique_ptr<SwitchAudioStream>> m_switchAudioStreamsLaser;
@@ -117,10 +121,26 @@ namespace MusicGame::Audio
 
 		SecondsF posSec() const;
 
+		[[nodiscard]]
+		const AudioClockStats& audioClockStats() const;
+
 		Duration duration() const;
 
 		Duration latency() const;
 
+		/// @brief 効果音をplaySE()に渡すために先読みする時間を取得
+		/// @return 現在の再生位置からこの時間以内にある効果音をplaySE()に渡す
+		[[nodiscard]]
+		Duration seLookahead() const;
+
+		/// @brief 効果音をBGMの再生位置に合わせて鳴らす
+		/// @param sample 効果音
+		/// @param timeSec 鳴らす時間(posSec()と同じ基準)
+		/// @param volume 音量
+		/// @remark BGMの再生中はBGMのミキサーでサンプル単位で位置を合わせて鳴らす。
+		///         ミキサーが既に処理した位置の場合やBGMの再生前後は即座に鳴らす
+		void playSE(const ksmaudio::Sample& sample, SecondsF timeSec, double volume);
+
 		void emplaceAudioEffectFX(
 			const std::string& name,
 			const kson::AudioEffectDef& def,
@@ -78,23 +78,24 @@ namespace MusicGame::Audio
 		}
 	}
 
-	void FXChipSE::update(const kson::ChartData& chartData, const GameStatus& gameStatus)
+	void FXChipSE::update(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm)
 	{
 		if (m_isAutoPlaySE)
 		{
 			// SE自動再生モードの場合、ノーツタイミングで効果音を再生
-			updateByNoteTime(chartData, gameStatus);
+			updateByNoteTime(chartData, gameStatus, bgm);
 		}
 		else
 		{
 			// 判定したタイミングで効果音を再生
-			updateByJudgment(chartData, gameStatus);
+			updateByJudgment(chartData, gameStatus, bgm);
 		}
 	}
 
-	void FXChipSE::updateByNoteTime(const kson::ChartData& chartData, const GameStatus& gameStatus)
+	void FXChipSE::updateByNoteTime(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm)
 	{
-		const double currentTimeSecForAudioProc = gameStatus.currentTimeSecForAudioProc + kSELatencySec;
+		const double currentTimeSecForAudioProc = gameStatus.currentTimeSecForAudioProc + bgm.seLookahead().count();
+		const double audioProcDelaySec = gameStatus.currentTimeSec - gameStatus.currentTimeSecForAudioProc;
 		const auto& chipEvent = chartData.audio.keySound.fx.chipEvent;
 
 		for (const auto& [filename, lanes] : chipEvent)
@@ -131,7 +132,7 @@ namespace MusicGame::Audio
 
 					// キー音を再生
 					const double volume = chipData.vol;
-					m_keySounds.at(filename).play(volume);
+					bgm.playSE(m_keySounds.at(filename), SecondsF{ chipTimeSec + audioProcDelaySec }, volume);
 					m_lastPlayedTimeSecs[laneIdx] = chipTimeSec;
 					m_autoPlaySELastPulses[laneIdx] = chipPulse;
 				}
@@ -139,9 +140,10 @@ namespace MusicGame::Audio
 		}
 	}
 
-	void FXChipSE::updateByJudgment(const kson::ChartData& chartData, const GameStatus& gameStatus)
+	void FXChipSE::updateByJudgment(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm)
 	{
 		const auto& chipEvent = chartData.audio.keySound.fx.chipEvent;
+		const double audioProcDelaySec = gameStatus.currentTimeSec - gameStatus.currentTimeSecForAudioProc;
 
 		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumFXLanesSZ; ++laneIdx)
 		{
@@ -155,7 +157,7 @@ namespace MusicGame::Audio
 				continue;
 			}
 
-			if (judgmentTimeSec > gameStatus.currentTimeSecForAudioProc + kSELatencySec)
+			if (judgmentTimeSec > gameStatus.currentTimeSecForAudioProc + bgm.seLookahead().count())
 			{
 				// 最後に判定したチップのタイミングがまだ先にある場合は何もしない
 				continue;
@@ -183,7 +185,7 @@ namespace MusicGame::Audio
 
 				// キー音を再生
 				const double volume = it->second.vol;
-				m_keySounds.at(filename).play(volume);
+				bgm.playSE(m_keySounds.at(filename), SecondsF{ judgmentTimeSec + audioProcDelaySec }, volume);
 				m_lastPlayedTimeSecs[laneIdx] = judgmentTimeSec;
 				break;
 			}
@@ -4,6 +4,7 @@
 #include "kson/ChartData.hpp"
 #include "kson/Util/TimingUtils.hpp"
 #include "ksmaudio/ksmaudio.hpp"
+#include "BGM.hpp"
 
 namespace MusicGame::Audio
 {
@@ -20,13 +21,13 @@ namespace MusicGame::Audio
 
 		std::map<kson::Pulse, double> m_pulseToSec;
 
-		void updateByNoteTime(const kson::ChartData& chartData, const GameStatus& gameStatus);
+		void updateByNoteTime(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm);
 
-		void updateByJudgment(const kson::ChartData& chartData, const GameStatus& gameStatus);
+		void updateByJudgment(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm);
 
 	public:
 		explicit FXChipSE(const kson::ChartData& chartData, const kson::TimingCache& timingCache, FilePathView parentPath, bool isAutoPlaySE);
 
-		void update(const kson::ChartData& chartData, const GameStatus& gameStatus);
+		void update(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm);
 	};
 }
@@ -87,23 +87,24 @@ namespace MusicGame::Audio
 		}
 	}
 
-	void LaserSlamSE::update(const kson::ChartData& chartData, const GameStatus& gameStatus)
+	void LaserSlamSE::update(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm)
 	{
 		if (m_isAutoPlaySE)
 		{
 			// SE自動再生モードの場合、ノーツタイミングで効果音を再生
-			updateByNoteTime(chartData, gameStatus);
+			updateByNoteTime(chartData, gameStatus, bgm);
 		}
 		else
 		{
 			// 判定したタイミングで効果音を再生
-			updateByJudgment(chartData, gameStatus);
+			updateByJudgment(chartData, gameStatus, bgm);
 		}
 	}
 
-	void LaserSlamSE::updateByNoteTime(const kson::ChartData& chartData, const GameStatus& gameStatus)
+	void LaserSlamSE::updateByNoteTime(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm)
 	{
-		const double currentTimeSecForAudioProc = gameStatus.currentTimeSecForAudioProc + kSELatencySec;
+		const double currentTimeSecForAudioProc = gameStatus.currentTimeSecForAudioProc + bgm.seLookahead().count();
+		const double audioProcDelaySec = gameStatus.currentTimeSec - gameStatus.currentTimeSecForAudioProc;
 
 		const auto fnGetVolumeScaleByNote = [](const kson::ChartData& chartData, std::size_t laneIdx, kson::Pulse slamY) -> double
 		{
@@ -213,7 +214,7 @@ namespace MusicGame::Audio
 					}
 
 					// 直角音を再生
-					pSlamSound->play(volume * volumeScaleByNote);
+					bgm.playSE(*pSlamSound, SecondsF{ slamTimeSec + audioProcDelaySec }, volume * volumeScaleByNote);
 					m_lastPlayedTimeSecs[i] = slamTimeSec;
 					m_autoPlaySELastPulses[i] = slamY;
 				}
@@ -221,8 +222,9 @@ namespace MusicGame::Audio
 		}
 	}
 
-	void LaserSlamSE::updateByJudgment(const kson::ChartData& chartData, const GameStatus& gameStatus)
+	void LaserSlamSE::updateByJudgment(const kson::ChartData& chartData, const GameStatus& gameStatus, BGM& bgm)
 	{
+		const double audioProcDelaySec = gameStatus.currentTimeSec - gameStatus.currentTimeSecForAudioProc;
 		for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
 		{
 			const auto& laneStatus = gameStatus.laserLaneStatus[i];
@@ -233,7 +235,7 @@ namespace MusicGame::Audio
 				continue;
 			}
 
-			if (laneStatus.lastLaserSlamJudgedTimeSec > gameStatus.currentTimeSecForAudioProc + kSELatencySec)
+			if (laneStatus.lastLaserSlamJudgedTimeSec > gameStatus.currentTimeSecForAudioProc + bgm.seLookahead().count())
 			{
 				// 最後に判定した直角LASERのタイミングがまだ先にある場合は何もしない
 				continue;
@@ -311,7 +313,7 @@ namespace MusicGame::Audio
 			}
 
 			// 直角音を再生
-			pSlamSound->play(volume * volumeScaleByNote);
+			bgm.playSE(*pSlamSound, SecondsF{ laneStatus.lastLaserSlamJudgedTimeSec + audioProcDelaySec }, volume * volumeScaleByNote);
 			m_lastPlayedTimeSecs[i] = laneStatus.lastLaserSlamJudgedTimeSec;
 		}
 	}
@@ -0,0 +1,40 @@
+﻿#include "ChartDataLoader.hpp"
+#include "TurnUtil.hpp"
+#include "PlayModeUtil.hpp"
+#include "CompiledChartCache.hpp"
+
+namespace MusicGame
+{
+	kson::ChartData LoadChartDataForPlay(FilePathView chartFilePath, const PlayOption& playOption, kson::TimingCache* pTimingCache)
+	{
+		// カーブ展開・stopの焼き込み済みの譜面データを読み込む
+		// (Turn変換・PlayModeフィルタはカーブ展開の結果に依存しないため、展開後に適用する)
+		kson::CompiledChartData compiledChartData = CompiledChartCache::Load(chartFilePath);
+		kson::ChartData& chartData = compiledChartData.chartData;
+
+		// Turn変換を適用
+		const TurnTable turnTable = MakeTurnTable(playOption.turnMode);
+		ApplyTurnTable(chartData, turnTable);
+
+		// Off/Hideモードフィルタを適用
+		ApplyPlayModeFilter(chartData, playOption);
+
+		// 再生速度に応じてBPMをスケーリング
+		const double playbackSpeed = playOption.playbackSpeed;
+		if (playbackSpeed != 1.0)
+		{
+			for (auto& [pulse, bpm] : chartData.beat.bpm)
+			{
+				bpm *= playbackSpeed;
+			}
+		}
+
+		if (pTimingCache != nullptr)
+		{
+			// キャッシュのTimingCacheはスケーリング前のBPMで構築されているため、等速の場合のみ使用する
+			*pTimingCache = playbackSpeed == 1.0 ? std::move(compiledChartData.timingCache) : kson::CreateTimingCache(chartData.beat);
+		}
+
+		return std::move(chartData);
+	}
+}
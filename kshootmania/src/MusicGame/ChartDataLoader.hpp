@@ -0,0 +1,17 @@
+﻿#pragma once
+#include "kson/ChartData.hpp"
+#include "kson/Util/TimingUtils.hpp"
+#include "PlayOption.hpp"
+
+namespace MusicGame
+{
+	/// @brief プレイ用に譜面データを読み込む
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @param playOption プレイオプション
+	/// @param pTimingCache 譜面データに対応するTimingCacheの格納先(不要な場合はnullptr)
+	/// @return カーブ展開・stopの焼き込み・Turn変換・PlayModeフィルタ・再生速度を適用した譜面データ
+	/// @remark ゲームプレイとリプレイ再生で同一の譜面データを得るため、プレイ用の譜面データは必ずこの関数で読み込むこと
+	/// @remark カーブ展開・stopの焼き込みはプレイオプションに依存しないため、コンパイル済み譜面のキャッシュから読み込む
+	[[nodiscard]]
+	kson::ChartData LoadChartDataForPlay(FilePathView chartFilePath, const PlayOption& playOption, kson::TimingCache* pTimingCache = nullptr);
+}
@@ -0,0 +1,190 @@
+﻿#include "ChartPreparation.hpp"
+#include "ChartDataLoader.hpp"
+#include "Replay/ReplayIO.hpp"
+#include "Common/ThreadPool.hpp"
+
+namespace MusicGame
+{
+	namespace
+	{
+		std::unique_ptr<Audio::BGM> CreateBGM(const kson::ChartData& chartData, FilePathView chartFilePath, const PlayOption& playOption)
+		{
+			const FilePath parentPath = FileSystem::ParentPath(chartFilePath);
+			return std::make_unique<Audio::BGM>(
+				FileSystem::PathAppend(parentPath, Unicode::FromUTF8(chartData.audio.bgm.filename)),
+				chartData.audio.bgm.vol,
+				SecondsF{ (chartData.audio.bgm.offset + playOption.effectiveGlobalOffsetMs()) / 1000.0 / playOption.nonZeroPlaybackSpeed() },
+				Audio::DetermineLegacyAudioFPMode(chartData, parentPath),
+				chartData,
+				parentPath,
+				playOption.playbackSpeed);
+		}
+
+		Optional<uint64> ChartFileHashForRecording(FilePathView chartFilePath, const PlayOption& playOption)
+		{
+			// オートプレイは記録しないため不要
+			if (playOption.isAutoPlay)
+			{
+				return none;
+			}
+			return Replay::ChartFileHash(chartFilePath);
+		}
+	}
+
+	PreparedChart PrepareChart(FilePathView chartFilePath, const PlayOption& playOption)
+	{
+		kson::TimingCache timingCache;
+		kson::ChartData chartData = LoadChartDataForPlay(chartFilePath, playOption, &timingCache);
+		NoteAttributeTable noteAttributeTable(chartData, timingCache, playOption.noteSkin);
+		std::unique_ptr<Audio::BGM> bgm = CreateBGM(chartData, chartFilePath, playOption);
+		return PreparedChart
+		{
+			.chartData = std::move(chartData),
+			.timingCache = std::move(timingCache),
+			.noteAttributeTable = std::move(noteAttributeTable),
+			.bgm = std::move(bgm),
+			.chartFileHash = ChartFileHashForRecording(chartFilePath, playOption),
+		};
+	}
+
+	ChartPreparation::ChartPreparation(FilePathView chartFilePath, const PlayOption& playOption)
+		: m_sharedState(std::make_shared<SharedState>())
+		, m_chartFilePath(chartFilePath)
+		, m_playOption(playOption)
+	{
+		// タスクの完了をSharedStateに記録し、次の段階のタスクを投入する
+		// (例外や中断の場合は後段のタスクを投入せずに完了扱いにする)
+		const auto fnRunStage = [](const std::shared_ptr<SharedState>& sharedState, const CancellationToken& cancellationToken, auto&& fnStage)
+		{
+			std::exception_ptr exception;
+			if (!cancellationToken.isCancelled())
+			{
+				try
+				{
+					fnStage();
+				}
+				catch (...)
+				{
+					exception = std::current_exception();
+				}
+			}
+
+			{
+				std::lock_guard lock(sharedState->mutex);
+				if (exception && !sharedState->exception)
+				{
+					sharedState->exception = exception;
+				}
+				--sharedState->numRemainingTasks;
+			}
+			sharedState->condition.notify_all();
+		};
+
+		ThreadPool::Shared().submit(
+			[sharedState = m_sharedState, cancellationToken = m_cancellationToken, chartFilePath = m_chartFilePath, playOption = m_playOption, fnRunStage]
+			{
+				bool isLoaded = false;
+				fnRunStage(sharedState, cancellationToken, [&]
+				{
+					// 1段階目: 譜面の読み込み(コンパイル済み譜面のキャッシュがあればTimingCacheも併せて読み込まれる)
+					kson::TimingCache timingCache;
+					sharedState->chartData = LoadChartDataForPlay(chartFilePath, playOption, &timingCache);
+					sharedState->timingCache = std::move(timingCache);
+
+					// 後段のタスク数を加算してから投入する(待機側が途中で完了と判定しないよう、このタスクの完了より先に加算する)
+					{
+						std::lock_guard lock(sharedState->mutex);
+						sharedState->numRemainingTasks += 2;
+					}
+					isLoaded = true;
+				});
+				if (!isLoaded)
+				{
+					return;
+				}
+
+				// 2段階目: NoteAttributeTableの構築と、BGMのストリームの作成を並列に実行
+				ThreadPool& threadPool = ThreadPool::Shared();
+				threadPool.submit(
+					[sharedState, cancellationToken, playOption, fnRunStage]
+					{
+						fnRunStage(sharedState, cancellationToken, [&]
+						{
+							NoteAttributeTable noteAttributeTable(sharedState->chartData, *sharedState->timingCache, playOption.noteSkin);
+
+							std::lock_guard lock(sharedState->mutex);
+							sharedState->noteAttributeTable = std::move(noteAttributeTable);
+						});
+					});
+				threadPool.submit(
+					[sharedState, cancellationToken, chartFilePath, playOption, fnRunStage]
+					{
+						fnRunStage(sharedState, cancellationToken, [&]
+						{
+							std::unique_ptr<Audio::BGM> bgm = CreateBGM(sharedState->chartData, chartFilePath, playOption);
+							const Optional<uint64> chartFileHash = ChartFileHashForRecording(chartFilePath, playOption);
+
+							std::lock_guard lock(sharedState->mutex);
+							sharedState->bgm = std::move(bgm);
+							sharedState->chartFileHash = chartFileHash;
+						});
+					});
+			});
+	}
+
+	ChartPreparation::~ChartPreparation()
+	{
+		m_cancellationToken.cancel();
+	}
+
+	bool ChartPreparation::isReady() const
+	{
+		std::lock_guard lock(m_sharedState->mutex);
+		return m_sharedState->numRemainingTasks == 0U;
+	}
+
+	bool ChartPreparation::matches(FilePathView chartFilePath, const PlayOption& playOption) const
+	{
+		// 準備の結果に影響するプレイオプションのみ比較
+		return m_chartFilePath == chartFilePath
+			&& m_playOption.isAutoPlay == playOption.isAutoPlay
+			&& m_playOption.turnMode == playOption.turnMode
+			&& m_playOption.playbackSpeed == playOption.playbackSpeed
+			&& m_playOption.btJudgmentPlayMode == playOption.btJudgmentPlayMode
+			&& m_playOption.fxJudgmentPlayMode == playOption.fxJudgmentPlayMode
+			&& m_playOption.laserJudgmentPlayMode == playOption.laserJudgmentPlayMode
+			&& m_playOption.effectiveGlobalOffsetMs() == playOption.effectiveGlobalOffsetMs()
+			&& m_playOption.noteSkin == playOption.noteSkin;
+	}
+
+	PreparedChart ChartPreparation::take()
+	{
+		if (m_isTaken)
+		{
+			throw Error{ U"ChartPreparation::take() must not be called more than once" };
+		}
+		m_isTaken = true;
+
+		std::unique_lock lock(m_sharedState->mutex);
+		m_sharedState->condition.wait(lock, [&] { return m_sharedState->numRemainingTasks == 0U; });
+
+		if (m_sharedState->exception)
+		{
+			std::rethrow_exception(m_sharedState->exception);
+		}
+
+		if (!m_sharedState->timingCache.has_value() || !m_sharedState->noteAttributeTable.has_value() || m_sharedState->bgm == nullptr)
+		{
+			throw Error{ U"ChartPreparation::take(): Preparation was cancelled" };
+		}
+
+		return PreparedChart
+		{
+			.chartData = std::move(m_sharedState->chartData),
+			.timingCache = std::move(*m_sharedState->timingCache),
+			.noteAttributeTable = std::move(*m_sharedState->noteAttributeTable),
+			.bgm = std::move(m_sharedState->bgm),
+			.chartFileHash = m_sharedState->chartFileHash,
+		};
+	}
+}
@@ -0,0 +1,107 @@
+﻿#pragma once
+#include <mutex>
+#include <condition_variable>
+#include "kson/ChartData.hpp"
+#include "kson/Util/TimingUtils.hpp"
+#include "PlayOption.hpp"
+#include "NoteAttributeTable.hpp"
+#include "Audio/BGM.hpp"
+#include "Common/CancellationToken.hpp"
+
+namespace MusicGame
+{
+	/// @brief プレイ開始前に準備したデータ
+	/// @remark テクスチャ等のグラフィックス関連のリソースはメインスレッドでしか作成できないため、それ以外のデータのみを含む
+	struct PreparedChart
+	{
+		kson::ChartData chartData;
+
+		kson::TimingCache timingCache;
+
+		NoteAttributeTable noteAttributeTable;
+
+		std::unique_ptr<Audio::BGM> bgm;
+
+		// 記録するリプレイに含める譜面ファイルのハッシュ値(オートプレイ時はnone)
+		Optional<uint64> chartFileHash;
+	};
+
+	/// @brief プレイ開始前のデータを準備する(呼び出し元のスレッドで完了まで実行する)
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @param playOption プレイオプション
+	/// @return 準備したデータ
+	[[nodiscard]]
+	PreparedChart PrepareChart(FilePathView chartFilePath, const PlayOption& playOption);
+
+	/// @brief プレイ開始前のデータを共有スレッドプール上で準備する
+	/// @details 譜面の読み込み(コンパイル済み譜面のキャッシュの参照・Turn変換・BPMのスケーリング・TimingCacheの構築)を行った後、
+	///          NoteAttributeTableの構築とBGMのストリームの作成を並列に実行する。
+	///          選曲画面で譜面を決定した時点で開始し、PlayPrepareシーンの表示中に完了させることを想定している。
+	class ChartPreparation
+	{
+	private:
+		struct SharedState
+		{
+			std::mutex mutex;
+
+			std::condition_variable condition;
+
+			// 譜面の読み込み後は変更しない(後段のタスクから参照される)
+			kson::ChartData chartData;
+
+			// 譜面の読み込みと同時に設定し、以降は変更しない
+			Optional<kson::TimingCache> timingCache;
+
+			Optional<NoteAttributeTable> noteAttributeTable;
+
+			std::unique_ptr<Audio::BGM> bgm;
+
+			Optional<uint64> chartFileHash;
+
+			// 未完了のタスク数(読み込み後に後段のタスク数が加算される)
+			std::size_t numRemainingTasks = 1;
+
+			std::exception_ptr exception;
+		};
+
+		// Note: タスクの実行中にChartPreparationが破棄されても問題ないよう、タスク側とshared_ptrで共有する
+		std::shared_ptr<SharedState> m_sharedState;
+
+		CancellationToken m_cancellationToken;
+
+		const FilePath m_chartFilePath;
+
+		const PlayOption m_playOption;
+
+		bool m_isTaken = false;
+
+	public:
+		/// @brief コンストラクタ(準備を開始する)
+		/// @param chartFilePath 譜面ファイルのパス
+		/// @param playOption プレイオプション
+		ChartPreparation(FilePathView chartFilePath, const PlayOption& playOption);
+
+		/// @brief デストラクタ
+		/// @remark 未完了の場合は中断を要求する(完了は待たない)
+		~ChartPreparation();
+
+		ChartPreparation(const ChartPreparation&) = delete;
+
+		ChartPreparation& operator=(const ChartPreparation&) = delete;
+
+		/// @brief 準備が完了しているかどうか
+		[[nodiscard]]
+		bool isReady() const;
+
+		/// @brief 指定の譜面・プレイオプションに対する準備かどうか
+		/// @remark 準備の結果に影響しないプレイオプション(ハイスピード設定など)は比較しない
+		[[nodiscard]]
+		bool matches(FilePathView chartFilePath, const PlayOption& playOption) const;
+
+		/// @brief 準備が完了するまで待機して結果を取り出す
+		/// @return 準備したデータ
+		/// @remark 1回のみ呼び出し可能。準備中に例外が発生した場合はここで再送出する
+		[[nodiscard]]
+		PreparedChart take();
+	};
+}
@@ -0,0 +1,86 @@
+﻿#include "CompiledChartCache.hpp"
+#include "Common/FsUtils.hpp"
+#include "kson/kson.hpp"
+
+namespace MusicGame::CompiledChartCache
+{
+	namespace
+	{
+		FilePath CacheFilePath(uint64 sourceHash)
+		{
+			return FileSystem::PathAppend(CacheDirectoryPath(), U"{:016X}.kson.bin"_fmt(sourceHash));
+		}
+
+		Optional<kson::CompiledChartData> LoadCacheFile(FilePathView cacheFilePath, uint64 sourceHash)
+		{
+			if (!FileSystem::IsFile(cacheFilePath))
+			{
+				return none;
+			}
+
+			MemoryMappedFileView file{ cacheFilePath };
+			if (!file)
+			{
+				return none;
+			}
+
+			const auto mapped = file.mapAll();
+			std::optional<kson::CompiledChartData> compiledChartData = kson::LoadKsonBinaryChartData(mapped.data, mapped.size, sourceHash);
+			if (!compiledChartData.has_value())
+			{
+				// バージョンが異なる・書き込み途中で終了した等の場合は作り直す
+				Logger << U"[ksm info] CompiledChartCache::Load: Cache file is outdated or corrupted, rebuilding (path:'{}')"_fmt(cacheFilePath);
+				return none;
+			}
+			return std::move(*compiledChartData);
+		}
+
+		void WriteCacheFile(FilePathView cacheFilePath, const kson::CompiledChartData& compiledChartData, uint64 sourceHash)
+		{
+			const FilePath cacheDirectoryPath = CacheDirectoryPath();
+			if (!FileSystem::Exists(cacheDirectoryPath))
+			{
+				FileSystem::CreateDirectories(cacheDirectoryPath);
+			}
+
+			// Note: 一時ファイルへ書き込んでからリネームされるため、別スレッドで同じ譜面を読み込んでいても壊れたファイルを読むことはない
+			const kson::ErrorType error = kson::SaveKsonBinaryChartData(Unicode::ToUTF8(cacheFilePath), compiledChartData, sourceHash);
+			if (error != kson::ErrorType::None)
+			{
+				Logger << U"[ksm warning] CompiledChartCache::Load: Could not write cache file (path:'{}', error:{})"_fmt(cacheFilePath, Unicode::FromUTF8(kson::GetErrorString(error)));
+			}
+		}
+	}
+
+	FilePath CacheDirectoryPath()
+	{
+		return FileSystem::PathAppend(FsUtils::CacheDirectoryPath(), U"chart");
+	}
+
+	kson::CompiledChartData Load(FilePathView chartFilePath)
+	{
+		MemoryMappedFileView chartFile{ chartFilePath };
+		if (!chartFile)
+		{
+			// 開けない場合もエラー内容を譜面データに含めて返すため、通常の読み込みを行う
+			return kson::CompileChartData(kson::LoadKSHChartData(chartFilePath.narrow()));
+		}
+
+		const auto mappedChart = chartFile.mapAll();
+		const uint64 sourceHash = kson::ChartContentHash(mappedChart.data, mappedChart.size);
+		const FilePath cacheFilePath = CacheFilePath(sourceHash);
+		if (Optional<kson::CompiledChartData> cached = LoadCacheFile(cacheFilePath, sourceHash))
+		{
+			return std::move(*cached);
+		}
+
+		// ハッシュ値と解析結果が食い違わないよう、ハッシュ値を求めたのと同じ内容を解析する
+		std::istringstream iss{ std::string{ static_cast<const char*>(mappedChart.data), mappedChart.size } };
+		kson::CompiledChartData compiledChartData = kson::CompileChartData(kson::LoadKSHChartData(iss));
+		if (compiledChartData.chartData.error == kson::ErrorType::None)
+		{
+			WriteCacheFile(cacheFilePath, compiledChartData, sourceHash);
+		}
+		return compiledChartData;
+	}
+}
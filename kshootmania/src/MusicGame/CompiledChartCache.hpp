@@ -0,0 +1,19 @@
+﻿#pragma once
+#include "kson/IO/KsonBinaryIO.hpp"
+
+namespace MusicGame::CompiledChartCache
+{
+	/// @brief コンパイル済み譜面のキャッシュの保存先フォルダのフルパスを取得
+	/// @return フルパス
+	[[nodiscard]]
+	FilePath CacheDirectoryPath();
+
+	/// @brief 譜面データをコンパイル済み(カーブ展開・stopの焼き込み・TimingCache構築済み)の状態で読み込む
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @return コンパイル済みの譜面データ
+	/// @details 譜面ファイルの内容のハッシュ値をキーとしてキャッシュを参照し、存在すればメモリマップして読み込む。
+	///          存在しない場合は譜面ファイルを解析してコンパイルし、キャッシュを書き込む。
+	/// @remark ワーカースレッドから呼び出してもよい
+	[[nodiscard]]
+	kson::CompiledChartData Load(FilePathView chartFilePath);
+}
@@ -1,9 +1,10 @@
 ﻿#include "GameMain.hpp"
 #include "GameDefines.hpp"
-#include "TurnUtil.hpp"
-#include "PlayModeUtil.hpp"
 #include "kson/kson.hpp"
 #include "Input/PlatformKey.hpp"
+#include "Replay/ReplayIO.hpp"
+#include "Common/FrameProfiler.hpp"
+#include "Input/ButtonEvent/KeyboardButtonStateSource.hpp"
 
 namespace MusicGame
 {
@@ -27,75 +28,53 @@ namespace MusicGame
 			return chartData.beat.bpm.contains(0) ? chartData.beat.bpm.at(0) : kDefaultBPM;
 		}
 
-		// 譜面データを読み込み、Turn変換とPlayModeフィルタを適用
-		kson::ChartData LoadChartDataWithTurn(const GameCreateInfo& createInfo)
+		Optional<Replay::ReplayData> CreateReplayDataForRecording(const GameCreateInfo& createInfo, const Optional<uint64>& chartFileHash)
 		{
-			auto chartData = kson::LoadKSHChartData(createInfo.chartFilePath.narrow());
-
-			// Turn変換を適用
-			const TurnTable turnTable = MakeTurnTable(createInfo.playOption.turnMode);
-			ApplyTurnTable(chartData, turnTable);
-
-			// Off/Hideモードフィルタを適用
-			ApplyPlayModeFilter(chartData, createInfo.playOption);
-
-			// レーザーを非カーブのみのグラフへ展開
-			for (auto& lane : chartData.note.laser)
+			// オートプレイは記録しない
+			if (createInfo.playOption.isAutoPlay || !chartFileHash.has_value())
 			{
-				for (auto& [y, section] : lane)
-				{
-					section = kson::ExpandCurveSegments(section, kson::kCurveSubdivisionInterval);
-				}
+				return none;
 			}
 
-			// scroll_speedを非カーブのみのグラフへ展開
-			chartData.beat.scrollSpeed = kson::ExpandCurveSegments(chartData.beat.scrollSpeed, kson::kCurveSubdivisionInterval);
+			return Replay::ReplayData
+			{
+				.chartFileHash = *chartFileHash,
+				.playOption = createInfo.playOption,
+				.courseContinuation = createInfo.courseContinuation,
+			};
+		}
 
-			// stopをscroll_speedへ焼き込む
-			chartData.beat.scrollSpeed = kson::BakeStopIntoScrollSpeed(chartData.beat.scrollSpeed, chartData.beat.stop);
+		std::unique_ptr<ButtonEventThread> CreateButtonEventThread(const PlayOption& playOption)
+		{
+			// BT・FXの判定にボタン入力を使用しない場合は不要
+			if (playOption.effectiveBtJudgmentPlayMode() != JudgmentPlayMode::kOn && playOption.effectiveFxJudgmentPlayMode() != JudgmentPlayMode::kOn)
+			{
+				return nullptr;
+			}
 
-			// 再生速度に応じてBPMをスケーリング
-			const double playbackSpeed = createInfo.playOption.playbackSpeed;
-			if (playbackSpeed != 1.0)
+			std::unique_ptr<IButtonStateSource> source = CreateKeyboardButtonStateSource();
+			if (source == nullptr)
 			{
-				for (auto& [pulse, bpm] : chartData.beat.bpm)
-				{
-					bpm *= playbackSpeed;
-				}
+				// 入力スレッドに未対応のプラットフォームの場合は、フレームの時刻で判定する
+				return nullptr;
 			}
 
-			return chartData;
+			return std::make_unique<ButtonEventThread>(std::move(source));
 		}
 	}
 
 	void GameMain::updateStatus()
 	{
+		const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kGameUpdateStatus };
+
 		// 曲の音声の更新
-		m_bgm.update();
+		m_bgm->update();
 
 		// 再生時間と現在のBPMを取得
 		// TODO: SecondsFに統一
-		const double currentTimeSec = m_bgm.posSec().count();
-		const double inputDelaySec = m_playOption.effectiveInputDelayMs() / 1000.0;
-		const double laserInputDelaySec = m_playOption.effectiveLaserInputDelayMs() / 1000.0;
-		const double audioProcDelaySec = m_playOption.effectiveAudioProcDelayMs() / 1000.0;
-		const double currentTimeSecForButtonJudgment = currentTimeSec - inputDelaySec;
-		const double currentTimeSecForLaserJudgment = currentTimeSec - inputDelaySec - laserInputDelaySec;
-		const double currentTimeSecForAudioProc = currentTimeSec - audioProcDelaySec;
-		const kson::Pulse currentPulse = kson::SecToPulse(currentTimeSec, m_chartData.beat, m_timingCache);
-		const double currentPulseDouble = kson::SecToPulseDouble(currentTimeSec, m_chartData.beat, m_timingCache);
-		const kson::Pulse currentPulseForButtonJudgment = kson::SecToPulse(currentTimeSecForButtonJudgment, m_chartData.beat, m_timingCache);
-		const kson::Pulse currentPulseForLaserJudgment = kson::SecToPulse(currentTimeSecForLaserJudgment, m_chartData.beat, m_timingCache);
-		const double currentBPM = kson::TempoAt(currentPulse, m_chartData.beat);
-		m_gameStatus.currentTimeSec = currentTimeSec;
-		m_gameStatus.currentTimeSecForButtonJudgment = currentTimeSecForButtonJudgment;
-		m_gameStatus.currentTimeSecForLaserJudgment = currentTimeSecForLaserJudgment;
-		m_gameStatus.currentTimeSecForAudioProc = currentTimeSecForAudioProc;
-		m_gameStatus.currentPulse = currentPulse;
-		m_gameStatus.currentPulseDouble = currentPulseDouble;
-		m_gameStatus.currentPulseForButtonJudgment = currentPulseForButtonJudgment;
-		m_gameStatus.currentPulseForLaserJudgment = currentPulseForLaserJudgment;
-		m_gameStatus.currentBPM = currentBPM;
+		const double currentTimeSec = m_bgm->posSec().count();
+		const auto currentSteadyTime = std::chrono::steady_clock::now();
+		m_gameStatusTimer.update(currentTimeSec, m_gameStatus);
 
 		// 視点変更を更新
 		// (CamStatusにノーツイベントによる値が相対的に反映されるので、判定の更新より先に実行する必要がある)
@@ -107,34 +86,36 @@ namespace MusicGame
 		m_viewStatus.tiltRadians = m_highwayTilt.radians();
 
 		// 判定の更新
-		m_judgmentMain.update(m_chartData, m_gameStatus, m_viewStatus);
-
-		// HARDゲージ/コースモード落ち判定
-		if (!m_gameStatus.playFinishStatus.has_value() &&
-			(m_playOption.gaugeType == GaugeType::kHardGauge || m_playOption.gameMode == GameMode::kCourseMode) &&
-			m_viewStatus.gaugePercentageInt <= kGaugePercentageThresholdHard)
+		// (リプレイで同じ判定を再現できるよう、判定には入力と再生時間以外を与えない)
+		Judgment::JudgmentInput judgmentInput = Judgment::CaptureJudgmentInput(m_playOption.effectiveLaserJudgmentPlayMode());
+		if (m_buttonEventThread != nullptr)
 		{
-			m_gameStatus.playFinishStatus = PlayFinishStatus
+			// 入力スレッドで検出した押下時刻を付与
+			ButtonEvent event;
+			while (m_buttonEventThread->tryPop(&event))
 			{
-				.finishTimeSec = currentTimeSec,
-				.achievement = Achievement::kNone,
-				.isHardFailed = IsHardFailedYN::Yes,
-			};
-
-			// HARD落ち効果音を再生
-			m_hardFailedSound.play();
-
-			// HARD落ち以降の入力は無視
-			m_judgmentMain.lockForExit();
+				m_judgmentInputTimestamper.addEvent(event);
+			}
+			m_judgmentInputTimestamper.apply(judgmentInput, currentSteadyTime);
 		}
-
-		if (!m_gameStatus.playFinishStatus.has_value() && m_judgmentMain.isFinished())
 		{
-			m_gameStatus.playFinishStatus = PlayFinishStatus
+			const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kGameJudgment };
+			m_judgmentMain.update(m_chartData, judgmentInput, m_gameStatus, m_viewStatus);
+		}
+		if (m_replayData.has_value())
+		{
+			m_replayData->frames.push_back(Replay::ReplayFrame
 			{
-				.finishTimeSec = currentTimeSec,
-				.achievement = m_judgmentMain.playResult(m_chartData, m_timingCache, currentTimeSec, IsHardFailedYN::No).achievement(),
-			};
+				.currentTimeSec = currentTimeSec,
+				.input = judgmentInput,
+			});
+		}
+
+		// HARDゲージ/コースモード落ち判定・プレイ終了判定
+		if (m_judgmentMain.updatePlayFinishStatus(m_chartData, m_timingCache, m_gameStatus, m_viewStatus))
+		{
+			// HARD落ち効果音を再生
+			m_hardFailedSound.play();
 		}
 	}
 
@@ -151,27 +132,37 @@ namespace MusicGame
 	}
 
 	GameMain::GameMain(const GameCreateInfo& createInfo)
+		: GameMain(createInfo, PrepareChart(createInfo.chartFilePath, createInfo.playOption))
+	{
+	}
+
+	GameMain::GameMain(const GameCreateInfo& createInfo, PreparedChart&& preparedChart)
 		: m_chartFilePath(createInfo.chartFilePath)
 		, m_parentPath(FileSystem::ParentPath(createInfo.chartFilePath))
-		, m_chartData(LoadChartDataWithTurn(createInfo))
-		, m_timingCache(kson::CreateTimingCache(m_chartData.beat))
+		, m_chartData(std::move(preparedChart.chartData))
+		, m_timingCache(std::move(preparedChart.timingCache))
+		, m_noteAttributeTable(std::move(preparedChart.noteAttributeTable))
+		, m_gameStatusTimer(m_timingCache, createInfo.playOption)
 		, m_playOption(createInfo.playOption)
 		, m_judgmentMain(
 			m_chartData,
 			m_timingCache,
+			m_noteAttributeTable,
 			createInfo.playOption,
 			createInfo.courseContinuation,
 			createInfo.playOption.gameMode)
+		, m_buttonEventThread(CreateButtonEventThread(createInfo.playOption))
 		, m_camSystem(m_chartData)
 		, m_highwayScroll(m_chartData)
-		, m_bgm(FileSystem::PathAppend(m_parentPath, Unicode::FromUTF8(m_chartData.audio.bgm.filename)), m_chartData.audio.bgm.vol, SecondsF{ (m_chartData.audio.bgm.offset + createInfo.playOption.effectiveGlobalOffsetMs()) / 1000.0 / createInfo.playOption.nonZeroPlaybackSpeed() }, Audio::DetermineLegacyAudioFPMode(m_chartData, m_parentPath), m_chartData, m_parentPath, createInfo.playOption.playbackSpeed)
+		, m_bgm(std::move(preparedChart.bgm))
 		, m_assistTick(createInfo.assistTickMode)
 		, m_laserSlamSE(m_chartData, m_timingCache, m_parentPath, createInfo.playOption.isAutoPlaySE)
 		, m_fxChipSE(m_chartData, m_timingCache, m_parentPath, createInfo.playOption.isAutoPlaySE)
 		, m_hardFailedSound("se/play_hardfailed.wav")
-		, m_audioEffectMain(m_bgm, m_chartData, m_timingCache, m_parentPath, createInfo.playOption.effectiveAudioProcDelayMs() / 1000.0)
+		, m_audioEffectMain(*m_bgm, m_chartData, m_timingCache, m_parentPath, createInfo.playOption.effectiveAudioProcDelayMs() / 1000.0)
 		, m_hispeedSettingMenu(createInfo.playOption.availableHispeedTypes, createInfo.playOption.hispeedSetting, kson::GetEffectiveStdBPM(m_chartData), GetInitialBPM(m_chartData))
-		, m_graphicsMain(m_chartData, m_parentPath, createInfo.playOption)
+		, m_graphicsMain(m_chartData, m_noteAttributeTable, m_parentPath, createInfo.playOption)
+		, m_replayData(CreateReplayDataForRecording(createInfo, preparedChart.chartFileHash))
 	{
 	}
 
@@ -179,8 +170,8 @@ namespace MusicGame
 	{
 		const double globalOffsetSec = m_playOption.effectiveGlobalOffsetMs() / 1000.0 / m_playOption.nonZeroPlaybackSpeed();
 		m_graphicsMain.prepareMovie(globalOffsetSec);
-		m_bgm.seekPosSec(-TimeSecBeforeStart(m_graphicsMain.hasMovie()));
-		m_bgm.play();
+		m_bgm->seekPosSec(-TimeSecBeforeStart(m_graphicsMain.hasMovie()));
+		m_bgm->play();
 	}
 
 	GameMain::StartFadeOutYN GameMain::update()
@@ -206,20 +197,28 @@ namespace MusicGame
 			const auto& laneStatus = m_gameStatus.laserLaneStatus[i];
 			laserIsOnOrNone[i] = !laneStatus.noteCursorX.has_value() || laneStatus.isCursorInCriticalJudgmentRange();
 		}
-		m_audioEffectMain.update(m_bgm, m_chartData, m_timingCache, {
-			.longFXPressed = longFXPressed,
-			.laserIsOnOrNone = laserIsOnOrNone,
-		}, m_gameStatus.currentPulse);
+		{
+			const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kGameAudioEffect };
+			m_audioEffectMain.update(*m_bgm, m_chartData, m_timingCache, {
+				.longFXPressed = longFXPressed,
+				.laserIsOnOrNone = laserIsOnOrNone,
+			}, m_gameStatus.currentPulse);
+		}
 
 		// 効果音の更新
 		// TODO: SecondsFに統一
-		const double currentTimeSec = m_bgm.posSec().count();
-		m_assistTick.update(m_chartData, m_timingCache, currentTimeSec);
-		m_laserSlamSE.update(m_chartData, m_gameStatus);
-		m_fxChipSE.update(m_chartData, m_gameStatus);
+		{
+			const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kGameSE };
+			m_assistTick.update(m_chartData, m_timingCache, *m_bgm);
+			m_laserSlamSE.update(m_chartData, m_gameStatus, *m_bgm);
+			m_fxChipSE.update(m_chartData, m_gameStatus, *m_bgm);
+		}
 
 		// グラフィックの更新
-		m_graphicsMain.update(m_gameStatus, m_viewStatus, m_timingCache);
+		{
+			const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kGameGraphicsUpdate };
+			m_graphicsMain.update(m_gameStatus, m_viewStatus, m_timingCache);
+		}
 
 		m_isFirstUpdate = false;
 
@@ -233,17 +232,31 @@ namespace MusicGame
 		const Scroll::HighwayScrollContext highwayScrollContext(&m_highwayScroll, &m_chartData.beat, &m_timingCache, &m_gameStatus);
 
 		// 描画実行
-		m_graphicsMain.draw(m_chartData, m_timingCache, m_gameStatus, m_viewStatus, highwayScrollContext, m_bgm.duration());
+		const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kGameGraphicsDraw };
+		m_graphicsMain.draw(m_chartData, m_timingCache, m_gameStatus, m_viewStatus, highwayScrollContext, m_bgm->duration());
 	}
 
 	void GameMain::lockForExit()
 	{
 		m_judgmentMain.lockForExit();
+
+		// リプレイ再生時に同じフレームでロックされるよう記録
+		if (m_replayData.has_value() && !m_replayData->frames.empty())
+		{
+			m_replayData->frames.back().isLockedForExit = true;
+		}
 	}
 
 	void GameMain::terminate()
 	{
 		m_hispeedSettingMenu.saveToConfigIni();
+
+		const auto& audioClockStats = m_bgm->audioClockStats();
+		Logger << U"[ksm info] Audio clock: drift={:.1f}ppm, rmsError={:.2f}ms, maxError={:.2f}ms, resyncs={}"_fmt(
+			audioClockStats.driftPPM(),
+			audioClockStats.rmsErrorSec() * 1000,
+			audioClockStats.maxAbsErrorSec * 1000,
+			audioClockStats.numResyncs);
 	}
 
 	FilePathView GameMain::chartFilePath() const
@@ -262,9 +275,14 @@ namespace MusicGame
 		return m_judgmentMain.playResult(m_chartData, m_timingCache, m_gameStatus.currentTimeSec, isHardFailed);
 	}
 
+	const Optional<Replay::ReplayData>& GameMain::replayData() const
+	{
+		return m_replayData;
+	}
+
 	void GameMain::startBGMFadeOut(Duration duration)
 	{
-		m_bgm.setFadeOut(duration);
+		m_bgm->setFadeOut(duration);
 	}
 
 	void GameMain::processPlaybackControl()
@@ -276,12 +294,12 @@ namespace MusicGame
 		{
 			if (m_isPaused)
 			{
-				m_bgm.play();
+				m_bgm->play();
 				m_isPaused = false;
 			}
 			else
 			{
-				m_bgm.pause();
+				m_bgm->pause();
 				m_isPaused = true;
 			}
 			m_gameStatus.isPaused = m_isPaused;
@@ -292,9 +310,9 @@ namespace MusicGame
 		{
 			if (m_fastForwardStopwatch.ms() >= 60)
 			{
-				const auto currentPos = m_bgm.posSec();
+				const auto currentPos = m_bgm->posSec();
 				const auto newPos = currentPos + SecondsF{ 1.0 };
-				m_bgm.seekPosSec(newPos);
+				m_bgm->seekPosSec(newPos);
 				m_graphicsMain.seekMoviePosSec(newPos);
 				m_fastForwardStopwatch.restart();
 			}
@@ -3,7 +3,12 @@
 #include "GameStatus.hpp"
 #include "PlayOption.hpp"
 #include "PlayResult.hpp"
+#include "NoteAttributeTable.hpp"
+#include "ChartPreparation.hpp"
+#include "GameStatusTimer.hpp"
 #include "Judgment/JudgmentMain.hpp"
+#include "Judgment/JudgmentInputTimestamper.hpp"
+#include "Input/ButtonEvent/ButtonEventThread.hpp"
 #include "Camera/HighwayTilt.hpp"
 #include "Scroll/HispeedSetting.hpp"
 #include "Scroll/HighwayScroll.hpp"
@@ -14,6 +19,7 @@
 #include "Audio/AudioEffectMain.hpp"
 #include "UI/HispeedSettingMenu.hpp"
 #include "Graphics/GraphicsMain.hpp"
+#include "Replay/ReplayData.hpp"
 #include "kson/Util/TimingUtils.hpp"
 
 namespace MusicGame
@@ -47,12 +53,22 @@ namespace MusicGame
 		const kson::ChartData m_chartData;
 		const kson::TimingCache m_timingCache;
 
+		// 描画・判定用に事前計算したノーツの属性
+		const NoteAttributeTable m_noteAttributeTable;
+
+		// 再生位置からGameStatusの時間・Pulse値を求める
+		GameStatusTimer m_gameStatusTimer;
+
 		// プレイオプション
 		const PlayOption m_playOption;
 
 		// 判定
 		Judgment::JudgmentMain m_judgmentMain;
 
+		// 入力スレッド(押下時刻の取得用。未対応のプラットフォームやオートプレイ時はnullptr)
+		std::unique_ptr<ButtonEventThread> m_buttonEventThread;
+		Judgment::JudgmentInputTimestamper m_judgmentInputTimestamper;
+
 		// 視点制御
 		Camera::HighwayTilt m_highwayTilt; // 傾き
 		Camera::CamSystem m_camSystem; // 視点変更
@@ -61,7 +77,7 @@ namespace MusicGame
 		Scroll::HighwayScroll m_highwayScroll;
 
 		// 音声
-		Audio::BGM m_bgm;
+		std::unique_ptr<Audio::BGM> m_bgm; // ワーカースレッドで作成したものを受け取るためポインタで保持
 		Audio::AssistTick m_assistTick;
 		Audio::LaserSlamSE m_laserSlamSE;
 		Audio::FXChipSE m_fxChipSE;
@@ -81,6 +97,9 @@ namespace MusicGame
 		ViewStatus m_viewStatus;
 		bool m_isFinishedPrev = false;
 
+		// 記録中のリプレイ(オートプレイ時はnone)
+		Optional<Replay::ReplayData> m_replayData;
+
 		// 再生制御
 		bool m_isPaused = false;
 		Stopwatch m_fastForwardStopwatch;
@@ -92,8 +111,16 @@ namespace MusicGame
 		void processPlaybackControl();
 
 	public:
+		/// @brief コンストラクタ
+		/// @param createInfo 作成情報
+		/// @remark 譜面の読み込み等の準備を呼び出し元のスレッドで行う
 		explicit GameMain(const GameCreateInfo& createInfo);
 
+		/// @brief 準備済みのデータを使用するコンストラクタ
+		/// @param createInfo 作成情報
+		/// @param preparedChart PrepareChart()またはChartPreparation::take()で準備したデータ
+		GameMain(const GameCreateInfo& createInfo, PreparedChart&& preparedChart);
+
 		void start();
 
 		StartFadeOutYN update();
@@ -111,6 +138,10 @@ namespace MusicGame
 
 		PlayResult playResult() const;
 
+		/// @brief 現在までに記録したリプレイを取得
+		/// @return リプレイデータ(オートプレイ時はnone)
+		const Optional<Replay::ReplayData>& replayData() const;
+
 		void startBGMFadeOut(Duration duration);
 	};
 }
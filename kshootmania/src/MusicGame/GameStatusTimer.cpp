@@ -0,0 +1,35 @@
+﻿#include "GameStatusTimer.hpp"
+
+namespace MusicGame
+{
+	GameStatusTimer::GameStatusTimer(const kson::TimingCache& timingCache, const PlayOption& playOption)
+		: m_timingCursor(timingCache)
+		, m_timingCursorForButtonJudgment(timingCache)
+		, m_timingCursorForLaserJudgment(timingCache)
+		, m_inputDelaySec(playOption.effectiveInputDelayMs() / 1000.0)
+		, m_laserInputDelaySec(playOption.effectiveLaserInputDelayMs() / 1000.0)
+		, m_audioProcDelaySec(playOption.effectiveAudioProcDelayMs() / 1000.0)
+	{
+	}
+
+	void GameStatusTimer::update(double currentTimeSec, GameStatus& gameStatusRef)
+	{
+		const double currentTimeSecForButtonJudgment = currentTimeSec - m_inputDelaySec;
+		const double currentTimeSecForLaserJudgment = currentTimeSec - m_inputDelaySec - m_laserInputDelaySec;
+		const double currentTimeSecForAudioProc = currentTimeSec - m_audioProcDelaySec;
+		const kson::Pulse currentPulse = m_timingCursor.secToPulse(currentTimeSec);
+		const double currentPulseDouble = m_timingCursor.secToPulseDouble(currentTimeSec);
+		const kson::Pulse currentPulseForButtonJudgment = m_timingCursorForButtonJudgment.secToPulse(currentTimeSecForButtonJudgment);
+		const kson::Pulse currentPulseForLaserJudgment = m_timingCursorForLaserJudgment.secToPulse(currentTimeSecForLaserJudgment);
+		const double currentBPM = m_timingCursor.tempoAt(currentPulse);
+		gameStatusRef.currentTimeSec = currentTimeSec;
+		gameStatusRef.currentTimeSecForButtonJudgment = currentTimeSecForButtonJudgment;
+		gameStatusRef.currentTimeSecForLaserJudgment = currentTimeSecForLaserJudgment;
+		gameStatusRef.currentTimeSecForAudioProc = currentTimeSecForAudioProc;
+		gameStatusRef.currentPulse = currentPulse;
+		gameStatusRef.currentPulseDouble = currentPulseDouble;
+		gameStatusRef.currentPulseForButtonJudgment = currentPulseForButtonJudgment;
+		gameStatusRef.currentPulseForLaserJudgment = currentPulseForLaserJudgment;
+		gameStatusRef.currentBPM = currentBPM;
+	}
+}
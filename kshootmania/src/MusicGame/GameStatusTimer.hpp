@@ -0,0 +1,33 @@
+﻿#pragma once
+#include "GameStatus.hpp"
+#include "PlayOption.hpp"
+#include "kson/Util/TimingUtils.hpp"
+
+namespace MusicGame
+{
+	/// @brief 再生時間からGameStatusの時間・Pulse値を更新する
+	/// @note ゲームプレイとリプレイ再生で同じ計算を行うため、判定に関与する時間の計算はこのクラスに集約する
+	class GameStatusTimer
+	{
+	private:
+		// 再生位置から現在のPulseを求めるためのカーソル
+		// (時間が前進する場合は償却O(1)で求まるため、判定用に遅延させた時間ごとに別のカーソルを持つ)
+		kson::TimingCursor m_timingCursor;
+		kson::TimingCursor m_timingCursorForButtonJudgment;
+		kson::TimingCursor m_timingCursorForLaserJudgment;
+
+		const double m_inputDelaySec;
+		const double m_laserInputDelaySec;
+		const double m_audioProcDelaySec;
+
+	public:
+		/// @param timingCache タイミングキャッシュ(このインスタンスより長く生存すること)
+		/// @param playOption プレイオプション
+		GameStatusTimer(const kson::TimingCache& timingCache, const PlayOption& playOption);
+
+		/// @brief GameStatusの時間関連の値を更新
+		/// @param currentTimeSec 現在の再生時間(秒)
+		/// @param gameStatusRef GameStatusへの参照
+		void update(double currentTimeSec, GameStatus& gameStatusRef);
+	};
+}
@@ -198,13 +198,14 @@ namespace MusicGame::Graphics
 		}
 	}
 
-	GraphicsMain::GraphicsMain(const kson::ChartData& chartData, FilePathView parentPath, const PlayOption& playOption)
+	GraphicsMain::GraphicsMain(const kson::ChartData& chartData, const NoteAttributeTable& noteAttributeTable, FilePathView parentPath, const PlayOption& playOption)
 		: m_camera(Scene::Size(), kCameraVerticalFOV, kCameraPosition, kCameraLookAt)
 		, m_bgBillboardMesh(MeshData::Billboard())
 		, m_bgTextures(LoadBGTextures(chartData, parentPath))
 		, m_bgTransform(m_camera.billboard(kBGBillboardPosition, kBGBillboardSize))
 		, m_layerFrameTextures(SplitLayerTexture(LayerFilePath(chartData, parentPath)))
 		, m_layerTransform(m_camera.billboard(kLayerBillboardPosition, kLayerBillboardSize))
+		, m_highway3DGraphics(chartData, noteAttributeTable)
 		, m_jdgoverlay3DGraphics(m_camera)
 		, m_songInfoPanel(chartData, parentPath)
 		, m_gaugePanel(ToGaugeCalcType(playOption.gaugeType, playOption.gameMode))
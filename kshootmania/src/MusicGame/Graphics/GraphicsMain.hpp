@@ -53,7 +53,7 @@ namespace MusicGame::Graphics
 		void drawLayer(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus) const;
 
 	public:
-		explicit GraphicsMain(const kson::ChartData& chartData, FilePathView parentPath, const PlayOption& playOption);
+		explicit GraphicsMain(const kson::ChartData& chartData, const NoteAttributeTable& noteAttributeTable, FilePathView parentPath, const PlayOption& playOption);
 
 		void prepareMovie(double globalOffsetSec);
 
@@ -48,9 +48,11 @@ namespace MusicGame::Graphics
 		}
 	}
 
-	Highway3DGraphics::Highway3DGraphics()
+	Highway3DGraphics::Highway3DGraphics(const kson::ChartData& chartData, const NoteAttributeTable& noteAttributeTable)
 		: m_shineEffectTexture(TextureAsset(kShineEffectTextureFilename))
 		, m_barLineTexture(TextureAsset(kBarLineTextureFilename))
+		, m_buttonNoteGraphics(chartData, noteAttributeTable)
+		, m_laserNoteGraphics(chartData)
 		, m_meshData(MeshData::Grid({ 0.0, 0.0, 0.0 }, kHighwayPlaneSizeWide, 1, 1, { 1.0f - kUVShrinkX, 1.0f - kUVShrinkY }, { kUVShrinkX / 2, kUVShrinkY / 2 }))
 		, m_mesh(m_meshData) // DynamicMesh::fill()で頂点データの配列サイズが動的に変更される訳ではないのでこの初期化は必須
 	{
@@ -185,7 +187,7 @@ namespace MusicGame::Graphics
 		}
 
 		// BT/FXノーツの描画
-		m_buttonNoteGraphics.draw(chartData, gameStatus, viewStatus, playOption, highwayScrollContext, m_renderTexture);
+		m_buttonNoteGraphics.draw(gameStatus, viewStatus, highwayScrollContext, m_renderTexture);
 
 		// キービームの描画
 		m_keyBeamGraphics.draw(gameStatus, viewStatus, m_renderTexture);
@@ -28,7 +28,7 @@ namespace MusicGame::Graphics
 		bool m_trianglesFlipped = false;
 
 	public:
-		Highway3DGraphics();
+		Highway3DGraphics(const kson::ChartData& chartData, const NoteAttributeTable& noteAttributeTable);
 
 		void update(const ViewStatus& viewStatus);
 
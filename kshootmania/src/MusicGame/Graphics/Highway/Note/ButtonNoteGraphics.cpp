@@ -25,7 +25,7 @@ namespace MusicGame::Graphics
 		}
 	}
 
-	void ButtonNoteGraphics::drawChipNotesCommon(const kson::ChartData& chartData, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const
+	void ButtonNoteGraphics::drawChipNotesCommon(const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const
 	{
 		const ScopedRenderTarget2D renderTarget(target.additiveTexture());
 		const ScopedRenderStates2D samplerState(SamplerState::ClampNearest);
@@ -33,98 +33,69 @@ namespace MusicGame::Graphics
 		const std::size_t numLanes = isBT ? kson::kNumBTLanesSZ : kson::kNumFXLanesSZ;
 		for (std::size_t laneIdx = 0; laneIdx < numLanes; ++laneIdx)
 		{
-			const auto& lane = isBT ? chartData.note.bt[laneIdx] : chartData.note.fx[laneIdx];
 			const double centerSplitShiftX = Camera::CenterSplitShiftX(viewStatus.camStatus.centerSplit) * ((laneIdx >= numLanes / 2) ? 1 : -1);
 			const Vec2 offsetPosition = kLanePositionOffset + (isBT ? kBTLanePositionDiff : kFXLanePositionDiff) * static_cast<double>(laneIdx);
 
-			// scroll_speedに負の値が含まれている場合は描画範囲外の判定を変更
-			const bool hasNegativeScrollSpeed = highwayScrollContext.hasNegativeScrollSpeed();
-
-			for (const auto& [y, note] : lane)
+			// 描画範囲内にありうるノーツのみを走査
+			const auto& culler = isBT ? m_btLaneCullers[laneIdx] : m_fxLaneCullers[laneIdx];
+			const ButtonNoteAttributeLane& attributes = isBT ? m_noteAttributeTable.btLane(laneIdx) : m_noteAttributeTable.fxLane(laneIdx);
+			culler.forEachVisible(highwayScrollContext, [&](const auto&, std::size_t noteIdx)
 			{
-				const int32 positionStartY = highwayScrollContext.getPositionY(y);
+				const ButtonNoteAttribute& attribute = attributes[noteIdx];
+				const int32 positionStartY = highwayScrollContext.getPositionY(attribute.start);
 
 				// 描画範囲外チェック
 				if (positionStartY < 0 || positionStartY >= kHighwayTextureSize.y)
 				{
-					if (!hasNegativeScrollSpeed && positionStartY < 0)
-					{
-						// scroll_speedに負の値がなく、ノーツが上にある場合はループを抜ける
-						break;
-					}
-					continue;
+					return;
 				}
 
-				if (note.length != 0)
+				if (!attribute.isChip())
 				{
 					// ここではチップノーツ以外は描画しない
-					continue;
-				}
-
-				// 音ありFX描画の可否
-				// TODO: キー音有無は譜面ロード時にノーツ毎に事前判定しておく
-				bool hasKeySound = false;
-				const auto& chipEvent = chartData.audio.keySound.fx.chipEvent;
-				for (const auto& [filename, lanes] : chipEvent)
-				{
-					if (laneIdx >= lanes.size())
-					{
-						continue;
-					}
-
-					if (lanes[laneIdx].contains(y))
-					{
-						hasKeySound = true;
-						break;
-					}
+					return;
 				}
 
 				const double yRate = static_cast<double>(kHighwayTextureSize.y - positionStartY) / kHighwayTextureSize.y;
 				const int32 height = NoteGraphicsUtils::ChipNoteHeight(yRate);
-				const TiledTexture& sourceTexture = isBT ? m_chipBTNoteTexture : hasKeySound ? m_chipFXSENoteTexture : m_chipFXNoteTexture;
+				const TiledTexture& sourceTexture = isBT ? m_chipBTNoteTexture : attribute.hasKeySound ? m_chipFXSENoteTexture : m_chipFXNoteTexture;
 				const Vec2 position = offsetPosition + Vec2::Right(centerSplitShiftX) + Vec2::Down(positionStartY - height / 2);
-				const int32 colorIndex = isBT ? NoteGraphicsUtils::CalcChipNoteColorIndex(y, chartData.beat, playOption.noteSkin) : 0;
-				sourceTexture(0, colorIndex)
+				sourceTexture(0, attribute.chipColorIndex)
 					.resized(isBT ? 40 : 82, height)
 					.draw(position);
-			}
+			});
 		}
 	}
 
-	void ButtonNoteGraphics::drawChipBTNotes(const kson::ChartData& chartData, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
+	void ButtonNoteGraphics::drawChipBTNotes(const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
 	{
-		drawChipNotesCommon(chartData, viewStatus, playOption, highwayScrollContext, target, true);
+		drawChipNotesCommon(viewStatus, highwayScrollContext, target, true);
 	}
 
-	void ButtonNoteGraphics::drawChipFXNotes(const kson::ChartData& chartData, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
+	void ButtonNoteGraphics::drawChipFXNotes(const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
 	{
-		drawChipNotesCommon(chartData, viewStatus, playOption, highwayScrollContext, target, false);
+		drawChipNotesCommon(viewStatus, highwayScrollContext, target, false);
 	}
 
-	void ButtonNoteGraphics::drawLongNotesCommon(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const
+	void ButtonNoteGraphics::drawLongNotesCommon(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const
 	{
 		const ScopedRenderStates2D samplerState(SamplerState::ClampNearest);
 
 		const std::size_t numLanes = isBT ? kson::kNumBTLanesSZ : kson::kNumFXLanesSZ;
 		for (std::size_t laneIdx = 0; laneIdx < numLanes; ++laneIdx)
 		{
-			const auto& lane = isBT ? chartData.note.bt[laneIdx] : chartData.note.fx[laneIdx];
 			const double centerSplitShiftX = Camera::CenterSplitShiftX(viewStatus.camStatus.centerSplit) * ((laneIdx >= numLanes / 2) ? 1 : -1);
 			const Vec2 offsetPosition = kLanePositionOffset + (isBT ? kBTLanePositionDiff : kFXLanePositionDiff) * laneIdx;
 
-			// scroll_speedに負の値が含まれている場合は描画範囲外の判定を変更
-			const bool hasNegativeScrollSpeed = highwayScrollContext.hasNegativeScrollSpeed();
-
-			for (const auto& [y, note] : lane)
+			// 描画範囲内にありうるノーツのみを走査
+			const auto& culler = isBT ? m_btLaneCullers[laneIdx] : m_fxLaneCullers[laneIdx];
+			const ButtonNoteAttributeLane& attributes = isBT ? m_noteAttributeTable.btLane(laneIdx) : m_noteAttributeTable.fxLane(laneIdx);
+			culler.forEachVisible(highwayScrollContext, [&](const auto& itr, std::size_t noteIdx)
 			{
-				const int32 positionStartY = highwayScrollContext.getPositionY(y);
-				if (!hasNegativeScrollSpeed && positionStartY < 0)
-				{
-					// scroll_speedに負の値がない場合は、positionStartY < 0でループを抜ける
-					break;
-				}
-
-				const int32 positionEndY = note.length == 0 ? positionStartY : highwayScrollContext.getPositionY(y + note.length);
+				const auto& [y, note] = *itr;
+				const ButtonNoteAttribute& attribute = attributes[noteIdx];
+				const int32 positionStartY = highwayScrollContext.getPositionY(attribute.start);
+				const int32 positionEndY = attribute.isChip() ? positionStartY : highwayScrollContext.getPositionY(attribute.end);
 
 				// scroll_speedが負の場合、始点と終点が逆転する可能性があるため両方チェック
 				const int32 minY = Min(positionStartY, positionEndY);
@@ -133,32 +104,27 @@ namespace MusicGame::Graphics
 				// ノーツ全体が描画範囲外の場合はスキップ
 				if (maxY < 0 || minY >= kHighwayTextureSize.y)
 				{
-					if (!hasNegativeScrollSpeed && maxY < 0)
-					{
-						// scroll_speedに負の値がなく、ノーツ全体が上にある場合はループを抜ける
-						break;
-					}
-					continue;
+					return;
 				}
 
 				if (note.length <= 0)
 				{
 					// ここではロングノーツ以外は描画しない
-					continue;
+					return;
 				}
 
 				const int32 height = positionStartY - positionEndY;
 				if (height == 0)
 				{
 					// 高さが0の場合は描画しない
-					continue;
+					return;
 				}
 
 				// scroll_speedが負の場合、heightが負になる可能性がある
 				const int32 absHeight = Abs(height);
 				if (absHeight <= 0)
 				{
-					continue;
+					return;
 				}
 
 				const int32 numColumns = isBT ? kNumTextureColumnsMainSub : 1; // ロングBTノーツの場合はinvMultiply用のテクスチャ列が追加で存在する
@@ -192,21 +158,21 @@ namespace MusicGame::Graphics
 						.resized(width, absHeight)
 						.draw(position);
 				}
-			}
+			});
 		}
 	}
 
-	void ButtonNoteGraphics::drawLongBTNotes(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
+	void ButtonNoteGraphics::drawLongBTNotes(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
 	{
-		drawLongNotesCommon(chartData, gameStatus, viewStatus, highwayScrollContext, target, true);
+		drawLongNotesCommon(gameStatus, viewStatus, highwayScrollContext, target, true);
 	}
 
-	void ButtonNoteGraphics::drawLongFXNotes(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
+	void ButtonNoteGraphics::drawLongFXNotes(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
 	{
-		drawLongNotesCommon(chartData, gameStatus, viewStatus, highwayScrollContext, target, false);
+		drawLongNotesCommon(gameStatus, viewStatus, highwayScrollContext, target, false);
 	}
 
-	ButtonNoteGraphics::ButtonNoteGraphics()
+	ButtonNoteGraphics::ButtonNoteGraphics(const kson::ChartData& chartData, const NoteAttributeTable& noteAttributeTable)
 		: m_chipBTNoteTexture(NoteGraphicsUtils::ApplyAlphaToNoteTexture(TextureAsset(kChipBTNoteTextureFilename),
 			{
 				.column = 9 * kNumTextureColumnsMainSub,
@@ -224,14 +190,17 @@ namespace MusicGame::Graphics
 				.sourceSize = { 82, 14 },
 			}))
 		, m_longFXNoteTexture(TextureAsset(kLongFXNoteTextureFilename))
+		, m_btLaneCullers(CreateLaneNoteCullers(chartData.note.bt, chartData.beat.scrollSpeed, 0))
+		, m_fxLaneCullers(CreateLaneNoteCullers(chartData.note.fx, chartData.beat.scrollSpeed, 0))
+		, m_noteAttributeTable(noteAttributeTable)
 	{
 	}
 
-	void ButtonNoteGraphics::draw(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
+	void ButtonNoteGraphics::draw(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
 	{
-		drawLongFXNotes(chartData, gameStatus, viewStatus, highwayScrollContext, target);
-		drawLongBTNotes(chartData, gameStatus, viewStatus, highwayScrollContext, target);
-		drawChipFXNotes(chartData, viewStatus, playOption, highwayScrollContext, target);
-		drawChipBTNotes(chartData, viewStatus, playOption, highwayScrollContext, target);
+		drawLongFXNotes(gameStatus, viewStatus, highwayScrollContext, target);
+		drawLongBTNotes(gameStatus, viewStatus, highwayScrollContext, target);
+		drawChipFXNotes(viewStatus, highwayScrollContext, target);
+		drawChipBTNotes(viewStatus, highwayScrollContext, target);
 	}
 }
@@ -2,8 +2,10 @@
 #include "MusicGame/GameStatus.hpp"
 #include "MusicGame/ViewStatus.hpp"
 #include "MusicGame/PlayOption.hpp"
+#include "MusicGame/NoteAttributeTable.hpp"
 #include "MusicGame/Scroll/HighwayScroll.hpp"
 #include "MusicGame/Graphics/Highway/HighwayRenderTexture.hpp"
+#include "LaneNoteCuller.hpp"
 
 namespace MusicGame::Graphics
 {
@@ -17,21 +19,28 @@ namespace MusicGame::Graphics
 		const TiledTexture m_chipFXSENoteTexture;
 		const Texture m_longFXNoteTexture;
 
-		void drawChipNotesCommon(const kson::ChartData& chartData, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const;
+		const std::array<LaneNoteCuller<kson::Interval>, kson::kNumBTLanesSZ> m_btLaneCullers;
+		const std::array<LaneNoteCuller<kson::Interval>, kson::kNumFXLanesSZ> m_fxLaneCullers;
 
-		void drawChipBTNotes(const kson::ChartData& chartData, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
+		const NoteAttributeTable& m_noteAttributeTable;
 
-		void drawChipFXNotes(const kson::ChartData& chartData, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
+		void drawChipNotesCommon(const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const;
 
-		void drawLongNotesCommon(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const;
+		void drawChipBTNotes(const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
 
-		void drawLongBTNotes(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
+		void drawChipFXNotes(const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
 
-		void drawLongFXNotes(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
+		void drawLongNotesCommon(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target, bool isBT) const;
+
+		void drawLongBTNotes(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
+
+		void drawLongFXNotes(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
 
 	public:
-		ButtonNoteGraphics();
+		/// @param chartData 譜面データ(このインスタンスより長く生存すること)
+		/// @param noteAttributeTable chartDataから作成したノーツの属性テーブル(このインスタンスより長く生存すること)
+		ButtonNoteGraphics(const kson::ChartData& chartData, const NoteAttributeTable& noteAttributeTable);
 
-		void draw(const kson::ChartData& chartData, const GameStatus& gameStatus, const ViewStatus& viewStatus, const PlayOption& playOption, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
+		void draw(const GameStatus& gameStatus, const ViewStatus& viewStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
 	};
 }
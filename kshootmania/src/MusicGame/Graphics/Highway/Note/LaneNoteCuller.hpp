@@ -0,0 +1,220 @@
+﻿#pragma once
+#include "MusicGame/Scroll/HighwayScroll.hpp"
+#include "MusicGame/Scroll/ScrollSpeedIntegralTable.hpp"
+#include "MusicGame/Graphics/GraphicsDefines.hpp"
+
+namespace MusicGame::Graphics
+{
+	namespace detail
+	{
+		inline kson::Pulse NoteEndPulse(kson::Pulse y, const kson::Interval& note)
+		{
+			return y + Max(note.length, kson::RelPulse{ 0 });
+		}
+
+		inline kson::Pulse NoteEndPulse(kson::Pulse y, const kson::LaserSection& laserSection)
+		{
+			return laserSection.v.empty() ? y : y + laserSection.v.rbegin()->first;
+		}
+	}
+
+	/// @brief 1レーン分のノーツのうち描画範囲内にありうるものを列挙する
+	/// @details 描画範囲外のノーツの座標計算を毎フレーム行わないようにするためのもの。
+	///          座標がPulse値に対して単調な場合(scroll_speedに負の値がない、またはC-mod)は、再生位置に合わせて進めるカーソルから遠方のクリップ位置までを列挙する。
+	///          scroll_speedに負の値がある場合は、譜面読み込み時に各ノーツのscroll_speed積分値の範囲を事前計算しておき、描画範囲に対応する積分値の範囲と重なるノーツのみを列挙する。
+	/// @note 列挙するのは描画範囲内にありうるノーツの候補であり、実際の描画範囲の判定は呼び出し側で行うこと
+	template <typename T>
+	class LaneNoteCuller
+	{
+	public:
+		using ConstIterator = typename kson::ByPulse<T>::const_iterator;
+
+	private:
+		/// @brief 描画範囲の上下に追加する余白のピクセル数(ノーツの始点・終点の外側に描画されるテクスチャの分)
+		const int32 m_marginPx;
+
+		/// @brief ノーツ(Pulse値順)
+		std::vector<ConstIterator> m_notes;
+
+		/// @brief 先頭から各ノーツまでの終点Pulse値の最大値
+		/// @note 同一レーン上のノーツが重なっている場合でもカーソルを単調に扱えるようにするためのもの
+		std::vector<kson::Pulse> m_prefixMaxEndPulses;
+
+		/// @brief 逆引きインデックス: scroll_speed積分値の最小値の昇順に並べたノーツのインデックス
+		std::vector<std::size_t> m_sortedNoteIdxs;
+
+		/// @brief 逆引きインデックス: m_sortedNoteIdxsの各要素に対応するノーツの積分値の最小値・最大値
+		std::vector<double> m_sortedIntegralMins;
+		std::vector<double> m_sortedIntegralMaxs;
+
+		/// @brief 逆引きインデックス: m_sortedNoteIdxsを暗黙の二分木とみなした場合の部分木内の積分値の最大値
+		std::vector<double> m_subtreeIntegralMaxs;
+
+		/// @brief 座標が単調な場合のカーソル(描画範囲より下に完全に外れていない最初のノーツのインデックス)
+		/// @note 描画処理のみから使用するキャッシュのためmutableにしている
+		mutable std::size_t m_cursor = 0U;
+
+		/// @brief 逆引きインデックスで列挙したノーツのインデックスの一時バッファ
+		mutable std::vector<std::size_t> m_visibleNoteIdxs;
+
+		double buildSubtreeIntegralMaxs(std::size_t begin, std::size_t end)
+		{
+			if (begin >= end)
+			{
+				return std::numeric_limits<double>::lowest();
+			}
+			const std::size_t mid = begin + (end - begin) / 2;
+			const double leftMax = buildSubtreeIntegralMaxs(begin, mid);
+			const double rightMax = buildSubtreeIntegralMaxs(mid + 1, end);
+			m_subtreeIntegralMaxs[mid] = Max(m_sortedIntegralMaxs[mid], Max(leftMax, rightMax));
+			return m_subtreeIntegralMaxs[mid];
+		}
+
+		void queryIntegralRange(std::size_t begin, std::size_t end, double minIntegral, double maxIntegral) const
+		{
+			if (begin >= end)
+			{
+				return;
+			}
+			const std::size_t mid = begin + (end - begin) / 2;
+			if (m_subtreeIntegralMaxs[mid] < minIntegral)
+			{
+				// 部分木内に範囲と重なるノーツはない
+				return;
+			}
+
+			queryIntegralRange(begin, mid, minIntegral, maxIntegral);
+
+			// 右側の部分木は積分値の最小値がm_sortedIntegralMins[mid]以上のため、これが範囲外なら調べる必要はない
+			if (m_sortedIntegralMins[mid] <= maxIntegral)
+			{
+				if (m_sortedIntegralMaxs[mid] >= minIntegral)
+				{
+					m_visibleNoteIdxs.push_back(m_sortedNoteIdxs[mid]);
+				}
+				queryIntegralRange(mid + 1, end, minIntegral, maxIntegral);
+			}
+		}
+
+		bool isBelowVisibleRange(kson::Pulse pulse, const Scroll::HighwayScrollContext& highwayScrollContext) const
+		{
+			return highwayScrollContext.getPositionY(pulse) >= kHighwayTextureSize.y + m_marginPx;
+		}
+
+		bool isAboveVisibleRange(kson::Pulse pulse, const Scroll::HighwayScrollContext& highwayScrollContext) const
+		{
+			return highwayScrollContext.getPositionY(pulse) < -m_marginPx;
+		}
+
+	public:
+		/// @brief コンストラクタ
+		/// @param lane レーン(このインスタンスより長く生存すること)
+		/// @param scrollSpeed scroll_speedグラフ(HighwayScrollに渡すものと同じであること)
+		/// @param marginPx 描画範囲の上下に追加する余白のピクセル数
+		LaneNoteCuller(const kson::ByPulse<T>& lane, const kson::Graph& scrollSpeed, int32 marginPx)
+			: m_marginPx(marginPx)
+		{
+			m_notes.reserve(lane.size());
+			m_prefixMaxEndPulses.reserve(lane.size());
+			kson::Pulse maxEndPulse = std::numeric_limits<kson::Pulse>::lowest();
+			for (auto itr = lane.begin(); itr != lane.end(); ++itr)
+			{
+				maxEndPulse = Max(maxEndPulse, detail::NoteEndPulse(itr->first, itr->second));
+				m_notes.push_back(itr);
+				m_prefixMaxEndPulses.push_back(maxEndPulse);
+			}
+
+			// scroll_speedに負の値がある場合のみ逆引きインデックスを作成
+			const bool hasNegativeScrollSpeed = std::any_of(scrollSpeed.begin(), scrollSpeed.end(),
+				[](const auto& pair) { return pair.second.v.v < 0.0 || pair.second.v.vf < 0.0; });
+			if (!hasNegativeScrollSpeed || m_notes.empty())
+			{
+				return;
+			}
+
+			const Scroll::ScrollSpeedIntegralTable integralTable(scrollSpeed);
+			std::vector<std::pair<double, double>> integralRanges;
+			integralRanges.reserve(m_notes.size());
+			for (const auto& itr : m_notes)
+			{
+				integralRanges.push_back(integralTable.integralRange(itr->first, detail::NoteEndPulse(itr->first, itr->second)));
+			}
+
+			m_sortedNoteIdxs.resize(m_notes.size());
+			std::iota(m_sortedNoteIdxs.begin(), m_sortedNoteIdxs.end(), std::size_t{ 0 });
+			std::stable_sort(m_sortedNoteIdxs.begin(), m_sortedNoteIdxs.end(),
+				[&integralRanges](std::size_t a, std::size_t b) { return integralRanges[a].first < integralRanges[b].first; });
+
+			m_sortedIntegralMins.reserve(m_notes.size());
+			m_sortedIntegralMaxs.reserve(m_notes.size());
+			for (const std::size_t idx : m_sortedNoteIdxs)
+			{
+				m_sortedIntegralMins.push_back(integralRanges[idx].first);
+				m_sortedIntegralMaxs.push_back(integralRanges[idx].second);
+			}
+
+			m_subtreeIntegralMaxs.resize(m_notes.size());
+			buildSubtreeIntegralMaxs(0U, m_notes.size());
+		}
+
+		/// @brief 描画範囲内にありうるノーツをPulse値順に列挙する
+		/// @param highwayScrollContext HighwayScrollのコンテキスト
+		/// @param func ノーツのイテレータとレーン上でのノーツの順番(0始まり)を受け取る関数
+		template <typename Func>
+		void forEachVisible(const Scroll::HighwayScrollContext& highwayScrollContext, Func&& func) const
+		{
+			if (m_notes.empty())
+			{
+				return;
+			}
+
+			// scroll_speedに負の値がありC-modでない場合は逆引きインデックスを使用
+			if (!m_sortedNoteIdxs.empty())
+			{
+				const auto integralRange = highwayScrollContext.visibleIntegralRange(-m_marginPx, kHighwayTextureSize.y + m_marginPx);
+				if (integralRange.has_value())
+				{
+					m_visibleNoteIdxs.clear();
+					queryIntegralRange(0U, m_sortedNoteIdxs.size(), integralRange->first, integralRange->second);
+					std::sort(m_visibleNoteIdxs.begin(), m_visibleNoteIdxs.end());
+					for (const std::size_t idx : m_visibleNoteIdxs)
+					{
+						func(m_notes[idx], idx);
+					}
+					return;
+				}
+			}
+
+			// 座標がPulse値に対して単調な場合はカーソルを使用
+			// シークやハイスピード変更で描画範囲が手前に戻った場合はカーソルも戻す
+			while (m_cursor > 0U && !isBelowVisibleRange(m_prefixMaxEndPulses[m_cursor - 1U], highwayScrollContext))
+			{
+				--m_cursor;
+			}
+			while (m_cursor < m_notes.size() && isBelowVisibleRange(m_prefixMaxEndPulses[m_cursor], highwayScrollContext))
+			{
+				++m_cursor;
+			}
+
+			// 始点が描画範囲より上に外れたノーツ以降は描画しない
+			for (std::size_t idx = m_cursor; idx < m_notes.size(); ++idx)
+			{
+				if (isAboveVisibleRange(m_notes[idx]->first, highwayScrollContext))
+				{
+					break;
+				}
+				func(m_notes[idx], idx);
+			}
+		}
+	};
+
+	/// @brief 各レーンのLaneNoteCullerを作成する
+	template <typename T, std::size_t N>
+	std::array<LaneNoteCuller<T>, N> CreateLaneNoteCullers(const std::array<kson::ByPulse<T>, N>& lanes, const kson::Graph& scrollSpeed, int32 marginPx)
+	{
+		return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+		{
+			return std::array<LaneNoteCuller<T>, N>{ LaneNoteCuller<T>(lanes[Is], scrollSpeed, marginPx)... };
+		}(std::make_index_sequence<N>{});
+	}
+}
@@ -20,6 +20,9 @@ namespace MusicGame::Graphics
 		constexpr Size kLaserStartTextureSize = { 44, 200 };
 		constexpr int32 kLaserShiftY = -6;
 
+		// LASERセクションの始点・終点の外側に描画されるテクスチャの高さの最大値
+		constexpr int32 kLaserCullingMarginPx = kLaserStartTextureSize.y + kLaserSlamHeightMax + kLaserTailHeightMax - kLaserShiftY;
+
 		constexpr double kLaserCriticalBlinkIntervalSec = 0.12;
 
 		enum class JudgmentStatus
@@ -314,7 +317,7 @@ namespace MusicGame::Graphics
 		}
 	}
 
-	LaserNoteGraphics::LaserNoteGraphics()
+	LaserNoteGraphics::LaserNoteGraphics(const kson::ChartData& chartData)
 		: m_laserNoteTexture(TextureAsset(kLaserNoteTextureFilename))
 		, m_laserNoteMaskTexture(TextureAsset(kLaserNoteMaskTextureFilename))
 		, m_laserNoteStartTextures{
@@ -330,10 +333,11 @@ namespace MusicGame::Graphics
 					.column = kNumTextureColumnsMainSub,
 					.sourceSize = kLaserStartTextureSize,
 				}) }
+		, m_laneCullers(CreateLaneNoteCullers(chartData.note.laser, chartData.beat.scrollSpeed, kLaserCullingMarginPx))
 	{
 	}
 
-	void LaserNoteGraphics::draw(const kson::ChartData& chartData, const PlayOption& playOption, const GameStatus& gameStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
+	void LaserNoteGraphics::draw([[maybe_unused]] const kson::ChartData& chartData, const PlayOption& playOption, const GameStatus& gameStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const
 	{
 		const ScopedRenderStates2D samplerState(SamplerState::ClampNearest);
 		const ScopedRenderStates2D renderState(BlendState::Additive);
@@ -341,14 +345,10 @@ namespace MusicGame::Graphics
 		// LASERノーツを描画
 		for (int32 laneIdx = 0; laneIdx < kson::kNumLaserLanes; ++laneIdx) // 座標計算で結局int32にする必要があるのでここではsize_t不使用
 		{
-			const auto& lane = chartData.note.laser[laneIdx];
 			const auto& laneStatus = gameStatus.laserLaneStatus[laneIdx];
 
-			// scroll_speedに負の値が含まれている場合は過去のノーツも描画範囲に入る可能性があるため、先頭から走査
-			const bool hasNegativeScrollSpeed = highwayScrollContext.hasNegativeScrollSpeed();
-			auto itr = hasNegativeScrollSpeed ? lane.begin() : kson::ValueItrAt(lane, gameStatus.currentPulse);
-
-			for (; itr != lane.end(); ++itr)
+			// 描画範囲内にありうるLASERセクションのみを走査
+			m_laneCullers[laneIdx].forEachVisible(highwayScrollContext, [&](const auto& itr, std::size_t)
 			{
 				const auto& [y, laserSection] = *itr;
 
@@ -383,12 +383,7 @@ namespace MusicGame::Graphics
 				// LASERセクション全体が描画範囲外の場合はスキップ
 				if (maxY < 0 || minY >= kHighwayTextureSize.y)
 				{
-					if (!hasNegativeScrollSpeed && maxY < 0)
-					{
-						// scroll_speedに負の値がなく、セクション全体が上にある場合はループを抜ける
-						break;
-					}
-					continue;
+					return;
 				}
 
 				// LASERセクションの判定状況をもとに描画すべきテクスチャの行を取得
@@ -399,7 +394,7 @@ namespace MusicGame::Graphics
 				// LASERセクションを描画
 				DrawLaserSection(laneIdx, y, laserSection, highwayScrollContext, target.additiveTexture(), m_laserNoteTexture, textureRow, m_laserNoteStartTextures[laneIdx](0, kTextureColumnMain));
 				DrawLaserSection(laneIdx, y, laserSection, highwayScrollContext, target.invMultiplyTexture(), m_laserNoteMaskTexture, textureRow, m_laserNoteStartTextures[laneIdx](0, kTextureColumnSub));
-			}
+			});
 		}
 	}
 }
@@ -3,6 +3,7 @@
 #include "MusicGame/PlayOption.hpp"
 #include "MusicGame/Scroll/HighwayScroll.hpp"
 #include "MusicGame/Graphics/Highway/HighwayRenderTexture.hpp"
+#include "LaneNoteCuller.hpp"
 
 namespace MusicGame::Graphics
 {
@@ -12,9 +13,11 @@ namespace MusicGame::Graphics
 		const Texture m_laserNoteTexture;
 		const Texture m_laserNoteMaskTexture;
 		const std::array<TiledTexture, kson::kNumLaserLanesSZ> m_laserNoteStartTextures;
+		const std::array<LaneNoteCuller<kson::LaserSection>, kson::kNumLaserLanesSZ> m_laneCullers;
 
 	public:
-		LaserNoteGraphics();
+		/// @param chartData 譜面データ(描画時に渡すものと同じであり、このインスタンスより長く生存すること)
+		explicit LaserNoteGraphics(const kson::ChartData& chartData);
 
 		void draw(const kson::ChartData& chartData, const PlayOption& playOption, const GameStatus& gameStatus, const Scroll::HighwayScrollContext& highwayScrollContext, const HighwayRenderTexture& target) const;
 	};
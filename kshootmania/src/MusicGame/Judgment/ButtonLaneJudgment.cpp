@@ -1,32 +1,10 @@
 ﻿#include "ButtonLaneJudgment.hpp"
 #include "MusicGame/Graphics/GraphicsDefines.hpp"
-#include "Input/KeyConfig.hpp"
 
 namespace MusicGame::Judgment
 {
 	namespace
 	{
-		std::map<kson::Pulse, double> CreatePulseToSec(const kson::ByPulse<kson::Interval>& lane, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache)
-		{
-			std::map<kson::Pulse, double> pulseToSec;
-
-			for (const auto& [y, note] : lane)
-			{
-				if (!pulseToSec.contains(y))
-				{
-					const double sec = kson::PulseToSec(y, beatInfo, timingCache);
-					pulseToSec.emplace(y, sec);
-				}
-				if (!pulseToSec.contains(y + note.length))
-				{
-					const double sec = kson::PulseToSec(y + note.length, beatInfo, timingCache);
-					pulseToSec.emplace(y + note.length, sec);
-				}
-			}
-
-			return pulseToSec;
-		}
-
 		kson::ByPulse<JudgmentResult> CreateChipNoteJudgmentArray(const kson::ByPulse<kson::Interval>& lane, JudgmentPlayMode judgmentPlayMode)
 		{
 			// Offモードの場合は空配列を返す
@@ -115,31 +93,12 @@ namespace MusicGame::Judgment
 			return false;
 		}
 
-		bool HasFXChipKeySound(const kson::ChartData& chartData, Button button, kson::Pulse pulse)
+		/// @brief 指定したPulse値を始点とするノーツの秒数を返す
+		double NoteStartSecAt(const ButtonNoteAttributeLane& noteAttributes, kson::Pulse y)
 		{
-			if (button != kButtonFX_L && button != kButtonFX_R)
-			{
-				// FXレーンでない場合は対象外
-				return false;
-			}
-
-			const std::size_t laneIdx = button - kButtonFX_L;
-			const auto& chipEvent = chartData.audio.keySound.fx.chipEvent;
-
-			for (const auto& [filename, lanes] : chipEvent)
-			{
-				if (laneIdx >= lanes.size())
-				{
-					continue;
-				}
-
-				if (lanes[laneIdx].contains(pulse))
-				{
-					return true;
-				}
-			}
-
-			return false;
+			const auto noteIdx = FindButtonNoteAttributeIdx(noteAttributes, y);
+			assert(noteIdx.has_value() && "Note attribute must exist for each note in the lane");
+			return noteAttributes[*noteIdx].start.sec;
 		}
 	}
 
@@ -148,7 +107,7 @@ namespace MusicGame::Judgment
 		return m_gaugeType == GaugeType::kEasyGauge ? TimingWindow::ChipNote::kWindowSecErrorEasy : TimingWindow::ChipNote::kWindowSecError;
 	}
 
-	void ButtonLaneJudgment::processKeyDown(const kson::ChartData& chartData, const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef)
+	void ButtonLaneJudgment::processKeyDown(kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef)
 	{
 		using namespace TimingWindow;
 
@@ -156,19 +115,20 @@ namespace MusicGame::Judgment
 		bool found = false;
 		double minDistance = 0.0;
 		bool isFast = false;
-		kson::Pulse nearestNotePulse = 0;
-		for (auto itr = m_passedNoteCursor; itr != lane.end(); ++itr)
+		double nearestDiffSec = 0.0;
+		std::size_t nearestNoteIdx = 0U;
+		for (std::size_t noteIdx = m_passedNoteIdx; noteIdx < m_noteAttributes.size(); ++noteIdx)
 		{
-			const auto& [y, note] = *itr;
-			const double sec = m_pulseToSec.at(y);
-			const double endSec = (note.length == 0) ? sec : m_pulseToSec.at(y + note.length);
-			if (currentTimeSec - endSec >= errorWindowSec())
+			const ButtonNoteAttribute& attribute = m_noteAttributes[noteIdx];
+			const kson::Pulse y = attribute.start.pulse;
+			const double sec = attribute.start.sec;
+			if (currentTimeSec - attribute.end.sec >= errorWindowSec())
 			{
 				continue;
 			}
 
 			const double diffSec = sec - currentTimeSec;
-			if (note.length == 0) // Chip note
+			if (attribute.isChip()) // Chip note
 			{
 				if (m_chipJudgmentArray.at(y) != JudgmentResult::kUnspecified)
 				{
@@ -177,7 +137,8 @@ namespace MusicGame::Judgment
 
 				if (!found || Abs(diffSec) < minDistance)
 				{
-					nearestNotePulse = y;
+					nearestNoteIdx = noteIdx;
+					nearestDiffSec = diffSec;
 					minDistance = Abs(diffSec);
 					isFast = currentTimeSec < sec;
 					found = true;
@@ -189,7 +150,7 @@ namespace MusicGame::Judgment
 			}
 			else // Long note
 			{
-				if ((!found || Abs(diffSec) < minDistance) && diffSec <= LongNote::kWindowSecPreHold && (y + note.length > currentPulse))
+				if ((!found || Abs(diffSec) < minDistance) && diffSec <= LongNote::kWindowSecPreHold && (attribute.end.pulse > currentPulse))
 				{
 					laneStatusRef.currentLongNotePulse = y;
 					laneStatusRef.currentLongNoteAnimOffsetTimeSec = currentTimeSec;
@@ -208,6 +169,9 @@ namespace MusicGame::Judgment
 		if (found)
 		{
 			// チップノーツの判定
+			const ButtonNoteAttribute& nearestNote = m_noteAttributes[nearestNoteIdx];
+			const kson::Pulse nearestNotePulse = nearestNote.start.pulse;
+			const double diffSec = nearestDiffSec;
 			Optional<ChipAnimType> chipAnimType = none;
 			if (minDistance < ChipNote::kWindowSecCritical)
 			{
@@ -220,7 +184,7 @@ namespace MusicGame::Judgment
 			else if (minDistance < ChipNote::kWindowSecNear)
 			{
 				// NEAR判定
-				if (isFast && HasFXChipKeySound(chartData, m_keyConfigButton, nearestNotePulse))
+				if (isFast && nearestNote.hasKeySound)
 				{
 					// 効果音付きチップFXノーツの場合、FAST NEARは出さずCRITICAL判定扱いとする
 					// (効果音の再生遅延を気にして早押しした場合にNEARにならないようにするための仕様)
@@ -319,21 +283,22 @@ namespace MusicGame::Judgment
 		}
 	}
 
-	void ButtonLaneJudgment::processPassedNoteJudgment(const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef, IsAutoPlayYN isAutoPlay)
+	void ButtonLaneJudgment::processPassedNoteJudgment(kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef, IsAutoPlayYN isAutoPlay)
 	{
 		using namespace TimingWindow;
 
 		const JudgmentResult result = isAutoPlay ? JudgmentResult::kCritical : JudgmentResult::kError;
 		const double thresholdSec = isAutoPlay ? 0.0 : ChipNote::kWindowSecLateErrorBegin;
 
-		for (auto itr = m_passedNoteCursor; itr != lane.end(); ++itr)
+		for (std::size_t noteIdx = m_passedNoteIdx; noteIdx < m_noteAttributes.size(); ++noteIdx)
 		{
-			const auto& [y, note] = *itr;
-			const double passSec = ((note.length == 0) ? m_pulseToSec.at(y) : m_pulseToSec.at(y + note.length)) + thresholdSec;
+			const ButtonNoteAttribute& attribute = m_noteAttributes[noteIdx];
+			const kson::Pulse y = attribute.start.pulse;
+			const double passSec = attribute.end.sec + thresholdSec;
 			if (currentTimeSec >= passSec)
 			{
 				// 通過済みチップノーツの判定
-				if (note.length == 0 && m_chipJudgmentArray.at(y) == JudgmentResult::kUnspecified)
+				if (attribute.isChip() && m_chipJudgmentArray.at(y) == JudgmentResult::kUnspecified)
 				{
 					m_chipJudgmentArray.at(y) = result;
 					judgmentHandlerRef.onChipJudged(result);
@@ -357,7 +322,7 @@ namespace MusicGame::Judgment
 					}
 				}
 
-				m_passedNoteCursor = std::next(itr);
+				m_passedNoteIdx = noteIdx + 1U;
 			}
 		}
 
@@ -378,45 +343,47 @@ namespace MusicGame::Judgment
 		}
 	}
 
-	ButtonLaneJudgment::ButtonLaneJudgment(JudgmentPlayMode judgmentPlayMode, GaugeType gaugeType, FastSlowMode fastSlowMode, Button keyConfigButton, const kson::ByPulse<kson::Interval>& lane, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache)
+	ButtonLaneJudgment::ButtonLaneJudgment(JudgmentPlayMode judgmentPlayMode, GaugeType gaugeType, FastSlowMode fastSlowMode, Button keyConfigButton, const kson::ByPulse<kson::Interval>& lane, const ButtonNoteAttributeLane& noteAttributes, const kson::BeatInfo& beatInfo)
 		: m_judgmentPlayMode(judgmentPlayMode)
 		, m_gaugeType(gaugeType)
 		, m_fastSlowMode(fastSlowMode)
 		, m_keyConfigButton(keyConfigButton)
-		, m_pulseToSec(CreatePulseToSec(lane, beatInfo, timingCache))
+		, m_noteAttributes(noteAttributes)
 		, m_chipJudgmentArray(CreateChipNoteJudgmentArray(lane, judgmentPlayMode))
 		, m_longJudgmentArray(CreateLongNoteJudgmentArray(lane, beatInfo, judgmentPlayMode))
-		, m_passedNoteCursor(lane.begin())
 		, m_passedLongJudgmentCursor(m_longJudgmentArray.begin())
 	{
 	}
 
-	void ButtonLaneJudgment::update(const kson::ChartData& chartData, const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef)
+	void ButtonLaneJudgment::update(const kson::ByPulse<kson::Interval>& lane, const JudgmentInput& input, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef)
 	{
+		const ButtonInput& buttonInput = input.button(m_keyConfigButton);
+
 		if (m_judgmentPlayMode == JudgmentPlayMode::kOn)
 		{
 			// チップノーツとロングノーツの始点の判定処理
-			if (!m_isLockedForExit && KeyConfig::Down(m_keyConfigButton))
+			// (入力スレッドで押下時刻を取得できた場合は、フレームの時刻ではなく押下時刻で判定する)
+			if (!m_isLockedForExit && buttonInput.down)
 			{
-				processKeyDown(chartData, lane, currentPulse, currentTimeSec, currentTimeSecForDraw, laneStatusRef, judgmentHandlerRef);
+				processKeyDown(currentPulse, currentTimeSec + buttonInput.downTimeOffsetSec, currentTimeSecForDraw, laneStatusRef, judgmentHandlerRef);
 			}
 
 			// ロングノーツ押下中の判定処理
-			if (KeyConfig::Pressed(m_keyConfigButton))
+			if (buttonInput.pressed)
 			{
 				processKeyPressed(lane, currentPulse, laneStatusRef, judgmentHandlerRef);
 			}
 
 			// ロングノーツを離したときの判定処理
 			if (laneStatusRef.currentLongNotePulse.has_value() &&
-				(KeyConfig::Up(m_keyConfigButton) || (*laneStatusRef.currentLongNotePulse + lane.at(*laneStatusRef.currentLongNotePulse).length < currentPulse)))
+				(buttonInput.up || (*laneStatusRef.currentLongNotePulse + lane.at(*laneStatusRef.currentLongNotePulse).length < currentPulse)))
 			{
 				laneStatusRef.currentLongNotePulse = none;
 				laneStatusRef.currentLongNoteAnimOffsetTimeSec = currentTimeSec;
 			}
 
 			// 通り過ぎたノーツをERROR判定にする
-			processPassedNoteJudgment(lane, currentPulse, currentTimeSec, currentTimeSecForDraw, laneStatusRef, judgmentHandlerRef, IsAutoPlayYN::No);
+			processPassedNoteJudgment(currentPulse, currentTimeSec, currentTimeSecForDraw, laneStatusRef, judgmentHandlerRef, IsAutoPlayYN::No);
 
 			if (IsDuringLongNote(lane, currentPulse))
 			{
@@ -430,7 +397,7 @@ namespace MusicGame::Judgment
 		else if (m_judgmentPlayMode == JudgmentPlayMode::kAuto)
 		{
 			// 通り過ぎたノーツをCRITICAL判定にする
-			processPassedNoteJudgment(lane, currentPulse, currentTimeSec, currentTimeSecForDraw, laneStatusRef, judgmentHandlerRef, IsAutoPlayYN::Yes);
+			processPassedNoteJudgment(currentPulse, currentTimeSec, currentTimeSecForDraw, laneStatusRef, judgmentHandlerRef, IsAutoPlayYN::Yes);
 
 			kson::Pulse currentLongNoteY;
 			if (IsDuringLongNote(lane, currentPulse, &currentLongNoteY))
@@ -438,7 +405,7 @@ namespace MusicGame::Judgment
 				// ロングノーツ中の場合は押下中にする
 				laneStatusRef.longNotePressed = true;
 				laneStatusRef.currentLongNotePulse = currentLongNoteY;
-				laneStatusRef.currentLongNoteAnimOffsetTimeSec = m_pulseToSec.at(currentLongNoteY);
+				laneStatusRef.currentLongNoteAnimOffsetTimeSec = NoteStartSecAt(m_noteAttributes, currentLongNoteY);
 			}
 			else
 			{
@@ -456,11 +423,11 @@ namespace MusicGame::Judgment
 		{
 			// Offモード時もボタン入力を受け付けてアニメーションを表示
 			kson::Pulse currentLongNoteY;
-			if (IsDuringLongNote(lane, currentPulse, &currentLongNoteY) && KeyConfig::Pressed(m_keyConfigButton))
+			if (IsDuringLongNote(lane, currentPulse, &currentLongNoteY) && buttonInput.pressed)
 			{
 				// ロングノーツ中でボタンを押している場合
 				laneStatusRef.currentLongNotePulse = currentLongNoteY;
-				laneStatusRef.currentLongNoteAnimOffsetTimeSec = m_pulseToSec.at(currentLongNoteY);
+				laneStatusRef.currentLongNoteAnimOffsetTimeSec = NoteStartSecAt(m_noteAttributes, currentLongNoteY);
 			}
 			else
 			{
@@ -1,7 +1,9 @@
 ﻿#pragma once
 #include "MusicGame/GameDefines.hpp"
 #include "MusicGame/GameStatus.hpp"
+#include "MusicGame/NoteAttributeTable.hpp"
 #include "MusicGame/Judgment/JudgmentHandler.hpp"
+#include "MusicGame/Judgment/JudgmentInput.hpp"
 #include "kson/ChartData.hpp"
 #include "kson/Util/TimingUtils.hpp"
 
@@ -22,7 +24,7 @@ namespace MusicGame::Judgment
 		const GaugeType m_gaugeType;
 		const FastSlowMode m_fastSlowMode;
 		const Button m_keyConfigButton;
-		const std::map<kson::Pulse, double> m_pulseToSec;
+		const ButtonNoteAttributeLane& m_noteAttributes;
 
 		bool m_isLockedForExit = false;
 
@@ -31,21 +33,22 @@ namespace MusicGame::Judgment
 
 		kson::Pulse m_prevPulse = kPastPulse;
 
-		kson::ByPulse<kson::Interval>::const_iterator m_passedNoteCursor;
+		std::size_t m_passedNoteIdx = 0U;
 		kson::ByPulse<LongNoteJudgment>::iterator m_passedLongJudgmentCursor;
 
 		double errorWindowSec() const;
 
-		void processKeyDown(const kson::ChartData& chartData, const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
+		void processKeyDown(kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
 
 		void processKeyPressed(const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, const ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
 
-		void processPassedNoteJudgment(const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef, IsAutoPlayYN isAutoPlay);
+		void processPassedNoteJudgment(kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef, IsAutoPlayYN isAutoPlay);
 
 	public:
-		ButtonLaneJudgment(JudgmentPlayMode judgmentPlayMode, GaugeType gaugeType, FastSlowMode fastSlowMode, Button keyConfigButton, const kson::ByPulse<kson::Interval>& lane, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache);
+		/// @param noteAttributes laneに対応するノーツの属性(このインスタンスより長く生存すること)
+		ButtonLaneJudgment(JudgmentPlayMode judgmentPlayMode, GaugeType gaugeType, FastSlowMode fastSlowMode, Button keyConfigButton, const kson::ByPulse<kson::Interval>& lane, const ButtonNoteAttributeLane& noteAttributes, const kson::BeatInfo& beatInfo);
 
-		void update(const kson::ChartData& chartData, const kson::ByPulse<kson::Interval>& lane, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
+		void update(const kson::ByPulse<kson::Interval>& lane, const JudgmentInput& input, kson::Pulse currentPulse, double currentTimeSec, double currentTimeSecForDraw, ButtonLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
 
 		std::size_t chipJudgmentCount() const;
 
@@ -0,0 +1,32 @@
+﻿#include "JudgmentInput.hpp"
+#include "Input/KeyConfig.hpp"
+
+namespace MusicGame::Judgment
+{
+	JudgmentInput CaptureJudgmentInput(JudgmentPlayMode laserJudgmentPlayMode)
+	{
+		JudgmentInput input;
+
+		for (std::size_t i = 0U; i < kNumJudgmentButtons; ++i)
+		{
+			const Button button = static_cast<Button>(kButtonBT_A + i);
+			input.buttons[i] = ButtonInput
+			{
+				.pressed = KeyConfig::Pressed(button),
+				.down = KeyConfig::Down(button),
+				.up = KeyConfig::Up(button),
+			};
+		}
+
+		// Note: LASER入力方式は前回取得時からの差分を返すため、判定に使用する場合のみ取得する
+		if (laserJudgmentPlayMode == JudgmentPlayMode::kOn)
+		{
+			for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
+			{
+				input.laserDeltaCursorX[i] = KeyConfig::LaserDeltaCursorX(static_cast<int32>(i), Scene::DeltaTime());
+			}
+		}
+
+		return input;
+	}
+}
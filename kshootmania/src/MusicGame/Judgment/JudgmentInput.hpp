@@ -0,0 +1,49 @@
+﻿#pragma once
+#include "kson/Common/Common.hpp"
+
+namespace MusicGame::Judgment
+{
+	/// @brief 判定に使用するボタンの数(kButtonBT_A〜kButtonFX_R)
+	constexpr std::size_t kNumJudgmentButtons = kson::kNumBTLanesSZ + kson::kNumFXLanesSZ;
+
+	/// @brief 1フレーム分のボタンの入力状態
+	struct ButtonInput
+	{
+		bool pressed = false;
+
+		bool down = false;
+
+		bool up = false;
+
+		// 押下した時刻の、フレームの時刻からのずれ(秒、0以下)
+		// (入力スレッドで押下時刻を取得できた場合のみ設定され、取得できなかった場合はフレームの時刻で判定する)
+		double downTimeOffsetSec = 0.0;
+
+		bool operator==(const ButtonInput&) const = default;
+	};
+
+	/// @brief 1フレーム分の判定用の入力
+	/// @note 判定はKeyConfigを直接参照せずにこの値のみを参照する。リプレイの記録・再生もこの単位で行う
+	struct JudgmentInput
+	{
+		// kButtonBT_A〜kButtonFX_Rの順
+		std::array<ButtonInput, kNumJudgmentButtons> buttons = {};
+
+		// LASERカーソルの移動量(左LASER, 右LASERの順)
+		std::array<double, kson::kNumLaserLanesSZ> laserDeltaCursorX = {};
+
+		const ButtonInput& button(Button button) const
+		{
+			assert(0 <= button && static_cast<std::size_t>(button) < kNumJudgmentButtons && "Button is not a judgment button");
+			return buttons[static_cast<std::size_t>(button)];
+		}
+
+		bool operator==(const JudgmentInput&) const = default;
+	};
+
+	/// @brief 現在のフレームの入力をKeyConfigから取得
+	/// @param laserJudgmentPlayMode LASERの判定モード(kOnの場合のみLASER入力を取得する)
+	/// @return 判定用の入力
+	[[nodiscard]]
+	JudgmentInput CaptureJudgmentInput(JudgmentPlayMode laserJudgmentPlayMode);
+}
@@ -0,0 +1,57 @@
+﻿#include "JudgmentInputTimestamper.hpp"
+
+namespace MusicGame::Judgment
+{
+	void JudgmentInputTimestamper::addEvent(const ButtonEvent& event)
+	{
+		if (event.button < 0 || static_cast<std::size_t>(event.button) >= kNumJudgmentButtons)
+		{
+			return;
+		}
+		m_pendingEvents.push_back(event);
+	}
+
+	void JudgmentInputTimestamper::apply(JudgmentInput& inputRef, std::chrono::steady_clock::time_point frameTime)
+	{
+		for (std::size_t i = 0U; i < kNumJudgmentButtons; ++i)
+		{
+			ButtonInput& buttonRef = inputRef.buttons[i];
+			if (!buttonRef.down)
+			{
+				continue;
+			}
+
+			// フレーム内で最初に押下したときの時刻を使用する(KeyConfig::Down()もフレーム内の最初の押下で真になるため)
+			const Button button = static_cast<Button>(i);
+			const auto itr = std::find_if(m_pendingEvents.begin(), m_pendingEvents.end(), [button, frameTime](const ButtonEvent& event)
+			{
+				return event.button == button && event.isDown && event.time <= frameTime;
+			});
+			if (itr == m_pendingEvents.end())
+			{
+				continue;
+			}
+
+			buttonRef.downTimeOffsetSec = Min(std::chrono::duration<double>(itr->time - frameTime).count(), 0.0);
+
+			// 使用したイベントと、それ以前の同じボタンのイベントは以降使用しない
+			const auto usedTime = itr->time;
+			m_pendingEvents.remove_if([button, usedTime](const ButtonEvent& event)
+			{
+				return event.button == button && event.time <= usedTime;
+			});
+		}
+
+		// 前回のフレームより前のイベントは前回までのフレーム単位の入力に反映済みのはずなので破棄する
+		// (入力スレッドの検出がフレーム単位の入力より遅れた場合に、次の押下へ誤って対応付けないようにするため)
+		if (m_prevFrameTime.has_value())
+		{
+			const auto prevFrameTime = *m_prevFrameTime;
+			m_pendingEvents.remove_if([prevFrameTime](const ButtonEvent& event)
+			{
+				return event.time < prevFrameTime;
+			});
+		}
+		m_prevFrameTime = frameTime;
+	}
+}
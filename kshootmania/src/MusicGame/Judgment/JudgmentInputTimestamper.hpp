@@ -0,0 +1,30 @@
+﻿#pragma once
+#include "Input/ButtonEvent/ButtonEvent.hpp"
+#include "JudgmentInput.hpp"
+
+namespace MusicGame::Judgment
+{
+	/// @brief 入力スレッドで検出したButtonEventの時刻を、フレーム単位で取得した入力に押下時刻として付与する
+	/// @details 押下・解放の有無はフレーム単位の入力(KeyConfig)を正とし、押下時刻のみをButtonEventから補完する。
+	///          そのため、入力スレッドが対応していない入力デバイスの押下は従来通りフレームの時刻で判定される
+	class JudgmentInputTimestamper
+	{
+	private:
+		// まだフレーム単位の入力に反映されていない可能性があるイベント
+		Array<ButtonEvent> m_pendingEvents;
+
+		Optional<std::chrono::steady_clock::time_point> m_prevFrameTime;
+
+	public:
+		JudgmentInputTimestamper() = default;
+
+		/// @brief 入力スレッドから取り出したイベントを追加
+		/// @param event イベント(時刻順に追加すること)
+		void addEvent(const ButtonEvent& event);
+
+		/// @brief フレーム単位の入力に押下時刻を付与
+		/// @param inputRef フレーム単位の入力
+		/// @param frameTime 入力を取得したフレームの時刻(再生時間を取得した時刻)
+		void apply(JudgmentInput& inputRef, std::chrono::steady_clock::time_point frameTime);
+	};
+}
@@ -4,16 +4,16 @@
 namespace MusicGame::Judgment
 {
 
-	JudgmentMain::JudgmentMain(const kson::ChartData& chartData, const kson::TimingCache& timingCache, const PlayOption& playOption, const Optional<CourseContinuation>& courseContinuation, GameMode gameMode)
+	JudgmentMain::JudgmentMain(const kson::ChartData& chartData, const kson::TimingCache& timingCache, const NoteAttributeTable& noteAttributeTable, const PlayOption& playOption, const Optional<CourseContinuation>& courseContinuation, GameMode gameMode)
 		: m_playOption(playOption)
 		, m_btLaneJudgments{
-			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_A, chartData.note.bt[0], chartData.beat, timingCache),
-			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_B, chartData.note.bt[1], chartData.beat, timingCache),
-			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_C, chartData.note.bt[2], chartData.beat, timingCache),
-			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_D, chartData.note.bt[3], chartData.beat, timingCache) }
+			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_A, chartData.note.bt[0], noteAttributeTable.btLane(0), chartData.beat),
+			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_B, chartData.note.bt[1], noteAttributeTable.btLane(1), chartData.beat),
+			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_C, chartData.note.bt[2], noteAttributeTable.btLane(2), chartData.beat),
+			ButtonLaneJudgment(playOption.effectiveBtJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonBT_D, chartData.note.bt[3], noteAttributeTable.btLane(3), chartData.beat) }
 		, m_fxLaneJudgments{
-			ButtonLaneJudgment(playOption.effectiveFxJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonFX_L, chartData.note.fx[0], chartData.beat, timingCache),
-			ButtonLaneJudgment(playOption.effectiveFxJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonFX_R, chartData.note.fx[1], chartData.beat, timingCache) }
+			ButtonLaneJudgment(playOption.effectiveFxJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonFX_L, chartData.note.fx[0], noteAttributeTable.fxLane(0), chartData.beat),
+			ButtonLaneJudgment(playOption.effectiveFxJudgmentPlayMode(), playOption.gaugeType, playOption.fastSlowMode, kButtonFX_R, chartData.note.fx[1], noteAttributeTable.fxLane(1), chartData.beat) }
 		, m_laserLaneJudgments{
 			LaserLaneJudgment(playOption.effectiveLaserJudgmentPlayMode(), 0, kButtonLeftLaserL, kButtonLeftLaserR, chartData.note.laser[0], chartData.beat, timingCache),
 			LaserLaneJudgment(playOption.effectiveLaserJudgmentPlayMode(), 1, kButtonRightLaserL, kButtonRightLaserR, chartData.note.laser[1], chartData.beat, timingCache) }
@@ -21,30 +21,62 @@ namespace MusicGame::Judgment
 	{
 	}
 
-	void JudgmentMain::update(const kson::ChartData& chartData, GameStatus& gameStatusRef, ViewStatus& viewStatusRef)
+	void JudgmentMain::update(const kson::ChartData& chartData, const JudgmentInput& input, GameStatus& gameStatusRef, ViewStatus& viewStatusRef)
 	{
 		// BTレーンの判定
 		for (std::size_t i = 0U; i < kson::kNumBTLanesSZ; ++i)
 		{
-			m_btLaneJudgments[i].update(chartData, chartData.note.bt[i], gameStatusRef.currentPulseForButtonJudgment, gameStatusRef.currentTimeSecForButtonJudgment, gameStatusRef.currentTimeSec, gameStatusRef.btLaneStatus[i], m_judgmentHandler);
+			m_btLaneJudgments[i].update(chartData.note.bt[i], input, gameStatusRef.currentPulseForButtonJudgment, gameStatusRef.currentTimeSecForButtonJudgment, gameStatusRef.currentTimeSec, gameStatusRef.btLaneStatus[i], m_judgmentHandler);
 		}
 
 		// FXレーンの判定
 		for (std::size_t i = 0U; i < kson::kNumFXLanesSZ; ++i)
 		{
-			m_fxLaneJudgments[i].update(chartData, chartData.note.fx[i], gameStatusRef.currentPulseForButtonJudgment, gameStatusRef.currentTimeSecForButtonJudgment, gameStatusRef.currentTimeSec, gameStatusRef.fxLaneStatus[i], m_judgmentHandler);
+			m_fxLaneJudgments[i].update(chartData.note.fx[i], input, gameStatusRef.currentPulseForButtonJudgment, gameStatusRef.currentTimeSecForButtonJudgment, gameStatusRef.currentTimeSec, gameStatusRef.fxLaneStatus[i], m_judgmentHandler);
 		}
 
 		// LASERレーンの判定
 		for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
 		{
-			m_laserLaneJudgments[i].update(chartData.note.laser[i], gameStatusRef.currentPulseForLaserJudgment, gameStatusRef.currentPulse, gameStatusRef.currentTimeSecForLaserJudgment, gameStatusRef.currentTimeSec, gameStatusRef.laserLaneStatus[i], m_judgmentHandler);
+			m_laserLaneJudgments[i].update(chartData.note.laser[i], input, gameStatusRef.currentPulseForLaserJudgment, gameStatusRef.currentPulse, gameStatusRef.currentTimeSecForLaserJudgment, gameStatusRef.currentTimeSec, gameStatusRef.laserLaneStatus[i], m_judgmentHandler);
 		}
 
 		// 状態をViewStatusに反映
 		m_judgmentHandler.applyToViewStatus(viewStatusRef, gameStatusRef.currentTimeSec, gameStatusRef.currentPulse);
 	}
 
+	bool JudgmentMain::updatePlayFinishStatus(const kson::ChartData& chartData, const kson::TimingCache& timingCache, GameStatus& gameStatusRef, const ViewStatus& viewStatus)
+	{
+		// HARDゲージ/コースモード落ち判定
+		if (!gameStatusRef.playFinishStatus.has_value() &&
+			(m_playOption.gaugeType == GaugeType::kHardGauge || m_playOption.gameMode == GameMode::kCourseMode) &&
+			viewStatus.gaugePercentageInt <= kGaugePercentageThresholdHard)
+		{
+			gameStatusRef.playFinishStatus = PlayFinishStatus
+			{
+				.finishTimeSec = gameStatusRef.currentTimeSec,
+				.achievement = Achievement::kNone,
+				.isHardFailed = IsHardFailedYN::Yes,
+			};
+
+			// HARD落ち以降の入力は無視
+			lockForExit();
+
+			return true;
+		}
+
+		if (!gameStatusRef.playFinishStatus.has_value() && isFinished())
+		{
+			gameStatusRef.playFinishStatus = PlayFinishStatus
+			{
+				.finishTimeSec = gameStatusRef.currentTimeSec,
+				.achievement = playResult(chartData, timingCache, gameStatusRef.currentTimeSec, IsHardFailedYN::No).achievement(),
+			};
+		}
+
+		return false;
+	}
+
 	void JudgmentMain::lockForExit()
 	{
 		// ERROR判定通知時にゲージが変動しないよう先にロック
@@ -4,6 +4,7 @@
 #include "ButtonLaneJudgment.hpp"
 #include "LaserLaneJudgment.hpp"
 #include "JudgmentHandler.hpp"
+#include "JudgmentInput.hpp"
 
 namespace MusicGame::Judgment
 {
@@ -19,9 +20,23 @@ namespace MusicGame::Judgment
 		JudgmentHandler m_judgmentHandler;
 
 	public:
-		explicit JudgmentMain(const kson::ChartData& chartData, const kson::TimingCache& timingCache, const PlayOption& playOption, const Optional<CourseContinuation>& courseContinuation, GameMode gameMode);
+		explicit JudgmentMain(const kson::ChartData& chartData, const kson::TimingCache& timingCache, const NoteAttributeTable& noteAttributeTable, const PlayOption& playOption, const Optional<CourseContinuation>& courseContinuation, GameMode gameMode);
 
-		void update(const kson::ChartData& chartData, GameStatus& gameStatusRef, ViewStatus& viewStatusRef);
+		/// @brief 1フレーム分の判定を更新
+		/// @param chartData 譜面データ
+		/// @param input このフレームの入力
+		/// @param gameStatusRef 時間関連の値を更新済みのGameStatusへの参照
+		/// @param viewStatusRef ViewStatusへの参照
+		void update(const kson::ChartData& chartData, const JudgmentInput& input, GameStatus& gameStatusRef, ViewStatus& viewStatusRef);
+
+		/// @brief HARDゲージ/コースモードの落ち判定と全ノーツ判定済みの判定を行い、GameStatusのplayFinishStatusを更新する
+		/// @param chartData 譜面データ
+		/// @param timingCache タイミングキャッシュ
+		/// @param gameStatusRef GameStatusへの参照
+		/// @param viewStatus update()適用後のViewStatus
+		/// @return この呼び出しでHARD落ちした場合はtrue
+		/// @remark HARD落ちした場合は以降の入力を無視するためlockForExit()を呼び出す
+		bool updatePlayFinishStatus(const kson::ChartData& chartData, const kson::TimingCache& timingCache, GameStatus& gameStatusRef, const ViewStatus& viewStatus);
 
 		/// @brief プレイ終了のために判定処理をロックし、残りの未判定ノーツをERROR判定にする
 		void lockForExit();
@@ -1,7 +1,6 @@
 ﻿#include "LaserLaneJudgment.hpp"
 #include "kson/Util/TimingUtils.hpp"
 #include "kson/Util/GraphUtils.hpp"
-#include "Input/KeyConfig.hpp"
 
 namespace MusicGame::Judgment
 {
@@ -808,7 +807,7 @@ namespace MusicGame::Judgment
 	{
 	}
 
-	void LaserLaneJudgment::update(const kson::ByPulse<kson::LaserSection>& lane, kson::Pulse currentPulse, kson::Pulse currentPulseForDraw, double currentTimeSec, double currentTimeSecForDraw, LaserLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef)
+	void LaserLaneJudgment::update(const kson::ByPulse<kson::LaserSection>& lane, const JudgmentInput& input, kson::Pulse currentPulse, kson::Pulse currentPulseForDraw, double currentTimeSec, double currentTimeSecForDraw, LaserLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef)
 	{
 		laneStatusRef.noteCursorX = kson::GraphSectionValueAt(lane, currentPulse);
 
@@ -899,7 +898,7 @@ namespace MusicGame::Judgment
 		if (m_judgmentPlayMode == JudgmentPlayMode::kOn)
 		{
 			// 入力からカーソルの移動量を取得
-			const double deltaCursorX = KeyConfig::LaserDeltaCursorX(m_laneIdx, Scene::DeltaTime());
+			const double deltaCursorX = input.laserDeltaCursorX[static_cast<std::size_t>(m_laneIdx)];
 			processCursorMovement(deltaCursorX, currentPulse, currentTimeSec, laneStatusRef);
 			processSlamJudgment(lane, deltaCursorX, currentTimeSec, laneStatusRef, judgmentHandlerRef, IsAutoPlayYN::No);
 
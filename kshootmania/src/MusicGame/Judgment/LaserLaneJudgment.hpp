@@ -3,6 +3,7 @@
 #include "MusicGame/GameStatus.hpp"
 #include "MusicGame/ViewStatus.hpp"
 #include "MusicGame/Judgment/JudgmentHandler.hpp"
+#include "MusicGame/Judgment/JudgmentInput.hpp"
 #include "kson/ChartData.hpp"
 #include "kson/Util/TimingUtils.hpp"
 
@@ -125,7 +126,7 @@ namespace MusicGame::Judgment
 	public:
 		LaserLaneJudgment(JudgmentPlayMode judgmentPlayMode, int32 laneIdx, Button keyConfigButtonL, Button keyConfigButtonR, const kson::ByPulse<kson::LaserSection>& lane, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache);
 
-		void update(const kson::ByPulse<kson::LaserSection>& lane, kson::Pulse currentPulse, kson::Pulse currentPulseForDraw, double currentSec, double currentTimeSecForDraw, LaserLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
+		void update(const kson::ByPulse<kson::LaserSection>& lane, const JudgmentInput& input, kson::Pulse currentPulse, kson::Pulse currentPulseForDraw, double currentSec, double currentTimeSecForDraw, LaserLaneStatus& laneStatusRef, JudgmentHandler& judgmentHandlerRef);
 
 		/// @brief プレイ終了のために判定処理をロックし、残りの未判定ノーツをERROR判定にする
 		/// @param judgmentHandlerRef 判定ハンドラへの参照
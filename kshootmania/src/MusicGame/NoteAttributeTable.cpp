@@ -0,0 +1,90 @@
+﻿#include "NoteAttributeTable.hpp"
+#include "MusicGame/Graphics/Highway/Note/NoteGraphicsUtils.hpp"
+
+namespace MusicGame
+{
+	namespace
+	{
+		/// @brief FXレーン上でキー音が指定されているPulse値の一覧を作成
+		/// @param chipEvent kson.audio.key_sound.fx.chip_event
+		/// @param laneIdx FXレーンのインデックス
+		/// @return キー音が指定されているPulse値(昇順・重複なし)
+		std::vector<kson::Pulse> CreateFXKeySoundPulses(const kson::KeySoundInvokeListFX& chipEvent, std::size_t laneIdx)
+		{
+			std::vector<kson::Pulse> pulses;
+			for (const auto& [filename, lanes] : chipEvent)
+			{
+				if (laneIdx >= lanes.size())
+				{
+					continue;
+				}
+
+				for (const auto& [y, _] : lanes[laneIdx])
+				{
+					pulses.push_back(y);
+				}
+			}
+
+			std::sort(pulses.begin(), pulses.end());
+			pulses.erase(std::unique(pulses.begin(), pulses.end()), pulses.end());
+			return pulses;
+		}
+
+		ButtonNoteAttributeLane CreateButtonNoteAttributeLane(const kson::ByPulse<kson::Interval>& lane, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const Scroll::ScrollSpeedIntegralTable& scrollSpeedIntegralTable, NoteSkinType noteSkin, bool isBT, const std::vector<kson::Pulse>& keySoundPulses)
+		{
+			ButtonNoteAttributeLane attributes;
+			attributes.reserve(lane.size());
+
+			for (const auto& [y, note] : lane)
+			{
+				const bool isChip = note.length == 0;
+				const Scroll::PulsePosition start = Scroll::CreatePulsePosition(y, beatInfo, timingCache, scrollSpeedIntegralTable);
+				attributes.push_back({
+					.start = start,
+					.end = isChip ? start : Scroll::CreatePulsePosition(y + note.length, beatInfo, timingCache, scrollSpeedIntegralTable),
+					.chipColorIndex = (isBT && isChip) ? Graphics::NoteGraphicsUtils::CalcChipNoteColorIndex(y, beatInfo, noteSkin) : 0,
+					.hasKeySound = !isBT && isChip && std::binary_search(keySoundPulses.begin(), keySoundPulses.end(), y),
+				});
+			}
+
+			return attributes;
+		}
+	}
+
+	NoteAttributeTable::NoteAttributeTable(const kson::ChartData& chartData, const kson::TimingCache& timingCache, NoteSkinType noteSkin)
+	{
+		const Scroll::ScrollSpeedIntegralTable scrollSpeedIntegralTable(chartData.beat.scrollSpeed);
+
+		for (std::size_t laneIdx = 0; laneIdx < kson::kNumBTLanesSZ; ++laneIdx)
+		{
+			m_btLanes[laneIdx] = CreateButtonNoteAttributeLane(chartData.note.bt[laneIdx], chartData.beat, timingCache, scrollSpeedIntegralTable, noteSkin, true, {});
+		}
+
+		for (std::size_t laneIdx = 0; laneIdx < kson::kNumFXLanesSZ; ++laneIdx)
+		{
+			const std::vector<kson::Pulse> keySoundPulses = CreateFXKeySoundPulses(chartData.audio.keySound.fx.chipEvent, laneIdx);
+			m_fxLanes[laneIdx] = CreateButtonNoteAttributeLane(chartData.note.fx[laneIdx], chartData.beat, timingCache, scrollSpeedIntegralTable, noteSkin, false, keySoundPulses);
+		}
+	}
+
+	const ButtonNoteAttributeLane& NoteAttributeTable::btLane(std::size_t laneIdx) const
+	{
+		return m_btLanes.at(laneIdx);
+	}
+
+	const ButtonNoteAttributeLane& NoteAttributeTable::fxLane(std::size_t laneIdx) const
+	{
+		return m_fxLanes.at(laneIdx);
+	}
+
+	Optional<std::size_t> FindButtonNoteAttributeIdx(const ButtonNoteAttributeLane& lane, kson::Pulse y)
+	{
+		const auto itr = std::lower_bound(lane.begin(), lane.end(), y,
+			[](const ButtonNoteAttribute& attribute, kson::Pulse pulse) { return attribute.start.pulse < pulse; });
+		if (itr == lane.end() || itr->start.pulse != y)
+		{
+			return none;
+		}
+		return static_cast<std::size_t>(std::distance(lane.begin(), itr));
+	}
+}
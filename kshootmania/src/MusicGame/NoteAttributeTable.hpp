@@ -0,0 +1,68 @@
+﻿#pragma once
+#include "MusicGame/Scroll/HighwayScroll.hpp"
+
+namespace MusicGame
+{
+	/// @brief 譜面読み込み時に事前計算したボタンノーツ(BT/FX)の属性
+	struct ButtonNoteAttribute
+	{
+		/// @brief 始点
+		Scroll::PulsePosition start;
+
+		/// @brief 終点(チップノーツの場合は始点と同じ)
+		Scroll::PulsePosition end;
+
+		/// @brief チップBTノーツの色インデックス(ノーツスキン設定を反映済み。それ以外のノーツは0)
+		int32 chipColorIndex = 0;
+
+		/// @brief キー音付きのチップFXノーツかどうか
+		bool hasKeySound = false;
+
+		/// @brief チップノーツかどうか
+		/// @return チップノーツであればtrue
+		[[nodiscard]]
+		bool isChip() const
+		{
+			return start.pulse == end.pulse;
+		}
+	};
+
+	/// @brief ボタンノーツ1レーン分の属性(kson::ByPulseのノーツと同じ順序)
+	using ButtonNoteAttributeLane = std::vector<ButtonNoteAttribute>;
+
+	/// @brief 描画・判定で毎フレーム参照するノーツの属性を譜面読み込み時に事前計算したテーブル
+	/// @details キー音の有無やチップノーツの色などをノーツ毎に一度だけ求めておき、描画・判定では連続した配列を添字で参照する。
+	///          各レーンの要素は譜面データのレーンと同じPulse値順に並ぶため、レーン上のノーツの順番をそのまま添字として使用できる
+	class NoteAttributeTable
+	{
+	private:
+		std::array<ButtonNoteAttributeLane, kson::kNumBTLanesSZ> m_btLanes;
+		std::array<ButtonNoteAttributeLane, kson::kNumFXLanesSZ> m_fxLanes;
+
+	public:
+		/// @brief コンストラクタ
+		/// @param chartData 譜面データ(scroll_speedはHighwayScrollに渡すものと同じであること)
+		/// @param timingCache 事前計算したTimingCache
+		/// @param noteSkin ノーツスキン
+		NoteAttributeTable(const kson::ChartData& chartData, const kson::TimingCache& timingCache, NoteSkinType noteSkin);
+
+		/// @brief BTレーンの属性を返す
+		/// @param laneIdx レーンのインデックス
+		/// @return BTレーンの属性
+		[[nodiscard]]
+		const ButtonNoteAttributeLane& btLane(std::size_t laneIdx) const;
+
+		/// @brief FXレーンの属性を返す
+		/// @param laneIdx レーンのインデックス
+		/// @return FXレーンの属性
+		[[nodiscard]]
+		const ButtonNoteAttributeLane& fxLane(std::size_t laneIdx) const;
+	};
+
+	/// @brief 指定したPulse値を始点とするノーツの属性のインデックスを二分探索で求める
+	/// @param lane ボタンノーツ1レーン分の属性
+	/// @param y ノーツの始点のPulse値
+	/// @return インデックス(該当するノーツがない場合はnone)
+	[[nodiscard]]
+	Optional<std::size_t> FindButtonNoteAttributeIdx(const ButtonNoteAttributeLane& lane, kson::Pulse y);
+}
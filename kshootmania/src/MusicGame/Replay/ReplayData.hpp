@@ -0,0 +1,36 @@
+﻿#pragma once
+#include "Course/CourseContinuation.hpp"
+#include "MusicGame/PlayOption.hpp"
+#include "MusicGame/Judgment/JudgmentInput.hpp"
+
+namespace MusicGame::Replay
+{
+	/// @brief リプレイの1フレーム分の記録
+	struct ReplayFrame
+	{
+		// 曲の再生時間(GameStatus::currentTimeSec)
+		double currentTimeSec = 0.0;
+
+		// 判定用の入力
+		Judgment::JudgmentInput input;
+
+		// このフレームの判定後にlockForExit()が呼ばれたかどうか(プレイ中にBackボタンで抜けた場合)
+		bool isLockedForExit = false;
+
+		bool operator==(const ReplayFrame&) const = default;
+	};
+
+	/// @brief リプレイデータ
+	/// @note 判定は入力と再生時間のみに依存するため、フレームごとの両者を記録すればPlayResultを完全に再現できる
+	struct ReplayData
+	{
+		// 記録した譜面ファイルのハッシュ値(編集後の譜面へ適用しないためのもの)
+		uint64 chartFileHash = 0;
+
+		PlayOption playOption;
+
+		Optional<CourseContinuation> courseContinuation = none;
+
+		Array<ReplayFrame> frames;
+	};
+}
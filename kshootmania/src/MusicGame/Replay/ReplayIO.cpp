@@ -0,0 +1,365 @@
+﻿#include "ReplayIO.hpp"
+#include <bit>
+#include "Common/BinaryBufferIO.hpp"
+#include "HighScore/KscIO.hpp"
+#include "Common/FsUtils.hpp"
+#include "Common/PersistenceQueue.hpp"
+#include "kson/IO/KsonBinaryIO.hpp"
+
+namespace MusicGame::Replay
+{
+	namespace
+	{
+		constexpr std::array<char, 8> kMagic = { 'K', 'S', 'M', 'R', 'P', 'L', 'Y', '\0' };
+
+		// フォーマットを変更した場合はインクリメントすること(バージョンが異なるリプレイファイルは読み込まない)
+		constexpr uint32 kFormatVersion = 2;
+
+		constexpr StringView kReplayExtension = U"ksr";
+
+		// フレームのフラグ
+		// (LASERの移動量は0の場合が大半のため、0以外の場合のみ書き込む)
+		constexpr uint8 kFrameFlagLaserL = 1 << 0;
+		constexpr uint8 kFrameFlagLaserR = 1 << 1;
+		constexpr uint8 kFrameFlagLockedForExit = 1 << 2;
+		constexpr uint8 kFrameFlagDownTimeOffset = 1 << 3;
+
+		// LASERの移動量・押下時刻のずれを除いた1フレームあたりのバイト数(時間 + フラグ + ボタン3種)
+		constexpr std::size_t kFrameMinSize = sizeof(double) + sizeof(uint8) * 4;
+
+		constexpr std::array<uint8, kson::kNumLaserLanesSZ> kFrameFlagsLaser = { kFrameFlagLaserL, kFrameFlagLaserR };
+
+		void WritePlayOption(BinaryBufferWriter& writer, const PlayOption& playOption)
+		{
+			writer.write(static_cast<int32>(playOption.gameMode));
+			writer.write(static_cast<uint8>(playOption.isAutoPlay.getBool()));
+			writer.write(static_cast<int32>(playOption.gaugeType));
+			writer.write(static_cast<int32>(playOption.turnMode));
+			writer.write(playOption.playbackSpeed);
+			writer.write(static_cast<int32>(playOption.btJudgmentPlayMode));
+			writer.write(static_cast<int32>(playOption.fxJudgmentPlayMode));
+			writer.write(static_cast<int32>(playOption.laserJudgmentPlayMode));
+			writer.write(playOption.globalOffsetMs);
+			writer.write(playOption.inputDelayMs);
+			writer.write(playOption.laserInputDelayMs);
+			writer.write(playOption.audioProcDelayMs);
+			writer.write(playOption.visualOffsetMs);
+			writer.write(static_cast<uint8>(playOption.isAutoPlaySE));
+			writer.write(static_cast<int32>(playOption.noteSkin));
+			writer.write(static_cast<int32>(playOption.fastSlowMode));
+			writer.write(static_cast<uint32>(playOption.availableHispeedTypes.size()));
+			for (const HispeedType hispeedType : playOption.availableHispeedTypes)
+			{
+				writer.write(static_cast<int32>(hispeedType));
+			}
+			writer.write(static_cast<int32>(playOption.hispeedSetting.type));
+			writer.write(playOption.hispeedSetting.value);
+			writer.write(static_cast<uint8>(playOption.movieEnabled));
+			writer.write(static_cast<uint8>(playOption.showBG));
+			writer.write(static_cast<uint8>(playOption.showLayer));
+		}
+
+		PlayOption ReadPlayOption(BinaryBufferReader& reader)
+		{
+			PlayOption playOption;
+			playOption.gameMode = static_cast<GameMode>(reader.read<int32>());
+			playOption.isAutoPlay = IsAutoPlayYN{ reader.read<uint8>() != 0 };
+			playOption.gaugeType = static_cast<GaugeType>(reader.read<int32>());
+			playOption.turnMode = static_cast<TurnMode>(reader.read<int32>());
+			playOption.playbackSpeed = reader.read<double>();
+			playOption.btJudgmentPlayMode = static_cast<JudgmentPlayMode>(reader.read<int32>());
+			playOption.fxJudgmentPlayMode = static_cast<JudgmentPlayMode>(reader.read<int32>());
+			playOption.laserJudgmentPlayMode = static_cast<JudgmentPlayMode>(reader.read<int32>());
+			playOption.globalOffsetMs = reader.read<int32>();
+			playOption.inputDelayMs = reader.read<int32>();
+			playOption.laserInputDelayMs = reader.read<int32>();
+			playOption.audioProcDelayMs = reader.read<int32>();
+			playOption.visualOffsetMs = reader.read<int32>();
+			playOption.isAutoPlaySE = reader.read<uint8>() != 0;
+			playOption.noteSkin = static_cast<NoteSkinType>(reader.read<int32>());
+			playOption.fastSlowMode = static_cast<FastSlowMode>(reader.read<int32>());
+			const uint32 numAvailableHispeedTypes = reader.read<uint32>();
+			playOption.availableHispeedTypes.clear();
+			for (uint32 i = 0; i < numAvailableHispeedTypes && !reader.failed(); ++i)
+			{
+				playOption.availableHispeedTypes.push_back(static_cast<HispeedType>(reader.read<int32>()));
+			}
+			playOption.hispeedSetting.type = static_cast<HispeedType>(reader.read<int32>());
+			playOption.hispeedSetting.value = reader.read<int32>();
+			playOption.movieEnabled = reader.read<uint8>() != 0;
+			playOption.showBG = reader.read<uint8>() != 0;
+			playOption.showLayer = reader.read<uint8>() != 0;
+			return playOption;
+		}
+
+		template <typename Getter>
+		uint8 PackButtonBits(const Judgment::JudgmentInput& input, Getter getter)
+		{
+			uint8 bits = 0;
+			for (std::size_t i = 0U; i < Judgment::kNumJudgmentButtons; ++i)
+			{
+				if (getter(input.buttons[i]))
+				{
+					bits |= static_cast<uint8>(1 << i);
+				}
+			}
+			return bits;
+		}
+
+		void WriteFrame(BinaryBufferWriter& writer, const ReplayFrame& frame)
+		{
+			uint8 flags = frame.isLockedForExit ? kFrameFlagLockedForExit : 0;
+
+			// 押下時刻のずれは入力スレッドを使用した押下の場合のみ存在するため、0以外の場合のみ書き込む
+			const uint8 downTimeOffsetBits = PackButtonBits(frame.input, [](const Judgment::ButtonInput& button) { return button.down && std::bit_cast<uint64>(button.downTimeOffsetSec) != 0U; });
+			if (downTimeOffsetBits != 0)
+			{
+				flags |= kFrameFlagDownTimeOffset;
+			}
+			for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
+			{
+				// Note: 判定結果を完全に再現するため、-0.0も0.0と区別してビット列で比較する
+				if (std::bit_cast<uint64>(frame.input.laserDeltaCursorX[i]) != 0U)
+				{
+					flags |= kFrameFlagsLaser[i];
+				}
+			}
+
+			writer.write(frame.currentTimeSec);
+			writer.write(flags);
+			writer.write(PackButtonBits(frame.input, [](const Judgment::ButtonInput& button) { return button.pressed; }));
+			writer.write(PackButtonBits(frame.input, [](const Judgment::ButtonInput& button) { return button.down; }));
+			writer.write(PackButtonBits(frame.input, [](const Judgment::ButtonInput& button) { return button.up; }));
+			for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
+			{
+				if (flags & kFrameFlagsLaser[i])
+				{
+					writer.write(frame.input.laserDeltaCursorX[i]);
+				}
+			}
+			if (flags & kFrameFlagDownTimeOffset)
+			{
+				writer.write(downTimeOffsetBits);
+				for (std::size_t i = 0U; i < Judgment::kNumJudgmentButtons; ++i)
+				{
+					if (downTimeOffsetBits & (1 << i))
+					{
+						writer.write(frame.input.buttons[i].downTimeOffsetSec);
+					}
+				}
+			}
+		}
+
+		ReplayFrame ReadFrame(BinaryBufferReader& reader)
+		{
+			ReplayFrame frame;
+			frame.currentTimeSec = reader.read<double>();
+			const uint8 flags = reader.read<uint8>();
+			const uint8 pressedBits = reader.read<uint8>();
+			const uint8 downBits = reader.read<uint8>();
+			const uint8 upBits = reader.read<uint8>();
+			for (std::size_t i = 0U; i < Judgment::kNumJudgmentButtons; ++i)
+			{
+				const uint8 mask = static_cast<uint8>(1 << i);
+				frame.input.buttons[i] = Judgment::ButtonInput
+				{
+					.pressed = (pressedBits & mask) != 0,
+					.down = (downBits & mask) != 0,
+					.up = (upBits & mask) != 0,
+				};
+			}
+			for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
+			{
+				if (flags & kFrameFlagsLaser[i])
+				{
+					frame.input.laserDeltaCursorX[i] = reader.read<double>();
+				}
+			}
+			if (flags & kFrameFlagDownTimeOffset)
+			{
+				const uint8 downTimeOffsetBits = reader.read<uint8>();
+				for (std::size_t i = 0U; i < Judgment::kNumJudgmentButtons; ++i)
+				{
+					if (downTimeOffsetBits & (1 << i))
+					{
+						frame.input.buttons[i].downTimeOffsetSec = reader.read<double>();
+					}
+				}
+			}
+			frame.isLockedForExit = (flags & kFrameFlagLockedForExit) != 0;
+			return frame;
+		}
+
+		bool WriteReplayFileTo(FilePathView replayFilePath, const ReplayData& replayData)
+		{
+			const FilePath parentPath = FileSystem::ParentPath(replayFilePath);
+			if (!FileSystem::Exists(parentPath))
+			{
+				FileSystem::CreateDirectories(parentPath);
+			}
+
+			// 書き込み途中で終了した場合に壊れたリプレイファイルが残らないよう、一時ファイルへ書き込んでからリネームする
+			const std::string buffer = Serialize(replayData);
+			if (!FsUtils::WriteFileDurably(replayFilePath, buffer.data(), buffer.size()))
+			{
+				Logger << U"[ksm warning] Replay::WriteReplayFile: Could not write replay file (path:'{}')"_fmt(replayFilePath);
+				return false;
+			}
+			return true;
+		}
+	}
+
+	std::string Serialize(const ReplayData& replayData)
+	{
+		BinaryBufferWriter writer;
+		writer.reserve(256 + replayData.frames.size() * kFrameMinSize);
+
+		writer.write(kMagic);
+		writer.write(kFormatVersion);
+		writer.write(replayData.chartFileHash);
+		WritePlayOption(writer, replayData.playOption);
+
+		writer.write(static_cast<uint8>(replayData.courseContinuation.has_value()));
+		if (replayData.courseContinuation.has_value())
+		{
+			writer.write(replayData.courseContinuation->gaugeValue);
+			writer.write(replayData.courseContinuation->combo);
+			writer.write(static_cast<uint8>(replayData.courseContinuation->isNoError));
+		}
+
+		writer.write(static_cast<uint32>(replayData.frames.size()));
+		for (const auto& frame : replayData.frames)
+		{
+			WriteFrame(writer, frame);
+		}
+
+		return writer.buffer();
+	}
+
+	Optional<ReplayData> Deserialize(const void* data, std::size_t size)
+	{
+		BinaryBufferReader reader{ data, size };
+
+		const auto magic = reader.read<std::array<char, 8>>();
+		const uint32 formatVersion = reader.read<uint32>();
+		if (reader.failed() || magic != kMagic || formatVersion != kFormatVersion)
+		{
+			return none;
+		}
+
+		ReplayData replayData;
+		replayData.chartFileHash = reader.read<uint64>();
+		replayData.playOption = ReadPlayOption(reader);
+
+		if (reader.read<uint8>() != 0)
+		{
+			CourseContinuation courseContinuation;
+			courseContinuation.gaugeValue = reader.read<int32>();
+			courseContinuation.combo = reader.read<int32>();
+			courseContinuation.isNoError = reader.read<uint8>() != 0;
+			replayData.courseContinuation = courseContinuation;
+		}
+
+		const uint32 numFrames = reader.read<uint32>();
+		if (reader.failed() || reader.remainingSize() < numFrames * kFrameMinSize)
+		{
+			// フレーム数が残りのバイト数と矛盾する場合は壊れているとみなす
+			return none;
+		}
+
+		replayData.frames.reserve(numFrames);
+		for (uint32 i = 0; i < numFrames; ++i)
+		{
+			replayData.frames.push_back(ReadFrame(reader));
+		}
+
+		if (reader.failed())
+		{
+			return none;
+		}
+
+		return replayData;
+	}
+
+	uint64 ChartFileHash(FilePathView chartFilePath)
+	{
+		MemoryMappedFileView file{ chartFilePath };
+		if (!file)
+		{
+			return 0U;
+		}
+
+		// コンパイル済み譜面のキャッシュのキーと同じハッシュ値(FNV-1a 64bit)
+		const auto mapped = file.mapAll();
+		return kson::ChartContentHash(mapped.data, mapped.size);
+	}
+
+	Optional<FilePath> ChartReplayFilePath(FilePathView chartFilePath)
+	{
+		const Optional<FilePath> kscFilePath = KscIO::ChartKscFilePath(chartFilePath);
+		if (!kscFilePath.has_value())
+		{
+			return none;
+		}
+		return U"{}.{}"_fmt(FsUtils::EliminateExtension(*kscFilePath), kReplayExtension);
+	}
+
+	bool WriteReplayFile(FilePathView chartFilePath, const ReplayData& replayData)
+	{
+		const Optional<FilePath> replayFilePath = ChartReplayFilePath(chartFilePath);
+		if (!replayFilePath.has_value())
+		{
+			return false;
+		}
+		return WriteReplayFileTo(*replayFilePath, replayData);
+	}
+
+	std::shared_future<bool> EnqueueWriteReplayFile(FilePathView chartFilePath, ReplayData replayData)
+	{
+		// Note: リプレイファイルのパスはConfigIniの値から求めるため、ワーカースレッドではなくここで求める
+		const Optional<FilePath> replayFilePath = ChartReplayFilePath(chartFilePath);
+		if (!replayFilePath.has_value())
+		{
+			std::promise<bool> promise;
+			promise.set_value(false);
+			return promise.get_future().share();
+		}
+
+		// WriteFuncはコピー可能である必要があるため、shared_ptrで保持する
+		auto pReplayData = std::make_shared<const ReplayData>(std::move(replayData));
+		return PersistenceQueue::Shared().enqueue(*replayFilePath, [path = *replayFilePath, pReplayData] { return WriteReplayFileTo(path, *pReplayData); });
+	}
+
+	Optional<ReplayData> ReadReplayFile(FilePathView chartFilePath)
+	{
+		const Optional<FilePath> replayFilePath = ChartReplayFilePath(chartFilePath);
+		if (!replayFilePath.has_value() || !FileSystem::IsFile(*replayFilePath))
+		{
+			return none;
+		}
+
+		MemoryMappedFileView file{ *replayFilePath };
+		if (!file)
+		{
+			Logger << U"[ksm warning] Replay::ReadReplayFile: Could not open replay file (path:'{}')"_fmt(*replayFilePath);
+			return none;
+		}
+
+		const auto mapped = file.mapAll();
+		Optional<ReplayData> replayData = Deserialize(mapped.data, mapped.size);
+		if (!replayData.has_value())
+		{
+			Logger << U"[ksm warning] Replay::ReadReplayFile: Replay file is corrupted or outdated (path:'{}')"_fmt(*replayFilePath);
+			return none;
+		}
+
+		if (replayData->chartFileHash != ChartFileHash(chartFilePath))
+		{
+			// 記録後に譜面が編集された場合は同じ判定を再現できないため読み込まない
+			Logger << U"[ksm info] Replay::ReadReplayFile: Chart file has been modified since recording (path:'{}')"_fmt(*replayFilePath);
+			return none;
+		}
+
+		return replayData;
+	}
+}
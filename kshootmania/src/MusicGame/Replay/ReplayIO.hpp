@@ -0,0 +1,52 @@
+﻿#pragma once
+#include <future>
+#include "ReplayData.hpp"
+
+namespace MusicGame::Replay
+{
+	/// @brief リプレイデータをバイナリ形式に変換
+	/// @param replayData リプレイデータ
+	/// @return バイナリ形式のリプレイデータ
+	[[nodiscard]]
+	std::string Serialize(const ReplayData& replayData);
+
+	/// @brief バイナリ形式のリプレイデータを読み込む
+	/// @param data バイナリ形式のリプレイデータの先頭
+	/// @param size バイト数
+	/// @return リプレイデータ(形式が不正、またはバージョンが異なる場合はnone)
+	[[nodiscard]]
+	Optional<ReplayData> Deserialize(const void* data, std::size_t size);
+
+	/// @brief 譜面ファイルのハッシュ値を求める
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @return ハッシュ値(ファイルが開けない場合は0)
+	[[nodiscard]]
+	uint64 ChartFileHash(FilePathView chartFilePath);
+
+	/// @brief 譜面ファイルに対応するリプレイファイルのパスを取得
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @return リプレイファイルのパス(kscファイルと同じフォルダに拡張子ksrで配置。ksh形式の譜面でない場合はnone)
+	[[nodiscard]]
+	Optional<FilePath> ChartReplayFilePath(FilePathView chartFilePath);
+
+	/// @brief リプレイファイルを書き込む
+	/// @param chartFilePath 譜面ファイルのパス(リプレイファイルのパスではないので注意)
+	/// @param replayData リプレイデータ
+	/// @return 書き込みに成功した場合はtrue, そうでなければfalse
+	/// @remark 譜面ごとに直近のプレイのリプレイのみを保持する。書き込み途中で終了しても、以前のリプレイファイルか新しいリプレイファイルのどちらかが残る
+	bool WriteReplayFile(FilePathView chartFilePath, const ReplayData& replayData);
+
+	/// @brief リプレイファイルの書き込みをPersistenceQueueへ投入する
+	/// @param chartFilePath 譜面ファイルのパス(リプレイファイルのパスではないので注意)
+	/// @param replayData リプレイデータ
+	/// @return 書き込みの完了を待つためのfuture
+	/// @remark シリアライズと書き込みはワーカースレッドで行われる。リプレイファイルのパスをキーとするため、同じ譜面のリプレイを連続して投入した場合は最後のもののみ書き込まれる
+	[[nodiscard]]
+	std::shared_future<bool> EnqueueWriteReplayFile(FilePathView chartFilePath, ReplayData replayData);
+
+	/// @brief リプレイファイルを読み込む
+	/// @param chartFilePath 譜面ファイルのパス(リプレイファイルのパスではないので注意)
+	/// @return リプレイデータ(ファイルが存在しない・壊れている・譜面ファイルが記録時から変更されている場合はnone)
+	[[nodiscard]]
+	Optional<ReplayData> ReadReplayFile(FilePathView chartFilePath);
+}
@@ -0,0 +1,21 @@
+﻿#include "ReplaySimulator.hpp"
+#include "MusicGame/Simulation/JudgmentSimulator.hpp"
+
+namespace MusicGame::Replay
+{
+	PlayResult SimulateJudgment(const kson::ChartData& chartData, const ReplayData& replayData)
+	{
+		Simulation::JudgmentSimulator simulator(chartData, replayData.playOption, replayData.courseContinuation);
+		for (const ReplayFrame& frame : replayData.frames)
+		{
+			simulator.tick(frame.currentTimeSec, frame.input);
+
+			if (frame.isLockedForExit)
+			{
+				simulator.lockForExit();
+			}
+		}
+
+		return simulator.playResult();
+	}
+}
@@ -0,0 +1,15 @@
+﻿#pragma once
+#include "kson/ChartData.hpp"
+#include "MusicGame/PlayResult.hpp"
+#include "ReplayData.hpp"
+
+namespace MusicGame::Replay
+{
+	/// @brief リプレイの入力でJudgmentMainを駆動し、記録時のPlayResultを再計算する
+	/// @param chartData LoadChartDataForPlay()でreplayData.playOptionを指定して読み込んだ譜面データ
+	/// @param replayData リプレイデータ
+	/// @return PlayResult(記録時と同じ譜面・同じ判定処理であれば記録時と完全に一致する)
+	/// @remark 音声・描画を伴わないため、Siv3Dのメインループ外から呼び出してよい
+	[[nodiscard]]
+	PlayResult SimulateJudgment(const kson::ChartData& chartData, const ReplayData& replayData);
+}
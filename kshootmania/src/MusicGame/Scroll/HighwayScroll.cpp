@@ -74,127 +74,15 @@ namespace MusicGame::Scroll
 				return static_cast<int32>(currentBPM);
 			}
 		}
+	}
 
-		/// @brief scrollSpeedを考慮したノーツの相対Pulse値を計算
-		/// @param notePulse ノーツのPulse位置
-		/// @param currentPulseDouble 現在のPulse位置
-		/// @param scrollSpeed scrollSpeedグラフ
-		/// @return scrollSpeedを考慮した相対Pulse値
-		double CalcScrollSpeedAdjustedRelPulse(kson::Pulse notePulse, double currentPulseDouble, const kson::Graph& scrollSpeed)
-		{
-			if (scrollSpeed.empty())
-			{
-				return static_cast<double>(notePulse - currentPulseDouble);
-			}
-
-			const kson::Pulse currentPulse = static_cast<kson::Pulse>(currentPulseDouble);
-
-			// notePulseが現在位置より未来の場合
-			if (notePulse > currentPulse)
-			{
-				double totalRelPulse = 0.0;
-				kson::Pulse segmentStartPulse = currentPulse;
-				double currentSpeed = kson::GraphValueAt(scrollSpeed, segmentStartPulse);
-
-				while (segmentStartPulse < notePulse)
-				{
-					auto nextItr = scrollSpeed.upper_bound(segmentStartPulse);
-
-					kson::Pulse segmentEndPulse;
-					double nextSpeed;
-					if (nextItr != scrollSpeed.end() && nextItr->first <= notePulse)
-					{
-						segmentEndPulse = nextItr->first;
-						nextSpeed = nextItr->second.v.v;
-					}
-					else
-					{
-						segmentEndPulse = notePulse;
-						nextSpeed = currentSpeed;
-					}
-
-					// 台形則で積分
-					const kson::Pulse length = segmentEndPulse - segmentStartPulse;
-					totalRelPulse += length * (currentSpeed + nextSpeed) / 2.0;
-
-					// 次の区間の開始速度を設定
-					if (nextItr != scrollSpeed.end() && nextItr->first == segmentEndPulse)
-					{
-						currentSpeed = nextItr->second.v.vf;
-					}
-					else
-					{
-						currentSpeed = nextSpeed;
-					}
-
-					segmentStartPulse = segmentEndPulse;
-				}
-
-				return totalRelPulse;
-			}
-			// notePulseが現在位置より過去の場合
-			else
-			{
-				double totalRelPulse = 0.0;
-				kson::Pulse segmentEndPulse = currentPulse;
-				double endSpeed = kson::GraphValueAt(scrollSpeed, segmentEndPulse);
-
-				while (segmentEndPulse > notePulse)
-				{
-					// segmentEndPulse未満で最大のscroll_speed変更点を探す
-					auto itr = scrollSpeed.lower_bound(segmentEndPulse);
-					if (itr != scrollSpeed.begin())
-					{
-						--itr;
-					}
-
-					kson::Pulse segmentStartPulse;
-					double startSpeed;
-					if (itr == scrollSpeed.begin() && itr->first > notePulse)
-					{
-						// scroll_speedの最初の変更点より前の区間
-						segmentStartPulse = notePulse;
-						startSpeed = itr->second.v.v;
-					}
-					else if (itr != scrollSpeed.end() && itr->first > notePulse)
-					{
-						segmentStartPulse = itr->first;
-						startSpeed = itr->second.v.v;
-					}
-					else
-					{
-						segmentStartPulse = notePulse;
-						startSpeed = endSpeed;
-					}
-
-					// 台形則で積分(負の方向)
-					const kson::Pulse length = segmentEndPulse - segmentStartPulse;
-					totalRelPulse -= length * (startSpeed + endSpeed) / 2.0;
-
-					// 次の区間へ移動
-					// 次の区間の終了速度を設定(scroll_speed変更点がある場合はその直前の速度)
-					if (itr != scrollSpeed.end() && itr->first == segmentStartPulse)
-					{
-						// itrがbeginの場合、これ以上前に戻れないのでループ終了
-						if (itr == scrollSpeed.begin())
-						{
-							break;
-						}
-						// 一つ前のscroll_speed変更点の終了速度を取得
-						auto prevItr = std::prev(itr);
-						endSpeed = prevItr->second.v.vf;
-					}
-					else
-					{
-						endSpeed = startSpeed;
-					}
-
-					segmentEndPulse = segmentStartPulse;
-				}
-
-				return totalRelPulse;
-			}
-		}
+	PulsePosition CreatePulsePosition(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const ScrollSpeedIntegralTable& scrollSpeedIntegralTable)
+	{
+		return {
+			.pulse = pulse,
+			.sec = kson::PulseToSec(pulse, beatInfo, timingCache),
+			.scrollSpeedIntegral = scrollSpeedIntegralTable.integralAt(pulse),
+		};
 	}
 
 	HighwayScrollContext::HighwayScrollContext(const HighwayScroll* pHighwayScroll, const kson::BeatInfo* pBeatInfo, const kson::TimingCache* pTimingCache, const GameStatus* pGameStatus)
@@ -213,11 +101,21 @@ namespace MusicGame::Scroll
 		return m_pHighwayScroll->getPositionY(pulse, *m_pBeatInfo, *m_pTimingCache, *m_pGameStatus);
 	}
 
+	int32 HighwayScrollContext::getPositionY(const PulsePosition& pulsePosition) const
+	{
+		return m_pHighwayScroll->getPositionY(pulsePosition, *m_pBeatInfo, *m_pGameStatus);
+	}
+
 	int32 HighwayScrollContext::relPulseToPixelHeight(kson::Pulse basePulse, kson::RelPulse relPulse) const
 	{
 		return m_pHighwayScroll->relPulseToPixelHeight(basePulse, relPulse, *m_pBeatInfo);
 	}
 
+	std::optional<std::pair<double, double>> HighwayScrollContext::visibleIntegralRange(int32 minY, int32 maxY) const
+	{
+		return m_pHighwayScroll->visibleIntegralRange(minY, maxY, *m_pBeatInfo, *m_pGameStatus);
+	}
+
 	const HighwayScroll& HighwayScrollContext::highwayScroll() const
 	{
 		return *m_pHighwayScroll;
@@ -256,12 +154,11 @@ namespace MusicGame::Scroll
 		return sec;
 	}
 
-	double HighwayScroll::getRelPulseEquvalent(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const GameStatus& gameStatus) const
+	double HighwayScroll::getRelPulseEquvalent(const PulsePosition& pulsePosition, const kson::BeatInfo& beatInfo, const GameStatus& gameStatus) const
 	{
 		if (m_hispeedSetting.type == HispeedType::CMod)
 		{
-			const double sec = pulseToSec(pulse, beatInfo, timingCache);
-			const double relTimeSec = sec - gameStatus.currentTimeSec;
+			const double relTimeSec = pulsePosition.sec - gameStatus.currentTimeSec;
 			return relTimeSec / 60 * kson::kResolution;
 		}
 		else
@@ -269,16 +166,18 @@ namespace MusicGame::Scroll
 			// scrollSpeedがなければ単純な差分計算
 			if (beatInfo.scrollSpeed.empty())
 			{
-				return static_cast<double>(pulse) - gameStatus.currentPulseDouble;
+				return static_cast<double>(pulsePosition.pulse) - gameStatus.currentPulseDouble;
 			}
 
-			// scrollSpeedがあれば現在地点からノーツ地点までの区間を積分計算
-			return CalcScrollSpeedAdjustedRelPulse(pulse, gameStatus.currentPulseDouble, beatInfo.scrollSpeed);
+			// scrollSpeedがあれば現在地点からノーツ地点までの区間の積分値を事前計算したテーブルから求める
+			// (ScrollSpeedIntegralTable::scrollSpeedAdjustedRelPulseと同様、現在のPulse位置は整数に切り捨てて計算する)
+			return pulsePosition.scrollSpeedIntegral - m_scrollSpeedIntegralTable.integralAt(static_cast<kson::Pulse>(gameStatus.currentPulseDouble));
 		}
 	}
 
 	HighwayScroll::HighwayScroll(const kson::ChartData& chartData)
 		: m_stdBPM(kson::GetEffectiveStdBPM(chartData))
+		, m_scrollSpeedIntegralTable(chartData.beat.scrollSpeed)
 	{
 	}
 
@@ -291,10 +190,25 @@ namespace MusicGame::Scroll
 	}
 
 	int32 HighwayScroll::getPositionY(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const GameStatus& gameStatus) const
+	{
+		// 現在のハイスピード設定の計算で使用する値のみを求める
+		PulsePosition pulsePosition{ .pulse = pulse };
+		if (m_hispeedSetting.type == HispeedType::CMod)
+		{
+			pulsePosition.sec = pulseToSec(pulse, beatInfo, timingCache);
+		}
+		else if (!beatInfo.scrollSpeed.empty())
+		{
+			pulsePosition.scrollSpeedIntegral = m_scrollSpeedIntegralTable.integralAt(pulse);
+		}
+		return getPositionY(pulsePosition, beatInfo, gameStatus);
+	}
+
+	int32 HighwayScroll::getPositionY(const PulsePosition& pulsePosition, const kson::BeatInfo& beatInfo, const GameStatus& gameStatus) const
 	{
 		assert(m_hispeedFactor != 0.0 && "HighwayScroll::update() must be called at least once before HighwayScroll::getPositionY()");
 
-		const double relPulseEquivalent = getRelPulseEquvalent(pulse, beatInfo, timingCache, gameStatus);
+		const double relPulseEquivalent = getRelPulseEquvalent(pulsePosition, beatInfo, gameStatus);
 		return static_cast<int32>(Graphics::kHighwayTextureSize.y - Graphics::kJdglineYFromBottom) - static_cast<int32>(relPulseEquivalent * kBasePixels * m_hispeedFactor / kson::kResolution4);
 	}
 
@@ -302,10 +216,31 @@ namespace MusicGame::Scroll
 	{
 		assert(m_hispeedFactor != 0.0 && "HighwayScroll::update() must be called at least once before HighwayScroll::relPulseToPixelHeight()");
 
-		const double relPulseEquivalent = CalcScrollSpeedAdjustedRelPulse(basePulse + relPulse, static_cast<double>(basePulse), beatInfo.scrollSpeed);
+		const double relPulseEquivalent = beatInfo.scrollSpeed.empty()
+			? static_cast<double>(relPulse)
+			: m_scrollSpeedIntegralTable.scrollSpeedAdjustedRelPulse(basePulse + relPulse, static_cast<double>(basePulse));
 		return static_cast<int32>(relPulseEquivalent * kBasePixels * m_hispeedFactor / kson::kResolution4);
 	}
 
+	std::optional<std::pair<double, double>> HighwayScroll::visibleIntegralRange(int32 minY, int32 maxY, const kson::BeatInfo& beatInfo, const GameStatus& gameStatus) const
+	{
+		if (m_hispeedSetting.type == HispeedType::CMod || m_hispeedFactor <= 0.0)
+		{
+			return std::nullopt;
+		}
+
+		// getPositionYの逆算
+		// Y = baseY - (int32)((積分値 - 現在位置の積分値) * pixelsPerRelPulse)
+		const double pixelsPerRelPulse = kBasePixels * m_hispeedFactor / kson::kResolution4;
+		const double baseY = static_cast<double>(static_cast<int32>(Graphics::kHighwayTextureSize.y - Graphics::kJdglineYFromBottom));
+		const double currentIntegral = beatInfo.scrollSpeed.empty()
+			? gameStatus.currentPulseDouble
+			: m_scrollSpeedIntegralTable.integralAt(static_cast<kson::Pulse>(gameStatus.currentPulseDouble));
+		return std::make_pair(
+			currentIntegral + (baseY - maxY - 1.0) / pixelsPerRelPulse,
+			currentIntegral + (baseY - minY + 1.0) / pixelsPerRelPulse);
+	}
+
 	const HispeedSetting& HighwayScroll::hispeedSetting() const
 	{
 		return m_hispeedSetting;
@@ -3,12 +3,35 @@
 #include "MusicGame/GameStatus.hpp"
 #include "MusicGame/Graphics/GraphicsDefines.hpp"
 #include "HispeedSetting.hpp"
+#include "ScrollSpeedIntegralTable.hpp"
 #include "kson/kson.hpp"
 
 namespace MusicGame::Scroll
 {
 	class HighwayScroll;
 
+	/// @brief 座標計算に使用する値を譜面読み込み時に事前計算したPulse位置
+	/// @note 毎フレームの座標計算でPulse値から秒数やscroll_speedの積分値を求め直さないようにするためのもの
+	struct PulsePosition
+	{
+		/// @brief Pulse値
+		kson::Pulse pulse = 0;
+
+		/// @brief Pulse値に対応する秒数(C-modで使用)
+		double sec = 0.0;
+
+		/// @brief scroll_speedの積分値(ScrollSpeedIntegralTable::integralAtの値。scroll_speedが空の場合はPulse値そのもの)
+		double scrollSpeedIntegral = 0.0;
+	};
+
+	/// @brief Pulse位置の座標計算用の値を事前計算する
+	/// @param pulse Pulse値
+	/// @param beatInfo kson.beat
+	/// @param timingCache 事前計算したTimingCache
+	/// @param scrollSpeedIntegralTable HighwayScrollと同じscroll_speedから作成した積分テーブル
+	/// @return 事前計算したPulse位置
+	PulsePosition CreatePulsePosition(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const ScrollSpeedIntegralTable& scrollSpeedIntegralTable);
+
 	/// @brief HighwayScrollのコンテキスト
 	class HighwayScrollContext
 	{
@@ -36,6 +59,11 @@ namespace MusicGame::Scroll
 		/// @return Y座標
 		int32 getPositionY(kson::Pulse pulse) const;
 
+		/// @brief 事前計算したPulse位置をもとにHighway上のY座標を求める
+		/// @param pulsePosition 事前計算したPulse位置
+		/// @return Y座標(getPositionY(pulsePosition.pulse)と同じ値)
+		int32 getPositionY(const PulsePosition& pulsePosition) const;
+
 		/// @brief 相対Pulse値をピクセル高さに変換する
 		/// @param basePulse 基準となるPulse位置(scroll_speed計算に使用)
 		/// @param relPulse 相対Pulse値
@@ -54,6 +82,12 @@ namespace MusicGame::Scroll
 		/// @param pulse Pulse位置
 		/// @return scrollSpeedが0以上ならtrue
 		bool isScrollSpeedPositiveAt(kson::Pulse pulse) const;
+
+		/// @brief Highway上のY座標が[minY, maxY]の範囲に入りうるscroll_speed積分値の範囲を求める
+		/// @param minY Y座標の最小値
+		/// @param maxY Y座標の最大値
+		/// @return 積分値の範囲(C-modの場合はscroll_speedを使用しないためstd::nullopt)
+		std::optional<std::pair<double, double>> visibleIntegralRange(int32 minY, int32 maxY) const;
 	};
 
 	/// @brief Highway上のスクロール計算(ハイスピードおよびscroll_speedの計算)
@@ -63,6 +97,9 @@ namespace MusicGame::Scroll
 		/// @brief o-mod用の基準BPM
 		const double m_stdBPM;
 
+		/// @brief scroll_speedの累積積分テーブル(譜面読み込み時に事前計算)
+		const ScrollSpeedIntegralTable m_scrollSpeedIntegralTable;
+
 		/// @brief ハイスピード設定
 		HispeedSetting m_hispeedSetting;
 
@@ -90,16 +127,17 @@ namespace MusicGame::Scroll
 		double pulseToSec(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache) const;
 
 		/// @brief 現在時間からの相対Pulse数を求める(C-modの場合は秒数をもとに計算した換算値を返す)
-		/// @param pulse Pulse値
+		/// @param pulsePosition Pulse位置(C-modの場合はsec、scroll_speedがある場合はscrollSpeedIntegralを使用)
 		/// @param beatInfo kson.beat
-		/// @param timingCache 事前計算したTimingCache
 		/// @param gameStatus ゲーム状態
-		/// @param hispeedSetting ハイスピード設定
 		/// @return 相対Pulse数換算値
 		/// @note HSP版: https://github.com/kshootmania/ksm-v1/blob/1c75880b545d1232eeffc4bb3fc19704a3622f73/src/scene/play/play_utils.hsp#L246-L269
-		double getRelPulseEquvalent(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const GameStatus& gameStatus) const;
+		double getRelPulseEquvalent(const PulsePosition& pulsePosition, const kson::BeatInfo& beatInfo, const GameStatus& gameStatus) const;
 
 	public:
+		/// @brief コンストラクタ
+		/// @param chartData 譜面データ(scroll_speedはカーブ展開・stopの焼き込み済みであること)
+		/// @remark scroll_speedの積分テーブルをここで事前計算するため、以降のメンバ関数には同じ譜面のkson.beatを渡すこと
 		explicit HighwayScroll(const kson::ChartData& chartData);
 
 		/// @brief 毎フレームの更新
@@ -116,6 +154,14 @@ namespace MusicGame::Scroll
 		/// @return Y座標
 		int32 getPositionY(kson::Pulse pulse, const kson::BeatInfo& beatInfo, const kson::TimingCache& timingCache, const GameStatus& gameStatus) const;
 
+		/// @brief 事前計算したPulse位置をもとにHighway上のY座標を求める
+		/// @param pulsePosition 事前計算したPulse位置
+		/// @param beatInfo kson.beat
+		/// @param gameStatus ゲーム状態
+		/// @return Y座標
+		/// @note Pulse値を渡す場合も、秒数・積分値を求めてからこの関数で計算する
+		int32 getPositionY(const PulsePosition& pulsePosition, const kson::BeatInfo& beatInfo, const GameStatus& gameStatus) const;
+
 		/// @brief 相対Pulse値をピクセル高さに変換する
 		/// @param basePulse 基準となるPulse位置(scroll_speed計算に使用)
 		/// @param relPulse 相対Pulse値
@@ -123,6 +169,15 @@ namespace MusicGame::Scroll
 		/// @return ピクセル高さ
 		int32 relPulseToPixelHeight(kson::Pulse basePulse, kson::RelPulse relPulse, const kson::BeatInfo& beatInfo) const;
 
+		/// @brief Highway上のY座標が[minY, maxY]の範囲に入りうるscroll_speed積分値の範囲を求める
+		/// @param minY Y座標の最小値
+		/// @param maxY Y座標の最大値
+		/// @param beatInfo kson.beat
+		/// @param gameStatus ゲーム状態
+		/// @return 積分値(ScrollSpeedIntegralTable::integralAtの値)の範囲。C-modの場合はscroll_speedを使用しないためstd::nullopt
+		/// @note 座標計算の切り捨て誤差を考慮して1ピクセル分広い範囲を返す
+		std::optional<std::pair<double, double>> visibleIntegralRange(int32 minY, int32 maxY, const kson::BeatInfo& beatInfo, const GameStatus& gameStatus) const;
+
 		/// @brief ハイスピード設定を返す
 		/// @return ハイスピード設定
 		const HispeedSetting& hispeedSetting() const;
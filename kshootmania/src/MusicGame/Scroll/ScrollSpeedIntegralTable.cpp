@@ -0,0 +1,225 @@
+﻿#include "ScrollSpeedIntegralTable.hpp"
+
+namespace MusicGame::Scroll
+{
+	ScrollSpeedIntegralTable::ScrollSpeedIntegralTable(const kson::Graph& scrollSpeed)
+	{
+		if (scrollSpeed.empty())
+		{
+			return;
+		}
+
+		const std::size_t numPoints = scrollSpeed.size();
+		m_pulses.reserve(numPoints);
+		m_integrals.reserve(numPoints);
+		m_speedsAfter.reserve(numPoints);
+		m_slopes.reserve(numPoints);
+
+		m_speedBeforeFirst = scrollSpeed.begin()->second.v.v;
+
+		double integral = 0.0;
+		for (auto itr = scrollSpeed.begin(); itr != scrollSpeed.end(); ++itr)
+		{
+			const auto& [pulse, point] = *itr;
+			m_pulses.push_back(pulse);
+			m_integrals.push_back(integral);
+			m_speedsAfter.push_back(point.v.vf);
+
+			const auto nextItr = std::next(itr);
+			if (nextItr == scrollSpeed.end())
+			{
+				m_slopes.push_back(0.0);
+				break;
+			}
+
+			// 変更点間は直後の速度(vf)から次の変更点の速度(v)へ線形に変化するので、台形の面積を加算
+			const kson::Pulse length = nextItr->first - pulse;
+			m_slopes.push_back((nextItr->second.v.v - point.v.vf) / static_cast<double>(length));
+			integral += static_cast<double>(length) * (point.v.vf + nextItr->second.v.v) / 2.0;
+		}
+	}
+
+	double ScrollSpeedIntegralTable::integralAt(kson::Pulse pulse) const
+	{
+		if (m_pulses.empty())
+		{
+			return static_cast<double>(pulse);
+		}
+
+		// pulse以下で最大の変更点を探す
+		const auto itr = std::upper_bound(m_pulses.begin(), m_pulses.end(), pulse);
+		if (itr == m_pulses.begin())
+		{
+			// 先頭の変更点より前は先頭の変更点の速度(v)で一定
+			return -static_cast<double>(m_pulses.front() - pulse) * m_speedBeforeFirst;
+		}
+
+		const std::size_t idx = static_cast<std::size_t>(std::distance(m_pulses.begin(), itr)) - 1;
+		const double dx = static_cast<double>(pulse - m_pulses[idx]);
+		return m_integrals[idx] + dx * (m_speedsAfter[idx] + m_slopes[idx] * dx / 2.0);
+	}
+
+	double ScrollSpeedIntegralTable::scrollSpeedAdjustedRelPulse(kson::Pulse notePulse, double currentPulseDouble) const
+	{
+		if (m_pulses.empty())
+		{
+			return static_cast<double>(notePulse - currentPulseDouble);
+		}
+
+		const kson::Pulse currentPulse = static_cast<kson::Pulse>(currentPulseDouble);
+		return integralAt(notePulse) - integralAt(currentPulse);
+	}
+
+	std::pair<double, double> ScrollSpeedIntegralTable::integralRange(kson::Pulse beginPulse, kson::Pulse endPulse) const
+	{
+		assert(beginPulse <= endPulse);
+
+		const double beginIntegral = integralAt(beginPulse);
+		const double endIntegral = integralAt(endPulse);
+		double minIntegral = Min(beginIntegral, endIntegral);
+		double maxIntegral = Max(beginIntegral, endIntegral);
+
+		// 区間内の変更点、および変更点間で速度が0になる点で極値をとりうる
+		// (先頭の変更点より前は速度一定のため極値をとらない)
+		const auto beginItr = std::upper_bound(m_pulses.begin(), m_pulses.end(), beginPulse);
+		const std::size_t firstIdx = (beginItr == m_pulses.begin()) ? 0U : static_cast<std::size_t>(std::distance(m_pulses.begin(), beginItr)) - 1U;
+		for (std::size_t idx = firstIdx; idx < m_pulses.size() && m_pulses[idx] < endPulse; ++idx)
+		{
+			if (m_pulses[idx] > beginPulse)
+			{
+				minIntegral = Min(minIntegral, m_integrals[idx]);
+				maxIntegral = Max(maxIntegral, m_integrals[idx]);
+			}
+
+			if (m_slopes[idx] != 0.0)
+			{
+				const double zeroDx = -m_speedsAfter[idx] / m_slopes[idx];
+				const double zeroPulse = static_cast<double>(m_pulses[idx]) + zeroDx;
+				if (zeroDx > 0.0 && static_cast<double>(beginPulse) < zeroPulse && zeroPulse < static_cast<double>(endPulse))
+				{
+					const double zeroIntegral = m_integrals[idx] + zeroDx * (m_speedsAfter[idx] + m_slopes[idx] * zeroDx / 2.0);
+					minIntegral = Min(minIntegral, zeroIntegral);
+					maxIntegral = Max(maxIntegral, zeroIntegral);
+				}
+			}
+		}
+
+		return { minIntegral, maxIntegral };
+	}
+
+	double CalcScrollSpeedAdjustedRelPulseReference(kson::Pulse notePulse, double currentPulseDouble, const kson::Graph& scrollSpeed)
+	{
+		if (scrollSpeed.empty())
+		{
+			return static_cast<double>(notePulse - currentPulseDouble);
+		}
+
+		const kson::Pulse currentPulse = static_cast<kson::Pulse>(currentPulseDouble);
+
+		// notePulseが現在位置より未来の場合
+		if (notePulse > currentPulse)
+		{
+			double totalRelPulse = 0.0;
+			kson::Pulse segmentStartPulse = currentPulse;
+			double currentSpeed = kson::GraphValueAt(scrollSpeed, segmentStartPulse);
+
+			while (segmentStartPulse < notePulse)
+			{
+				auto nextItr = scrollSpeed.upper_bound(segmentStartPulse);
+
+				kson::Pulse segmentEndPulse;
+				double nextSpeed;
+				if (nextItr != scrollSpeed.end() && nextItr->first <= notePulse)
+				{
+					segmentEndPulse = nextItr->first;
+					nextSpeed = nextItr->second.v.v;
+				}
+				else
+				{
+					segmentEndPulse = notePulse;
+					nextSpeed = currentSpeed;
+				}
+
+				// 台形則で積分
+				const kson::Pulse length = segmentEndPulse - segmentStartPulse;
+				totalRelPulse += length * (currentSpeed + nextSpeed) / 2.0;
+
+				// 次の区間の開始速度を設定
+				if (nextItr != scrollSpeed.end() && nextItr->first == segmentEndPulse)
+				{
+					currentSpeed = nextItr->second.v.vf;
+				}
+				else
+				{
+					currentSpeed = nextSpeed;
+				}
+
+				segmentStartPulse = segmentEndPulse;
+			}
+
+			return totalRelPulse;
+		}
+		// notePulseが現在位置より過去の場合
+		else
+		{
+			double totalRelPulse = 0.0;
+			kson::Pulse segmentEndPulse = currentPulse;
+			double endSpeed = kson::GraphValueAt(scrollSpeed, segmentEndPulse);
+
+			while (segmentEndPulse > notePulse)
+			{
+				// segmentEndPulse未満で最大のscroll_speed変更点を探す
+				auto itr = scrollSpeed.lower_bound(segmentEndPulse);
+				if (itr != scrollSpeed.begin())
+				{
+					--itr;
+				}
+
+				kson::Pulse segmentStartPulse;
+				double startSpeed;
+				if (itr == scrollSpeed.begin() && itr->first > notePulse)
+				{
+					// scroll_speedの最初の変更点より前の区間
+					segmentStartPulse = notePulse;
+					startSpeed = itr->second.v.v;
+				}
+				else if (itr != scrollSpeed.end() && itr->first > notePulse)
+				{
+					segmentStartPulse = itr->first;
+					startSpeed = itr->second.v.v;
+				}
+				else
+				{
+					segmentStartPulse = notePulse;
+					startSpeed = endSpeed;
+				}
+
+				// 台形則で積分(負の方向)
+				const kson::Pulse length = segmentEndPulse - segmentStartPulse;
+				totalRelPulse -= length * (startSpeed + endSpeed) / 2.0;
+
+				// 次の区間へ移動
+				// 次の区間の終了速度を設定(scroll_speed変更点がある場合はその直前の速度)
+				if (itr != scrollSpeed.end() && itr->first == segmentStartPulse)
+				{
+					// itrがbeginの場合、これ以上前に戻れないのでループ終了
+					if (itr == scrollSpeed.begin())
+					{
+						break;
+					}
+					// 一つ前のscroll_speed変更点の終了速度を取得
+					auto prevItr = std::prev(itr);
+					endSpeed = prevItr->second.v.vf;
+				}
+				else
+				{
+					endSpeed = startSpeed;
+				}
+
+				segmentEndPulse = segmentStartPulse;
+			}
+
+			return totalRelPulse;
+		}
+	}
+}
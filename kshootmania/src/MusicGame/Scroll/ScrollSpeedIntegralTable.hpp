@@ -0,0 +1,66 @@
+﻿#pragma once
+#include "kson/kson.hpp"
+
+namespace MusicGame::Scroll
+{
+	/// @brief scroll_speedグラフの累積積分テーブル
+	/// @details 譜面読み込み時にscroll_speedの各変更点までの積分値を事前計算しておき、
+	///          任意の2点間の積分(scroll_speedを考慮した相対Pulse値)を二分探索2回と減算で求める。
+	/// @note グラフはカーブを含まない(変更点間が線形補間される)ことを前提とする。
+	///       プレイ中のscroll_speedはExpandCurveSegmentsで展開済みのため、この前提を満たす
+	class ScrollSpeedIntegralTable
+	{
+	private:
+		/// @brief 各変更点のPulse値
+		std::vector<kson::Pulse> m_pulses;
+
+		/// @brief 先頭の変更点から各変更点までの積分値
+		std::vector<double> m_integrals;
+
+		/// @brief 各変更点の直後の速度(vf)
+		std::vector<double> m_speedsAfter;
+
+		/// @brief 各変更点から次の変更点までの速度の傾き(最後の変更点は0)
+		std::vector<double> m_slopes;
+
+		/// @brief 先頭の変更点より前の速度
+		double m_speedBeforeFirst = 1.0;
+
+	public:
+		/// @brief コンストラクタ
+		/// @param scrollSpeed scroll_speedグラフ
+		explicit ScrollSpeedIntegralTable(const kson::Graph& scrollSpeed);
+
+		/// @brief 先頭の変更点を基準とした指定Pulse位置までの積分値を求める
+		/// @param pulse Pulse値
+		/// @return 積分値(scroll_speedが空の場合はpulseそのもの)
+		[[nodiscard]]
+		double integralAt(kson::Pulse pulse) const;
+
+		/// @brief scrollSpeedを考慮したノーツの相対Pulse値を計算
+		/// @param notePulse ノーツのPulse位置
+		/// @param currentPulseDouble 現在のPulse位置
+		/// @return scrollSpeedを考慮した相対Pulse値
+		/// @note CalcScrollSpeedAdjustedRelPulseReferenceと同様、現在のPulse位置は整数に切り捨てて計算する
+		[[nodiscard]]
+		double scrollSpeedAdjustedRelPulse(kson::Pulse notePulse, double currentPulseDouble) const;
+
+		/// @brief 指定区間内での積分値の最小値と最大値を求める
+		/// @param beginPulse 区間の開始Pulse値
+		/// @param endPulse 区間の終了Pulse値(beginPulse以上であること)
+		/// @return 積分値の最小値と最大値のペア
+		/// @note scroll_speedに負の値が含まれる場合は積分値が単調でないため、区間内の変更点と速度が0になる点も候補として調べる
+		[[nodiscard]]
+		std::pair<double, double> integralRange(kson::Pulse beginPulse, kson::Pulse endPulse) const;
+	};
+
+	/// @brief scrollSpeedを考慮したノーツの相対Pulse値を、scroll_speedグラフを区間ごとに辿って計算(参照実装)
+	/// @param notePulse ノーツのPulse位置
+	/// @param currentPulseDouble 現在のPulse位置
+	/// @param scrollSpeed scrollSpeedグラフ
+	/// @return scrollSpeedを考慮した相対Pulse値
+	/// @note ScrollSpeedIntegralTableの結果を検証するためのテスト用。計算量は区間数に比例する。
+	///       ノーツが線形補間区間の途中にある場合、その区間の速度を一定とみなして計算する点がScrollSpeedIntegralTableと異なる
+	[[nodiscard]]
+	double CalcScrollSpeedAdjustedRelPulseReference(kson::Pulse notePulse, double currentPulseDouble, const kson::Graph& scrollSpeed);
+}
@@ -0,0 +1,111 @@
+﻿#include "InputScript.hpp"
+#include "kson/Util/GraphUtils.hpp"
+
+namespace MusicGame::Simulation
+{
+	namespace
+	{
+		// チップを押してから離すまでの時間(秒)
+		constexpr double kChipPressDurationSec = 0.03;
+
+		// ロングノーツを始点より前に押し始める時間(秒)
+		constexpr double kLongNotePrePressSec = 0.03;
+
+		// ロングノーツを終点より後に離す時間(秒)
+		constexpr double kLongNotePostReleaseSec = 0.03;
+
+		// 連続するノーツの間で、少なくともボタンを離しておく時間(秒)
+		constexpr double kMinReleaseDurationSec = 0.001;
+
+		// ノーツを押す時間の区間を求める(ずれは含まない)
+		Array<std::pair<double, double>> CreatePressIntervals(const kson::ByPulse<kson::Interval>& lane, const kson::BeatInfo& beat, const kson::TimingCache& timingCache)
+		{
+			Array<std::pair<double, double>> intervals;
+			intervals.reserve(lane.size());
+			for (const auto& [y, note] : lane)
+			{
+				const double beginSec = kson::PulseToSec(y, beat, timingCache);
+				if (note.length == 0)
+				{
+					intervals.emplace_back(beginSec, beginSec + kChipPressDurationSec);
+				}
+				else
+				{
+					intervals.emplace_back(beginSec - kLongNotePrePressSec, kson::PulseToSec(y + note.length, beat, timingCache) + kLongNotePostReleaseSec);
+				}
+			}
+
+			// 次のノーツの押下を検出できるよう、次のノーツの前に一度離す
+			for (std::size_t i = 0U; i + 1U < intervals.size(); ++i)
+			{
+				intervals[i].second = Max(Min(intervals[i].second, intervals[i + 1U].first - kMinReleaseDurationSec), intervals[i].first);
+			}
+
+			return intervals;
+		}
+	}
+
+	NoteTimingInputScript::NoteTimingInputScript(const kson::ChartData& chartData, double offsetSec)
+		: m_chartData(chartData)
+		, m_timingCache(kson::CreateTimingCache(chartData.beat))
+		, m_offsetSec(offsetSec)
+		, m_laserLanes{ LaserLaneState{ .timingCursor = kson::TimingCursor(m_timingCache) }, LaserLaneState{ .timingCursor = kson::TimingCursor(m_timingCache) } }
+	{
+		for (std::size_t buttonIdx = 0U; buttonIdx < Judgment::kNumJudgmentButtons; ++buttonIdx)
+		{
+			const auto& lane = buttonIdx < kson::kNumBTLanesSZ ? chartData.note.bt[buttonIdx] : chartData.note.fx[buttonIdx - kson::kNumBTLanesSZ];
+			Array<PressInterval>& intervals = m_buttonLanes[buttonIdx].intervals;
+			for (const auto& [beginSec, endSec] : CreatePressIntervals(lane, chartData.beat, m_timingCache))
+			{
+				intervals.push_back(PressInterval{ .beginSec = beginSec + offsetSec, .endSec = endSec + offsetSec });
+			}
+		}
+	}
+
+	Judgment::JudgmentInput NoteTimingInputScript::inputAt(double currentTimeSec)
+	{
+		Judgment::JudgmentInput input;
+
+		for (std::size_t buttonIdx = 0U; buttonIdx < Judgment::kNumJudgmentButtons; ++buttonIdx)
+		{
+			ButtonLaneState& lane = m_buttonLanes[buttonIdx];
+			Judgment::ButtonInput& button = input.buttons[buttonIdx];
+
+			// 前回のティック以降に開始・終了した押下区間を処理
+			while (lane.cursor < lane.intervals.size() && lane.intervals[lane.cursor].endSec <= currentTimeSec)
+			{
+				if (lane.intervals[lane.cursor].beginSec > m_prevTimeSec)
+				{
+					// ティックの間に押して離した場合
+					button.down = true;
+				}
+				button.up = true;
+				++lane.cursor;
+			}
+
+			if (lane.cursor < lane.intervals.size() && lane.intervals[lane.cursor].beginSec <= currentTimeSec)
+			{
+				button.pressed = true;
+				if (lane.intervals[lane.cursor].beginSec > m_prevTimeSec)
+				{
+					button.down = true;
+				}
+			}
+		}
+
+		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumLaserLanesSZ; ++laneIdx)
+		{
+			LaserLaneState& lane = m_laserLanes[laneIdx];
+			const kson::Pulse pulse = lane.timingCursor.secToPulse(currentTimeSec - m_offsetSec);
+			const std::optional<double> value = kson::GraphSectionValueAt(m_chartData.note.laser[laneIdx], pulse);
+			if (value.has_value() && lane.prevValue.has_value())
+			{
+				input.laserDeltaCursorX[laneIdx] = *value - *lane.prevValue;
+			}
+			lane.prevValue = value;
+		}
+
+		m_prevTimeSec = currentTimeSec;
+		return input;
+	}
+}
@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "kson/ChartData.hpp"
+#include "kson/Util/TimingUtils.hpp"
+#include "MusicGame/Judgment/JudgmentInput.hpp"
+
+namespace MusicGame::Simulation
+{
+	/// @brief シミュレーション用の入力の生成元
+	class IInputScript
+	{
+	public:
+		virtual ~IInputScript() = default;
+
+		/// @brief 指定時間のティックの入力を取得
+		/// @param currentTimeSec 曲の再生時間(秒)。呼び出しごとに単調増加する
+		/// @return 前回の呼び出しからの入力
+		virtual Judgment::JudgmentInput inputAt(double currentTimeSec) = 0;
+	};
+
+	/// @brief ノーツのタイミングに一定のずれを加えて押下・LASER操作を行う入力
+	/// @note チップは一定時間だけ押し、ロングは終端まで押し続ける。LASERはカーソルがノーツに追従するよう動かす
+	class NoteTimingInputScript : public IInputScript
+	{
+	private:
+		struct PressInterval
+		{
+			double beginSec;
+
+			double endSec;
+		};
+
+		struct ButtonLaneState
+		{
+			Array<PressInterval> intervals;
+
+			std::size_t cursor = 0U;
+		};
+
+		struct LaserLaneState
+		{
+			kson::TimingCursor timingCursor;
+
+			std::optional<double> prevValue;
+		};
+
+		const kson::ChartData& m_chartData;
+
+		const kson::TimingCache m_timingCache;
+
+		const double m_offsetSec;
+
+		std::array<ButtonLaneState, Judgment::kNumJudgmentButtons> m_buttonLanes;
+
+		std::array<LaserLaneState, kson::kNumLaserLanesSZ> m_laserLanes;
+
+		double m_prevTimeSec = std::numeric_limits<double>::lowest();
+
+	public:
+		/// @param chartData 譜面データ(このインスタンスより長く生存すること)
+		/// @param offsetSec 入力のずれ(秒)。正の値で遅く、負の値で早く入力する
+		NoteTimingInputScript(const kson::ChartData& chartData, double offsetSec);
+
+		NoteTimingInputScript(const NoteTimingInputScript&) = delete;
+
+		NoteTimingInputScript& operator=(const NoteTimingInputScript&) = delete;
+
+		virtual Judgment::JudgmentInput inputAt(double currentTimeSec) override;
+	};
+}
@@ -0,0 +1,109 @@
+﻿#include "JudgmentSimulator.hpp"
+#include <chrono>
+#include "kson/Util/TimingUtils.hpp"
+
+namespace MusicGame::Simulation
+{
+	namespace
+	{
+		// 時間計測をまとめて行うティック数
+		// (ティックごとに計測すると計測自体のコストが判定のコストに対して無視できないため)
+		constexpr std::size_t kTicksPerMeasurement = 256U;
+
+		double ChartEndTimeSec(const kson::ChartData& chartData, const kson::TimingCache& timingCache)
+		{
+			return kson::PulseToSec(kson::LastNoteEndY(chartData.note), chartData.beat, timingCache);
+		}
+	}
+
+	JudgmentSimulator::JudgmentSimulator(const kson::ChartData& chartData, const PlayOption& playOption, const Optional<CourseContinuation>& courseContinuation)
+		: m_chartData(chartData)
+		, m_timingCache(kson::CreateTimingCache(chartData.beat))
+		, m_noteAttributeTable(chartData, m_timingCache, playOption.noteSkin)
+		, m_chartEndTimeSec(ChartEndTimeSec(chartData, m_timingCache))
+		, m_gameStatusTimer(m_timingCache, playOption)
+		, m_judgmentMain(chartData, m_timingCache, m_noteAttributeTable, playOption, courseContinuation, playOption.gameMode)
+	{
+	}
+
+	void JudgmentSimulator::tick(double currentTimeSec, const Judgment::JudgmentInput& input)
+	{
+		m_gameStatusTimer.update(currentTimeSec, m_gameStatus);
+		m_judgmentMain.update(m_chartData, input, m_gameStatus, m_viewStatus);
+		m_judgmentMain.updatePlayFinishStatus(m_chartData, m_timingCache, m_gameStatus, m_viewStatus);
+	}
+
+	void JudgmentSimulator::lockForExit()
+	{
+		m_judgmentMain.lockForExit();
+	}
+
+	bool JudgmentSimulator::isPlayFinished() const
+	{
+		return m_gameStatus.playFinishStatus.has_value();
+	}
+
+	double JudgmentSimulator::chartEndTimeSec() const
+	{
+		return m_chartEndTimeSec;
+	}
+
+	const GameStatus& JudgmentSimulator::gameStatus() const
+	{
+		return m_gameStatus;
+	}
+
+	PlayResult JudgmentSimulator::playResult() const
+	{
+		const IsHardFailedYN isHardFailed{ m_gameStatus.playFinishStatus.has_value() && m_gameStatus.playFinishStatus->isHardFailed };
+		return m_judgmentMain.playResult(m_chartData, m_timingCache, m_gameStatus.currentTimeSec, isHardFailed);
+	}
+
+	SimulationResult RunSimulation(const kson::ChartData& chartData, const PlayOption& playOption, const SimulationOption& option, IInputScript* pInputScript)
+	{
+		assert(option.tickRateHz > 0.0 && "tickRateHz must be positive");
+
+		JudgmentSimulator simulator(chartData, playOption);
+		const double endTimeSec = simulator.chartEndTimeSec() + option.endMarginSec;
+
+		SimulationResult result;
+		std::array<double, kTicksPerMeasurement> timeSecs;
+		std::array<Judgment::JudgmentInput, kTicksPerMeasurement> inputs;
+		bool isFinished = false;
+		while (!isFinished)
+		{
+			// 入力の生成は計測対象外にするため、先にまとめて生成しておく
+			std::size_t numTicks = 0U;
+			for (; numTicks < kTicksPerMeasurement; ++numTicks)
+			{
+				// 誤差が蓄積しないよう、加算ではなく乗算で時間を求める
+				const double currentTimeSec = option.startTimeSec + static_cast<double>(result.numTicks + static_cast<int64>(numTicks)) / option.tickRateHz;
+				if (currentTimeSec > endTimeSec)
+				{
+					isFinished = true;
+					break;
+				}
+				timeSecs[numTicks] = currentTimeSec;
+				inputs[numTicks] = pInputScript != nullptr ? pInputScript->inputAt(currentTimeSec) : Judgment::JudgmentInput{};
+			}
+
+			const auto start = std::chrono::steady_clock::now();
+			std::size_t numTicksDone = 0U;
+			while (numTicksDone < numTicks)
+			{
+				simulator.tick(timeSecs[numTicksDone], inputs[numTicksDone]);
+				++numTicksDone;
+				if (simulator.isPlayFinished())
+				{
+					isFinished = true;
+					break;
+				}
+			}
+			result.judgmentNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+			result.numTicks += static_cast<int64>(numTicksDone);
+		}
+
+		result.playResult = simulator.playResult();
+		return result;
+	}
+}
@@ -0,0 +1,101 @@
+﻿#pragma once
+#include "kson/ChartData.hpp"
+#include "Course/CourseContinuation.hpp"
+#include "MusicGame/GameStatus.hpp"
+#include "MusicGame/GameStatusTimer.hpp"
+#include "MusicGame/ViewStatus.hpp"
+#include "MusicGame/PlayOption.hpp"
+#include "MusicGame/PlayResult.hpp"
+#include "MusicGame/NoteAttributeTable.hpp"
+#include "MusicGame/Judgment/JudgmentMain.hpp"
+#include "InputScript.hpp"
+
+namespace MusicGame::Simulation
+{
+	/// @brief GameMainのうち判定に関与する処理のみを、音声・描画・Siv3Dのメインループなしで実行する
+	/// @note 判定の更新順序はGameMain::updateStatus()と同一
+	/// @remark 判定がメンバへの参照を保持するため、コピー・ムーブ不可
+	class JudgmentSimulator
+	{
+	private:
+		const kson::ChartData& m_chartData;
+		const kson::TimingCache m_timingCache;
+		const NoteAttributeTable m_noteAttributeTable;
+		const double m_chartEndTimeSec;
+
+		GameStatusTimer m_gameStatusTimer;
+		Judgment::JudgmentMain m_judgmentMain;
+
+		GameStatus m_gameStatus;
+		ViewStatus m_viewStatus;
+
+	public:
+		/// @param chartData LoadChartDataForPlay()で読み込んだ譜面データ(このインスタンスより長く生存すること)
+		/// @param playOption プレイオプション
+		/// @param courseContinuation コース継続情報(コースモード時に使用)
+		JudgmentSimulator(const kson::ChartData& chartData, const PlayOption& playOption, const Optional<CourseContinuation>& courseContinuation = none);
+
+		JudgmentSimulator(const JudgmentSimulator&) = delete;
+
+		JudgmentSimulator& operator=(const JudgmentSimulator&) = delete;
+
+		/// @brief 1ティック分の判定を更新
+		/// @param currentTimeSec 曲の再生時間(秒)
+		/// @param input このティックの入力
+		void tick(double currentTimeSec, const Judgment::JudgmentInput& input);
+
+		/// @brief プレイ終了のために判定処理をロックし、残りの未判定ノーツをERROR判定にする
+		void lockForExit();
+
+		/// @brief HARD落ち、または全ノーツ判定済みでプレイが終了したかどうか
+		[[nodiscard]]
+		bool isPlayFinished() const;
+
+		/// @brief 最後のノーツの終端の時間(秒)
+		[[nodiscard]]
+		double chartEndTimeSec() const;
+
+		[[nodiscard]]
+		const GameStatus& gameStatus() const;
+
+		[[nodiscard]]
+		PlayResult playResult() const;
+	};
+
+	struct SimulationOption
+	{
+		// 1秒あたりのティック数(描画フレームレートに相当)
+		double tickRateHz = 60.0;
+
+		// 開始時の再生時間(秒)
+		double startTimeSec = -1.0;
+
+		// 最後のノーツの終端からシミュレーションを打ち切るまでの時間(秒)
+		double endMarginSec = 2.0;
+	};
+
+	struct SimulationResult
+	{
+		PlayResult playResult;
+
+		int64 numTicks = 0;
+
+		// 判定の更新にかかった時間の合計(入力の生成にかかった時間は含まない)
+		double judgmentNanoseconds = 0.0;
+
+		[[nodiscard]]
+		double nsPerTick() const
+		{
+			return numTicks > 0 ? judgmentNanoseconds / static_cast<double>(numTicks) : 0.0;
+		}
+	};
+
+	/// @brief 一定間隔のティックで判定をシミュレーションする
+	/// @param chartData LoadChartDataForPlay()で読み込んだ譜面データ
+	/// @param playOption プレイオプション(オートプレイの場合は入力を無視する)
+	/// @param option シミュレーションの設定
+	/// @param pInputScript 入力の生成元(nullptrの場合は入力なし)
+	/// @return シミュレーション結果
+	[[nodiscard]]
+	SimulationResult RunSimulation(const kson::ChartData& chartData, const PlayOption& playOption, const SimulationOption& option, IInputScript* pInputScript);
+}
@@ -4,6 +4,7 @@
 #include "Scenes/Result/ResultScene.hpp"
 #include "RuntimeConfig.hpp"
 #include "MusicGame/HispeedUtils.hpp"
+#include "MusicGame/Replay/ReplayIO.hpp"
 
 namespace
 {
@@ -42,55 +43,84 @@ namespace
 		return MusicGame::HispeedUtils::FromConfigStringValue(ConfigIni::GetString(ConfigIni::Key::kHispeed));
 	}
 
-	MusicGame::GameCreateInfo MakeGameCreateInfo(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState)
+	// 記録したリプレイを保存(PlayResultを取得した時点までの入力が記録されている)
+	// (ディスクへの書き込みはワーカースレッドで行われるため、完了状態はリザルト画面で確認する)
+	std::shared_future<bool> EnqueueReplayFileIfRecorded(const MusicGame::GameMain& gameMain)
 	{
-		return
+		const auto& replayData = gameMain.replayData();
+		if (!replayData.has_value())
 		{
-			.chartFilePath = FilePath{ chartFilePath },
-			.playOption = MusicGame::PlayOption
-			{
-				.gameMode = courseState.has_value() ? MusicGame::GameMode::kCourseMode : MusicGame::GameMode::kNormal,
-				.isAutoPlay = isAutoPlay,
-				.gaugeType = RuntimeConfig::GetGaugeType(),
-				.turnMode = RuntimeConfig::GetTurnMode(),
-				.playbackSpeed = RuntimeConfig::GetPlaybackSpeed(),
-				.btJudgmentPlayMode = RuntimeConfig::GetJudgmentPlayModeBT(),
-				.fxJudgmentPlayMode = RuntimeConfig::GetJudgmentPlayModeFX(),
-				.laserJudgmentPlayMode = RuntimeConfig::GetJudgmentPlayModeLaser(),
-				.globalOffsetMs = ConfigIni::GetInt(ConfigIni::Key::kGlobalOffset),
-				.inputDelayMs = ConfigIni::GetInt(ConfigIni::Key::kInputDelay),
-				.laserInputDelayMs = ConfigIni::GetInt(ConfigIni::Key::kLaserInputDelay),
-				.audioProcDelayMs = ConfigIni::GetInt(ConfigIni::Key::kAudioProcDelay),
-				.visualOffsetMs = ConfigIni::GetInt(ConfigIni::Key::kVisualOffset),
-				.isAutoPlaySE = ConfigIni::GetBool(ConfigIni::Key::kAutoPlaySE),
-				.noteSkin = [&]()
-				{
-					const StringView noteSkinStr = ConfigIni::GetString(ConfigIni::Key::kNoteSkin, U"default");
-					return noteSkinStr == U"note" ? NoteSkinType::kNote : NoteSkinType::kDefault;
-				}(),
-				.fastSlowMode = static_cast<FastSlowMode>(ConfigIni::GetInt(ConfigIni::Key::kShowFastSlow, static_cast<int32>(FastSlowMode::kHide))),
-				.availableHispeedTypes = LoadAvailableHispeedTypesFromConfigIni(),
-				.hispeedSetting = LoadHispeedSettingFromConfigIni(),
-				.movieEnabled = ConfigIni::GetInt(ConfigIni::Key::kBGMovie, static_cast<int32>(MovieMode::kOn)) == static_cast<int32>(MovieMode::kOn),
-				.showBG = [&]()
-				{
-					const int32 bgDisplayMode = ConfigIni::GetInt(ConfigIni::Key::kBGDisplayMode, ConfigIni::Value::BGDisplayMode::kShowLayer);
-					return bgDisplayMode != ConfigIni::Value::BGDisplayMode::kHide;
-				}(),
-				.showLayer = [&]()
-				{
-					const int32 bgDisplayMode = ConfigIni::GetInt(ConfigIni::Key::kBGDisplayMode, ConfigIni::Value::BGDisplayMode::kShowLayer);
-					return bgDisplayMode == ConfigIni::Value::BGDisplayMode::kShowLayer;
-				}(),
-			},
-			.assistTickMode = static_cast<AssistTickMode>(ConfigIni::GetInt(ConfigIni::Key::kAssistTick, static_cast<int32>(AssistTickMode::kOff))),
-			.courseContinuation = courseState.has_value() && courseState->currentChartIdx() > 0 ? MakeOptional(courseState->continuation()) : none,
-		};
+			return std::shared_future<bool>{};
+		}
+
+		return MusicGame::Replay::EnqueueWriteReplayFile(gameMain.chartFilePath(), *replayData);
 	}
+
+	MusicGame::PreparedChart TakePreparedChart(const MusicGame::GameCreateInfo& createInfo, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation)
+	{
+		if (chartPreparation != nullptr && chartPreparation->matches(createInfo.chartFilePath, createInfo.playOption))
+		{
+			// 事前に開始した準備の結果を使用(未完了の場合は完了まで待機)
+			return chartPreparation->take();
+		}
+
+		return MusicGame::PrepareChart(createInfo.chartFilePath, createInfo.playOption);
+	}
+}
+
+MusicGame::GameCreateInfo MakeGameCreateInfo(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState)
+{
+	return
+	{
+		.chartFilePath = FilePath{ chartFilePath },
+		.playOption = MusicGame::PlayOption
+		{
+			.gameMode = courseState.has_value() ? MusicGame::GameMode::kCourseMode : MusicGame::GameMode::kNormal,
+			.isAutoPlay = isAutoPlay,
+			.gaugeType = RuntimeConfig::GetGaugeType(),
+			.turnMode = RuntimeConfig::GetTurnMode(),
+			.playbackSpeed = RuntimeConfig::GetPlaybackSpeed(),
+			.btJudgmentPlayMode = RuntimeConfig::GetJudgmentPlayModeBT(),
+			.fxJudgmentPlayMode = RuntimeConfig::GetJudgmentPlayModeFX(),
+			.laserJudgmentPlayMode = RuntimeConfig::GetJudgmentPlayModeLaser(),
+			.globalOffsetMs = ConfigIni::GetInt(ConfigIni::Key::kGlobalOffset),
+			.inputDelayMs = ConfigIni::GetInt(ConfigIni::Key::kInputDelay),
+			.laserInputDelayMs = ConfigIni::GetInt(ConfigIni::Key::kLaserInputDelay),
+			.audioProcDelayMs = ConfigIni::GetInt(ConfigIni::Key::kAudioProcDelay),
+			.visualOffsetMs = ConfigIni::GetInt(ConfigIni::Key::kVisualOffset),
+			.isAutoPlaySE = ConfigIni::GetBool(ConfigIni::Key::kAutoPlaySE),
+			.noteSkin = [&]()
+			{
+				const StringView noteSkinStr = ConfigIni::GetString(ConfigIni::Key::kNoteSkin, U"default");
+				return noteSkinStr == U"note" ? NoteSkinType::kNote : NoteSkinType::kDefault;
+			}(),
+			.fastSlowMode = static_cast<FastSlowMode>(ConfigIni::GetInt(ConfigIni::Key::kShowFastSlow, static_cast<int32>(FastSlowMode::kHide))),
+			.availableHispeedTypes = LoadAvailableHispeedTypesFromConfigIni(),
+			.hispeedSetting = LoadHispeedSettingFromConfigIni(),
+			.movieEnabled = ConfigIni::GetInt(ConfigIni::Key::kBGMovie, static_cast<int32>(MovieMode::kOn)) == static_cast<int32>(MovieMode::kOn),
+			.showBG = [&]()
+			{
+				const int32 bgDisplayMode = ConfigIni::GetInt(ConfigIni::Key::kBGDisplayMode, ConfigIni::Value::BGDisplayMode::kShowLayer);
+				return bgDisplayMode != ConfigIni::Value::BGDisplayMode::kHide;
+			}(),
+			.showLayer = [&]()
+			{
+				const int32 bgDisplayMode = ConfigIni::GetInt(ConfigIni::Key::kBGDisplayMode, ConfigIni::Value::BGDisplayMode::kShowLayer);
+				return bgDisplayMode == ConfigIni::Value::BGDisplayMode::kShowLayer;
+			}(),
+		},
+		.assistTickMode = static_cast<AssistTickMode>(ConfigIni::GetInt(ConfigIni::Key::kAssistTick, static_cast<int32>(AssistTickMode::kOff))),
+		.courseContinuation = courseState.has_value() && courseState->currentChartIdx() > 0 ? MakeOptional(courseState->continuation()) : none,
+	};
+}
+
+PlayScene::PlayScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation)
+	: PlayScene(MakeGameCreateInfo(chartFilePath, isAutoPlay, courseState), isAutoPlay, courseState, chartPreparation)
+{
 }
 
-PlayScene::PlayScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState)
-	: m_gameMain(MakeGameCreateInfo(chartFilePath, isAutoPlay, courseState))
+PlayScene::PlayScene(const MusicGame::GameCreateInfo& createInfo, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation)
+	: m_gameMain(createInfo, TakePreparedChart(createInfo, chartPreparation))
 	, m_isAutoPlay(isAutoPlay)
 	, m_courseState(courseState)
 	, m_fadeOutDuration(kFadeDuration)
@@ -147,6 +177,7 @@ void PlayScene::update()
 				.chartData = m_gameMain.chartData(), // TODO: shared_ptrでコピーを避ける?
 				.playResult = m_gameMain.playResult(),
 				.courseState = m_courseState,
+				.replaySaveFuture = EnqueueReplayFileIfRecorded(m_gameMain),
 			};
 			requestNextScene<ResultScene>(args);
 		}
@@ -181,6 +212,7 @@ void PlayScene::processBackButtonInput()
 			.chartData = m_gameMain.chartData(), // TODO: shared_ptrでコピーを避ける?
 			.playResult = m_gameMain.playResult(),
 			.courseState = m_courseState,
+			.replaySaveFuture = EnqueueReplayFileIfRecorded(m_gameMain),
 		};
 		requestNextScene<ResultScene>(args);
 	}
@@ -1,8 +1,14 @@
 ﻿#pragma once
 #include <CoTaskLib.hpp>
 #include "MusicGame/GameMain.hpp"
+#include "MusicGame/ChartPreparation.hpp"
 #include "Course/CoursePlayState.hpp"
 
+/// @brief 現在の設定からGameMainの作成情報を作成
+/// @remark ConfigIniから値を読み込むため、メインスレッドから呼び出すこと
+[[nodiscard]]
+MusicGame::GameCreateInfo MakeGameCreateInfo(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState);
+
 class PlayScene : public Co::UpdaterSceneBase
 {
 private:
@@ -23,8 +29,15 @@ private:
 
 	void processBackButtonInput();
 
+	PlayScene(const MusicGame::GameCreateInfo& createInfo, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation);
+
 public:
-	explicit PlayScene(FilePathView filePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState = none);
+	/// @brief コンストラクタ
+	/// @param filePath 譜面ファイルのパス
+	/// @param isAutoPlay オートプレイかどうか
+	/// @param courseState コース状態(コースモード時のみ)
+	/// @param chartPreparation 事前に開始した譜面の準備(nullptrまたは条件が一致しない場合はここで準備する)
+	explicit PlayScene(FilePathView filePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState = none, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation = nullptr);
 
 	virtual ~PlayScene();
 
@@ -47,13 +47,20 @@ namespace
 	{
 		ConfigIni::SetString(ConfigIni::Key::kHispeed, MusicGame::HispeedUtils::ToConfigStringValue(hispeedSetting));
 	}
+
+	std::shared_ptr<MusicGame::ChartPreparation> StartChartPreparation(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState)
+	{
+		const MusicGame::GameCreateInfo createInfo = MakeGameCreateInfo(chartFilePath, isAutoPlay, courseState);
+		return std::make_shared<MusicGame::ChartPreparation>(createInfo.chartFilePath, createInfo.playOption);
+	}
 }
 
-PlayPrepareScene::PlayPrepareScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState)
+PlayPrepareScene::PlayPrepareScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation)
 	: m_chartFilePath(chartFilePath)
 	, m_isAutoPlay(isAutoPlay)
 	, m_chartData(kson::LoadKSHChartData(chartFilePath.narrow()))
 	, m_courseState(courseState)
+	, m_chartPreparation(chartPreparation != nullptr ? chartPreparation : StartChartPreparation(chartFilePath, isAutoPlay, courseState))
 	, m_canvas(LoadPlayPrepareSceneCanvas())
 	, m_hispeedMenu(ConfigIni::LoadAvailableHispeedTypes(), LoadHispeedSettingFromConfigIni(), kson::GetEffectiveStdBPM(m_chartData), GetInitialBPM(m_chartData))
 	, m_highwayScroll(m_chartData)
@@ -112,7 +119,7 @@ Co::Task<void> PlayPrepareScene::start()
 		{
 			// 自動終了
 			SaveHispeedSettingToConfigIni(m_hispeedMenu.hispeedSetting());
-			requestNextScene<PlayScene>(m_chartFilePath, m_isAutoPlay, m_courseState);
+			requestNextScene<PlayScene>(m_chartFilePath, m_isAutoPlay, m_courseState, m_chartPreparation);
 			break;
 		}
 
@@ -137,7 +144,7 @@ Co::Task<void> PlayPrepareScene::start()
 		{
 			// 一定時間経過後はStartボタンでスキップ可能
 			SaveHispeedSettingToConfigIni(m_hispeedMenu.hispeedSetting());
-			requestNextScene<PlayScene>(m_chartFilePath, m_isAutoPlay, m_courseState);
+			requestNextScene<PlayScene>(m_chartFilePath, m_isAutoPlay, m_courseState, m_chartPreparation);
 			break;
 		}
 
@@ -4,6 +4,7 @@
 #include "MusicGame/UI/HispeedSettingMenu.hpp"
 #include "MusicGame/Scroll/HighwayScroll.hpp"
 #include "Course/CoursePlayState.hpp"
+#include "MusicGame/ChartPreparation.hpp"
 
 class PlayPrepareScene : public Co::SceneBase
 {
@@ -16,6 +17,9 @@ private:
 
 	Optional<CoursePlayState> m_courseState;
 
+	// プレイ開始前のデータ準備(この画面の表示中にワーカースレッドで進める)
+	std::shared_ptr<MusicGame::ChartPreparation> m_chartPreparation;
+
 	std::shared_ptr<noco::Canvas> m_canvas;
 
 	MusicGame::HispeedSettingMenu m_hispeedMenu;
@@ -25,7 +29,12 @@ private:
 	Stopwatch m_stopwatchSinceHispeedChange{ StartImmediately::Yes };
 
 public:
-	explicit PlayPrepareScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState = none);
+	/// @brief コンストラクタ
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @param isAutoPlay オートプレイかどうか
+	/// @param courseState コース状態(コースモード時のみ)
+	/// @param chartPreparation 選曲画面で開始した譜面の準備(nullptrの場合はここで開始する)
+	explicit PlayPrepareScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState = none, const std::shared_ptr<MusicGame::ChartPreparation>& chartPreparation = nullptr);
 
 	virtual ~PlayPrepareScene() = default;
 
@@ -9,6 +9,7 @@
 #include "UI/Dialog.hpp"
 #include "Network/InternetRanking.hpp"
 #include "Network/TwitterClient.hpp"
+#include "Common/AssetManagement.hpp"
 
 namespace
 {
@@ -223,6 +224,7 @@ ResultScene::ResultScene(const ResultSceneArgs& args)
 	, m_playResult(args.playResult)
 	, m_newRecordPanel(m_canvas)
 	, m_courseState(args.courseState)
+	, m_replaySaveFuture(args.replaySaveFuture)
 {
 	// コースモードの場合は結果を記録
 	if (m_courseState)
@@ -253,7 +255,8 @@ ResultScene::ResultScene(const ResultSceneArgs& args)
 		m_newRecordPanel.setValue(oldScore, m_playResult.score);
 
 		// スコアを保存
-		KscIO::WriteHighScoreInfo(chartFilePath, m_playResult, condition);
+		// (ディスクへの書き込みはワーカースレッドで行われるため、完了状態はdraw時に確認する)
+		m_scoreSaveFuture = KscIO::WriteHighScoreInfo(chartFilePath, m_playResult, condition);
 	}
 
 	updateCanvasParams();
@@ -605,9 +608,50 @@ void ResultScene::update()
 	m_canvas->update();
 }
 
+void ResultScene::drawScoreSaveStatus() const
+{
+	// ハイスコアとリプレイファイルの両方の保存状態をまとめて表示
+	// (保存しないものは完了扱い)
+	if (!m_scoreSaveFuture.valid() && !m_replaySaveFuture.valid())
+	{
+		return;
+	}
+
+	const auto isReady = [](const std::shared_future<bool>& future)
+	{
+		return !future.valid() || future.wait_for(std::chrono::seconds{ 0 }) == std::future_status::ready;
+	};
+	const auto isSucceeded = [](const std::shared_future<bool>& future)
+	{
+		return !future.valid() || future.get();
+	};
+
+	StringView text;
+	ColorF color;
+	if (!isReady(m_scoreSaveFuture) || !isReady(m_replaySaveFuture))
+	{
+		text = U"SAVING...";
+		color = ColorF{ 1.0, 0.8 };
+	}
+	else if (isSucceeded(m_scoreSaveFuture) && isSucceeded(m_replaySaveFuture))
+	{
+		text = U"SAVED";
+		color = ColorF{ 0.6, 1.0, 0.6, 0.8 };
+	}
+	else
+	{
+		text = U"SAVE FAILED";
+		color = ColorF{ 1.0, 0.4, 0.4, 0.9 };
+	}
+
+	const Vec2 pos = Scene::Size() - Scaled(8, 4);
+	AssetManagement::SystemFont()(text).draw(Scaled(12), Arg::bottomRight = pos, color);
+}
+
 void ResultScene::draw() const
 {
 	m_canvas->draw();
+	drawScoreSaveStatus();
 }
 
 Co::Task<void> ResultScene::fadeIn()
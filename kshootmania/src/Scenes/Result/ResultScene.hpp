@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <future>
 #include <CoTaskLib.hpp>
 #include "ResultSceneArgs.hpp"
 #include "ResultNewRecordPanel.hpp"
@@ -20,6 +21,14 @@ private:
 
 	Optional<CoursePlayState> m_courseState;
 
+	/// @brief ハイスコアの保存の完了を待つためのfuture(保存しない場合は無効)
+	std::shared_future<bool> m_scoreSaveFuture;
+
+	/// @brief リプレイファイルの保存の完了を待つためのfuture(保存しない場合は無効)
+	std::shared_future<bool> m_replaySaveFuture;
+
+	void drawScoreSaveStatus() const;
+
 	void updateCanvasParams();
 
 	void update();
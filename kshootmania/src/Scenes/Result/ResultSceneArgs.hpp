@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <future>
 #include "MusicGame/PlayResult.hpp"
 #include "Course/CoursePlayState.hpp"
 
@@ -11,4 +12,7 @@ struct ResultSceneArgs
 	MusicGame::PlayResult playResult;
 
 	Optional<CoursePlayState> courseState;
+
+	/// @brief リプレイファイルの保存の完了を待つためのfuture(保存しない場合は無効)
+	std::shared_future<bool> replaySaveFuture;
 };
@@ -100,6 +100,13 @@ public:
 	/// @param tag SubCanvasのタグ(例:"top1", "bottom2")
 	virtual void setCanvasParamsTopBottom(const SelectMenuEventContext& context, noco::Canvas& canvas, int32 difficultyIdx, StringView tag) const = 0;
 
+	/// @brief 先読みする画像の読み込み要求を追加
+	/// @param difficultyIdx 現在選択中の難易度のインデックス(0～3)
+	/// @param pRequests 追加先
+	virtual void appendTextureRequests([[maybe_unused]] int32 difficultyIdx, [[maybe_unused]] Array<SelectTextureRequest>* pRequests) const
+	{
+	}
+
 	/// @brief この項目をエクスプローラで表示
 	/// @param difficultyIdx 現在選択中の難易度のインデックス(0～3)
 	virtual void showInFileManager([[maybe_unused]] int32 difficultyIdx) const
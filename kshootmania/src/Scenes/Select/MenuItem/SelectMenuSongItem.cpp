@@ -3,10 +3,13 @@
 #include "Scenes/Select/SelectDifficultyMenu.hpp"
 #include "RuntimeConfig.hpp"
 #include "NocoExtensions/NocoUtils.hpp"
+#include "Common/FrameProfiler.hpp"
 
 SelectMenuSongItem::SelectMenuSongItem(FilePathView fullPath)
 	: m_fullPath(fullPath)
 {
+	const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kSelectItemConstruction };
+
 	Array<FilePath> chartFilePaths;
 
 	if (FileSystem::IsFile(fullPath))
@@ -35,32 +38,57 @@ SelectMenuSongItem::SelectMenuSongItem(FilePathView fullPath)
 			continue;
 		}
 
-		auto chartInfo = std::make_unique<SelectChartInfo>(chartFilePath);
+		addChartInfo(std::make_unique<SelectChartInfo>(chartFilePath));
+	}
+}
 
-		if (chartInfo->hasError())
-		{
-			Logger << U"[ksm warning] SelectMenuSongItem::SelectMenuSongItem: KSH Loading Error (error:'{}', chartFilePath:'{}')"_fmt(chartInfo->errorString(), chartFilePath);
-			continue;
-		}
+SelectMenuSongItem::SelectMenuSongItem(FilePathView directoryPath, Array<ScannedChart>&& scannedCharts)
+	: m_fullPath(directoryPath)
+{
+	const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kSelectItemConstruction };
 
-		int32 difficultyIdx = chartInfo->difficultyIdx();
-		if (difficultyIdx < 0 || kNumDifficulties <= difficultyIdx) [[unlikely]]
-		{
-			// 未知の難易度の場合は一番右の難易度にする
-			Logger << U"[ksm warning] SelectMenuSongItem::SelectMenuSongItem: Difficulty index out of range (difficultyIdx:{}, chartFilePath:'{}')"_fmt(difficultyIdx, chartFilePath);
-			difficultyIdx = kNumDifficulties - 1;
-		}
+	for (auto& scannedChart : scannedCharts)
+	{
+		addChartInfo(std::make_unique<SelectChartInfo>(scannedChart.chartFilePath, std::move(scannedChart.chartEntry)));
+	}
+}
 
-		if (m_chartInfos[difficultyIdx] != nullptr) [[unlikely]]
-		{
-			Logger << U"[ksm warning] SelectMenuSongItem::SelectMenuSongItem: Skip duplication (difficultyIdx:{}, chartFilePath:'{}')"_fmt(difficultyIdx, chartFilePath);
-			continue;
-		}
+SelectMenuSongItem::SelectMenuSongItem(ScannedChart&& scannedChart)
+	: m_fullPath(scannedChart.chartFilePath)
+	, m_isSingleChartItem(true)
+{
+	const FrameProfiler::ScopedTimer profilerTimer{ FrameProfiler::Section::kSelectItemConstruction };
+
+	addChartInfo(std::make_unique<SelectChartInfo>(scannedChart.chartFilePath, std::move(scannedChart.chartEntry)));
+}
+
+void SelectMenuSongItem::addChartInfo(std::unique_ptr<SelectChartInfo>&& chartInfo)
+{
+	const FilePathView chartFilePath = chartInfo->chartFilePath();
+
+	if (chartInfo->hasError())
+	{
+		Logger << U"[ksm warning] SelectMenuSongItem::SelectMenuSongItem: KSH Loading Error (error:'{}', chartFilePath:'{}')"_fmt(chartInfo->errorString(), chartFilePath);
+		return;
+	}
 
-		m_chartInfos[difficultyIdx] = std::move(chartInfo);
+	int32 difficultyIdx = chartInfo->difficultyIdx();
+	if (difficultyIdx < 0 || kNumDifficulties <= difficultyIdx) [[unlikely]]
+	{
+		// 未知の難易度の場合は一番右の難易度にする
+		Logger << U"[ksm warning] SelectMenuSongItem::SelectMenuSongItem: Difficulty index out of range (difficultyIdx:{}, chartFilePath:'{}')"_fmt(difficultyIdx, chartFilePath);
+		difficultyIdx = kNumDifficulties - 1;
+	}
 
-		m_chartExists = true;
+	if (m_chartInfos[difficultyIdx] != nullptr) [[unlikely]]
+	{
+		Logger << U"[ksm warning] SelectMenuSongItem::SelectMenuSongItem: Skip duplication (difficultyIdx:{}, chartFilePath:'{}')"_fmt(difficultyIdx, chartFilePath);
+		return;
 	}
+
+	m_chartInfos[difficultyIdx] = std::move(chartInfo);
+
+	m_chartExists = true;
 }
 
 void SelectMenuSongItem::decide(const SelectMenuEventContext& context, int32 difficultyIdx)
@@ -462,6 +490,40 @@ void SelectMenuSongItem::setCanvasParamsTopBottom(const SelectMenuEventContext&
 	}
 }
 
+void SelectMenuSongItem::appendTextureRequests(int32 difficultyIdx, Array<SelectTextureRequest>* pRequests) const
+{
+	// 画面内に入った際はsetCanvasParamsTopBottomで表示されるため、同じく代替カーソル値の譜面の画像を先読みする
+	const int32 altDifficultyIdx = SelectDifficultyMenu::GetAlternativeCursor(difficultyIdx,
+		[this](int32 idx)
+		{
+			return chartInfoPtr(idx) != nullptr;
+		});
+	const SelectChartInfo* pAltChartInfo = chartInfoPtr(altDifficultyIdx);
+	if (pAltChartInfo == nullptr)
+	{
+		return;
+	}
+
+	pRequests->push_back({ SelectTextureKind::kJacket, pAltChartInfo->jacketFilePath() });
+
+	if (const FilePath iconFilePath = pAltChartInfo->iconFilePath(); !iconFilePath.isEmpty())
+	{
+		pRequests->push_back({ SelectTextureKind::kIcon, iconFilePath });
+	}
+
+	if (ConfigIni::GetBool(ConfigIni::Key::kShowSongTitleImages))
+	{
+		if (const String titleImgPath = pAltChartInfo->titleImgFilePath(); !titleImgPath.empty())
+		{
+			pRequests->push_back({ SelectTextureKind::kTitle, titleImgPath });
+		}
+		if (const String artistImgPath = pAltChartInfo->artistImgFilePath(); !artistImgPath.empty())
+		{
+			pRequests->push_back({ SelectTextureKind::kArtist, artistImgPath });
+		}
+	}
+}
+
 void SelectMenuSongItem::showInFileManager(int32 difficultyIdx) const
 {
 	// 選択中の難易度の譜面ファイルを取得
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "ISelectMenuItem.hpp"
+#include "SongLibrary/ChartScanner.hpp"
 
 class SelectMenuSongItem : public ISelectMenuItem
 {
@@ -15,10 +16,19 @@ private:
 	// 単一譜面項目の譜面情報を取得(存在しない場合はnullptrを返す)
 	const SelectChartInfo* chartInfoForSingleChartItem() const;
 
+	// 譜面情報を難易度に対応する位置に追加(読み込みエラー・難易度の重複時は追加しない)
+	void addChartInfo(std::unique_ptr<SelectChartInfo>&& chartInfo);
+
 public:
 	// fullPathはディレクトリパスの場合は楽曲フォルダ、ファイルパスの場合は単体難易度の譜面として読み込む
 	explicit SelectMenuSongItem(FilePathView fullPath);
 
+	// ChartScannerでスキャン済みの譜面から楽曲フォルダの項目を作成(譜面ファイルは読み込まない)
+	SelectMenuSongItem(FilePathView directoryPath, Array<ScannedChart>&& scannedCharts);
+
+	// ChartScannerでスキャン済みの譜面から単体難易度の項目を作成(譜面ファイルは読み込まない)
+	explicit SelectMenuSongItem(ScannedChart&& scannedChart);
+
 	virtual ~SelectMenuSongItem() = default;
 
 	virtual void decide(const SelectMenuEventContext& context, int32 difficultyIdx) override;
@@ -67,6 +77,11 @@ public:
 	/// @param tag SubCanvasのタグ(例:"top1", "bottom2")
 	virtual void setCanvasParamsTopBottom(const SelectMenuEventContext& context, noco::Canvas& canvas, int32 difficultyIdx, StringView tag) const override;
 
+	/// @brief 先読みする画像の読み込み要求を追加
+	/// @param difficultyIdx 現在選択中の難易度のインデックス(0～3)
+	/// @param pRequests 追加先
+	virtual void appendTextureRequests(int32 difficultyIdx, Array<SelectTextureRequest>* pRequests) const override;
+
 	/// @brief この項目をエクスプローラで表示
 	/// @param difficultyIdx 現在選択中の難易度のインデックス(0～3)
 	virtual void showInFileManager(int32 difficultyIdx) const override;
@@ -1,8 +1,6 @@
 ﻿#include "SelectChartInfo.hpp"
-#include "HighScore/KscIO.hpp"
 #include "HighScore/KscKey.hpp"
 #include "Ini/ConfigIni.hpp"
-#include "kson/IO/KshIO.hpp"
 #include "RuntimeConfig.hpp"
 
 namespace
@@ -27,10 +25,15 @@ FilePath SelectChartInfo::toFullPath(const std::string& u8Filename) const
 }
 
 SelectChartInfo::SelectChartInfo(FilePathView chartFilePath)
+	: SelectChartInfo(chartFilePath, SongLibraryIndex::GetChartEntry(chartFilePath))
+{
+}
+
+SelectChartInfo::SelectChartInfo(FilePathView chartFilePath, SongLibraryIndex::ChartEntry&& chartEntry)
 	: m_chartFilePath(chartFilePath)
-	, m_chartData(kson::LoadKSHMetaChartData(chartFilePath.narrow()))
+	, m_chartData(std::move(chartEntry.chartData))
+	, m_highScoreInfoMap(std::move(chartEntry.highScoreInfoMap))
 {
-	KscIO::ReadAllHighScoreInfo(chartFilePath, &m_highScoreInfoMap);
 }
 
 String SelectChartInfo::title() const
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "kson/ChartData.hpp"
 #include "HighScore/HighScoreInfo.hpp"
+#include "SongLibrary/SongLibraryIndex.hpp"
 
 class SelectChartInfo
 {
@@ -17,6 +18,8 @@ private:
 public:
 	explicit SelectChartInfo(FilePathView chartFilePath);
 
+	SelectChartInfo(FilePathView chartFilePath, SongLibraryIndex::ChartEntry&& chartEntry);
+
 	String title() const;
 
 	String titleImgFilePath() const;
@@ -14,28 +14,10 @@
 #include "Ini/ConfIni.hpp"
 #include "Input/PlatformKey.hpp"
 #include "Course/CourseInfo.hpp"
+#include "SongLibrary/ChartScanner.hpp"
 
 namespace
 {
-	Array<FilePath> GetSubDirectories(FilePathView path)
-	{
-		Array<FilePath> directories =
-			FileSystem::DirectoryContents(path, Recursive::No)
-				.filter(
-					[](FilePathView p)
-					{
-						return FileSystem::IsDirectory(p);
-					});
-
-		// フォルダ名(小文字変換)の昇順でソート
-		directories.sort_by([](const FilePath& a, const FilePath& b)
-		{
-			return FsUtils::DirectoryNameByDirectoryPath(a).lowercased() < FsUtils::DirectoryNameByDirectoryPath(b).lowercased();
-		});
-
-		return directories;
-	}
-
 	// foldername.csvを読み込んでフォルダ名→表示名の対応関係を取得
 	// (キー"*"は全フォルダに対して適用される表示名を示す)
 	HashTable<String, String> LoadFolderNameTable(FilePathView directoryPath)
@@ -254,8 +236,76 @@ namespace
 
 		return courseItems;
 	}
+
+	// レベル順ソート用の譜面情報
+	struct LevelSortChart
+	{
+		ScannedChart scannedChart;
+		String songDirectoryName;
+	};
+
+	// スキャン済みの楽曲フォルダ内の譜面をレベルごとに分類
+	void ClassifyScannedChartsByLevel(ScannedSongDirectory&& scannedDirectory, StringView callerName, std::array<Array<LevelSortChart>, kNumLevels>* pChartsByLevel)
+	{
+		// サブディレクトリ内の譜面を先に追加
+		for (auto& subDirectory : scannedDirectory.subDirectories)
+		{
+			ClassifyScannedChartsByLevel(std::move(subDirectory), callerName, pChartsByLevel);
+		}
+
+		const String songDirectoryName = FsUtils::DirectoryNameByDirectoryPath(scannedDirectory.directoryPath).lowercased();
+		for (auto& scannedChart : scannedDirectory.charts)
+		{
+			const kson::MetaChartData& chartData = scannedChart.chartEntry.chartData;
+			if (chartData.error != kson::ErrorType::None)
+			{
+				Logger << U"[ksm warning] {}: KSH Loading Error (error:'{}', chartFilePath:'{}')"_fmt(callerName, Unicode::FromUTF8(kson::GetErrorString(chartData.error)), scannedChart.chartFilePath);
+				continue;
+			}
+
+			const int32 level = chartData.meta.level;
+			const int32 difficultyIdx = chartData.meta.difficulty.idx;
+
+			if (level < 1 || level > 20)
+			{
+				Logger << U"[ksm warning] {}: Level out of range (level:{}, chartFilePath:'{}')"_fmt(callerName, level, scannedChart.chartFilePath);
+				continue;
+			}
+
+			if (difficultyIdx < 0 || difficultyIdx >= kNumDifficulties)
+			{
+				Logger << U"[ksm warning] {}: Difficulty index out of range (difficultyIdx:{}, chartFilePath:'{}')"_fmt(callerName, difficultyIdx, scannedChart.chartFilePath);
+				continue;
+			}
+
+			(*pChartsByLevel)[level - 1].push_back(LevelSortChart{
+				.scannedChart = std::move(scannedChart),
+				.songDirectoryName = songDirectoryName,
+			});
+		}
+	}
 }
 
+struct SelectMenu::PendingDirectoryScan
+{
+	ChartScanner scanner;
+
+	// 曲の項目の挿入位置(見出し項目・コース項目の後、フォルダ項目の前)
+	std::size_t insertIdx;
+
+	HashTable<String, String> folderNameTable;
+
+	// フォルダ直下に譜面がなかった楽曲フォルダ(サブディレクトリの候補)
+	Array<ScannedSongDirectory> subDirCandidates;
+
+	PendingDirectoryScan(const Array<FilePath>& songDirectories, std::size_t insertIdx, HashTable<String, String>&& folderNameTable)
+		: scanner(songDirectories, SubDirectoryScanMode::kIfNoValidChart)
+		, insertIdx(insertIdx)
+		, folderNameTable(std::move(folderNameTable))
+	{
+	}
+};
+
 bool SelectMenu::openDirectory(FilePathView directoryPath, PlaySeYN playSe, RefreshSongPreviewYN refreshSongPreview, SaveToConfigIniYN saveToConfigIni)
 {
 	if (playSe)
@@ -305,29 +355,6 @@ bool SelectMenu::openDirectory(FilePathView directoryPath, PlaySeYN playSe, Refr
 
 bool SelectMenu::openDirectoryWithNameSort(FilePathView directoryPath)
 {
-	using Unicode::FromUTF8;
-
-	// 曲の項目を挿入する関数
-	// (挿入されたかどうかを返す)
-	const auto fnInsertSongItem = [this](const String& songDirectory) -> bool
-	{
-		if (!FileSystem::IsDirectory(songDirectory))
-		{
-			return false;
-		}
-
-		std::unique_ptr<SelectMenuSongItem> item = std::make_unique<SelectMenuSongItem>(songDirectory);
-		if (item->chartExists())
-		{
-			m_menu.push_back(std::move(item));
-			return true;
-		}
-		else
-		{
-			return false;
-		}
-	};
-
 	if (!directoryPath.empty())
 	{
 		if (!FileSystem::IsDirectory(directoryPath))
@@ -336,11 +363,7 @@ bool SelectMenu::openDirectoryWithNameSort(FilePathView directoryPath)
 			return false;
 		}
 
-		m_menu.clear();
-		m_jacketTextureCache.clear();
-		m_iconTextureCache.clear();
-		m_titleTextureCache.clear();
-		m_artistTextureCache.clear();
+		clearMenu();
 
 		// ディレクトリの見出し項目を追加
 		m_menu.push_back(std::make_unique<SelectMenuDirFolderItem>(IsCurrentFolderYN::Yes, FileSystem::FullPath(directoryPath)));
@@ -355,66 +378,19 @@ bool SelectMenu::openDirectoryWithNameSort(FilePathView directoryPath)
 		}
 
 		// 曲の項目を追加
-		Array<FilePath> subDirCandidates;
-		{
-			const Array<FilePath> songDirectories = GetSubDirectories(directoryPath);
-			for (const auto& songDirectory : songDirectories)
-			{
-				// 項目追加
-				const bool chartExists = fnInsertSongItem(songDirectory);
-
-				// フォルダ直下に譜面がなかった場合はサブディレクトリの候補に追加
-				if (!chartExists)
-				{
-					subDirCandidates.push_back(songDirectory);
-				}
-			}
-		}
-
-		// foldername.csvを読み込んでフォルダ名の対応関係を取得
-		const HashTable<String, String> folderNameTable = LoadFolderNameTable(directoryPath);
-
-		// サブディレクトリ内の曲の項目を追加
-		for (const auto& subDirCandidate : subDirCandidates)
-		{
-			const String folderName = FsUtils::DirectoryNameByDirectoryPath(subDirCandidate);
-			const Optional<String> displayName = GetDisplayNameFromFolderNameTable(folderNameTable, folderName);
-
-			// 表示名が空文字列の場合は見出し項目を追加せず、曲だけを追加
-			const bool shouldSkipHeading = displayName.has_value() && displayName->isEmpty();
-
-			if (!shouldSkipHeading)
-			{
-				// サブディレクトリの見出し項目を追加
-				m_menu.push_back(std::make_unique<SelectMenuSubDirSectionItem>(FileSystem::FullPath(subDirCandidate), displayName));
-			}
-
-			bool chartExists = false;
-			const Array<FilePath> songDirectories = GetSubDirectories(subDirCandidate);
-			for (const auto& songDirectory : songDirectories)
-			{
-				// 項目追加
-				if (fnInsertSongItem(songDirectory))
-				{
-					chartExists = true;
-				}
-			}
-
-			// サブディレクトリ内に譜面が存在しなかった場合は見出し項目を削除
-			if (!shouldSkipHeading && !chartExists)
-			{
-				m_menu.pop_back();
-			}
-		}
+		// (楽曲フォルダはスレッドプール上で並列にスキャンし、画面に表示される分だけ完了を待つ。残りはupdate()内で順次追加する)
+		m_pendingDirectoryScan = std::make_unique<PendingDirectoryScan>(
+			FsUtils::SubDirectoriesSortedByName(directoryPath),
+			m_menu.size(),
+			LoadFolderNameTable(directoryPath));
+		insertScannedSongDirectories(m_pendingDirectoryScan->scanner.take(static_cast<std::size_t>(kNumDisplayItems)));
 
 		m_folderState.folderType = SelectFolderState::kDirectory;
 		m_folderState.fullPath = FileSystem::FullPath(directoryPath);
 	}
 	else
 	{
-		m_menu.clear();
-		m_jacketTextureCache.clear();
-		m_iconTextureCache.clear();
+		clearMenu();
 
 		m_folderState.folderType = SelectFolderState::kNone;
 		m_folderState.fullPath = U"";
@@ -422,14 +398,120 @@ bool SelectMenu::openDirectoryWithNameSort(FilePathView directoryPath)
 
 	// フォルダ項目を追加
 	// (フォルダを開いていない場合、または現在開いていないフォルダを表示する設定の場合のみ)
+	// Note: スキャン途中の曲の項目はフォルダ項目より前に挿入される
 	if (directoryPath.empty() || ConfigIni::GetBool(ConfigIni::Key::kAlwaysShowOtherFolders))
 	{
 		addOtherFolderItemsRotated();
 	}
 
+	// 曲数が少なくスキャンが既に完了している場合はここでサブディレクトリの項目まで追加される
+	pumpDirectoryScan();
+
 	return true;
 }
 
+void SelectMenu::clearMenu()
+{
+	// スキャン途中のフォルダがあれば中断
+	m_pendingDirectoryScan.reset();
+
+	m_menu.clear();
+}
+
+void SelectMenu::insertScannedSongDirectories(Array<ScannedSongDirectory>&& scannedDirectories)
+{
+	PendingDirectoryScan& scan = *m_pendingDirectoryScan;
+	for (auto& scannedDirectory : scannedDirectories)
+	{
+		auto item = std::make_unique<SelectMenuSongItem>(scannedDirectory.directoryPath, std::move(scannedDirectory.charts));
+		if (item->chartExists())
+		{
+			m_menu.insert(scan.insertIdx, std::move(item));
+			++scan.insertIdx;
+		}
+		else
+		{
+			// フォルダ直下に譜面がなかった場合はサブディレクトリの候補に追加
+			scan.subDirCandidates.push_back(std::move(scannedDirectory));
+		}
+	}
+}
+
+void SelectMenu::insertSubDirSectionItems()
+{
+	PendingDirectoryScan& scan = *m_pendingDirectoryScan;
+	for (auto& subDirCandidate : scan.subDirCandidates)
+	{
+		Array<std::unique_ptr<ISelectMenuItem>> songItems;
+		for (auto& scannedDirectory : subDirCandidate.subDirectories)
+		{
+			auto item = std::make_unique<SelectMenuSongItem>(scannedDirectory.directoryPath, std::move(scannedDirectory.charts));
+			if (item->chartExists())
+			{
+				songItems.push_back(std::move(item));
+			}
+		}
+
+		// サブディレクトリ内に譜面が存在しなかった場合は見出し項目も追加しない
+		if (songItems.isEmpty())
+		{
+			continue;
+		}
+
+		const String folderName = FsUtils::DirectoryNameByDirectoryPath(subDirCandidate.directoryPath);
+		const Optional<String> displayName = GetDisplayNameFromFolderNameTable(scan.folderNameTable, folderName);
+
+		// 表示名が空文字列の場合は見出し項目を追加せず、曲だけを追加
+		const bool shouldSkipHeading = displayName.has_value() && displayName->isEmpty();
+		if (!shouldSkipHeading)
+		{
+			// サブディレクトリの見出し項目を追加
+			m_menu.insert(scan.insertIdx, std::make_unique<SelectMenuSubDirSectionItem>(FileSystem::FullPath(subDirCandidate.directoryPath), displayName));
+			++scan.insertIdx;
+		}
+
+		for (auto& songItem : songItems)
+		{
+			m_menu.insert(scan.insertIdx, std::move(songItem));
+			++scan.insertIdx;
+		}
+	}
+	scan.subDirCandidates.clear();
+}
+
+bool SelectMenu::pumpDirectoryScan()
+{
+	if (m_pendingDirectoryScan == nullptr)
+	{
+		return false;
+	}
+
+	const std::size_t prevSize = m_menu.size();
+
+	insertScannedSongDirectories(m_pendingDirectoryScan->scanner.takeReady());
+
+	// サブディレクトリの項目は全ての曲の項目の後に並ぶため、スキャンが全て完了してから追加する
+	if (m_pendingDirectoryScan->scanner.isCompleted())
+	{
+		insertSubDirSectionItems();
+		m_pendingDirectoryScan.reset();
+	}
+
+	return m_menu.size() != prevSize;
+}
+
+void SelectMenu::completeDirectoryScan()
+{
+	if (m_pendingDirectoryScan == nullptr)
+	{
+		return;
+	}
+
+	insertScannedSongDirectories(m_pendingDirectoryScan->scanner.takeAll());
+	insertSubDirSectionItems();
+	m_pendingDirectoryScan.reset();
+}
+
 void SelectMenu::setCursorAndSave(int32 cursor)
 {
 	m_menu.setCursor(cursor);
@@ -438,6 +520,8 @@ void SelectMenu::setCursorAndSave(int32 cursor)
 
 void SelectMenu::setCursorToItemByFullPath(FilePathView fullPath)
 {
+	completeDirectoryScan();
+
 	// 大した数ではないので線形探索
 	for (std::size_t i = 0U; i < m_menu.size(); ++i)
 	{
@@ -490,6 +574,29 @@ void SelectMenu::refreshContentCanvasParams()
 	}
 }
 
+void SelectMenu::prefetchTextures(int32 direction)
+{
+	if (m_menu.empty())
+	{
+		return;
+	}
+
+	const int32 difficultyCursor = m_difficultyMenu.cursor(); // この値は-1にもなり得る
+	const int32 difficultyIdx = difficultyCursor >= 0 ? difficultyCursor : m_difficultyMenu.rawCursor();
+
+	// 画面に表示される項目のすぐ外側から、スクロール方向へ順に先読みする
+	const int32 firstOffset = direction > 0 ? kNumBottomItems + 1 : -(kNumTopItems + 1);
+	Array<SelectTextureRequest> requests;
+	for (int32 i = 0; i < kNumPrefetchItems; ++i)
+	{
+		if (const auto pItem = m_menu.atCyclic(m_menu.cursor() + firstOffset + direction * i).get())
+		{
+			pItem->appendTextureRequests(difficultyIdx, &requests);
+		}
+	}
+	m_textureLoader.setPrefetchRequests(requests);
+}
+
 void SelectMenu::refreshSongPreview()
 {
 	if (m_menu.empty() || m_menu.cursorValue() == nullptr)
@@ -614,6 +721,8 @@ SelectMenu::SelectMenu(const std::shared_ptr<noco::Canvas>& selectSceneCanvas, s
 	if (openSuccess)
 	{
 		// 前回選択していたインデックスを復元
+		// (インデックスがずれないよう、スキャン途中の曲の項目を全て追加してから復元する)
+		completeDirectoryScan();
 		m_menu.setCursor(loadedCursor);
 		ConfigIni::SetInt(ConfigIni::Key::kSelectSongIndex, loadedCursor);
 
@@ -641,6 +750,26 @@ void SelectMenu::update(SongPreviewOnlyYN songPreviewOnly)
 		return;
 	}
 
+	// スキャンが完了した曲の項目を追加
+	{
+		const int32 prevCursor = m_menu.cursor();
+		if (pumpDirectoryScan())
+		{
+			// 項目の挿入でカーソルがずれた場合は保存されているインデックスも更新
+			if (m_menu.cursor() != prevCursor)
+			{
+				ConfigIni::SetInt(ConfigIni::Key::kSelectSongIndex, m_menu.cursor());
+			}
+			refreshContentCanvasParams();
+		}
+	}
+
+	// 読み込みが完了した画像を表示に反映
+	if (m_textureLoader.update())
+	{
+		refreshContentCanvasParams();
+	}
+
 	m_menu.update();
 	if (const int32 deltaCursor = m_menu.deltaCursor(); deltaCursor != 0)
 	{
@@ -656,6 +785,7 @@ void SelectMenu::update(SongPreviewOnlyYN songPreviewOnly)
 		}
 		refreshContentCanvasParams();
 		refreshSongPreview();
+		prefetchTextures(deltaCursor > 0 ? 1 : -1);
 	}
 
 	// FX-L + FX-R同時押しでソートモード切り替え
@@ -843,6 +973,8 @@ void SelectMenu::reloadCurrentDirectory(RefreshSongPreviewYN refreshSongPreview)
 	}
 
 	// 譜面ファイルパスから項目を探してフォーカスを復元
+	// (スキャン途中の曲の項目も探索対象にするため、全て追加してから探す)
+	completeDirectoryScan();
 	if (!currentChartFilePath.isEmpty())
 	{
 		bool found = false;
@@ -899,102 +1031,28 @@ void SelectMenu::refreshHighScoreDisplay()
 
 const Texture& SelectMenu::getJacketTexture(FilePathView filePath)
 {
-	if (auto it = m_jacketTextureCache.find(filePath); it != m_jacketTextureCache.end())
-	{
-		return it->second;
-	}
-
-	Texture texture;
-	FilePath actualFilePath{ filePath };
-
-	// 拡張子なしの場合はimgs/jacket内の画像を使用
-	if (FileSystem::Extension(actualFilePath).isEmpty())
-	{
-		const String baseName = FileSystem::BaseName(actualFilePath);
-		if (!baseName.isEmpty())
-		{
-			actualFilePath = FileSystem::PathAppend(U"imgs/jacket", baseName + U".jpg");
-		}
-	}
-
-	if (FileSystem::IsFile(actualFilePath))
-	{
-		texture = Texture{ actualFilePath };
-	}
-	else
-	{
-		Logger << U"[ksm warning] SelectMenu::getJacketTexture: Jacket image file not found (filePath:'{}')"_fmt(filePath);
-	}
-
-	return m_jacketTextureCache.emplace(filePath, std::move(texture)).first->second;
+	return m_textureLoader.get(SelectTextureKind::kJacket, filePath);
 }
 
 const Texture& SelectMenu::getIconTexture(FilePathView filePath)
 {
-	if (auto it = m_iconTextureCache.find(filePath); it != m_iconTextureCache.end())
-	{
-		return it->second;
-	}
-
-	Texture texture;
-	FilePath actualFilePath{ filePath };
-
-	// 拡張子なしの場合はimgs/icon内の画像を使用
-	if (FileSystem::Extension(actualFilePath).isEmpty())
-	{
-		const String baseName = FileSystem::BaseName(actualFilePath);
-		if (!baseName.isEmpty())
-		{
-			actualFilePath = FileSystem::PathAppend(U"imgs/icon", baseName + U".png");
-		}
-	}
-
-	if (FileSystem::IsFile(actualFilePath))
-	{
-		texture = Texture{ actualFilePath };
-	}
-	else
-	{
-		Logger << U"[ksm warning] SelectMenu::getIconTexture: Icon image file not found (filePath:'{}')"_fmt(filePath);
-	}
-
-	return m_iconTextureCache.emplace(filePath, std::move(texture)).first->second;
+	return m_textureLoader.get(SelectTextureKind::kIcon, filePath);
 }
 
 const Texture& SelectMenu::getTitleTexture(FilePathView filePath)
 {
-	if (auto it = m_titleTextureCache.find(filePath); it != m_titleTextureCache.end())
-	{
-		return it->second;
-	}
-
-	Texture texture;
-	if (FileSystem::IsFile(filePath))
-	{
-		texture = Texture{ filePath };
-	}
-
-	return m_titleTextureCache.emplace(filePath, std::move(texture)).first->second;
+	return m_textureLoader.get(SelectTextureKind::kTitle, filePath);
 }
 
 const Texture& SelectMenu::getArtistTexture(FilePathView filePath)
 {
-	if (auto it = m_artistTextureCache.find(filePath); it != m_artistTextureCache.end())
-	{
-		return it->second;
-	}
-
-	Texture texture;
-	if (FileSystem::IsFile(filePath))
-	{
-		texture = Texture{ filePath };
-	}
-
-	return m_artistTextureCache.emplace(filePath, std::move(texture)).first->second;
+	return m_textureLoader.get(SelectTextureKind::kArtist, filePath);
 }
 
 void SelectMenu::moveToNextSubDirSection()
 {
+	completeDirectoryScan();
+
 	if (m_menu.empty())
 	{
 		return;
@@ -1033,6 +1091,8 @@ void SelectMenu::moveToNextSubDirSection()
 
 void SelectMenu::moveToPrevSubDirSection()
 {
+	completeDirectoryScan();
+
 	if (m_menu.empty())
 	{
 		return;
@@ -1071,6 +1131,8 @@ void SelectMenu::moveToPrevSubDirSection()
 
 void SelectMenu::jumpToAlphabetItem(char32 letter)
 {
+	completeDirectoryScan();
+
 	if (m_menu.empty())
 	{
 		return;
@@ -1138,6 +1200,8 @@ void SelectMenu::jumpToAlphabetItem(char32 letter)
 
 void SelectMenu::jumpToNextAlphabet()
 {
+	completeDirectoryScan();
+
 	if (m_menu.empty())
 	{
 		return;
@@ -1204,6 +1268,8 @@ void SelectMenu::jumpToNextAlphabet()
 
 void SelectMenu::jumpToPrevAlphabet()
 {
+	completeDirectoryScan();
+
 	if (m_menu.empty())
 	{
 		return;
@@ -1294,9 +1360,7 @@ bool SelectMenu::openDirectoryWithLevelSort(FilePathView directoryPath)
 			return false;
 		}
 
-		m_menu.clear();
-		m_jacketTextureCache.clear();
-		m_iconTextureCache.clear();
+		clearMenu();
 
 		// ディレクトリの見出し項目を追加
 		m_menu.push_back(std::make_unique<SelectMenuDirFolderItem>(IsCurrentFolderYN::Yes, FileSystem::FullPath(directoryPath)));
@@ -1310,86 +1374,28 @@ bool SelectMenu::openDirectoryWithLevelSort(FilePathView directoryPath)
 			}
 		}
 
-		// レベルごとに譜面を分類
-		struct ChartFileInfo
-		{
-			FilePath filePath;
-			int32 difficultyIdx;
-			String songDirectoryName;
-		};
-		std::array<Array<ChartFileInfo>, kNumLevels> chartsByLevel;
-
-		// 譜面ファイルを処理してchartsByLevelに追加する関数
-		const auto fnProcessChartFiles = [&chartsByLevel](const FilePath& directory, const Array<FilePath>& chartFiles)
-		{
-			for (const auto& chartFile : chartFiles)
-			{
-				auto chartInfo = std::make_unique<SelectChartInfo>(chartFile);
-				if (chartInfo->hasError())
-				{
-					Logger << U"[ksm warning] SelectMenu::openDirectoryWithLevelSort: KSH Loading Error (error:'{}', chartFilePath:'{}')"_fmt(chartInfo->errorString(), chartFile);
-					continue;
-				}
-
-				const int32 level = chartInfo->level();
-				const int32 difficultyIdx = chartInfo->difficultyIdx();
-
-				if (level < 1 || level > 20)
-				{
-					Logger << U"[ksm warning] SelectMenu::openDirectoryWithLevelSort: Level out of range (level:{}, chartFilePath:'{}')"_fmt(level, chartFile);
-					continue;
-				}
-
-				if (difficultyIdx < 0 || difficultyIdx >= kNumDifficulties)
-				{
-					Logger << U"[ksm warning] SelectMenu::openDirectoryWithLevelSort: Difficulty index out of range (difficultyIdx:{}, chartFilePath:'{}')"_fmt(difficultyIdx, chartFile);
-					continue;
-				}
-
-				chartsByLevel[level - 1].push_back(ChartFileInfo{
-					.filePath = chartFile,
-					.difficultyIdx = difficultyIdx,
-					.songDirectoryName = FsUtils::DirectoryNameByDirectoryPath(directory).lowercased(),
-				});
-			}
-		};
-
-		// 全サブディレクトリを走査して譜面を収集
-		const Array<FilePath> songDirectories = GetSubDirectories(directoryPath);
-		for (const auto& songDirectory : songDirectories)
+		// 全サブディレクトリを並列にスキャンしてレベルごとに譜面を分類
+		// (レベル順ソートでは全譜面が揃うまで並び順が確定しないため、スキャン完了まで待機する)
+		std::array<Array<LevelSortChart>, kNumLevels> chartsByLevel;
 		{
-			const Array<FilePath> subDirs = GetSubDirectories(songDirectory);
-			for (const auto& subDir : subDirs)
+			ChartScanner scanner{ FsUtils::SubDirectoriesSortedByName(directoryPath), SubDirectoryScanMode::kAlways };
+			for (auto& scannedDirectory : scanner.takeAll())
 			{
-				// サブディレクトリ内の.kshファイルを走査
-				const Array<FilePath> chartFiles = FileSystem::DirectoryContents(subDir, Recursive::No).filter([](FilePathView p)
-				{
-					return FileSystem::Extension(p) == kKSHExtension;
-				});
-
-				fnProcessChartFiles(subDir, chartFiles);
+				ClassifyScannedChartsByLevel(std::move(scannedDirectory), U"SelectMenu::openDirectoryWithLevelSort", &chartsByLevel);
 			}
-
-			// songDirectory直下の.kshファイルも走査
-			const Array<FilePath> chartFiles = FileSystem::DirectoryContents(songDirectory, Recursive::No).filter([](FilePathView p)
-			{
-				return FileSystem::Extension(p) == kKSHExtension;
-			});
-
-			fnProcessChartFiles(songDirectory, chartFiles);
 		}
 
 		// レベルごとに見出しと譜面項目を追加
 		for (int32 level = 1; level <= 20; ++level)
 		{
-			Array<ChartFileInfo>& charts = chartsByLevel[level - 1];
+			Array<LevelSortChart>& charts = chartsByLevel[level - 1];
 			if (charts.isEmpty())
 			{
 				continue;
 			}
 
 			// フォルダ名(小文字変換)の昇順でソート
-			charts.sort_by([](const ChartFileInfo& a, const ChartFileInfo& b)
+			charts.sort_by([](const LevelSortChart& a, const LevelSortChart& b)
 			{
 				return a.songDirectoryName < b.songDirectoryName;
 			});
@@ -1398,9 +1404,9 @@ bool SelectMenu::openDirectoryWithLevelSort(FilePathView directoryPath)
 			m_menu.push_back(std::make_unique<SelectMenuLevelSectionItem>(level));
 
 			// 譜面項目を追加
-			for (const auto& chartInfo : charts)
+			for (auto& chart : charts)
 			{
-				auto item = std::make_unique<SelectMenuSongItem>(chartInfo.filePath);
+				auto item = std::make_unique<SelectMenuSongItem>(std::move(chart.scannedChart));
 				if (item->chartExists())
 				{
 					m_menu.push_back(std::move(item));
@@ -1413,9 +1419,7 @@ bool SelectMenu::openDirectoryWithLevelSort(FilePathView directoryPath)
 	}
 	else
 	{
-		m_menu.clear();
-		m_jacketTextureCache.clear();
-		m_iconTextureCache.clear();
+		clearMenu();
 
 		m_folderState.folderType = SelectFolderState::kNone;
 		m_folderState.fullPath = U"";
@@ -1472,32 +1476,7 @@ bool SelectMenu::openAllFolder(PlaySeYN playSe, RefreshSongPreviewYN refreshSong
 
 bool SelectMenu::openAllFolderWithNameSort()
 {
-	using Unicode::FromUTF8;
-
-	// 曲の項目を挿入する関数
-	// (挿入されたかどうかを返す)
-	const auto fnInsertSongItem = [this](const String& songDirectory) -> bool
-	{
-		if (!FileSystem::IsDirectory(songDirectory))
-		{
-			return false;
-		}
-
-		std::unique_ptr<SelectMenuSongItem> item = std::make_unique<SelectMenuSongItem>(songDirectory);
-		if (item->chartExists())
-		{
-			m_menu.push_back(std::move(item));
-			return true;
-		}
-		else
-		{
-			return false;
-		}
-	};
-
-	m_menu.clear();
-	m_jacketTextureCache.clear();
-	m_iconTextureCache.clear();
+	clearMenu();
 
 	// Allフォルダの見出し項目を追加
 	m_menu.push_back(std::make_unique<SelectMenuAllFolderItem>(IsCurrentFolderYN::Yes));
@@ -1515,7 +1494,7 @@ bool SelectMenu::openAllFolderWithNameSort()
 	Array<FilePath> allFolderDirectories;
 	for (const auto& path : searchPaths)
 	{
-		allFolderDirectories.append(GetSubDirectories(path).map([](FilePathView p) { return FileSystem::FullPath(p); }));
+		allFolderDirectories.append(FsUtils::SubDirectoriesSortedByName(path).map([](FilePathView p) { return FileSystem::FullPath(p); }));
 	}
 
 	// 全楽曲フォルダを収集(フォルダ名でソート)
@@ -1528,11 +1507,11 @@ bool SelectMenu::openAllFolderWithNameSort()
 
 	for (const auto& folderDirectory : allFolderDirectories)
 	{
-		const Array<FilePath> songDirectories = GetSubDirectories(folderDirectory);
+		const Array<FilePath> songDirectories = FsUtils::SubDirectoriesSortedByName(folderDirectory);
 		for (const auto& songDirectory : songDirectories)
 		{
 			// サブディレクトリがあるかチェック
-			const Array<FilePath> subDirs = GetSubDirectories(songDirectory);
+			const Array<FilePath> subDirs = FsUtils::SubDirectoriesSortedByName(songDirectory);
 			if (!subDirs.isEmpty())
 			{
 				// サブディレクトリ内の楽曲フォルダを追加
@@ -1562,9 +1541,17 @@ bool SelectMenu::openAllFolderWithNameSort()
 	});
 
 	// 曲の項目を追加
-	for (const auto& songDirInfo : allSongDirectories)
+	// (楽曲フォルダはスレッドプール上で並列にスキャンする)
 	{
-		fnInsertSongItem(songDirInfo.path);
+		ChartScanner scanner{ allSongDirectories.map([](const SongDirectoryInfo& info) { return info.path; }), SubDirectoryScanMode::kNone };
+		for (auto& scannedDirectory : scanner.takeAll())
+		{
+			auto item = std::make_unique<SelectMenuSongItem>(scannedDirectory.directoryPath, std::move(scannedDirectory.charts));
+			if (item->chartExists())
+			{
+				m_menu.push_back(std::move(item));
+			}
+		}
 	}
 
 	m_folderState.folderType = SelectFolderState::kAll;
@@ -1582,59 +1569,13 @@ bool SelectMenu::openAllFolderWithNameSort()
 
 bool SelectMenu::openAllFolderWithLevelSort()
 {
-	m_menu.clear();
-	m_jacketTextureCache.clear();
-	m_iconTextureCache.clear();
+	clearMenu();
 
 	// Allフォルダの見出し項目を追加
 	m_menu.push_back(std::make_unique<SelectMenuAllFolderItem>(IsCurrentFolderYN::Yes));
 
 	// TODO: Insert course items
 
-	// レベルごとに譜面を分類
-	struct ChartFileInfo
-	{
-		FilePath filePath;
-		int32 difficultyIdx;
-		String songDirectoryName;
-	};
-	std::array<Array<ChartFileInfo>, kNumLevels> chartsByLevel;
-
-	// 譜面ファイルを処理してchartsByLevelに追加する関数
-	const auto fnProcessChartFiles = [&chartsByLevel](const FilePath& directory, const Array<FilePath>& chartFiles)
-	{
-		for (const auto& chartFile : chartFiles)
-		{
-			auto chartInfo = std::make_unique<SelectChartInfo>(chartFile);
-			if (chartInfo->hasError())
-			{
-				Logger << U"[ksm warning] SelectMenu::openAllFolderWithLevelSort: KSH Loading Error (error:'{}', chartFilePath:'{}')"_fmt(chartInfo->errorString(), chartFile);
-				continue;
-			}
-
-			const int32 level = chartInfo->level();
-			const int32 difficultyIdx = chartInfo->difficultyIdx();
-
-			if (level < 1 || level > 20)
-			{
-				Logger << U"[ksm warning] SelectMenu::openAllFolderWithLevelSort: Level out of range (level:{}, chartFilePath:'{}')"_fmt(level, chartFile);
-				continue;
-			}
-
-			if (difficultyIdx < 0 || difficultyIdx >= kNumDifficulties)
-			{
-				Logger << U"[ksm warning] SelectMenu::openAllFolderWithLevelSort: Difficulty index out of range (difficultyIdx:{}, chartFilePath:'{}')"_fmt(difficultyIdx, chartFile);
-				continue;
-			}
-
-			chartsByLevel[level - 1].push_back(ChartFileInfo{
-				.filePath = chartFile,
-				.difficultyIdx = difficultyIdx,
-				.songDirectoryName = FsUtils::DirectoryNameByDirectoryPath(directory).lowercased(),
-			});
-		}
-	};
-
 	// 全フォルダの楽曲を収集
 	Array<FilePath> searchPaths = {
 		FsUtils::SongsDirectoryPath(),
@@ -1646,48 +1587,37 @@ bool SelectMenu::openAllFolderWithLevelSort()
 	Array<FilePath> allFolderDirectories;
 	for (const auto& path : searchPaths)
 	{
-		allFolderDirectories.append(GetSubDirectories(path).map([](FilePathView p) { return FileSystem::FullPath(p); }));
+		allFolderDirectories.append(FsUtils::SubDirectoriesSortedByName(path).map([](FilePathView p) { return FileSystem::FullPath(p); }));
 	}
 
-	// 全サブディレクトリを走査して譜面を収集
+	// 全楽曲フォルダを並列にスキャンしてレベルごとに譜面を分類
+	// (レベル順ソートでは全譜面が揃うまで並び順が確定しないため、スキャン完了まで待機する)
+	Array<FilePath> songDirectories;
 	for (const auto& folderDirectory : allFolderDirectories)
 	{
-		const Array<FilePath> songDirectories = GetSubDirectories(folderDirectory);
-		for (const auto& songDirectory : songDirectories)
-		{
-			const Array<FilePath> subDirs = GetSubDirectories(songDirectory);
-			for (const auto& subDir : subDirs)
-			{
-				// サブディレクトリ内の.kshファイルを走査
-				const Array<FilePath> chartFiles = FileSystem::DirectoryContents(subDir, Recursive::No).filter([](FilePathView p)
-				{
-					return FileSystem::Extension(p) == kKSHExtension;
-				});
-
-				fnProcessChartFiles(subDir, chartFiles);
-			}
-
-			// songDirectory直下の.kshファイルも走査
-			const Array<FilePath> chartFiles = FileSystem::DirectoryContents(songDirectory, Recursive::No).filter([](FilePathView p)
-			{
-				return FileSystem::Extension(p) == kKSHExtension;
-			});
+		songDirectories.append(FsUtils::SubDirectoriesSortedByName(folderDirectory));
+	}
 
-			fnProcessChartFiles(songDirectory, chartFiles);
+	std::array<Array<LevelSortChart>, kNumLevels> chartsByLevel;
+	{
+		ChartScanner scanner{ songDirectories, SubDirectoryScanMode::kAlways };
+		for (auto& scannedDirectory : scanner.takeAll())
+		{
+			ClassifyScannedChartsByLevel(std::move(scannedDirectory), U"SelectMenu::openAllFolderWithLevelSort", &chartsByLevel);
 		}
 	}
 
 	// レベルごとに見出しと譜面項目を追加
 	for (int32 level = 1; level <= 20; ++level)
 	{
-		Array<ChartFileInfo>& charts = chartsByLevel[level - 1];
+		Array<LevelSortChart>& charts = chartsByLevel[level - 1];
 		if (charts.isEmpty())
 		{
 			continue;
 		}
 
 		// フォルダ名(小文字変換)の昇順でソート
-		charts.sort_by([](const ChartFileInfo& a, const ChartFileInfo& b)
+		charts.sort_by([](const LevelSortChart& a, const LevelSortChart& b)
 		{
 			return a.songDirectoryName < b.songDirectoryName;
 		});
@@ -1696,9 +1626,9 @@ bool SelectMenu::openAllFolderWithLevelSort()
 		m_menu.push_back(std::make_unique<SelectMenuLevelSectionItem>(level));
 
 		// 譜面項目を追加
-		for (const auto& chartInfo : charts)
+		for (auto& chart : charts)
 		{
-			auto item = std::make_unique<SelectMenuSongItem>(chartInfo.filePath);
+			auto item = std::make_unique<SelectMenuSongItem>(std::move(chart.scannedChart));
 			if (item->chartExists())
 			{
 				m_menu.push_back(std::move(item));
@@ -1766,9 +1696,7 @@ bool SelectMenu::openFavoriteFolderWithNameSort(FilePathView specialPath)
 		return false;
 	}
 
-	m_menu.clear();
-	m_jacketTextureCache.clear();
-	m_iconTextureCache.clear();
+	clearMenu();
 
 	// お気に入りフォルダの見出し項目を追加
 	m_menu.push_back(std::make_unique<SelectMenuFavFolderItem>(IsCurrentFolderYN::Yes, specialPath));
@@ -1845,9 +1773,7 @@ bool SelectMenu::openFavoriteFolderWithLevelSort(FilePathView specialPath)
 		return false;
 	}
 
-	m_menu.clear();
-	m_jacketTextureCache.clear();
-	m_iconTextureCache.clear();
+	clearMenu();
 
 	// お気に入りフォルダの見出し項目を追加
 	m_menu.push_back(std::make_unique<SelectMenuFavFolderItem>(IsCurrentFolderYN::Yes, specialPath));
@@ -1996,9 +1922,7 @@ bool SelectMenu::openCoursesFolder(PlaySeYN playSe, RefreshSongPreviewYN refresh
 
 bool SelectMenu::openCoursesFolderWithNameSort()
 {
-	m_menu.clear();
-	m_jacketTextureCache.clear();
-	m_iconTextureCache.clear();
+	clearMenu();
 
 	// コースフォルダの見出し項目を追加
 	m_menu.push_back(std::make_unique<SelectMenuCoursesFolderItem>(IsCurrentFolderYN::Yes));
@@ -2035,9 +1959,7 @@ bool SelectMenu::openCoursesFolderWithNameSort()
 
 bool SelectMenu::openCoursesFolderWithLevelSort()
 {
-	m_menu.clear();
-	m_jacketTextureCache.clear();
-	m_iconTextureCache.clear();
+	clearMenu();
 
 	// コースフォルダの見出し項目を追加
 	m_menu.push_back(std::make_unique<SelectMenuCoursesFolderItem>(IsCurrentFolderYN::Yes));
@@ -2106,7 +2028,7 @@ Array<FilePath> SelectMenu::getSortedFolderPaths() const
 	Array<FilePath> normalDirectories;
 	for (const auto& path : searchPaths)
 	{
-		normalDirectories.append(GetSubDirectories(path).map([](FilePathView p) { return FileSystem::FullPath(p); }));
+		normalDirectories.append(FsUtils::SubDirectoriesSortedByName(path).map([](FilePathView p) { return FileSystem::FullPath(p); }));
 	}
 
 	// フォルダ名(小文字変換)の昇順でソート
@@ -2194,6 +2116,8 @@ void SelectMenu::jumpToFirst()
 
 void SelectMenu::jumpToLast()
 {
+	completeDirectoryScan();
+
 	if (m_menu.empty())
 	{
 		return;
@@ -3,10 +3,12 @@
 #include "UI/ArrayWithLinearMenu.hpp"
 #include "SelectDifficultyMenu.hpp"
 #include "SelectSongPreview.hpp"
+#include "SelectTextureLoader.hpp"
 #include "ksmaudio/ksmaudio.hpp"
 #include "Course/CoursePlayState.hpp"
 
 struct HighScoreInfo;
+struct ScannedSongDirectory;
 
 using PlaySeYN = YesNo<struct PlaySeYN_tag>;
 using RefreshSongPreviewYN = YesNo<struct RefreshSongPreviewYN_tag>;
@@ -47,6 +49,9 @@ private:
 	static constexpr int32 kNumTopItems = kNumDisplayItems / 2;
 	static constexpr int32 kNumBottomItems = kNumDisplayItems - kNumTopItems - 1;
 
+	// スクロール方向の画面外にある項目のうち、画像を先読みする項目の数
+	static constexpr int32 kNumPrefetchItems = 8;
+
 	const SelectMenuEventContext m_eventContext;
 
 	std::shared_ptr<noco::Canvas> m_selectSceneCanvas;
@@ -65,13 +70,27 @@ private:
 
 	const ksmaudio::Sample m_folderSelectSe{"se/sel_dir.wav"};
 
-	HashTable<String, Texture> m_jacketTextureCache;
+	SelectTextureLoader m_textureLoader;
+
+	// スキャン途中のフォルダの情報(ヘッダではChartScannerが不完全型なのでソースファイル側で定義)
+	struct PendingDirectoryScan;
+
+	// フォルダの曲の項目のうちスキャン未完了のものがある場合のみ非nullptr
+	std::unique_ptr<PendingDirectoryScan> m_pendingDirectoryScan;
 
-	HashTable<String, Texture> m_iconTextureCache;
+	void clearMenu();
 
-	HashTable<String, Texture> m_titleTextureCache;
+	void insertScannedSongDirectories(Array<ScannedSongDirectory>&& scannedDirectories);
 
-	HashTable<String, Texture> m_artistTextureCache;
+	void insertSubDirSectionItems();
+
+	// スキャンが完了した分の曲の項目を追加(待機しない)
+	// (項目が追加された場合はtrueを返す)
+	bool pumpDirectoryScan();
+
+	// スキャンが全て完了するまで待機して残りの曲の項目を追加
+	// (項目のインデックスを使用する処理の前に呼び出す)
+	void completeDirectoryScan();
 
 	bool openDirectory(FilePathView directoryPath, PlaySeYN playSe, RefreshSongPreviewYN refreshSongPreview = RefreshSongPreviewYN::Yes, SaveToConfigIniYN saveToConfigIni = SaveToConfigIniYN::Yes);
 
@@ -105,6 +124,10 @@ private:
 
 	void refreshSongPreview();
 
+	// スクロール方向の画面外にある項目の画像を先読み
+	// (direction: 下方向へのスクロールは1、上方向は-1)
+	void prefetchTextures(int32 direction);
+
 	void playShakeUpTween();
 
 	void playShakeDownTween();
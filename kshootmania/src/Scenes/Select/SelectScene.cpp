@@ -1,5 +1,6 @@
 ﻿#include "SelectScene.hpp"
 #include "Scenes/PlayPrepare/PlayPrepareScene.hpp"
+#include "Scenes/Play/PlayScene.hpp"
 #include "Scenes/Title/TitleScene.hpp"
 #include "Ini/ConfigIni.hpp"
 #include "Common/FsUtils.hpp"
@@ -134,7 +135,12 @@ namespace
 void SelectScene::moveToPlayScene(FilePathView chartFilePath, MusicGame::IsAutoPlayYN isAutoPlay, const Optional<CoursePlayState>& courseState)
 {
 	m_fadeOutColor = Palette::White;
-	requestNextScene<PlayPrepareScene>(FilePath{ chartFilePath }, isAutoPlay, courseState);
+
+	// フェードアウト・PlayPrepare画面の表示中に譜面の読み込み等を進めておく
+	const MusicGame::GameCreateInfo createInfo = MakeGameCreateInfo(chartFilePath, isAutoPlay, courseState);
+	const auto chartPreparation = std::make_shared<MusicGame::ChartPreparation>(createInfo.chartFilePath, createInfo.playOption);
+
+	requestNextScene<PlayPrepareScene>(FilePath{ chartFilePath }, isAutoPlay, courseState, chartPreparation);
 }
 
 void SelectScene::refreshCanvasPlayerName()
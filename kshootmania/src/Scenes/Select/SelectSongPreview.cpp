@@ -1,4 +1,6 @@
 ﻿#include "SelectSongPreview.hpp"
+#include "Common/ThreadPool.hpp"
+#include "SongLibrary/SongPreviewClipCache.hpp"
 
 namespace
 {
@@ -17,18 +19,87 @@ SelectSongPreview::SelectSongPreview()
 	m_defaultBgmStream.lockEnd();
 }
 
+SelectSongPreview::~SelectSongPreview()
+{
+	cancelOpeningSongPreview();
+}
+
+void SelectSongPreview::startOpeningSongPreview()
+{
+	m_pendingSongPreviewCancellationToken = CancellationToken{};
+	m_isPendingSongPreviewFirst = m_isFirst;
+
+	// Note: std::packaged_taskはコピーできずstd::functionに格納できないため、promiseをshared_ptrで共有する
+	const auto promise = std::make_shared<std::promise<OpenedSongPreview>>();
+	m_pendingSongPreview = promise->get_future();
+	ThreadPool::Shared().submit(
+		[promise, filename = m_songPreviewFilename, offset = m_songPreviewOffset, duration = m_songPreviewDuration, volume = m_songPreviewVolume, cancellationToken = m_pendingSongPreviewCancellationToken]
+		{
+			promise->set_value(OpenSongPreview(filename, offset, duration, volume, cancellationToken));
+		});
+}
+
+void SelectSongPreview::cancelOpeningSongPreview()
+{
+	if (m_pendingSongPreview.valid())
+	{
+		// 開き終えたストリームは結果を受け取る側がいなくなった時点でワーカースレッド上で破棄される
+		m_pendingSongPreviewCancellationToken.cancel();
+		m_pendingSongPreview = {};
+	}
+}
+
+SelectSongPreview::OpenedSongPreview SelectSongPreview::OpenSongPreview(const FilePath& filename, SecondsF offset, SecondsF duration, double volume, const CancellationToken& cancellationToken)
+{
+	if (cancellationToken.isCancelled())
+	{
+		return OpenedSongPreview{};
+	}
+
+	// プレビュー区間のキャッシュがあればそちらを開く(プリスキャン・シークが不要)
+	if (const Optional<FilePath> clipFilePath = SongPreviewClipCache::Find(filename, offset, duration))
+	{
+		auto stream = std::make_unique<ksmaudio::Stream>(clipFilePath->narrow(), volume, true, false);
+		if (stream->duration() > 0s)
+		{
+			return OpenedSongPreview{
+				.stream = std::move(stream),
+				.offset = 0s,
+			};
+		}
+
+		// 開けない場合は壊れているとみなして削除し、元の音声ファイルを開く
+		stream.reset();
+		SongPreviewClipCache::Remove(*clipFilePath);
+	}
+
+	// (プレイ開始時に同じファイルを開くBGMとメモリマップトファイルを共有できるようpreloadを指定)
+	auto stream = std::make_unique<ksmaudio::Stream>(filename.narrow(), volume, true, true);
+	stream->seekPosSec(offset);
+
+	// 次回以降すぐに開けるよう、プレビュー区間をデコードしてキャッシュしておく
+	if (!cancellationToken.isCancelled())
+	{
+		ThreadPool::Shared().submit(
+			[filename, offset, duration]
+			{
+				SongPreviewClipCache::Create(filename, offset, duration);
+			});
+	}
+
+	return OpenedSongPreview{
+		.stream = std::move(stream),
+		.offset = offset,
+	};
+}
+
 void SelectSongPreview::update()
 {
-	if (!m_songPreviewFilename.empty() && (m_songPreviewStartTimer.reachedZero() || m_isFirst))
+	if (!m_songPreviewFilename.empty() && m_songPreviewStream == nullptr && !m_pendingSongPreview.valid() && (m_songPreviewStartTimer.reachedZero() || m_isFirst))
 	{
-		// フェードインして再生開始
-		m_songPreviewStream = std::make_unique<ksmaudio::Stream>(m_songPreviewFilename.narrow(), m_songPreviewVolume, true, false);
-		m_songPreviewStream->lockBegin();
-		m_songPreviewStream->seekPosSec(m_songPreviewOffset);
-		const Duration fadeInDuration = m_isFirst ? kFadeInDurationFirst : kFadeInDuration;
-		m_songPreviewStream->setFadeIn(fadeInDuration);
-		m_songPreviewStream->play();
-		m_songPreviewStream->lockEnd();
+		// ストリームはワーカースレッド上で開き、開き終えたら再生を開始する
+		// (ファイル全体のプリスキャンやシークで描画が止まらないようにするため)
+		startOpeningSongPreview();
 
 		m_songPreviewStartTimer.reset();
 
@@ -38,17 +109,36 @@ void SelectSongPreview::update()
 		}
 	}
 
-	const bool isPlayingSongPreview = m_songPreviewStream != nullptr;
-	if (isPlayingSongPreview)
+	if (m_pendingSongPreview.valid() && m_pendingSongPreview.wait_for(std::chrono::seconds{ 0 }) == std::future_status::ready)
+	{
+		// フェードインして再生開始
+		OpenedSongPreview openedSongPreview = m_pendingSongPreview.get();
+		if (openedSongPreview.stream != nullptr)
+		{
+			m_songPreviewStream = std::move(openedSongPreview.stream);
+			m_songPreviewStreamOffset = openedSongPreview.offset;
+			m_songPreviewStream->lockBegin();
+			const Duration fadeInDuration = m_isPendingSongPreviewFirst ? kFadeInDurationFirst : kFadeInDuration;
+			m_songPreviewStream->setFadeIn(fadeInDuration);
+			m_songPreviewStream->play();
+			m_songPreviewStream->lockEnd();
+		}
+	}
+
+	const bool isOpeningSongPreview = m_pendingSongPreview.valid();
+	const bool isPlayingSongPreview = m_songPreviewStream != nullptr || isOpeningSongPreview;
+	if (m_songPreviewStream != nullptr)
 	{
-		const SecondsF previewEndSec = m_songPreviewOffset + m_songPreviewDuration;
+		const SecondsF previewStartSec = m_songPreviewStreamOffset;
+		// Note: キャッシュ済みのプレビュー区間の音声ファイルや曲の終端に被ったプレビューはプレビューの長さより短い場合があるため、音声の長さで制限する
+		const SecondsF previewEndSec = Min(previewStartSec + m_songPreviewDuration, m_songPreviewStream->duration());
 		const SecondsF posSec = m_songPreviewStream->posSec();
-		if (previewEndSec <= posSec)
+		if (previewEndSec <= posSec || !m_songPreviewStream->isPlaying())
 		{
 			// フェードアウトが終了したら再び最初からフェードインして再生開始
 			// (途中の音が鳴らないようロックを挟んでいる)
 			m_songPreviewStream->lockBegin();
-			m_songPreviewStream->seekPosSec(m_songPreviewOffset);
+			m_songPreviewStream->seekPosSec(previewStartSec);
 			m_songPreviewStream->setFadeIn(kFadeInDuration);
 			m_songPreviewStream->play();
 			m_songPreviewStream->lockEnd();
@@ -63,8 +153,10 @@ void SelectSongPreview::update()
 		}
 
 		m_selectingStopwatch.reset();
-
-		// TODO: 曲の終端に被ったときにおかしくなるかも知れないので要検証
+	}
+	else if (isOpeningSongPreview)
+	{
+		m_selectingStopwatch.reset();
 	}
 	else if (m_songPreviewStartTimer.isRunning())
 	{
@@ -99,6 +191,7 @@ void SelectSongPreview::requestSongPreview(FilePathView filename, SecondsF offse
 
 	m_songPreviewFilename = filename;
 	m_songPreviewStream = nullptr;
+	cancelOpeningSongPreview();
 	m_songPreviewOffset = offset;
 	m_songPreviewDuration = duration;
 	m_songPreviewVolume = volume;
@@ -110,11 +203,15 @@ void SelectSongPreview::requestDefaultBgm()
 {
 	m_songPreviewFilename.clear();
 	m_songPreviewStream = nullptr;
+	cancelOpeningSongPreview();
 	m_songPreviewStartTimer.reset();
 }
 
 void SelectSongPreview::fadeOutForExit(Duration duration)
 {
+	// 開いている途中の楽曲プレビューはフェードアウト中に再生し始めないよう破棄する
+	cancelOpeningSongPreview();
+
 	if (m_songPreviewStream)
 	{
 		m_songPreviewStream->setFadeOut(duration);
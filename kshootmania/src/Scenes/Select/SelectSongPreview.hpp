@@ -1,10 +1,22 @@
 ﻿#pragma once
+#include <future>
 #include "kson/ChartData.hpp"
 #include "ksmaudio/ksmaudio.hpp"
+#include "Common/CancellationToken.hpp"
 
 class SelectSongPreview
 {
 private:
+	/// @brief ワーカースレッド上で開いた楽曲プレビューのストリーム
+	struct OpenedSongPreview
+	{
+		std::unique_ptr<ksmaudio::Stream> stream;
+
+		// ストリーム内でのプレビュー区間の開始位置
+		// (プレビュー区間のキャッシュから開いた場合は0)
+		SecondsF offset = 0s;
+	};
+
 	ksmaudio::Stream m_defaultBgmStream{"se/sel_bgm.ogg", 1.0, false, false, true};
 
 	String m_songPreviewFilename;
@@ -17,10 +29,21 @@ private:
 
 	double m_songPreviewVolume = 1.0;
 
+	// m_songPreviewStream内でのプレビュー区間の開始位置
+	SecondsF m_songPreviewStreamOffset = 0s;
+
+	/// @brief ワーカースレッド上で開いている途中の楽曲プレビュー
+	/// @note 開いていない場合はvalid()がfalse
+	std::future<OpenedSongPreview> m_pendingSongPreview;
+
+	CancellationToken m_pendingSongPreviewCancellationToken;
+
+	bool m_isPendingSongPreviewFirst = false;
+
 	double m_defaultBgmVolumeWithFade = 1.0;
 
 	/// @brief 楽曲プレビュー開始までに猶予を持たせるためのタイマー
-	/// @note 猶予を持たせている理由: カーソル移動直後に再生開始すると負荷でカーソル移動がもたつくため。また、連続したカーソル移動中はデフォルトBGMを再生したいため。
+	/// @note 猶予を持たせている理由: 連続したカーソル移動中はデフォルトBGMを再生したいため。また、通過するだけの曲のファイルを開かないようにするため。
 	Timer m_songPreviewStartTimer{ 0.2s, StartImmediately::No };
 
 	/// @brief カーソル移動を始めてからの時間を計測するストップウォッチ
@@ -29,9 +52,18 @@ private:
 
 	bool m_isFirst = true;
 
+	void startOpeningSongPreview();
+
+	void cancelOpeningSongPreview();
+
+	[[nodiscard]]
+	static OpenedSongPreview OpenSongPreview(const FilePath& filename, SecondsF offset, SecondsF duration, double volume, const CancellationToken& cancellationToken);
+
 public:
 	SelectSongPreview();
 
+	~SelectSongPreview();
+
 	void update();
 
 	void requestSongPreview(FilePathView filename, SecondsF offset, SecondsF duration, double volume);
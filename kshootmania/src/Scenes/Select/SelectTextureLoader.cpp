@@ -0,0 +1,292 @@
+﻿#include "SelectTextureLoader.hpp"
+#include "Common/ThreadPool.hpp"
+#include "Common/FsUtils.hpp"
+#include "SongLibrary/JacketThumbnailCache.hpp"
+
+namespace
+{
+	// 保持するテクスチャの合計サイズの上限
+	// (縮小済みのジャケット画像で約128枚分)
+	constexpr std::size_t kMaxTextureCacheBytes = 128U * 1024U * 1024U;
+
+	// 保持するテクスチャの数の上限
+	// (ファイルが存在しない場合の空のテクスチャもキャッシュするため、数にも上限を設ける)
+	constexpr std::size_t kMaxTextureCacheCount = 1024U;
+
+	// 同時にデコードを行うワーカーの数
+	// (譜面スキャン等のタスクを妨げないよう、共有スレッドプールの一部のみ使用する)
+	constexpr std::size_t kMaxNumWorkers = 2U;
+
+	// 画面内の項目の要求の最大数
+	// (高速にスクロールした場合に、既に画面外へ出た項目の画像をデコードし続けないよう古いものから破棄する)
+	constexpr std::size_t kMaxNumVisibleRequests = 32U;
+
+	// 1フレームあたりに作成するテクスチャの最大数
+	constexpr std::size_t kMaxNumTextureUploadsPerFrame = 4U;
+
+	FilePath ResolveFilePath(SelectTextureKind kind, FilePathView filePath)
+	{
+		FilePath actualFilePath{ filePath };
+
+		// 拡張子なしの場合はimgs/jacketまたはimgs/icon内の画像を使用
+		if (kind == SelectTextureKind::kJacket || kind == SelectTextureKind::kIcon)
+		{
+			if (FileSystem::Extension(actualFilePath).isEmpty())
+			{
+				const String baseName = FileSystem::BaseName(actualFilePath);
+				if (!baseName.isEmpty())
+				{
+					actualFilePath = kind == SelectTextureKind::kJacket
+						? FileSystem::PathAppend(U"imgs/jacket", baseName + U".jpg")
+						: FileSystem::PathAppend(U"imgs/icon", baseName + U".png");
+				}
+			}
+		}
+
+		return actualFilePath;
+	}
+
+	Image DecodeJacketImage(FilePathView filePath)
+	{
+		const FsUtils::FileStamp stamp = FsUtils::GetFileStamp(filePath);
+		if (Optional<Image> thumbnail = JacketThumbnailCache::Find(filePath, stamp))
+		{
+			return std::move(*thumbnail);
+		}
+
+		Image image{ filePath };
+		const int32 maxEdge = Max(image.width(), image.height());
+		if (maxEdge > JacketThumbnailCache::kMaxThumbnailSize)
+		{
+			image = image.scaled(static_cast<double>(JacketThumbnailCache::kMaxThumbnailSize) / maxEdge, InterpolationAlgorithm::Area);
+			JacketThumbnailCache::Store(filePath, stamp, image);
+		}
+		return image;
+	}
+}
+
+void SelectTextureLoader::request(SelectTextureKind kind, FilePathView filePath, bool isVisible)
+{
+	String key = MakeKey(kind, filePath);
+
+	if (const auto it = m_pendingKeys.find(key); it != m_pendingKeys.end())
+	{
+		// 先読み中の画像が画面内に入った場合は優先して処理する
+		if (isVisible && !it->second)
+		{
+			it->second = true;
+
+			std::lock_guard lock(m_sharedState->mutex);
+			auto& prefetchRequests = m_sharedState->prefetchRequests;
+			const auto itRequest = std::find_if(prefetchRequests.begin(), prefetchRequests.end(), [&](const DecodeRequest& request) { return request.key == key; });
+			if (itRequest != prefetchRequests.end())
+			{
+				m_sharedState->visibleRequests.push_back(std::move(*itRequest));
+				prefetchRequests.erase(itRequest);
+			}
+		}
+		return;
+	}
+
+	m_pendingKeys.emplace(key, isVisible);
+
+	{
+		std::lock_guard lock(m_sharedState->mutex);
+		DecodeRequest request{
+			.key = std::move(key),
+			.kind = kind,
+			.filePath = FilePath{ filePath },
+		};
+		if (isVisible)
+		{
+			auto& visibleRequests = m_sharedState->visibleRequests;
+			visibleRequests.push_back(std::move(request));
+			if (visibleRequests.size() > kMaxNumVisibleRequests)
+			{
+				// 破棄した画像は再び画面内に入った際に要求し直す
+				m_pendingKeys.erase(visibleRequests.front().key);
+				visibleRequests.pop_front();
+			}
+		}
+		else
+		{
+			m_sharedState->prefetchRequests.push_back(std::move(request));
+		}
+	}
+
+	startWorkersIfNeeded();
+}
+
+void SelectTextureLoader::startWorkersIfNeeded()
+{
+	std::size_t numWorkersToStart;
+	{
+		std::lock_guard lock(m_sharedState->mutex);
+		const std::size_t numRequests = m_sharedState->visibleRequests.size() + m_sharedState->prefetchRequests.size();
+		numWorkersToStart = Min(numRequests, kMaxNumWorkers - m_sharedState->numActiveWorkers);
+		m_sharedState->numActiveWorkers += numWorkersToStart;
+	}
+
+	for (std::size_t i = 0; i < numWorkersToStart; ++i)
+	{
+		ThreadPool::Shared().submit(
+			[sharedState = m_sharedState, cancellationToken = m_cancellationToken]
+			{
+				WorkerMain(sharedState, cancellationToken);
+			});
+	}
+}
+
+void SelectTextureLoader::WorkerMain(const std::shared_ptr<SharedState>& sharedState, const CancellationToken& cancellationToken)
+{
+	while (true)
+	{
+		DecodeRequest request;
+		{
+			std::lock_guard lock(sharedState->mutex);
+			auto& visibleRequests = sharedState->visibleRequests;
+			auto& prefetchRequests = sharedState->prefetchRequests;
+			if (cancellationToken.isCancelled() || (visibleRequests.empty() && prefetchRequests.empty()))
+			{
+				--sharedState->numActiveWorkers;
+				return;
+			}
+
+			if (!visibleRequests.empty())
+			{
+				request = std::move(visibleRequests.back());
+				visibleRequests.pop_back();
+			}
+			else
+			{
+				request = std::move(prefetchRequests.front());
+				prefetchRequests.pop_front();
+			}
+		}
+
+		DecodeResult result = Decode(request);
+
+		std::lock_guard lock(sharedState->mutex);
+		sharedState->results.push_back(std::move(result));
+	}
+}
+
+SelectTextureLoader::DecodeResult SelectTextureLoader::Decode(const DecodeRequest& request)
+{
+	DecodeResult result{
+		.key = request.key,
+		.kind = request.kind,
+		.filePath = request.filePath,
+	};
+
+	const FilePath actualFilePath = ResolveFilePath(request.kind, request.filePath);
+	if (!FileSystem::IsFile(actualFilePath))
+	{
+		return result;
+	}
+	result.fileExists = true;
+
+	if (request.kind == SelectTextureKind::kJacket)
+	{
+		result.image = DecodeJacketImage(actualFilePath);
+	}
+	else
+	{
+		result.image = Image{ actualFilePath };
+	}
+
+	return result;
+}
+
+String SelectTextureLoader::MakeKey(SelectTextureKind kind, FilePathView filePath)
+{
+	return U"{}|{}"_fmt(static_cast<int32>(kind), filePath);
+}
+
+SelectTextureLoader::SelectTextureLoader()
+	: m_sharedState(std::make_shared<SharedState>())
+	, m_textureCache(kMaxTextureCacheBytes, kMaxTextureCacheCount)
+{
+}
+
+SelectTextureLoader::~SelectTextureLoader()
+{
+	m_cancellationToken.cancel();
+}
+
+const Texture& SelectTextureLoader::get(SelectTextureKind kind, FilePathView filePath)
+{
+	if (const Texture* pTexture = m_textureCache.find(MakeKey(kind, filePath)))
+	{
+		return *pTexture;
+	}
+
+	request(kind, filePath, true);
+	return m_placeholderTexture;
+}
+
+void SelectTextureLoader::setPrefetchRequests(const Array<SelectTextureRequest>& requests)
+{
+	{
+		std::lock_guard lock(m_sharedState->mutex);
+		for (const DecodeRequest& request : m_sharedState->prefetchRequests)
+		{
+			m_pendingKeys.erase(request.key);
+		}
+		m_sharedState->prefetchRequests.clear();
+	}
+
+	for (const SelectTextureRequest& request : requests)
+	{
+		// 読み込み済みの画像は、先読みの範囲にある間は破棄されにくいよう最近使用したものとして扱う
+		if (m_textureCache.find(MakeKey(request.kind, request.filePath)) != nullptr)
+		{
+			continue;
+		}
+		this->request(request.kind, request.filePath, false);
+	}
+}
+
+bool SelectTextureLoader::update()
+{
+	Array<DecodeResult> results;
+	{
+		std::lock_guard lock(m_sharedState->mutex);
+		auto& sharedResults = m_sharedState->results;
+		const std::size_t numResults = Min(sharedResults.size(), kMaxNumTextureUploadsPerFrame);
+		results.reserve(numResults);
+		for (std::size_t i = 0; i < numResults; ++i)
+		{
+			results.push_back(std::move(sharedResults[i]));
+		}
+		sharedResults.erase(sharedResults.begin(), sharedResults.begin() + numResults);
+	}
+
+	bool visibleTextureUpdated = false;
+	for (DecodeResult& result : results)
+	{
+		bool isVisible = false;
+		if (const auto it = m_pendingKeys.find(result.key); it != m_pendingKeys.end())
+		{
+			isVisible = it->second;
+			m_pendingKeys.erase(it);
+		}
+
+		// タイトル画像・アーティスト画像はファイルが存在しない場合に文字で表示するため、ジャケット画像・アイコン画像のみ警告を出す
+		const bool warnIfNotFound = result.kind == SelectTextureKind::kJacket || result.kind == SelectTextureKind::kIcon;
+		if (!result.fileExists && warnIfNotFound)
+		{
+			Logger << U"[ksm warning] SelectTextureLoader::update: Image file not found (filePath:'{}')"_fmt(result.filePath);
+		}
+
+		const std::size_t numBytes = result.image.size_bytes();
+		m_textureCache.insert(result.key, result.image.isEmpty() ? Texture{} : Texture{ result.image }, numBytes);
+
+		if (isVisible)
+		{
+			visibleTextureUpdated = true;
+		}
+	}
+
+	return visibleTextureUpdated;
+}
@@ -0,0 +1,121 @@
+﻿#pragma once
+#include <mutex>
+#include <deque>
+#include "Common/LruCache.hpp"
+#include "Common/CancellationToken.hpp"
+
+/// @brief 選曲画面で表示する画像の種類
+enum class SelectTextureKind : int32
+{
+	kJacket,
+	kIcon,
+	kTitle,
+	kArtist,
+};
+
+/// @brief 選曲画面で表示する画像の読み込み要求
+struct SelectTextureRequest
+{
+	SelectTextureKind kind;
+
+	FilePath filePath;
+};
+
+/// @brief 選曲画面のジャケット・アイコン・タイトル・アーティスト画像を非同期に読み込む
+/// @details 画像のデコード(ジャケット画像は縮小も)は共有スレッドプール上で行い、テクスチャの作成のみメインスレッドで行う。
+///          読み込み完了までは空のテクスチャを返すため、呼び出し側は画像が無い場合と同様に表示し、update()がtrueを返したら表示を更新する。
+///          読み込んだテクスチャは合計サイズに上限を持つLRUキャッシュで保持し、フォルダを切り替えても破棄しない。
+class SelectTextureLoader
+{
+private:
+	struct DecodeRequest
+	{
+		String key;
+
+		SelectTextureKind kind;
+
+		FilePath filePath;
+	};
+
+	struct DecodeResult
+	{
+		String key;
+
+		SelectTextureKind kind;
+
+		FilePath filePath;
+
+		Image image;
+
+		bool fileExists = false;
+	};
+
+	struct SharedState
+	{
+		std::mutex mutex;
+
+		// 画面内の項目の要求(新しいものから処理する)
+		std::deque<DecodeRequest> visibleRequests;
+
+		// 先読みの要求(古いものから処理する)
+		std::deque<DecodeRequest> prefetchRequests;
+
+		Array<DecodeResult> results;
+
+		std::size_t numActiveWorkers = 0U;
+	};
+
+	// Note: タスクの実行中にSelectTextureLoaderが破棄されても問題ないよう、タスク側とshared_ptrで共有する
+	std::shared_ptr<SharedState> m_sharedState;
+
+	CancellationToken m_cancellationToken;
+
+	LruCache<String, Texture> m_textureCache;
+
+	// 要求済みで結果を未反映のキー(値は画面内の項目の要求かどうか)
+	HashTable<String, bool> m_pendingKeys;
+
+	// 読み込み完了まで返す空のテクスチャ
+	const Texture m_placeholderTexture;
+
+	void request(SelectTextureKind kind, FilePathView filePath, bool isVisible);
+
+	void startWorkersIfNeeded();
+
+	static void WorkerMain(const std::shared_ptr<SharedState>& sharedState, const CancellationToken& cancellationToken);
+
+	[[nodiscard]]
+	static DecodeResult Decode(const DecodeRequest& request);
+
+	[[nodiscard]]
+	static String MakeKey(SelectTextureKind kind, FilePathView filePath);
+
+public:
+	SelectTextureLoader();
+
+	/// @brief デストラクタ
+	/// @remark 未処理の要求は破棄する(実行中のデコードの完了は待たない)
+	~SelectTextureLoader();
+
+	SelectTextureLoader(const SelectTextureLoader&) = delete;
+
+	SelectTextureLoader& operator=(const SelectTextureLoader&) = delete;
+
+	/// @brief テクスチャを取得
+	/// @param kind 画像の種類
+	/// @param filePath 画像ファイルのパス(ジャケット・アイコンは拡張子なしの場合imgs内の画像を使用)
+	/// @return 読み込み済みのテクスチャ(読み込み中・ファイルが存在しない場合は空のテクスチャ)
+	/// @remark 未読み込みの場合は読み込みを要求する。返した参照は次のupdate()呼び出しまで有効
+	[[nodiscard]]
+	const Texture& get(SelectTextureKind kind, FilePathView filePath);
+
+	/// @brief 先読みする画像を設定
+	/// @param requests 先読みする画像(先頭ほど優先)
+	/// @remark 前回設定した先読みのうち未処理のものは破棄する
+	void setPrefetchRequests(const Array<SelectTextureRequest>& requests);
+
+	/// @brief デコードが完了した画像からテクスチャを作成する
+	/// @return get()で要求された画像のテクスチャを作成した場合はtrue(表示の更新が必要)
+	/// @remark 毎フレーム呼び出す
+	bool update();
+};
@@ -0,0 +1,138 @@
+﻿#include "ChartScanner.hpp"
+#include "Common/ThreadPool.hpp"
+#include "Common/FsUtils.hpp"
+
+namespace
+{
+	ScannedSongDirectory ScanSongDirectory(FilePathView directoryPath, SubDirectoryScanMode subDirectoryScanMode, const KscIO::KscPathContext& kscPathContext, const CancellationToken& cancellationToken)
+	{
+		ScannedSongDirectory scannedDirectory{
+			.directoryPath = FilePath{ directoryPath },
+		};
+
+		for (const auto& filePath : FileSystem::DirectoryContents(directoryPath, Recursive::No))
+		{
+			if (cancellationToken.isCancelled())
+			{
+				return scannedDirectory;
+			}
+
+			if (FileSystem::Extension(filePath) != kKSHExtension) // Note: FileSystem::Extension()は常に小文字を返すので大文字は考慮不要
+			{
+				continue;
+			}
+
+			scannedDirectory.charts.push_back(ScannedChart{
+				.chartFilePath = filePath,
+				.chartEntry = SongLibraryIndex::GetChartEntry(filePath, kscPathContext),
+			});
+		}
+
+		const bool scanSubDirectories =
+			subDirectoryScanMode == SubDirectoryScanMode::kAlways ||
+			(subDirectoryScanMode == SubDirectoryScanMode::kIfNoValidChart && !scannedDirectory.validChartExists());
+		if (scanSubDirectories)
+		{
+			for (const auto& subDirectoryPath : FsUtils::SubDirectoriesSortedByName(directoryPath))
+			{
+				if (cancellationToken.isCancelled())
+				{
+					return scannedDirectory;
+				}
+
+				scannedDirectory.subDirectories.push_back(ScanSongDirectory(subDirectoryPath, SubDirectoryScanMode::kNone, kscPathContext, cancellationToken));
+			}
+		}
+
+		return scannedDirectory;
+	}
+}
+
+bool ScannedSongDirectory::validChartExists() const
+{
+	return charts.any([](const ScannedChart& chart) { return chart.chartEntry.chartData.error == kson::ErrorType::None; });
+}
+
+ChartScanner::ChartScanner(const Array<FilePath>& directoryPaths, SubDirectoryScanMode subDirectoryScanMode)
+	: m_sharedState(std::make_shared<SharedState>())
+{
+	m_sharedState->results.resize(directoryPaths.size());
+
+	// ConfigIniはメインスレッド以外からアクセスできないため、ここでコピーしておく
+	const KscIO::KscPathContext kscPathContext = KscIO::CurrentKscPathContext();
+
+	ThreadPool& threadPool = ThreadPool::Shared();
+	for (std::size_t i = 0; i < directoryPaths.size(); ++i)
+	{
+		threadPool.submit(
+			[sharedState = m_sharedState, cancellationToken = m_cancellationToken, directoryPath = directoryPaths[i], i, subDirectoryScanMode, kscPathContext]
+			{
+				// 中断された場合も待機側が止まらないよう、空の結果を格納する
+				ScannedSongDirectory scannedDirectory = cancellationToken.isCancelled()
+					? ScannedSongDirectory{ .directoryPath = directoryPath }
+					: ScanSongDirectory(directoryPath, subDirectoryScanMode, kscPathContext, cancellationToken);
+
+				{
+					std::lock_guard lock(sharedState->mutex);
+					sharedState->results[i] = std::move(scannedDirectory);
+				}
+				sharedState->condition.notify_all();
+			});
+	}
+}
+
+ChartScanner::~ChartScanner()
+{
+	cancel();
+}
+
+void ChartScanner::cancel()
+{
+	m_cancellationToken.cancel();
+}
+
+bool ChartScanner::isCompleted() const
+{
+	return m_numTaken >= m_sharedState->results.size();
+}
+
+Array<ScannedSongDirectory> ChartScanner::takeImpl(std::size_t maxCount, bool wait)
+{
+	Array<ScannedSongDirectory> taken;
+
+	std::unique_lock lock(m_sharedState->mutex);
+	auto& results = m_sharedState->results;
+	const std::size_t endIdx = m_numTaken + Min(maxCount, results.size() - m_numTaken);
+	while (m_numTaken < endIdx)
+	{
+		if (!results[m_numTaken].has_value())
+		{
+			if (!wait)
+			{
+				break;
+			}
+			m_sharedState->condition.wait(lock, [&] { return results[m_numTaken].has_value(); });
+		}
+
+		taken.push_back(std::move(*results[m_numTaken]));
+		results[m_numTaken].reset();
+		++m_numTaken;
+	}
+
+	return taken;
+}
+
+Array<ScannedSongDirectory> ChartScanner::takeReady()
+{
+	return takeImpl(std::numeric_limits<std::size_t>::max(), false);
+}
+
+Array<ScannedSongDirectory> ChartScanner::take(std::size_t count)
+{
+	return takeImpl(count, true);
+}
+
+Array<ScannedSongDirectory> ChartScanner::takeAll()
+{
+	return takeImpl(std::numeric_limits<std::size_t>::max(), true);
+}
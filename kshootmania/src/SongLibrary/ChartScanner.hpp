@@ -0,0 +1,108 @@
+﻿#pragma once
+#include <mutex>
+#include <condition_variable>
+#include "SongLibraryIndex.hpp"
+#include "Common/CancellationToken.hpp"
+
+/// @brief スキャンした譜面
+struct ScannedChart
+{
+	FilePath chartFilePath;
+
+	SongLibraryIndex::ChartEntry chartEntry;
+};
+
+/// @brief スキャンした楽曲フォルダ
+struct ScannedSongDirectory
+{
+	FilePath directoryPath;
+
+	// フォルダ直下の譜面(DirectoryContentsの列挙順)
+	Array<ScannedChart> charts;
+
+	// サブディレクトリのスキャン結果(フォルダ名(小文字変換)の昇順)
+	// Note: サブディレクトリ内のさらに下の階層はスキャンしない
+	// Note: 不完全型を要素型にできるようArrayではなくstd::vectorにしている
+	std::vector<ScannedSongDirectory> subDirectories;
+
+	/// @brief 読み込みエラーのない譜面が存在するかどうか
+	[[nodiscard]]
+	bool validChartExists() const;
+};
+
+/// @brief サブディレクトリをスキャンする条件
+enum class SubDirectoryScanMode
+{
+	// サブディレクトリはスキャンしない
+	kNone,
+
+	// フォルダ直下に有効な譜面が存在しない場合のみサブディレクトリをスキャンする
+	kIfNoValidChart,
+
+	// 常にサブディレクトリをスキャンする
+	kAlways,
+};
+
+/// @brief 楽曲フォルダ内の譜面を共有スレッドプール上で並列にスキャンする
+/// @details 楽曲フォルダ1つにつき1タスクを投入し、結果は完了した順ではなく指定したフォルダの順に取り出す。
+///          譜面のメタデータとハイスコア情報はSongLibraryIndex経由で取得するため、前回から変化がない譜面はファイルを読み込まない。
+class ChartScanner
+{
+private:
+	struct SharedState
+	{
+		std::mutex mutex;
+
+		std::condition_variable condition;
+
+		Array<Optional<ScannedSongDirectory>> results;
+	};
+
+	// Note: タスクの実行中にChartScannerが破棄されても問題ないよう、タスク側とshared_ptrで共有する
+	std::shared_ptr<SharedState> m_sharedState;
+
+	CancellationToken m_cancellationToken;
+
+	std::size_t m_numTaken = 0;
+
+	[[nodiscard]]
+	Array<ScannedSongDirectory> takeImpl(std::size_t maxCount, bool wait);
+
+public:
+	/// @brief コンストラクタ
+	/// @param directoryPaths スキャンする楽曲フォルダのパスの配列
+	/// @param subDirectoryScanMode サブディレクトリをスキャンする条件
+	/// @remark ConfigIniの値はこの時点でコピーされるため、メインスレッドから呼び出すこと
+	ChartScanner(const Array<FilePath>& directoryPaths, SubDirectoryScanMode subDirectoryScanMode);
+
+	/// @brief デストラクタ
+	/// @remark 未完了のタスクには中断を要求する(完了は待たない)
+	~ChartScanner();
+
+	ChartScanner(const ChartScanner&) = delete;
+
+	ChartScanner& operator=(const ChartScanner&) = delete;
+
+	/// @brief 未完了のタスクに中断を要求する
+	void cancel();
+
+	/// @brief 全ての結果を取り出し済みかどうか
+	[[nodiscard]]
+	bool isCompleted() const;
+
+	/// @brief 先頭から連続してスキャンが完了している結果を取り出す(待機しない)
+	/// @return 取り出した結果の配列(フォルダの指定順)
+	[[nodiscard]]
+	Array<ScannedSongDirectory> takeReady();
+
+	/// @brief 指定した数の結果がスキャン完了するまで待機して取り出す
+	/// @param count 取り出す数(残りの数より大きい場合は残り全て)
+	/// @return 取り出した結果の配列(フォルダの指定順)
+	[[nodiscard]]
+	Array<ScannedSongDirectory> take(std::size_t count);
+
+	/// @brief 残りの全ての結果がスキャン完了するまで待機して取り出す
+	/// @return 取り出した結果の配列(フォルダの指定順)
+	[[nodiscard]]
+	Array<ScannedSongDirectory> takeAll();
+};
@@ -0,0 +1,322 @@
+﻿#include "JacketThumbnailCache.hpp"
+#include <mutex>
+#include "Common/BinaryBufferIO.hpp"
+
+namespace JacketThumbnailCache
+{
+	namespace
+	{
+		constexpr std::array<char, 8> kMagic = { 'K', 'S', 'M', 'J', 'T', 'H', 'M', '\0' };
+
+		// フォーマットを変更した場合はインクリメントすること(バージョンが異なるキャッシュは破棄して再生成される)
+		constexpr uint32 kFormatVersion = 1;
+
+		constexpr FilePathView kIndexFilename = U"thumbnails.idx";
+
+		// アトラスファイル1つあたりのサイズの目安(これを超えたら次のアトラスファイルへ追記する)
+		constexpr int64 kMaxAtlasFileSize = 32LL * 1024 * 1024;
+
+		// アトラスファイルの合計サイズの上限(これを超えた状態で起動した場合はキャッシュを作り直す)
+		constexpr int64 kMaxTotalAtlasFileSize = 512LL * 1024 * 1024;
+
+		constexpr int32 kJPEGQuality = 90;
+
+		struct IndexEntry
+		{
+			FsUtils::FileStamp stamp;
+
+			uint32 atlasIdx = 0U;
+
+			int64 offset = 0;
+
+			uint32 size = 0U;
+		};
+
+		// Note: 選曲画面の画像読み込みでワーカースレッドからも参照されるため、以下へのアクセスは必ずg_mutexをロックして行うこと
+		std::mutex g_mutex;
+
+		HashTable<FilePath, IndexEntry> g_entries;
+
+		// 追記先のアトラスファイルの番号とサイズ
+		uint32 g_currentAtlasIdx = 0U;
+
+		int64 g_currentAtlasSize = 0;
+
+		bool g_dirty = false;
+
+		FilePath CacheDirectoryPath()
+		{
+			return FileSystem::PathAppend(FsUtils::CacheDirectoryPath(), U"jacket");
+		}
+
+		FilePath IndexFilePath()
+		{
+			return FileSystem::PathAppend(CacheDirectoryPath(), kIndexFilename);
+		}
+
+		FilePath AtlasFilePath(uint32 atlasIdx)
+		{
+			return FileSystem::PathAppend(CacheDirectoryPath(), U"atlas_{:04d}.bin"_fmt(atlasIdx));
+		}
+
+		int64 AtlasFileSize(uint32 atlasIdx)
+		{
+			const FilePath atlasFilePath = AtlasFilePath(atlasIdx);
+			return FileSystem::IsFile(atlasFilePath) ? FileSystem::FileSize(atlasFilePath) : 0;
+		}
+
+		// インデックスとアトラスファイルを全て破棄する
+		void ResetUnlocked()
+		{
+			g_entries.clear();
+			g_currentAtlasIdx = 0U;
+			g_currentAtlasSize = 0;
+			g_dirty = true;
+
+			const FilePath cacheDirectoryPath = CacheDirectoryPath();
+			if (FileSystem::IsDirectory(cacheDirectoryPath))
+			{
+				FileSystem::RemoveContents(cacheDirectoryPath);
+			}
+		}
+	}
+
+	void Load()
+	{
+		std::lock_guard lock(g_mutex);
+
+		g_entries.clear();
+		g_currentAtlasIdx = 0U;
+		g_currentAtlasSize = 0;
+		g_dirty = false;
+
+		const FilePath indexFilePath = IndexFilePath();
+		if (!FileSystem::IsFile(indexFilePath))
+		{
+			// インデックスの保存前に終了した場合に残ったアトラスファイルを破棄
+			ResetUnlocked();
+			return;
+		}
+
+		MemoryMappedFileView file{ indexFilePath };
+		if (!file)
+		{
+			Logger << U"[ksm warning] JacketThumbnailCache::Load: Could not open index file (path:'{}')"_fmt(indexFilePath);
+			return;
+		}
+
+		{
+			const auto mapped = file.mapAll();
+			BinaryBufferReader reader{ mapped.data, mapped.size };
+
+			const auto magic = reader.read<std::array<char, 8>>();
+			const uint32 formatVersion = reader.read<uint32>();
+			if (reader.failed() || magic != kMagic || formatVersion != kFormatVersion)
+			{
+				Logger << U"[ksm info] JacketThumbnailCache::Load: Index file is outdated, rebuilding (path:'{}')"_fmt(indexFilePath);
+				file.close(); // Note: 開いたままだとWindowsではディレクトリ内を削除できない
+				ResetUnlocked();
+				return;
+			}
+
+			g_currentAtlasIdx = reader.read<uint32>();
+			const uint32 numEntries = reader.read<uint32>();
+			g_entries.reserve(numEntries);
+			for (uint32 i = 0; i < numEntries; ++i)
+			{
+				FilePath imageFilePath = Unicode::FromUTF8(reader.readString());
+				IndexEntry entry;
+				entry.stamp.writeTime = reader.read<int64>();
+				entry.stamp.size = reader.read<int64>();
+				entry.atlasIdx = reader.read<uint32>();
+				entry.offset = reader.read<int64>();
+				entry.size = reader.read<uint32>();
+				if (reader.failed())
+				{
+					Logger << U"[ksm warning] JacketThumbnailCache::Load: Index file is corrupted, rebuilding (path:'{}')"_fmt(indexFilePath);
+					file.close();
+					ResetUnlocked();
+					return;
+				}
+				g_entries.emplace(std::move(imageFilePath), entry);
+			}
+		}
+
+		// アトラスファイルのサイズを確認
+		// (インデックスの保存後に追記された分や、古くなった画像の分は参照されずに残るため、合計サイズが上限を超えたら作り直す)
+		int64 totalAtlasFileSize = 0;
+		Array<int64> atlasFileSizes;
+		for (uint32 atlasIdx = 0U; atlasIdx <= g_currentAtlasIdx; ++atlasIdx)
+		{
+			atlasFileSizes.push_back(AtlasFileSize(atlasIdx));
+			totalAtlasFileSize += atlasFileSizes.back();
+		}
+		if (totalAtlasFileSize > kMaxTotalAtlasFileSize)
+		{
+			Logger << U"[ksm info] JacketThumbnailCache::Load: Atlas files exceeded the size limit, rebuilding (totalSize:{})"_fmt(totalAtlasFileSize);
+			file.close();
+			ResetUnlocked();
+			return;
+		}
+		g_currentAtlasSize = atlasFileSizes.back();
+
+		// アトラスファイルが削除された等で範囲外を指しているエントリは除去
+		const std::size_t numEntriesBefore = g_entries.size();
+		std::erase_if(g_entries, [&](const auto& pair)
+		{
+			const IndexEntry& entry = pair.second;
+			return entry.atlasIdx >= atlasFileSizes.size() || entry.offset + static_cast<int64>(entry.size) > atlasFileSizes[entry.atlasIdx];
+		});
+		if (g_entries.size() != numEntriesBefore)
+		{
+			g_dirty = true;
+		}
+	}
+
+	void Save()
+	{
+		std::lock_guard lock(g_mutex);
+
+		if (!g_dirty)
+		{
+			return;
+		}
+
+		BinaryBufferWriter writer;
+		writer.write(kMagic);
+		writer.write(kFormatVersion);
+		writer.write(g_currentAtlasIdx);
+		writer.write(static_cast<uint32>(g_entries.size()));
+		for (const auto& [imageFilePath, entry] : g_entries)
+		{
+			writer.writeString(imageFilePath);
+			writer.write(entry.stamp.writeTime);
+			writer.write(entry.stamp.size);
+			writer.write(entry.atlasIdx);
+			writer.write(entry.offset);
+			writer.write(entry.size);
+		}
+
+		const FilePath cacheDirectoryPath = CacheDirectoryPath();
+		if (!FileSystem::Exists(cacheDirectoryPath))
+		{
+			FileSystem::CreateDirectories(cacheDirectoryPath);
+		}
+
+		// Note: アトラスファイルは追記のみでfsyncしないため、電源断でインデックスと食い違った場合はFind()でのデコード失敗として扱われる
+		const FilePath indexFilePath = IndexFilePath();
+		if (!FsUtils::WriteFileDurably(indexFilePath, writer.buffer().data(), writer.buffer().size()))
+		{
+			Logger << U"[ksm warning] JacketThumbnailCache::Save: Could not write index file (path:'{}')"_fmt(indexFilePath);
+			return;
+		}
+
+		g_dirty = false;
+	}
+
+	Optional<Image> Find(FilePathView imageFilePath, const FsUtils::FileStamp& stamp)
+	{
+		const FilePath imageFilePathKey{ imageFilePath };
+
+		IndexEntry entry;
+		{
+			std::lock_guard lock(g_mutex);
+			const auto it = g_entries.find(imageFilePathKey);
+			if (it == g_entries.end())
+			{
+				return none;
+			}
+			if (it->second.stamp != stamp)
+			{
+				// 元の画像が更新された場合は作り直す
+				g_entries.erase(it);
+				g_dirty = true;
+				return none;
+			}
+			entry = it->second;
+		}
+
+		// ファイルの読み込みとデコードはロックの外で行い、複数スレッドから並列に実行できるようにする
+		Blob blob{ entry.size };
+		{
+			BinaryReader reader{ AtlasFilePath(entry.atlasIdx) };
+			if (reader && reader.setPos(entry.offset))
+			{
+				if (reader.read(blob.data(), static_cast<int64>(entry.size)) != static_cast<int64>(entry.size))
+				{
+					blob.clear();
+				}
+			}
+			else
+			{
+				blob.clear();
+			}
+		}
+
+		Image image = blob.isEmpty() ? Image{} : Image{ MemoryViewReader{ blob.data(), blob.size() } };
+		if (image.isEmpty())
+		{
+			Logger << U"[ksm warning] JacketThumbnailCache::Find: Cached thumbnail is broken, rebuilding (path:'{}')"_fmt(imageFilePath);
+			std::lock_guard lock(g_mutex);
+			g_entries.erase(imageFilePathKey);
+			g_dirty = true;
+			return none;
+		}
+		return image;
+	}
+
+	void Store(FilePathView imageFilePath, const FsUtils::FileStamp& stamp, const Image& thumbnail)
+	{
+		if (thumbnail.isEmpty())
+		{
+			return;
+		}
+
+		// エンコードはロックの外で行う
+		// (透明部分を含む画像のみPNG、それ以外はサイズの小さいJPEGで格納する)
+		const bool hasAlpha = std::any_of(thumbnail.begin(), thumbnail.end(), [](const Color& color) { return color.a < 255; });
+		const Blob blob = hasAlpha ? thumbnail.encodePNG() : thumbnail.encodeJPEG(kJPEGQuality);
+		if (blob.isEmpty())
+		{
+			return;
+		}
+
+		std::lock_guard lock(g_mutex);
+
+		if (g_currentAtlasSize > 0 && g_currentAtlasSize + static_cast<int64>(blob.size()) > kMaxAtlasFileSize)
+		{
+			++g_currentAtlasIdx;
+			g_currentAtlasSize = AtlasFileSize(g_currentAtlasIdx);
+		}
+
+		const FilePath cacheDirectoryPath = CacheDirectoryPath();
+		if (!FileSystem::Exists(cacheDirectoryPath))
+		{
+			FileSystem::CreateDirectories(cacheDirectoryPath);
+		}
+
+		const FilePath atlasFilePath = AtlasFilePath(g_currentAtlasIdx);
+		BinaryWriter writer{ atlasFilePath, OpenMode::Append };
+		if (!writer)
+		{
+			Logger << U"[ksm warning] JacketThumbnailCache::Store: Could not open atlas file (path:'{}')"_fmt(atlasFilePath);
+			return;
+		}
+
+		const int64 offset = writer.size();
+		if (writer.write(blob.data(), static_cast<int64>(blob.size())) != static_cast<int64>(blob.size()))
+		{
+			Logger << U"[ksm warning] JacketThumbnailCache::Store: Could not write atlas file (path:'{}')"_fmt(atlasFilePath);
+			return;
+		}
+		g_currentAtlasSize = offset + static_cast<int64>(blob.size());
+
+		g_entries[FilePath{ imageFilePath }] = IndexEntry{
+			.stamp = stamp,
+			.atlasIdx = g_currentAtlasIdx,
+			.offset = offset,
+			.size = static_cast<uint32>(blob.size()),
+		};
+		g_dirty = true;
+	}
+}
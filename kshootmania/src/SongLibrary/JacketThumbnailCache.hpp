@@ -0,0 +1,36 @@
+﻿#pragma once
+#include "Common/FsUtils.hpp"
+
+/// @brief 縮小済みジャケット画像のディスクキャッシュ
+/// @details 選曲画面で大きなジャケット画像を毎回デコード・縮小しないよう、縮小後の画像をエンコードしてアトラスファイルへ追記していく。
+///          多数の小さなファイルを作らないよう、複数の画像を1つのアトラスファイルにまとめて格納し、
+///          画像ファイルのパス・更新日時・ファイルサイズをキーとしたインデックスでアトラス内の位置を管理する。
+namespace JacketThumbnailCache
+{
+	/// @brief 縮小後の画像の最大の幅・高さ
+	/// @remark これより小さい画像はキャッシュせず元の画像をそのまま使用する
+	constexpr int32 kMaxThumbnailSize = 512;
+
+	/// @brief インデックスファイルを読み込む
+	/// @remark 起動時に一度だけ呼び出す。インデックスファイルが存在しない・壊れている場合は空のキャッシュから開始する
+	void Load();
+
+	/// @brief インデックスファイルを保存する
+	/// @remark 前回の保存から変更がない場合は何もしない。終了時にワーカースレッドの停止後に呼び出す
+	void Save();
+
+	/// @brief 縮小済みの画像を取得
+	/// @param imageFilePath 元の画像ファイルのパス
+	/// @param stamp 元の画像ファイルの更新日時とサイズ
+	/// @return 縮小済みの画像(キャッシュが存在しない・古い場合はnone)
+	/// @remark ワーカースレッドから呼び出してよい
+	[[nodiscard]]
+	Optional<Image> Find(FilePathView imageFilePath, const FsUtils::FileStamp& stamp);
+
+	/// @brief 縮小済みの画像を追加
+	/// @param imageFilePath 元の画像ファイルのパス
+	/// @param stamp 元の画像ファイルの更新日時とサイズ
+	/// @param thumbnail 縮小済みの画像
+	/// @remark ワーカースレッドから呼び出してよい
+	void Store(FilePathView imageFilePath, const FsUtils::FileStamp& stamp, const Image& thumbnail);
+}
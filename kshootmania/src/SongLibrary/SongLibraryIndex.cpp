@@ -0,0 +1,276 @@
+﻿#include "SongLibraryIndex.hpp"
+#include <mutex>
+#include "HighScore/KscIO.hpp"
+#include "Common/FsUtils.hpp"
+#include "Common/BinaryBufferIO.hpp"
+#include "kson/IO/KshIO.hpp"
+
+namespace SongLibraryIndex
+{
+	namespace
+	{
+		constexpr std::array<char, 8> kMagic = { 'K', 'S', 'M', 'L', 'I', 'D', 'X', '\0' };
+
+		// フォーマットを変更した場合はインクリメントすること(バージョンが異なるインデックスファイルは破棄して再生成される)
+		constexpr uint32 kFormatVersion = 2;
+
+		constexpr FilePathView kIndexFilename = U"songlibrary.idx";
+
+		struct IndexEntry
+		{
+			FsUtils::FileStamp chartStamp;
+
+			kson::MetaChartData chartData;
+		};
+
+		// Note: 選曲画面の譜面スキャンでワーカースレッドからも参照されるため、g_entriesとg_dirtyへのアクセスは必ずg_mutexをロックして行うこと
+		std::mutex g_mutex;
+
+		HashTable<FilePath, IndexEntry> g_entries;
+
+		bool g_dirty = false;
+
+		FilePath IndexFilePath()
+		{
+			return FileSystem::PathAppend(FsUtils::CacheDirectoryPath(), kIndexFilename);
+		}
+
+		void WriteFileStamp(BinaryBufferWriter& writer, const FsUtils::FileStamp& stamp)
+		{
+			writer.write(stamp.writeTime);
+			writer.write(stamp.size);
+		}
+
+		FsUtils::FileStamp ReadFileStamp(BinaryBufferReader& reader)
+		{
+			FsUtils::FileStamp stamp;
+			stamp.writeTime = reader.read<int64>();
+			stamp.size = reader.read<int64>();
+			return stamp;
+		}
+
+		void WriteMetaChartData(BinaryBufferWriter& writer, const kson::MetaChartData& chartData)
+		{
+			const kson::MetaInfo& meta = chartData.meta;
+			writer.writeString(meta.title);
+			writer.writeString(meta.titleTranslit);
+			writer.writeString(meta.titleImgFilename);
+			writer.writeString(meta.artist);
+			writer.writeString(meta.artistTranslit);
+			writer.writeString(meta.artistImgFilename);
+			writer.writeString(meta.chartAuthor);
+			writer.write(static_cast<int32>(meta.difficulty.idx));
+			writer.writeString(meta.difficulty.name);
+			writer.write(static_cast<int32>(meta.level));
+			writer.writeString(meta.dispBPM);
+			writer.write(meta.stdBPM);
+			writer.writeString(meta.jacketFilename);
+			writer.writeString(meta.jacketAuthor);
+			writer.writeString(meta.iconFilename);
+			writer.writeString(meta.information);
+
+			const kson::MetaBGMInfo& bgm = chartData.audio.bgm;
+			writer.writeString(bgm.filename);
+			writer.write(bgm.vol);
+			writer.write(static_cast<int32>(bgm.preview.offset));
+			writer.write(static_cast<int32>(bgm.preview.duration));
+
+			writer.write(static_cast<int32>(chartData.error));
+		}
+
+		kson::MetaChartData ReadMetaChartData(BinaryBufferReader& reader)
+		{
+			kson::MetaChartData chartData;
+
+			kson::MetaInfo& meta = chartData.meta;
+			meta.title = reader.readString();
+			meta.titleTranslit = reader.readString();
+			meta.titleImgFilename = reader.readString();
+			meta.artist = reader.readString();
+			meta.artistTranslit = reader.readString();
+			meta.artistImgFilename = reader.readString();
+			meta.chartAuthor = reader.readString();
+			meta.difficulty.idx = reader.read<int32>();
+			meta.difficulty.name = reader.readString();
+			meta.level = reader.read<int32>();
+			meta.dispBPM = reader.readString();
+			meta.stdBPM = reader.read<double>();
+			meta.jacketFilename = reader.readString();
+			meta.jacketAuthor = reader.readString();
+			meta.iconFilename = reader.readString();
+			meta.information = reader.readString();
+
+			kson::MetaBGMInfo& bgm = chartData.audio.bgm;
+			bgm.filename = reader.readString();
+			bgm.vol = reader.read<double>();
+			bgm.preview.offset = reader.read<int32>();
+			bgm.preview.duration = reader.read<int32>();
+
+			chartData.error = static_cast<kson::ErrorType>(reader.read<int32>());
+
+			return chartData;
+		}
+
+		void WriteIndexEntry(BinaryBufferWriter& writer, const IndexEntry& entry)
+		{
+			WriteFileStamp(writer, entry.chartStamp);
+			WriteMetaChartData(writer, entry.chartData);
+		}
+
+		IndexEntry ReadIndexEntry(BinaryBufferReader& reader)
+		{
+			IndexEntry entry;
+			entry.chartStamp = ReadFileStamp(reader);
+			entry.chartData = ReadMetaChartData(reader);
+			return entry;
+		}
+	}
+
+	void Load()
+	{
+		Load(IndexFilePath());
+	}
+
+	void Load(FilePathView indexFilePath)
+	{
+		std::lock_guard lock(g_mutex);
+
+		g_entries.clear();
+		g_dirty = false;
+
+		if (!FileSystem::IsFile(indexFilePath))
+		{
+			return;
+		}
+
+		MemoryMappedFileView file{ indexFilePath };
+		if (!file)
+		{
+			Logger << U"[ksm warning] SongLibraryIndex::Load: Could not open index file (path:'{}')"_fmt(indexFilePath);
+			return;
+		}
+
+		const auto mapped = file.mapAll();
+		BinaryBufferReader reader{ mapped.data, mapped.size };
+
+		const auto magic = reader.read<std::array<char, 8>>();
+		const uint32 formatVersion = reader.read<uint32>();
+		if (reader.failed() || magic != kMagic || formatVersion != kFormatVersion)
+		{
+			// 異なるバージョンのインデックスは破棄して作り直す
+			Logger << U"[ksm info] SongLibraryIndex::Load: Index file is outdated, rebuilding (path:'{}')"_fmt(indexFilePath);
+			g_dirty = true;
+			return;
+		}
+
+		const uint32 numEntries = reader.read<uint32>();
+		g_entries.reserve(numEntries);
+		for (uint32 i = 0; i < numEntries; ++i)
+		{
+			FilePath chartFilePath = Unicode::FromUTF8(reader.readString());
+			IndexEntry entry = ReadIndexEntry(reader);
+			if (reader.failed())
+			{
+				// 書き込み途中で終了した等でファイルが壊れている場合は作り直す
+				Logger << U"[ksm warning] SongLibraryIndex::Load: Index file is corrupted, rebuilding (path:'{}')"_fmt(indexFilePath);
+				g_entries.clear();
+				g_dirty = true;
+				return;
+			}
+			g_entries.emplace(std::move(chartFilePath), std::move(entry));
+		}
+	}
+
+	bool Save()
+	{
+		return Save(IndexFilePath());
+	}
+
+	bool Save(FilePathView indexFilePath)
+	{
+		std::lock_guard lock(g_mutex);
+
+		if (!g_dirty)
+		{
+			return true;
+		}
+
+		BinaryBufferWriter writer;
+		writer.write(kMagic);
+		writer.write(kFormatVersion);
+		writer.write(static_cast<uint32>(g_entries.size()));
+		for (const auto& [chartFilePath, entry] : g_entries)
+		{
+			writer.writeString(chartFilePath);
+			WriteIndexEntry(writer, entry);
+		}
+
+		const FilePath directoryPath = FileSystem::ParentPath(indexFilePath);
+		if (!FileSystem::Exists(directoryPath))
+		{
+			FileSystem::CreateDirectories(directoryPath);
+		}
+
+		if (!FsUtils::WriteFileDurably(indexFilePath, writer.buffer().data(), writer.buffer().size()))
+		{
+			Logger << U"[ksm warning] SongLibraryIndex::Save: Could not write index file (path:'{}')"_fmt(indexFilePath);
+			return false;
+		}
+
+		g_dirty = false;
+		return true;
+	}
+
+	ChartEntry GetChartEntry(FilePathView chartFilePath)
+	{
+		return GetChartEntry(chartFilePath, KscIO::CurrentKscPathContext());
+	}
+
+	ChartEntry GetChartEntry(FilePathView chartFilePath, const KscIO::KscPathContext& kscPathContext)
+	{
+		const FilePath chartFilePathKey{ chartFilePath };
+
+		// ハイスコア情報はScoreDatabaseのメモリ上の内容から取得するため、ファイルアクセスは発生しない
+		ChartEntry chartEntry;
+		KscIO::ReadAllHighScoreInfo(chartFilePath, kscPathContext, &chartEntry.highScoreInfoMap);
+
+		if (!FileSystem::IsFile(chartFilePath))
+		{
+			// 削除された譜面はインデックスからも除去
+			{
+				std::lock_guard lock(g_mutex);
+				if (g_entries.erase(chartFilePathKey) > 0)
+				{
+					g_dirty = true;
+				}
+			}
+			chartEntry.chartData = kson::LoadKSHMetaChartData(chartFilePath.narrow());
+			return chartEntry;
+		}
+
+		// インデックスの内容が最新かどうかを確認
+		// (ファイルの読み込みはロックの外で行い、複数スレッドからの読み込みを並列に実行できるようにする)
+		const FsUtils::FileStamp chartStamp = FsUtils::GetFileStamp(chartFilePath);
+		{
+			std::lock_guard lock(g_mutex);
+			const auto it = g_entries.find(chartFilePathKey);
+			if (it != g_entries.end() && it->second.chartStamp == chartStamp)
+			{
+				chartEntry.chartData = it->second.chartData;
+				return chartEntry;
+			}
+		}
+
+		kson::MetaChartData loadedChartData = kson::LoadKSHMetaChartData(chartFilePath.narrow());
+
+		std::lock_guard lock(g_mutex);
+
+		IndexEntry& entry = g_entries[chartFilePathKey];
+		entry.chartStamp = chartStamp;
+		entry.chartData = std::move(loadedChartData);
+		g_dirty = true;
+
+		chartEntry.chartData = entry.chartData;
+		return chartEntry;
+	}
+}
@@ -0,0 +1,54 @@
+﻿#pragma once
+#include "kson/ChartData.hpp"
+#include "HighScore/HighScoreInfo.hpp"
+#include "HighScore/KscIO.hpp"
+
+/// @brief 楽曲ライブラリのインデックス
+/// @details 譜面ファイルのパス・更新日時・ファイルサイズをキーとして、譜面のメタデータをディスク上に保持する。
+///          選曲画面でフォルダを開くたびにkshファイルをパースしないようにするためのもの。
+///          ハイスコア情報はScoreDatabaseのメモリ上の内容から都度取得する。
+namespace SongLibraryIndex
+{
+	struct ChartEntry
+	{
+		kson::MetaChartData chartData;
+
+		// 全条件のハイスコア情報(キー:gaugeType部分を除いたKscKey文字列)
+		HashTable<String, HighScoreInfo> highScoreInfoMap;
+	};
+
+	/// @brief インデックスファイルを読み込む
+	/// @remark 起動時に一度だけ呼び出す。インデックスファイルが存在しない・壊れている場合は空のインデックスから開始する
+	void Load();
+
+	/// @brief 指定したパスのインデックスファイルを読み込む
+	/// @param indexFilePath インデックスファイルのパス
+	/// @remark インデックスファイルが存在しない・壊れている・バージョンが異なる場合は空のインデックスから開始する
+	void Load(FilePathView indexFilePath);
+
+	/// @brief インデックスファイルを保存する
+	/// @return 保存に成功した場合(変更がなく保存不要だった場合も含む)はtrue
+	/// @remark 前回の保存から変更がない場合は何もしない
+	bool Save();
+
+	/// @brief 指定したパスへインデックスファイルを保存する
+	/// @param indexFilePath インデックスファイルのパス
+	/// @return 保存に成功した場合(変更がなく保存不要だった場合も含む)はtrue
+	/// @remark 一時ファイルへ書き込んでからリネームするため、書き込み途中で終了しても古いインデックスファイルが残る。失敗した場合は次回のSave()で再度保存を試みる
+	bool Save(FilePathView indexFilePath);
+
+	/// @brief 譜面のメタデータとハイスコア情報を取得
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @return 譜面のメタデータとハイスコア情報
+	/// @remark 譜面ファイルの更新日時とサイズを確認し、前回から変化があった場合のみファイルを読み込み直す
+	[[nodiscard]]
+	ChartEntry GetChartEntry(FilePathView chartFilePath);
+
+	/// @brief 譜面のメタデータとハイスコア情報を取得
+	/// @param chartFilePath 譜面ファイルのパス
+	/// @param kscPathContext ハイスコア情報の保存先を求めるのに必要な設定値
+	/// @return 譜面のメタデータとハイスコア情報
+	/// @remark ConfigIniにアクセスしないため、ワーカースレッドから呼び出してよい
+	[[nodiscard]]
+	ChartEntry GetChartEntry(FilePathView chartFilePath, const KscIO::KscPathContext& kscPathContext);
+}
@@ -0,0 +1,160 @@
+﻿#include "SongPreviewClipCache.hpp"
+#include <mutex>
+#include "Common/FsUtils.hpp"
+#include "ksmaudio/OfflineRender.hpp"
+
+namespace SongPreviewClipCache
+{
+	namespace
+	{
+		// キャッシュの合計サイズの上限
+		// (44.1kHzステレオの15秒のプレビューで約100曲分)
+		constexpr int64 kMaxTotalCacheSize = 256LL * 1024 * 1024;
+
+		// Note: 同じプレビューを複数のタスクから同時に作成しないよう、g_creatingClipFilePathsへのアクセスは必ずg_mutexをロックして行うこと
+		//       (キャッシュの合計サイズの確認と削除もg_mutexのロック中に行う)
+		std::mutex g_mutex;
+
+		HashSet<FilePath> g_creatingClipFilePaths;
+
+		FilePath CacheDirectoryPath()
+		{
+			return FileSystem::PathAppend(FsUtils::CacheDirectoryPath(), U"preview");
+		}
+
+		FilePath ClipFilePath(FilePathView audioFilePath, SecondsF offset, SecondsF duration)
+		{
+			// 元の音声ファイルのパス・更新日時・サイズとプレビュー区間をキーとしたハッシュ値(FNV-1a 64bit)
+			const FsUtils::FileStamp stamp = FsUtils::GetFileStamp(audioFilePath);
+			const std::string key = Unicode::ToUTF8(U"{}|{}|{}|{}|{}"_fmt(
+				audioFilePath,
+				stamp.writeTime,
+				stamp.size,
+				static_cast<int64>(offset.count() * 1000),
+				static_cast<int64>(duration.count() * 1000)));
+			uint64 hash = 14695981039346656037ULL;
+			for (const char c : key)
+			{
+				hash ^= static_cast<uint8>(c);
+				hash *= 1099511628211ULL;
+			}
+			return FileSystem::PathAppend(CacheDirectoryPath(), U"{:016X}.wav"_fmt(hash));
+		}
+
+		// 合計サイズが上限を超えた分を作成日時が古いものから削除
+		void TrimUnlocked()
+		{
+			struct CacheFile
+			{
+				FilePath path;
+
+				DateTime writeTime;
+
+				int64 size;
+			};
+
+			Array<CacheFile> cacheFiles;
+			int64 totalSize = 0;
+			for (const FilePath& path : FileSystem::DirectoryContents(CacheDirectoryPath(), Recursive::No))
+			{
+				if (FileSystem::Extension(path) != U"wav")
+				{
+					continue;
+				}
+				const int64 size = FileSystem::FileSize(path);
+				cacheFiles.push_back(CacheFile{
+					.path = path,
+					.writeTime = FileSystem::WriteTime(path).value_or(DateTime{}),
+					.size = size,
+				});
+				totalSize += size;
+			}
+
+			if (totalSize <= kMaxTotalCacheSize)
+			{
+				return;
+			}
+
+			cacheFiles.sort_by([](const CacheFile& a, const CacheFile& b) { return a.writeTime < b.writeTime; });
+			for (const CacheFile& cacheFile : cacheFiles)
+			{
+				if (totalSize <= kMaxTotalCacheSize)
+				{
+					break;
+				}
+				if (FileSystem::Remove(cacheFile.path))
+				{
+					totalSize -= cacheFile.size;
+				}
+			}
+		}
+	}
+
+	Optional<FilePath> Find(FilePathView audioFilePath, SecondsF offset, SecondsF duration)
+	{
+		FilePath clipFilePath = ClipFilePath(audioFilePath, offset, duration);
+		if (!FileSystem::IsFile(clipFilePath))
+		{
+			return none;
+		}
+		return clipFilePath;
+	}
+
+	bool Create(FilePathView audioFilePath, SecondsF offset, SecondsF duration)
+	{
+		if (duration <= 0s || !FileSystem::IsFile(audioFilePath))
+		{
+			return false;
+		}
+
+		const FilePath clipFilePath = ClipFilePath(audioFilePath, offset, duration);
+		{
+			std::lock_guard lock(g_mutex);
+			if (FileSystem::IsFile(clipFilePath) || g_creatingClipFilePaths.contains(clipFilePath))
+			{
+				return true;
+			}
+			g_creatingClipFilePaths.insert(clipFilePath);
+		}
+
+		const FilePath cacheDirectoryPath = CacheDirectoryPath();
+		if (!FileSystem::Exists(cacheDirectoryPath))
+		{
+			FileSystem::CreateDirectories(cacheDirectoryPath);
+		}
+
+		// 一時ファイルへ書き出してからリネームし、書き込み途中のファイルを再生しないようにする
+		// (デコード専用ストリームには音量・コンプレッサーが適用されないため、再生時に改めて適用する)
+		const FilePath tempFilePath = clipFilePath + U".tmp";
+		bool succeeded = false;
+		{
+			const ksmaudio::Stream stream{ audioFilePath.narrow(), 1.0, false, true, false, 1.0, true };
+			stream.seekPosSec(offset);
+			const std::optional<std::size_t> numFrames = ksmaudio::RenderToWavFile(stream, Unicode::ToUTF8(tempFilePath), ksmaudio::OfflineRenderOptions{ .maxDuration = duration });
+			succeeded = numFrames.has_value() && *numFrames > 0U;
+		}
+		if (succeeded)
+		{
+			succeeded = FileSystem::Rename(tempFilePath, clipFilePath);
+		}
+		if (!succeeded)
+		{
+			FileSystem::Remove(tempFilePath);
+			Logger << U"[ksm warning] SongPreviewClipCache::Create: Could not create preview clip (audioFilePath:'{}')"_fmt(audioFilePath);
+		}
+
+		std::lock_guard lock(g_mutex);
+		g_creatingClipFilePaths.erase(clipFilePath);
+		if (succeeded)
+		{
+			TrimUnlocked();
+		}
+		return succeeded;
+	}
+
+	void Remove(FilePathView clipFilePath)
+	{
+		std::lock_guard lock(g_mutex);
+		FileSystem::Remove(clipFilePath);
+	}
+}
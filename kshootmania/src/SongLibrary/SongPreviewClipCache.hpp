@@ -0,0 +1,29 @@
+﻿#pragma once
+
+/// @brief 楽曲プレビュー区間をデコード済みの音声ファイルのディスクキャッシュ
+/// @details 選曲画面で楽曲プレビューを開始するたびにMP3/OGG全体をプリスキャンしてシークしないよう、
+///          プレビュー区間(preview_offsetからpreview_durationの長さ)のみを16bit PCMのWAVファイルとして保存しておく。
+///          WAVファイルはプリスキャン・シークのコストがほぼ無く、ファイルサイズもプレビュー区間の分のみで済む。
+namespace SongPreviewClipCache
+{
+	/// @brief キャッシュ済みのプレビュー区間の音声ファイルを取得
+	/// @param audioFilePath 元の音声ファイルのパス
+	/// @param offset プレビュー区間の開始位置
+	/// @param duration プレビュー区間の長さ
+	/// @return プレビュー区間の音声ファイルのパス(キャッシュが存在しない場合はnone)
+	/// @remark 元の音声ファイルの更新日時・サイズが変化した場合はキャッシュが存在しないものとして扱う。ワーカースレッドから呼び出してよい
+	[[nodiscard]]
+	Optional<FilePath> Find(FilePathView audioFilePath, SecondsF offset, SecondsF duration);
+
+	/// @brief プレビュー区間をデコードして音声ファイルを作成
+	/// @param audioFilePath 元の音声ファイルのパス
+	/// @param offset プレビュー区間の開始位置
+	/// @param duration プレビュー区間の長さ
+	/// @return 作成に成功した場合(既に存在する場合も含む)はtrue
+	/// @remark デコードに時間がかかるため、ワーカースレッドから呼び出すこと。キャッシュの合計サイズが上限を超えた場合は古いものから削除する
+	bool Create(FilePathView audioFilePath, SecondsF offset, SecondsF duration);
+
+	/// @brief 壊れていたキャッシュを削除
+	/// @param clipFilePath Find()で取得したプレビュー区間の音声ファイルのパス
+	void Remove(FilePathView clipFilePath);
+}
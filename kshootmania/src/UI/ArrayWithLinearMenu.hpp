@@ -86,6 +86,12 @@ public:
 
 	void pop_back();
 
+	/// @brief 指定したインデックスの位置に要素を挿入
+	/// @param idx 挿入位置
+	/// @param value 挿入する要素
+	/// @remark カーソルが挿入位置以降にある場合は、同じ要素を指し続けるようカーソルを後ろにずらす
+	void insert(std::size_t idx, T&& value);
+
 	[[nodiscard]]
 	auto begin();
 
@@ -366,6 +372,18 @@ void ArrayWithLinearMenu<T>::pop_back()
 	updateLinearMenuCursorMax();
 }
 
+template <typename T>
+void ArrayWithLinearMenu<T>::insert(std::size_t idx, T&& value)
+{
+	const bool shiftsCursor = !m_array.empty() && static_cast<std::size_t>(m_linearMenu.cursor()) >= idx;
+	m_array.insert(m_array.begin() + idx, std::move(value));
+	updateLinearMenuCursorMax();
+	if (shiftsCursor)
+	{
+		m_linearMenu.setCursor(m_linearMenu.cursor() + 1);
+	}
+}
+
 template <typename T>
 auto ArrayWithLinearMenu<T>::begin()
 {
@@ -1,11 +1,12 @@
 ﻿#pragma once
 #include <array>
 #include <memory>
-#include <mutex>
+#include <atomic>
 #include <cassert>
 #include "bass.h"
 #include "AudioEffectParam.hpp"
 #include "detail/UpdateTriggerTimeline.hpp"
+#include "detail/DSPParamsHandoff.hpp"
 
 namespace ksmaudio::AudioEffect
 {
@@ -54,11 +55,15 @@ namespace ksmaudio::AudioEffect
 	{
 	protected:
 		const bool m_isLaser;
-		bool m_bypass = false;
+		std::atomic<bool> m_bypass = false;
 		Params m_params;
+
+		// ゲームスレッドで計算したDSPParamsをオーディオスレッドへロックなしで受け渡す
+		detail::DSPParamsHandoff<DSPParams> m_dspParamsHandoff;
+
+		// 以下はオーディオスレッドのみが使用
 		DSPParams m_dspParams;
 		DSP m_dsp;
-		std::mutex m_mutex;
 
 	public:
 		static constexpr bool kIsWithTrigger = false;
@@ -80,32 +85,31 @@ namespace ksmaudio::AudioEffect
 
 		virtual ~BasicAudioEffect() = default;
 
-		// この関数のみ他の関数とは別のスレッドからも呼ばれるので注意
+		// この関数のみ他の関数とは別のスレッド(オーディオスレッド)から呼ばれるので注意
+		// オーディオスレッドを待機させないよう、この関数内ではロックを取らない
 		virtual void process(float* pData, std::size_t dataSize) override
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
+			m_dspParamsHandoff.consume([this](const DSPParams& dspParams)
+			{
+				m_dspParams = dspParams;
+				m_dsp.updateParams(m_dspParams);
+			});
 
-			m_dsp.process(pData, dataSize, m_bypass, m_dspParams);
+			m_dsp.process(pData, dataSize, m_bypass.load(std::memory_order_relaxed), m_dspParams);
 		}
 
 		virtual void updateStatusByFX(const Status& status, std::optional<std::size_t> laneIdx) override
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			assert(!m_isLaser);
 
-			m_dspParams = m_params.renderByFX(status, laneIdx);
-			m_dsp.updateParams(m_dspParams);
+			m_dspParamsHandoff.push(m_params.renderByFX(status, laneIdx));
 		}
 
 		virtual void updateStatusByLaser(const Status& status, bool isOn) override
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			assert(m_isLaser);
 
-			m_dspParams = m_params.renderByLaser(status, isOn);
-			m_dsp.updateParams(m_dspParams);
+			m_dspParamsHandoff.push(m_params.renderByLaser(status, isOn));
 		}
 
 		virtual void setParamValueSet(ParamID paramID, const ValueSet& valueSet) override
@@ -132,12 +136,7 @@ namespace ksmaudio::AudioEffect
 
 		virtual void setBypass(bool bypass) override
 		{
-			if (m_bypass != bypass)
-			{
-				std::lock_guard<std::mutex> lock(m_mutex);
-
-				m_bypass = bypass;
-			}
+			m_bypass.store(bypass, std::memory_order_relaxed);
 		}
 	};
 
@@ -146,12 +145,16 @@ namespace ksmaudio::AudioEffect
 	{
 	protected:
 		const bool m_isLaser;
-		bool m_bypass = false;
+		std::atomic<bool> m_bypass = false;
 		Params m_params;
+		detail::UpdateTriggerTimeline m_updateTriggerTimeline;
+
+		// ゲームスレッドで計算したDSPParamsをオーディオスレッドへロックなしで受け渡す
+		detail::DSPParamsHandoff<DSPParams> m_dspParamsHandoff;
+
+		// 以下はオーディオスレッドのみが使用
 		DSPParams m_dspParams;
 		DSP m_dsp;
-		detail::UpdateTriggerTimeline m_updateTriggerTimeline;
-		std::mutex m_mutex;
 
 	public:
 		static constexpr bool kIsWithTrigger = true;
@@ -159,8 +162,8 @@ namespace ksmaudio::AudioEffect
 
 		BasicAudioEffectWithTrigger(std::size_t sampleRate, std::size_t numChannels, bool isLaser, const std::set<float>& updateTriggerTiming)
 			: m_isLaser(isLaser)
-			, m_dsp(DSPCommonInfo{ sampleRate, numChannels })
 			, m_updateTriggerTimeline(updateTriggerTiming)
+			, m_dsp(DSPCommonInfo{ sampleRate, numChannels })
 		{
 			if (isLaser)
 			{
@@ -174,40 +177,41 @@ namespace ksmaudio::AudioEffect
 
 		virtual ~BasicAudioEffectWithTrigger() = default;
 
-		// この関数のみ他の関数とは別のスレッドからも呼ばれるので注意
+		// この関数のみ他の関数とは別のスレッド(オーディオスレッド)から呼ばれるので注意
+		// オーディオスレッドを待機させないよう、この関数内ではロックを取らない
 		virtual void process(float* pData, std::size_t dataSize) override
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
+			m_dspParamsHandoff.consume([this](const DSPParams& dspParams)
+			{
+				m_dspParams = dspParams;
+				m_dsp.updateParams(m_dspParams);
+			});
 
-			m_dsp.process(pData, dataSize, m_bypass, m_dspParams);
+			m_dsp.process(pData, dataSize, m_bypass.load(std::memory_order_relaxed), m_dspParams);
 		}
 
 		virtual void updateStatusByFX(const Status& status, std::optional<std::size_t> laneIdx) override
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			assert(!m_isLaser);
 
-			m_dspParams = m_params.renderByFX(status, laneIdx);
+			DSPParams dspParams = m_params.renderByFX(status, laneIdx);
 
 			m_updateTriggerTimeline.update(status.sec);
-			m_dspParams.secUntilTrigger = m_updateTriggerTimeline.secUntilTrigger();
+			dspParams.secUntilTrigger = m_updateTriggerTimeline.secUntilTrigger();
 
-			m_dsp.updateParams(m_dspParams);
+			m_dspParamsHandoff.push(dspParams);
 		}
 
 		virtual void updateStatusByLaser(const Status& status, bool isOn) override
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-
 			assert(m_isLaser);
 
-			m_dspParams = m_params.renderByLaser(status, isOn);
+			DSPParams dspParams = m_params.renderByLaser(status, isOn);
 
 			m_updateTriggerTimeline.update(status.sec);
-			m_dspParams.secUntilTrigger = m_updateTriggerTimeline.secUntilTrigger();
+			dspParams.secUntilTrigger = m_updateTriggerTimeline.secUntilTrigger();
 
-			m_dsp.updateParams(m_dspParams);
+			m_dspParamsHandoff.push(dspParams);
 		}
 
 		virtual void setParamValueSet(ParamID paramID, const ValueSet& valueSet) override
@@ -234,12 +238,7 @@ namespace ksmaudio::AudioEffect
 
 		virtual void setBypass(bool bypass) override
 		{
-			if (m_bypass != bypass)
-			{
-				std::lock_guard<std::mutex> lock(m_mutex);
-
-				m_bypass = bypass;
-			}
+			m_bypass.store(bypass, std::memory_order_relaxed);
 		}
 	};
 }
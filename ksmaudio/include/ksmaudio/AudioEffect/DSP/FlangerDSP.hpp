@@ -2,7 +2,7 @@
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
 #include "ksmaudio/AudioEffect/Params/FlangerParams.hpp"
 #include "ksmaudio/AudioEffect/detail/RingBuffer.hpp"
-#include "ksmaudio/AudioEffect/detail/BiquadFilter.hpp"
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
 
 namespace ksmaudio::AudioEffect
 {
@@ -12,7 +12,7 @@ namespace ksmaudio::AudioEffect
 		const DSPCommonInfo m_info;
 		detail::RingBuffer<float> m_ringBuffer;
 		float m_lfoTimeRate = 0.0f;
-		std::array<detail::BiquadFilter<float>, 2> m_lowShelfFilters;
+		detail::StereoBiquadFilter m_lowShelfFilter;
 
 	public:
 		explicit FlangerDSP(const DSPCommonInfo& info);
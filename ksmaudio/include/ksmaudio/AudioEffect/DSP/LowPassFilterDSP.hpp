@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
 #include "ksmaudio/AudioEffect/Params/LowPassFilterParams.hpp"
-#include "ksmaudio/AudioEffect/detail/BiquadFilter.hpp"
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
 #include "ksmaudio/AudioEffect/detail/LinearEasing.hpp"
 
 namespace ksmaudio::AudioEffect
@@ -10,7 +10,7 @@ namespace ksmaudio::AudioEffect
 	{
 	private:
 		const DSPCommonInfo m_info;
-		std::array<detail::BiquadFilter<float>, 2> m_lowPassFilters;
+		detail::StereoBiquadFilter m_lowPassFilter;
 		detail::LinearEasing<float> m_vEasing;
 
 	public:
@@ -2,7 +2,7 @@
 #include <optional>
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
 #include "ksmaudio/AudioEffect/Params/PeakingFilterParams.hpp"
-#include "ksmaudio/AudioEffect/detail/BiquadFilter.hpp"
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
 #include "ksmaudio/AudioEffect/detail/LinearEasing.hpp"
 
 namespace ksmaudio::AudioEffect
@@ -68,7 +68,7 @@ namespace ksmaudio::AudioEffect
 	{
 	private:
 		const DSPCommonInfo m_info;
-		std::array<detail::BiquadFilter<float>, 2> m_peakingFilters;
+		detail::StereoBiquadFilter m_peakingFilter;
 		detail::PeakingFilterValueController m_valueController;
 		detail::PeakingFilterRelease m_release;
 
@@ -2,7 +2,7 @@
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
 #include "ksmaudio/AudioEffect/Params/PhaserParams.hpp"
 #include "ksmaudio/AudioEffect/detail/RingBuffer.hpp"
-#include "ksmaudio/AudioEffect/detail/BiquadFilter.hpp"
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
 
 namespace ksmaudio::AudioEffect
 {
@@ -14,8 +14,8 @@ namespace ksmaudio::AudioEffect
 	private:
 		const DSPCommonInfo m_info;
 		float m_lfoTimeRate = 0.0f;
-		std::array<std::array<detail::BiquadFilter<float>, 2>, kMaxNumAllPassFilters> m_allPassFilters;
-		std::array<detail::BiquadFilter<float>, 2> m_hiCutFilters;
+		std::array<detail::StereoBiquadFilter, kMaxNumAllPassFilters> m_allPassFilters;
+		detail::StereoBiquadFilter m_hiCutFilter;
 		std::array<std::array<float, 2>, kMaxNumAllPassFilters> m_prevWetArrayForFeedback;
 
 	public:
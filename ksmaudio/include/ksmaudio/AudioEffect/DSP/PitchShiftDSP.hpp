@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
 #include "ksmaudio/AudioEffect/Params/PitchShiftParams.hpp"
-#include "ksmaudio/AudioEffect/detail/BiquadFilter.hpp"
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
 #include <array>
 #include <vector>
 #include <cstddef>
@@ -29,7 +29,7 @@ namespace ksmaudio::AudioEffect
 		std::size_t m_prevStart = 0;
 		std::size_t m_prevPrevStart = 0;
 		std::optional<std::size_t> m_thirdChunkBlendStep = std::nullopt;
-		std::vector<std::array<detail::BiquadFilter<float>, kNumLowpassFilters>> m_lowpassFilter;
+		std::array<detail::StereoBiquadFilter, kNumLowpassFilters> m_lowpassFilters; // 両チャンネル分を同時に処理する縦続接続のLPF
 
 	public:
 		explicit PitchShiftDSP(const DSPCommonInfo& info);
@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
 #include "ksmaudio/AudioEffect/Params/WobbleParams.hpp"
-#include "ksmaudio/AudioEffect/detail/BiquadFilter.hpp"
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
 #include "ksmaudio/AudioEffect/detail/DSPSimpleTriggerHandler.hpp"
 
 namespace ksmaudio::AudioEffect
@@ -11,7 +11,7 @@ namespace ksmaudio::AudioEffect
 	private:
 		const DSPCommonInfo m_info;
 		detail::DSPSimpleTriggerHandler m_triggerHandler;
-		std::array<detail::BiquadFilter<float>, 2> m_lowPassFilters;
+		detail::StereoBiquadFilter m_lowPassFilter;
 
 	public:
 		explicit WobbleDSP(const DSPCommonInfo& info);
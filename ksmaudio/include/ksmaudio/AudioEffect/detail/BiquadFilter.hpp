@@ -4,56 +4,45 @@
 
 namespace ksmaudio::AudioEffect::detail
 {
+    // a0で正規化済みの双2次フィルタ係数
+    // (1サンプルごとにa0で除算しなくて済むよう、係数計算時に一度だけ正規化する)
     template <typename T>
-    class BiquadFilter
+    struct BiquadCoefficients
     {
-    private:
-        T m_a0 = T{ 1 };
-        T m_a1 = T{ 0 };
-        T m_a2 = T{ 0 };
-        T m_b0 = T{ 1 };
-        T m_b1 = T{ 0 };
-        T m_b2 = T{ 0 };
-        T m_input1 = T{ 0 };
-        T m_input2 = T{ 0 };
-        T m_output1 = T{ 0 };
-        T m_output2 = T{ 0 };
+        T b0 = T{ 1 };
+        T b1 = T{ 0 };
+        T b2 = T{ 0 };
+        T a1 = T{ 0 };
+        T a2 = T{ 0 };
 
-    public:
-        BiquadFilter() = default;
-
-        T process(T input)
+        static BiquadCoefficients Normalized(T a0, T a1, T a2, T b0, T b1, T b2)
         {
-            const T output
-                = m_b0 / m_a0 * input
-                + m_b1 / m_a0 * m_input1
-                + m_b2 / m_a0 * m_input2
-                - m_a1 / m_a0 * m_output1
-                - m_a2 / m_a0 * m_output2;
-
-            m_input2 = m_input1;
-            m_input1 = input;
-            m_output2 = m_output1;
-            m_output1 = output;
-
-            return output;
+            const T invA0 = T{ 1 } / a0;
+            return {
+                .b0 = b0 * invA0,
+                .b1 = b1 * invA0,
+                .b2 = b2 * invA0,
+                .a1 = a1 * invA0,
+                .a2 = a2 * invA0,
+            };
         }
 
-        void setLowPassFilter(T freq, T q, T sampleRate)
+        static BiquadCoefficients LowPassFilter(T freq, T q, T sampleRate)
         {
             const T omega = std::numbers::pi_v<T> * 2 * freq / sampleRate;
             const T alpha = std::sin(omega) / (q * 2);
 
             const T cosOmega = std::cos(omega);
-            m_a0 = T{ 1 } + alpha;
-            m_a1 = -T{ 2 } * cosOmega;
-            m_a2 = T{ 1 } - alpha;
-            m_b0 = (T{ 1 } - cosOmega) / 2;
-            m_b1 = T{ 1 } - cosOmega;
-            m_b2 = (T{ 1 } - cosOmega) / 2;
+            return Normalized(
+                T{ 1 } + alpha,
+                -T{ 2 } * cosOmega,
+                T{ 1 } - alpha,
+                (T{ 1 } - cosOmega) / 2,
+                T{ 1 } - cosOmega,
+                (T{ 1 } - cosOmega) / 2);
         }
 
-        void setLowShelfFilter(T freq, T q, T gainDb, T sampleRate)
+        static BiquadCoefficients LowShelfFilter(T freq, T q, T gainDb, T sampleRate)
         {
             const T omega = std::numbers::pi_v<T> * 2 * freq / sampleRate;
             const T A = std::pow(T{ 10 }, gainDb / 40);
@@ -61,29 +50,31 @@ namespace ksmaudio::AudioEffect::detail
 
             const T sinOmega = std::sin(omega);
             const T cosOmega = std::cos(omega);
-            m_a0 = (A + T{ 1 }) + (A - T{ 1 }) * cosOmega + beta * sinOmega;
-            m_a1 = -T{ 2 } * ((A - T{ 1 }) + (A + T{ 1 }) * cosOmega);
-            m_a2 = (A + T{ 1 }) + (A - T{ 1 }) * cosOmega - beta * sinOmega;
-            m_b0 = A * ((A + T{ 1 }) - (A - T{ 1 }) * cosOmega + beta * sinOmega);
-            m_b1 = T{ 2 } * A * ((A - T{ 1 }) - (A + T{ 1 }) * cosOmega);
-            m_b2 = A * ((A + T{ 1 }) - (A - T{ 1 }) * cosOmega - beta * sinOmega);
+            return Normalized(
+                (A + T{ 1 }) + (A - T{ 1 }) * cosOmega + beta * sinOmega,
+                -T{ 2 } * ((A - T{ 1 }) + (A + T{ 1 }) * cosOmega),
+                (A + T{ 1 }) + (A - T{ 1 }) * cosOmega - beta * sinOmega,
+                A * ((A + T{ 1 }) - (A - T{ 1 }) * cosOmega + beta * sinOmega),
+                T{ 2 } * A * ((A - T{ 1 }) - (A + T{ 1 }) * cosOmega),
+                A * ((A + T{ 1 }) - (A - T{ 1 }) * cosOmega - beta * sinOmega));
         }
 
-        void setHighPassFilter(T freq, T q, T sampleRate)
+        static BiquadCoefficients HighPassFilter(T freq, T q, T sampleRate)
         {
             const T omega = std::numbers::pi_v<T> * 2 * freq / sampleRate;
             const T alpha = std::sin(omega) / (q * 2);
 
             const T cosOmega = std::cos(omega);
-            m_a0 = T{ 1 } + alpha;
-            m_a1 = -T{ 2 } * cosOmega;
-            m_a2 = T{ 1 } - alpha;
-            m_b0 = (T{ 1 } + cosOmega) / 2;
-            m_b1 = -T{ 1 } - cosOmega;
-            m_b2 = (T{ 1 } + cosOmega) / 2;
+            return Normalized(
+                T{ 1 } + alpha,
+                -T{ 2 } * cosOmega,
+                T{ 1 } - alpha,
+                (T{ 1 } + cosOmega) / 2,
+                -T{ 1 } - cosOmega,
+                (T{ 1 } + cosOmega) / 2);
         }
 
-        void setHighShelfFilter(T freq, T q, T gainDb, T sampleRate)
+        static BiquadCoefficients HighShelfFilter(T freq, T q, T gainDb, T sampleRate)
         {
             const T omega = std::numbers::pi_v<T> * 2 * freq / sampleRate;
             const T A = std::pow(T{ 10 }, gainDb / 40);
@@ -91,41 +82,110 @@ namespace ksmaudio::AudioEffect::detail
 
             const T sinOmega = std::sin(omega);
             const T cosOmega = std::cos(omega);
-            m_a0 = (A + T{ 1 }) - (A - T{ 1 }) * cosOmega + beta * sinOmega;
-            m_a1 = T{ 2 } *((A - T{ 1 }) - (A + T{ 1 }) * cosOmega);
-            m_a2 = (A + T{ 1 }) - (A - T{ 1 }) * cosOmega - beta * sinOmega;
-            m_b0 = A * ((A + T{ 1 }) + (A - T{ 1 }) * cosOmega + beta * sinOmega);
-            m_b1 = -T{ 2 } * A * ((A - T{ 1 }) + (A + T{ 1 }) * cosOmega);
-            m_b2 = A * ((A + T{ 1 }) + (A - T{ 1 }) * cosOmega - beta * sinOmega);
+            return Normalized(
+                (A + T{ 1 }) - (A - T{ 1 }) * cosOmega + beta * sinOmega,
+                T{ 2 } * ((A - T{ 1 }) - (A + T{ 1 }) * cosOmega),
+                (A + T{ 1 }) - (A - T{ 1 }) * cosOmega - beta * sinOmega,
+                A * ((A + T{ 1 }) + (A - T{ 1 }) * cosOmega + beta * sinOmega),
+                -T{ 2 } * A * ((A - T{ 1 }) + (A + T{ 1 }) * cosOmega),
+                A * ((A + T{ 1 }) + (A - T{ 1 }) * cosOmega - beta * sinOmega));
         }
 
-        void setPeakingFilter(T freq, T bandwidth, T gainDb, T sampleRate)
+        static BiquadCoefficients PeakingFilter(T freq, T bandwidth, T gainDb, T sampleRate)
         {
             const T omega = std::numbers::pi_v<T> * 2 * freq / sampleRate;
             const T alpha = std::sin(omega) * std::sinh(std::log(T{ 2 }) / 2 * bandwidth * omega / std::sin(omega));
             const T A = std::pow(T{ 10 }, gainDb / 40);
 
             const T cosOmega = std::cos(omega);
-            m_a0 = T{ 1 } + alpha / A;
-            m_a1 = -T{ 2 } * cosOmega;
-            m_a2 = T{ 1 } - alpha / A;
-            m_b0 = T{ 1 } + alpha * A;
-            m_b1 = -T{ 2 } * cosOmega;
-            m_b2 = T{ 1 } - alpha * A;
+            return Normalized(
+                T{ 1 } + alpha / A,
+                -T{ 2 } * cosOmega,
+                T{ 1 } - alpha / A,
+                T{ 1 } + alpha * A,
+                -T{ 2 } * cosOmega,
+                T{ 1 } - alpha * A);
         }
 
-        void setAllPassFilter(T freq, T q, T sampleRate)
+        static BiquadCoefficients AllPassFilter(T freq, T q, T sampleRate)
         {
             const T omega = std::numbers::pi_v<T> * 2 * freq / sampleRate;
             const T alpha = std::sin(omega) / (q * 2);
 
             const T cosOmega = std::cos(omega);
-            m_a0 = T{ 1 } + alpha;
-            m_a1 = -T{ 2 } * cosOmega;
-            m_a2 = T{ 1 } - alpha;
-            m_b0 = T{ 1 } - alpha;
-            m_b1 = -T{ 2 } * cosOmega;
-            m_b2 = T{ 1 } + alpha;
+            return Normalized(
+                T{ 1 } + alpha,
+                -T{ 2 } * cosOmega,
+                T{ 1 } - alpha,
+                T{ 1 } - alpha,
+                -T{ 2 } * cosOmega,
+                T{ 1 } + alpha);
+        }
+    };
+
+    template <typename T>
+    class BiquadFilter
+    {
+    private:
+        BiquadCoefficients<T> m_coef;
+        T m_input1 = T{ 0 };
+        T m_input2 = T{ 0 };
+        T m_output1 = T{ 0 };
+        T m_output2 = T{ 0 };
+
+    public:
+        BiquadFilter() = default;
+
+        T process(T input)
+        {
+            const T output
+                = m_coef.b0 * input
+                + m_coef.b1 * m_input1
+                + m_coef.b2 * m_input2
+                - m_coef.a1 * m_output1
+                - m_coef.a2 * m_output2;
+
+            m_input2 = m_input1;
+            m_input1 = input;
+            m_output2 = m_output1;
+            m_output1 = output;
+
+            return output;
+        }
+
+        void setCoefficients(const BiquadCoefficients<T>& coef)
+        {
+            m_coef = coef;
+        }
+
+        void setLowPassFilter(T freq, T q, T sampleRate)
+        {
+            m_coef = BiquadCoefficients<T>::LowPassFilter(freq, q, sampleRate);
+        }
+
+        void setLowShelfFilter(T freq, T q, T gainDb, T sampleRate)
+        {
+            m_coef = BiquadCoefficients<T>::LowShelfFilter(freq, q, gainDb, sampleRate);
+        }
+
+        void setHighPassFilter(T freq, T q, T sampleRate)
+        {
+            m_coef = BiquadCoefficients<T>::HighPassFilter(freq, q, sampleRate);
+        }
+
+        void setHighShelfFilter(T freq, T q, T gainDb, T sampleRate)
+        {
+            m_coef = BiquadCoefficients<T>::HighShelfFilter(freq, q, gainDb, sampleRate);
+        }
+
+        void setPeakingFilter(T freq, T bandwidth, T gainDb, T sampleRate)
+        {
+            m_coef = BiquadCoefficients<T>::PeakingFilter(freq, bandwidth, gainDb, sampleRate);
+        }
+
+        void setAllPassFilter(T freq, T q, T sampleRate)
+        {
+            m_coef = BiquadCoefficients<T>::AllPassFilter(freq, q, sampleRate);
         }
     };
 }
@@ -0,0 +1,115 @@
+﻿#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "TripleBuffer.hpp"
+
+namespace ksmaudio::AudioEffect::detail
+{
+    // ゲームスレッドからオーディオスレッド(BASSのDSPコールバック)へDSPParamsを受け渡すためのクラス
+    //
+    // 単純に最新値のみを受け渡すと、コールバックの間に複数回更新された場合にsecUntilTriggerやupdateTrigger等の
+    // 一度きりのイベントが抜けてしまうため、読み込み側がまだ適用していない更新を連番付きでまとめて公開する。
+    // 読み込み側は未適用の更新のみを古い順に適用するため、updateParamsの呼び出し順序は従来のmutex版と変わらない。
+    template <typename DSPParams>
+    class DSPParamsHandoff
+    {
+    public:
+        // 読み込み側が長時間止まっている場合(ストリームの一時停止中など)はこれを超えた分の古い更新から破棄する
+        static constexpr std::size_t kMaxPendingUpdates = 16U;
+
+    private:
+        struct Batch
+        {
+            std::array<DSPParams, kMaxPendingUpdates> params{};
+            std::uint64_t firstSeq = 0U;
+            std::size_t size = 0U;
+        };
+
+        TripleBuffer<Batch> m_tripleBuffer;
+
+        // 読み込み側が適用済みの最後の連番(書き込み側が未適用の更新を判定するために参照)
+        std::atomic<std::uint64_t> m_appliedSeq = 0U;
+
+        // 書き込み側スレッドのみが使用
+        Batch m_pending;
+        std::uint64_t m_nextSeq = 1U;
+
+        // 読み込み側スレッドのみが使用
+        std::uint64_t m_appliedSeqLocal = 0U;
+
+    public:
+        DSPParamsHandoff() = default;
+
+        DSPParamsHandoff(const DSPParamsHandoff&) = delete;
+
+        DSPParamsHandoff& operator=(const DSPParamsHandoff&) = delete;
+
+        // 書き込み側(ゲームスレッド)
+        void push(const DSPParams& params)
+        {
+            // 適用済みの更新を取り除く
+            const std::uint64_t appliedSeq = m_appliedSeq.load(std::memory_order_acquire);
+            std::size_t numApplied = 0U;
+            if (appliedSeq >= m_pending.firstSeq)
+            {
+                numApplied = static_cast<std::size_t>(appliedSeq - m_pending.firstSeq + 1U);
+                if (numApplied > m_pending.size)
+                {
+                    numApplied = m_pending.size;
+                }
+            }
+            if (m_pending.size == kMaxPendingUpdates && numApplied == 0U)
+            {
+                numApplied = 1U;
+            }
+            if (numApplied > 0U)
+            {
+                for (std::size_t i = numApplied; i < m_pending.size; ++i)
+                {
+                    m_pending.params[i - numApplied] = m_pending.params[i];
+                }
+                m_pending.size -= numApplied;
+                m_pending.firstSeq += numApplied;
+            }
+
+            if (m_pending.size == 0U)
+            {
+                m_pending.firstSeq = m_nextSeq;
+            }
+            m_pending.params[m_pending.size] = params;
+            ++m_pending.size;
+            ++m_nextSeq;
+
+            m_tripleBuffer.back() = m_pending;
+            m_tripleBuffer.publish();
+        }
+
+        // 読み込み側(オーディオスレッド)
+        // 未適用の更新を古い順にfuncへ渡す。戻り値は1つ以上適用したかどうか
+        template <typename Func>
+        bool consume(Func func)
+        {
+            if (!m_tripleBuffer.fetch())
+            {
+                return false;
+            }
+
+            const Batch& batch = m_tripleBuffer.front();
+            bool applied = false;
+            for (std::size_t i = 0U; i < batch.size; ++i)
+            {
+                const std::uint64_t seq = batch.firstSeq + i;
+                if (seq > m_appliedSeqLocal)
+                {
+                    func(batch.params[i]);
+                    m_appliedSeqLocal = seq;
+                    applied = true;
+                }
+            }
+            m_appliedSeq.store(m_appliedSeqLocal, std::memory_order_release);
+            return applied;
+        }
+    };
+}
@@ -0,0 +1,250 @@
+﻿#pragma once
+#include <array>
+#include <cstddef>
+#include <cassert>
+#include "BiquadFilter.hpp"
+
+// SSE2・NEONはサポート対象のx64・arm64環境では常に利用できるため、実行時ではなくコンパイル時に実装を選択する
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define KSMAUDIO_USE_SSE2
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define KSMAUDIO_USE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace ksmaudio::AudioEffect::detail
+{
+    // 左右2チャンネル分のfloatをまとめて扱うための最小限のラッパー
+    namespace simd
+    {
+#if defined(KSMAUDIO_USE_SSE2)
+        using Vec2 = __m128; // 下位2レーンのみ使用
+
+        inline Vec2 Load2(const float* p)
+        {
+            // __m64経由のロード・ストアはstrict aliasingの対象外
+            return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p));
+        }
+
+        inline void Store2(float* p, Vec2 v)
+        {
+            _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+        }
+
+        inline Vec2 Splat2(float value)
+        {
+            return _mm_set1_ps(value);
+        }
+
+        inline Vec2 Add(Vec2 a, Vec2 b)
+        {
+            return _mm_add_ps(a, b);
+        }
+
+        inline Vec2 Sub(Vec2 a, Vec2 b)
+        {
+            return _mm_sub_ps(a, b);
+        }
+
+        inline Vec2 Mul(Vec2 a, Vec2 b)
+        {
+            return _mm_mul_ps(a, b);
+        }
+#elif defined(KSMAUDIO_USE_NEON)
+        using Vec2 = float32x2_t;
+
+        inline Vec2 Load2(const float* p)
+        {
+            return vld1_f32(p);
+        }
+
+        inline void Store2(float* p, Vec2 v)
+        {
+            vst1_f32(p, v);
+        }
+
+        inline Vec2 Splat2(float value)
+        {
+            return vdup_n_f32(value);
+        }
+
+        inline Vec2 Add(Vec2 a, Vec2 b)
+        {
+            return vadd_f32(a, b);
+        }
+
+        inline Vec2 Sub(Vec2 a, Vec2 b)
+        {
+            return vsub_f32(a, b);
+        }
+
+        inline Vec2 Mul(Vec2 a, Vec2 b)
+        {
+            return vmul_f32(a, b);
+        }
+#else
+        struct Vec2
+        {
+            float l;
+            float r;
+        };
+
+        inline Vec2 Load2(const float* p)
+        {
+            return { p[0], p[1] };
+        }
+
+        inline void Store2(float* p, Vec2 v)
+        {
+            p[0] = v.l;
+            p[1] = v.r;
+        }
+
+        inline Vec2 Splat2(float value)
+        {
+            return { value, value };
+        }
+
+        inline Vec2 Add(Vec2 a, Vec2 b)
+        {
+            return { a.l + b.l, a.r + b.r };
+        }
+
+        inline Vec2 Sub(Vec2 a, Vec2 b)
+        {
+            return { a.l - b.l, a.r - b.r };
+        }
+
+        inline Vec2 Mul(Vec2 a, Vec2 b)
+        {
+            return { a.l * b.l, a.r * b.r };
+        }
+#endif
+    }
+
+    // 左右2チャンネル分の双2次フィルタ
+    // 両チャンネルをSIMDレジスタの別レーンに載せて同時に処理する
+    // モノラルの場合は左チャンネルのレーンのみを使用する
+    class StereoBiquadFilter
+    {
+    private:
+        // 各配列の要素は(左, 右)の順
+        std::array<float, 2> m_b0 = { 1.0f, 1.0f };
+        std::array<float, 2> m_b1 = { 0.0f, 0.0f };
+        std::array<float, 2> m_b2 = { 0.0f, 0.0f };
+        std::array<float, 2> m_a1 = { 0.0f, 0.0f };
+        std::array<float, 2> m_a2 = { 0.0f, 0.0f };
+        std::array<float, 2> m_input1 = { 0.0f, 0.0f };
+        std::array<float, 2> m_input2 = { 0.0f, 0.0f };
+        std::array<float, 2> m_output1 = { 0.0f, 0.0f };
+        std::array<float, 2> m_output2 = { 0.0f, 0.0f };
+
+        // 演算順序はBiquadFilter::processと揃える
+        // (係数が毎フレーム変化する場合は丸め誤差の差が増幅されることがあるため)
+        static simd::Vec2 calcOutput(simd::Vec2 b0, simd::Vec2 b1, simd::Vec2 b2, simd::Vec2 a1, simd::Vec2 a2, simd::Vec2 input, simd::Vec2 input1, simd::Vec2 input2, simd::Vec2 output1, simd::Vec2 output2)
+        {
+            simd::Vec2 output = simd::Mul(b0, input);
+            output = simd::Add(output, simd::Mul(b1, input1));
+            output = simd::Add(output, simd::Mul(b2, input2));
+            output = simd::Sub(output, simd::Mul(a1, output1));
+            output = simd::Sub(output, simd::Mul(a2, output2));
+            return output;
+        }
+
+    public:
+        StereoBiquadFilter() = default;
+
+        // 両チャンネルに同じ係数を設定
+        void setCoefficients(const BiquadCoefficients<float>& coef)
+        {
+            setCoefficients(coef, coef);
+        }
+
+        // チャンネルごとに異なる係数を設定
+        void setCoefficients(const BiquadCoefficients<float>& coefL, const BiquadCoefficients<float>& coefR)
+        {
+            m_b0 = { coefL.b0, coefR.b0 };
+            m_b1 = { coefL.b1, coefR.b1 };
+            m_b2 = { coefL.b2, coefR.b2 };
+            m_a1 = { coefL.a1, coefR.a1 };
+            m_a2 = { coefL.a2, coefR.a2 };
+        }
+
+        // 1フレーム(左右2サンプル)を処理する
+        // pInput・pOutputはそれぞれ2要素を指す必要がある(同一のポインタでもよい)
+        void processFrame(const float* pInput, float* pOutput)
+        {
+            const simd::Vec2 input = simd::Load2(pInput);
+            const simd::Vec2 input1 = simd::Load2(m_input1.data());
+            const simd::Vec2 output1 = simd::Load2(m_output1.data());
+            const simd::Vec2 output = calcOutput(
+                simd::Load2(m_b0.data()), simd::Load2(m_b1.data()), simd::Load2(m_b2.data()), simd::Load2(m_a1.data()), simd::Load2(m_a2.data()),
+                input, input1, simd::Load2(m_input2.data()), output1, simd::Load2(m_output2.data()));
+
+            simd::Store2(m_input2.data(), input1);
+            simd::Store2(m_input1.data(), input);
+            simd::Store2(m_output2.data(), output1);
+            simd::Store2(m_output1.data(), output);
+            simd::Store2(pOutput, output);
+        }
+
+        // インターリーブされたnumFramesフレーム分のデータにフィルタを適用し、原音とmixの比率で混ぜる
+        // 係数はブロック内で一定のものとして扱う
+        void processBlock(float* pData, std::size_t numFrames, std::size_t numChannels, float mix)
+        {
+            assert(numChannels == 1U || numChannels == 2U);
+
+            if (numChannels == 1U)
+            {
+                // モノラルは左チャンネルのレーンのみをスカラーで処理
+                float input1 = m_input1[0];
+                float input2 = m_input2[0];
+                float output1 = m_output1[0];
+                float output2 = m_output2[0];
+                for (std::size_t i = 0U; i < numFrames; ++i)
+                {
+                    const float input = pData[i];
+                    const float output = m_b0[0] * input + m_b1[0] * input1 + m_b2[0] * input2 - m_a1[0] * output1 - m_a2[0] * output2;
+                    input2 = input1;
+                    input1 = input;
+                    output2 = output1;
+                    output1 = output;
+                    pData[i] = input + (output - input) * mix;
+                }
+                m_input1[0] = input1;
+                m_input2[0] = input2;
+                m_output1[0] = output1;
+                m_output2[0] = output2;
+                return;
+            }
+
+            // 係数と状態はブロックの処理中はレジスタに載せたままにする
+            const simd::Vec2 b0 = simd::Load2(m_b0.data());
+            const simd::Vec2 b1 = simd::Load2(m_b1.data());
+            const simd::Vec2 b2 = simd::Load2(m_b2.data());
+            const simd::Vec2 a1 = simd::Load2(m_a1.data());
+            const simd::Vec2 a2 = simd::Load2(m_a2.data());
+            const simd::Vec2 mixVec = simd::Splat2(mix);
+            simd::Vec2 input1 = simd::Load2(m_input1.data());
+            simd::Vec2 input2 = simd::Load2(m_input2.data());
+            simd::Vec2 output1 = simd::Load2(m_output1.data());
+            simd::Vec2 output2 = simd::Load2(m_output2.data());
+            for (std::size_t i = 0U; i < numFrames; ++i)
+            {
+                float* pFrame = pData + i * 2U;
+                const simd::Vec2 input = simd::Load2(pFrame);
+                const simd::Vec2 output = calcOutput(b0, b1, b2, a1, a2, input, input1, input2, output1, output2);
+                input2 = input1;
+                input1 = input;
+                output2 = output1;
+                output1 = output;
+                simd::Store2(pFrame, simd::Add(input, simd::Mul(simd::Sub(output, input), mixVec)));
+            }
+            simd::Store2(m_input1.data(), input1);
+            simd::Store2(m_input2.data(), input2);
+            simd::Store2(m_output1.data(), output1);
+            simd::Store2(m_output2.data(), output2);
+        }
+    };
+}
@@ -0,0 +1,67 @@
+﻿#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ksmaudio::AudioEffect::detail
+{
+    // 書き込み側・読み込み側それぞれ1スレッドで使用するトリプルバッファ
+    // どちらの操作もatomic変数1つの交換のみで完了するため、ロックを取らず待機も発生しない
+    template <typename T>
+    class TripleBuffer
+    {
+    private:
+        static constexpr std::uint8_t kIdxMask = 0b011;
+        static constexpr std::uint8_t kDirtyBit = 0b100; // 読み込み側がまだ取得していない値が中間バッファにあるか
+
+        std::array<T, 3> m_buffers{};
+
+        // 中間バッファのインデックス(+kDirtyBit)
+        std::atomic<std::uint8_t> m_middleState = 1;
+
+        // 書き込み側スレッドのみが使用
+        std::uint8_t m_backIdx = 0;
+
+        // 読み込み側スレッドのみが使用
+        std::uint8_t m_frontIdx = 2;
+
+    public:
+        TripleBuffer() = default;
+
+        TripleBuffer(const TripleBuffer&) = delete;
+
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+        // 書き込み側: 次に公開する値の書き込み先
+        T& back()
+        {
+            return m_buffers[m_backIdx];
+        }
+
+        // 書き込み側: back()に書き込んだ値を公開する
+        // 戻り値は前回公開した値が読み込み側に取得されないまま上書きされたかどうか
+        bool publish()
+        {
+            const std::uint8_t prevState = m_middleState.exchange(m_backIdx | kDirtyBit, std::memory_order_acq_rel);
+            m_backIdx = prevState & kIdxMask;
+            return (prevState & kDirtyBit) != 0;
+        }
+
+        // 読み込み側: 新しく公開された値があればfront()へ取り込む
+        bool fetch()
+        {
+            if ((m_middleState.load(std::memory_order_relaxed) & kDirtyBit) == 0)
+            {
+                return false;
+            }
+            m_frontIdx = m_middleState.exchange(m_frontIdx, std::memory_order_acq_rel) & kIdxMask;
+            return true;
+        }
+
+        // 読み込み側: 最後にfetch()で取り込んだ値
+        const T& front() const
+        {
+            return m_buffers[m_frontIdx];
+        }
+    };
+}
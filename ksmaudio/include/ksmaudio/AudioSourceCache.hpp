@@ -0,0 +1,88 @@
+﻿#pragma once
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "bass.h"
+
+namespace ksmaudio
+{
+	/// @brief メモリマップトファイルとして開いた音声ファイル
+	/// @note ファイルの内容はアクセスされたページのみOSによって読み込まれる。同じファイルを開いている全てのストリームで共有される
+	class MappedAudioFile
+	{
+	private:
+		const std::byte* m_pData = nullptr;
+		std::uint64_t m_size = 0;
+
+#ifdef _WIN32
+		void* m_hFile = nullptr;
+		void* m_hMapping = nullptr;
+#endif
+
+		MappedAudioFile() = default;
+
+	public:
+		/// @brief ファイルをメモリマップトファイルとして開く
+		/// @return 開けなかった場合(ファイルが存在しない、空ファイルなど)はnullptr
+		static std::unique_ptr<MappedAudioFile> Open(const std::string& filePath);
+
+		~MappedAudioFile();
+
+		MappedAudioFile(const MappedAudioFile&) = delete;
+
+		MappedAudioFile& operator=(const MappedAudioFile&) = delete;
+
+		const std::byte* data() const;
+
+		std::uint64_t size() const;
+
+		/// @brief 指定範囲のページを読み込んでおくようOSに要求する(完了は待たない)
+		void prefetch(std::uint64_t offset, std::uint64_t size) const;
+	};
+
+	/// @brief 共有の音声ファイルからBASSのストリームへデータを供給する読み込み位置
+	/// @note ストリームごとに作成し、ストリームを解放するまで破棄しないこと
+	class AudioSourceReader
+	{
+	private:
+		std::shared_ptr<const MappedAudioFile> m_file;
+		std::uint64_t m_pos = 0;
+		std::uint64_t m_prefetchedEnd = 0;
+
+	public:
+		explicit AudioSourceReader(std::shared_ptr<const MappedAudioFile> file);
+
+		AudioSourceReader(const AudioSourceReader&) = delete;
+
+		AudioSourceReader& operator=(const AudioSourceReader&) = delete;
+
+		/// @brief このReaderから読み込むBASSのストリームを作成
+		/// @param flags BASS_StreamCreateFileUserに渡すフラグ
+		HSTREAM createStream(DWORD flags);
+
+		/// @brief 現在位置から読み込み、読み込み位置を進める
+		/// @return 読み込んだバイト数(終端ではlengthより小さくなる)
+		/// @note 読み込み位置の先のページを先読みする
+		std::size_t read(void* pBuffer, std::size_t length);
+
+		bool seek(std::uint64_t offset);
+
+		std::uint64_t length() const;
+
+		std::uint64_t position() const;
+
+		const MappedAudioFile& file() const;
+	};
+
+	namespace AudioSourceCache
+	{
+		/// @brief 音声ファイルを開く
+		/// @return 開けなかった場合はnullptr
+		/// @note 同じファイルを使用中の場合は開いているものを共有する。全ての参照が破棄されると閉じられる
+		std::shared_ptr<const MappedAudioFile> Open(const std::string& filePath);
+
+		/// @brief 使用中の音声ファイルの数
+		std::size_t NumOpenFiles();
+	}
+}
@@ -0,0 +1,32 @@
+﻿#pragma once
+#include <string>
+#include <functional>
+#include <optional>
+#include "Stream.hpp"
+#include "StreamWithEffects.hpp"
+#include "WavFileWriter.hpp"
+
+namespace ksmaudio
+{
+	struct OfflineRenderOptions
+	{
+		// 1回のrender()で取り出すフレーム数
+		// 音声エフェクトのパラメータ更新はこの単位で行われるため、同じ値を指定すれば出力はサンプル単位で一致する
+		std::size_t blockFrames = 512U;
+
+		// レンダリングする最大の長さ(std::nulloptの場合は曲の終端まで)
+		std::optional<Duration> maxDuration = std::nullopt;
+
+		WavSampleFormat format = WavSampleFormat::kInt16;
+	};
+
+	// 各ブロックのレンダリング前に、そのブロックの先頭の再生位置を渡して呼ばれるコールバック
+	// 音声エフェクトのステータス更新(AudioEffectBus::updateByFX等)はここで行う
+	using OfflineRenderBlockCallback = std::function<void(SecondsF blockStartSec)>;
+
+	/// @brief デコード専用ストリームを実時間によらず最後までレンダリングしてWAVファイルに書き出す
+	/// @return 書き出したフレーム数(失敗した場合はstd::nullopt)
+	std::optional<std::size_t> RenderToWavFile(const Stream& stream, const std::string& filePath, const OfflineRenderOptions& options = {}, const OfflineRenderBlockCallback& onBlock = nullptr);
+
+	std::optional<std::size_t> RenderToWavFile(const StreamWithEffects& stream, const std::string& filePath, const OfflineRenderOptions& options = {}, const OfflineRenderBlockCallback& onBlock = nullptr);
+}
@@ -1,14 +1,34 @@
 ﻿#pragma once
 #include <string>
+#include <vector>
+#include <memory>
 #include "bass.h"
 
 namespace ksmaudio
 {
+	/// @brief ミキサーで効果音を鳴らすためのデコード済みの音声データ
+	struct SamplePCM
+	{
+		std::vector<float> data; // チャンネルごとにインターリーブしたfloatの値
+		std::size_t sampleRate = 0U;
+		std::size_t numChannels = 0U;
+
+		std::size_t numFrames() const
+		{
+			return numChannels == 0U ? 0U : data.size() / numChannels;
+		}
+	};
+
 	class Sample
 	{
 	private:
 		HSAMPLE m_hSample = 0;
 
+		DWORD m_maxPolyphony = 1U;
+
+		// ミキサーが再生中に参照するため、Sampleの破棄後も残るようshared_ptrで保持する
+		std::shared_ptr<const SamplePCM> m_pcm;
+
 	public:
 		// Note: filePath must be in UTF-8
 		Sample(const std::string& filePath, DWORD maxPolyphony = 1U);
@@ -24,5 +44,11 @@ namespace ksmaudio
 		Sample& operator=(Sample&& other) noexcept;
 
 		void play(double volume = 1.0) const;
+
+		DWORD maxPolyphony() const;
+
+		/// @brief デコード済みの音声データを取得
+		/// @return 読み込みに失敗した場合はnullptr
+		const std::shared_ptr<const SamplePCM>& pcm() const;
 	};
 }
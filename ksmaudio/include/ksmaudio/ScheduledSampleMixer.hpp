@@ -0,0 +1,102 @@
+﻿#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include "Sample.hpp"
+#include "detail/SPSCQueue.hpp"
+
+namespace ksmaudio
+{
+	/// @brief ストリームの再生位置(サンプル単位)を指定して効果音を鳴らすミキサー
+	/// @details ストリームのDSPとして登録し、ストリームの音声に効果音を加算する。
+	///          再生位置はストリームのposSec()にサンプリング周波数を掛けた値で、1出力サンプルあたり再生速度の分だけ進む
+	/// @remark schedule()は呼び出し側の1スレッド、process()はミキサーのスレッドから呼び出す。
+	///         seek()はストリームをロックした状態(process()と同時に呼ばれない状態)で呼び出す
+	class ScheduledSampleMixer
+	{
+	public:
+		// 予約を受け渡すキューの長さ(ミキサーが取り出す前にこれ以上予約された場合は鳴らさない)
+		static constexpr std::size_t kQueueCapacity = 256U;
+
+		// 開始位置待ちの予約の最大数
+		static constexpr std::size_t kMaxPendingEvents = 256U;
+
+		// 同時に鳴らす効果音の最大数(超えた場合は最も古いものを止める)
+		static constexpr std::size_t kMaxVoices = 64U;
+
+		// 開始位置を過ぎて取り出した予約を鳴らす猶予(秒)
+		// (これより古いものはシーク等で飛ばされたとみなして鳴らさない)
+		static constexpr double kMaxLateSec = 0.05;
+
+	private:
+		struct Event
+		{
+			std::shared_ptr<const SamplePCM> pcm;
+			std::int64_t startFrameIdx = 0;
+			float volume = 1.0f;
+			std::size_t maxPolyphony = 1U;
+		};
+
+		struct Voice
+		{
+			std::shared_ptr<const SamplePCM> pcm;
+			bool isActive = false;
+			std::int64_t startFrameIdx = 0;
+			float volume = 1.0f;
+
+			// 効果音内の読み込み位置と、1出力サンプルあたりの進み幅(サンプリング周波数の違いを吸収する)
+			double srcPos = 0.0;
+			double srcStep = 1.0;
+
+			// 処理中のブロック内で鳴らす範囲
+			std::size_t beginOffset = 0U;
+			std::size_t endOffset = SIZE_MAX;
+		};
+
+		const std::size_t m_sampleRate;
+		const std::size_t m_numChannels;
+		const double m_frameIdxPerOutputFrame;
+
+		detail::SPSCQueue<Event, kQueueCapacity> m_queue;
+
+		// 以下はミキサーのスレッドのみが使用する
+		double m_frameIdx;
+		std::array<Event, kMaxPendingEvents> m_pendingEvents;
+		std::size_t m_numPendingEvents = 0U;
+		std::array<Voice, kMaxVoices> m_voices;
+
+		void receiveEvents();
+
+		void startVoice(const Event& event, std::size_t offset);
+
+	public:
+		/// @param sampleRate ストリームのサンプリング周波数
+		/// @param numChannels ストリームのチャンネル数
+		/// @param playbackSpeed ストリームの再生速度
+		/// @param frameIdx 現在の再生位置
+		ScheduledSampleMixer(std::size_t sampleRate, std::size_t numChannels, double playbackSpeed, std::int64_t frameIdx);
+
+		ScheduledSampleMixer(const ScheduledSampleMixer&) = delete;
+
+		ScheduledSampleMixer& operator=(const ScheduledSampleMixer&) = delete;
+
+		/// @brief 効果音を指定の再生位置で鳴らすよう予約する
+		/// @param sample 効果音
+		/// @param startFrameIdx 鳴らし始める再生位置
+		/// @param volume 音量
+		/// @return 予約できた場合はtrue
+		bool schedule(const Sample& sample, std::int64_t startFrameIdx, double volume);
+
+		/// @brief 再生位置を変更する
+		/// @note 鳴っている効果音と開始位置待ちの予約はそのまま残る(新しい再生位置より古い予約は鳴らさない)
+		void seek(std::int64_t frameIdx);
+
+		/// @brief ストリームの音声に効果音を加算する
+		/// @param pData ストリームの音声(チャンネルごとにインターリーブしたfloatの値)
+		/// @param dataSize pDataの要素数
+		void process(float* pData, std::size_t dataSize);
+
+		/// @brief 秒数を再生位置に変換
+		std::int64_t secToFrameIdx(double sec) const;
+	};
+}
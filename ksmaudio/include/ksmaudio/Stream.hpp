@@ -7,6 +7,8 @@
 #include "bass.h"
 #include "bass_fx.h"
 #include "ksmaudio/AudioEffect/AudioEffect.hpp"
+#include "ksmaudio/AudioSourceCache.hpp"
+#include "ksmaudio/ScheduledSampleMixer.hpp"
 
 namespace ksmaudio
 {
@@ -16,16 +18,23 @@ namespace ksmaudio
 	class Stream
 	{
 	private:
-		std::unique_ptr<std::vector<char>> m_preloadedBinary;
+		std::unique_ptr<AudioSourceReader> m_sourceReader; // BASSのストリームより先に破棄されないよう先頭に置く
 		std::optional<HSTREAM> m_hStreamSource; // テンポ変更時のみ使用
 		HSTREAM m_hStream;
 		double m_playbackSpeed;
 		BASS_CHANNELINFO m_info;
 		double m_volume;
 		bool m_muted;
+		bool m_decodeOnly;
+		std::unique_ptr<ScheduledSampleMixer> m_scheduledSampleMixer;
+
+		// 音量の適用に使用する属性(ミキサーの有効化後はBASS_ATTRIB_VOLDSPになる)
+		DWORD m_volumeAttrib;
 
 	public:
-		explicit Stream(const std::string& filePath, double volume = 1.0, bool enableCompressor = false, bool preload = false, bool loop = false, double playbackSpeed = 1.0);
+		/// @param preload trueの場合はAudioSourceCacheで共有するメモリマップトファイルから読み込む(同じファイルを複数のストリームで開いても1つのマッピングを共有する)
+		/// @param decodeOnly trueの場合は出力デバイスを使用しないデコード専用ストリームとして作成する(render()で呼び出し側が音声を取り出す)
+		explicit Stream(const std::string& filePath, double volume = 1.0, bool enableCompressor = false, bool preload = false, bool loop = false, double playbackSpeed = 1.0, bool decodeOnly = false);
 
 		~Stream();
 
@@ -45,6 +54,15 @@ namespace ksmaudio
 
 		void updateManually() const;
 
+		/// @brief デコード専用ストリームから音声を取り出す
+		/// @param pBuffer 出力先(numFrames * numChannels()個のfloat)
+		/// @param numFrames 取り出すフレーム数
+		/// @return 実際に取り出したフレーム数(曲の終端に達した場合はnumFramesより小さくなる)
+		/// @note 登録済みの音声エフェクトはこの呼び出しの中で呼び出し側のスレッドから適用される
+		std::size_t render(float* pBuffer, std::size_t numFrames) const;
+
+		bool isDecodeOnly() const;
+
 		SecondsF posSec() const;
 
 		void seekPosSec(SecondsF time) const;
@@ -55,6 +73,19 @@ namespace ksmaudio
 
 		void removeAudioEffect(HDSP hDSP) const;
 
+		/// @brief 再生位置を指定して効果音を鳴らすためのミキサーを有効にする
+		/// @note 効果音にストリームの音量(フェード・ミュートを含む)がかからないよう、以降はストリームの音量をミキサーより前段のDSPで適用する
+		void enableScheduledSampleMixer();
+
+		bool hasScheduledSampleMixer() const;
+
+		/// @brief 効果音を指定の再生位置で鳴らすよう予約する
+		/// @param sample 効果音
+		/// @param timeSec 鳴らし始める再生位置(posSec()と同じ基準)
+		/// @param volume 音量
+		/// @return 予約できた場合はtrue(ミキサーが無効の場合はfalse)
+		bool scheduleSample(const Sample& sample, SecondsF timeSec, double volume) const;
+
 		void setFadeIn(Duration duration) const;
 
 		void setFadeIn(Duration duration, double volume);
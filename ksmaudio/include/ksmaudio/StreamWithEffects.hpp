@@ -16,7 +16,7 @@ namespace ksmaudio
 
 	public:
 		// TODO: filePath encoding problem
-		explicit StreamWithEffects(const std::string& filePath, double volume = 1.0, bool enableCompressor = false, bool preload = false, double playbackSpeed = 1.0);
+		explicit StreamWithEffects(const std::string& filePath, double volume = 1.0, bool enableCompressor = false, bool preload = false, double playbackSpeed = 1.0, bool decodeOnly = false);
 
 		StreamWithEffects(const StreamWithEffects&) = delete;
 
@@ -34,6 +34,10 @@ namespace ksmaudio
 
 		void updateManually() const;
 
+		std::size_t render(float* pBuffer, std::size_t numFrames) const;
+
+		bool isDecodeOnly() const;
+
 		SecondsF posSec() const;
 
 		void seekPosSec(SecondsF timeSec) const;
@@ -56,6 +60,12 @@ namespace ksmaudio
 
 		void setMuted(bool muted);
 
+		void enableScheduledSampleMixer();
+
+		bool hasScheduledSampleMixer() const;
+
+		bool scheduleSample(const Sample& sample, SecondsF timeSec, double volume) const;
+
 		// Note: The pointer is valid until this StreamWithEffects instance is destroyed.
 		AudioEffect::AudioEffectBus* emplaceAudioEffectBusFX();
 		AudioEffect::AudioEffectBus* emplaceAudioEffectBusLaser();
@@ -0,0 +1,52 @@
+﻿#pragma once
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <vector>
+
+namespace ksmaudio
+{
+	enum class WavSampleFormat
+	{
+		kInt16,
+		kFloat32,
+	};
+
+	// オフラインレンダリング結果を書き出すためのWAVファイルライタ
+	// Note: ヘッダのサイズ欄はclose()(またはデストラクタ)の時点で確定する
+	class WavFileWriter
+	{
+	private:
+		std::ofstream m_ofs;
+		std::size_t m_sampleRate;
+		std::size_t m_numChannels;
+		WavSampleFormat m_format;
+		std::uint64_t m_numDataBytes = 0U;
+		std::vector<char> m_encodeBuffer;
+
+		void writeHeader(std::uint32_t dataBytes);
+
+	public:
+		// Note: filePath must be in UTF-8
+		WavFileWriter(const std::string& filePath, std::size_t sampleRate, std::size_t numChannels, WavSampleFormat format = WavSampleFormat::kInt16);
+
+		~WavFileWriter();
+
+		WavFileWriter(const WavFileWriter&) = delete;
+
+		WavFileWriter& operator=(const WavFileWriter&) = delete;
+
+		bool isOpen() const;
+
+		/// @brief インターリーブされたfloatのサンプルを書き込む
+		/// @param pData 書き込むデータ(numFrames * numChannels個のfloat)
+		/// @param numFrames フレーム数
+		void write(const float* pData, std::size_t numFrames);
+
+		std::size_t numFramesWritten() const;
+
+		/// @brief ヘッダを確定してファイルを閉じる
+		/// @return 書き込みに成功したかどうか
+		bool close();
+	};
+}
@@ -0,0 +1,73 @@
+﻿#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+
+namespace ksmaudio::detail
+{
+	/// @brief 書き込み側・読み込み側それぞれ1スレッドで使用する固定長のロックフリーキュー
+	/// @details 書き込み位置と読み込み位置をそれぞれ片方のスレッドのみが更新するため、ロックを取らず待機も発生しない。
+	///          キューが満杯の場合、tryPush()は要素を追加せずにfalseを返す
+	/// @tparam T 要素の型
+	/// @tparam Capacity 最大要素数(2の累乗)
+	template <typename T, std::size_t Capacity>
+	class SPSCQueue
+	{
+		static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+	private:
+		static constexpr std::size_t kIdxMask = Capacity - 1U;
+
+		// 書き込み位置と読み込み位置が同じキャッシュラインに載って互いの更新で無効化され合わないよう、別々に配置する
+		static constexpr std::size_t kCacheLineSize = 64U;
+
+		std::array<T, Capacity> m_buffer{};
+
+		// 書き込み側のみが更新する(単調増加し、インデックスとして使用する際はkIdxMaskでマスクする)
+		alignas(kCacheLineSize) std::atomic<std::size_t> m_writePos = 0U;
+
+		// 読み込み側のみが更新する
+		alignas(kCacheLineSize) std::atomic<std::size_t> m_readPos = 0U;
+
+	public:
+		SPSCQueue() = default;
+
+		SPSCQueue(const SPSCQueue&) = delete;
+
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+		/// @brief 書き込み側: 要素を追加
+		/// @return 追加できた場合はtrue、キューが満杯の場合はfalse
+		bool tryPush(const T& value)
+		{
+			const std::size_t writePos = m_writePos.load(std::memory_order_relaxed);
+			if (writePos - m_readPos.load(std::memory_order_acquire) >= Capacity)
+			{
+				return false;
+			}
+			m_buffer[writePos & kIdxMask] = value;
+			m_writePos.store(writePos + 1U, std::memory_order_release);
+			return true;
+		}
+
+		/// @brief 読み込み側: 先頭の要素を取り出す
+		/// @return 取り出せた場合はtrue、キューが空の場合はfalse
+		bool tryPop(T* pValue)
+		{
+			const std::size_t readPos = m_readPos.load(std::memory_order_relaxed);
+			if (readPos == m_writePos.load(std::memory_order_acquire))
+			{
+				return false;
+			}
+			*pValue = m_buffer[readPos & kIdxMask];
+			m_readPos.store(readPos + 1U, std::memory_order_release);
+			return true;
+		}
+
+		[[nodiscard]]
+		static constexpr std::size_t capacity()
+		{
+			return Capacity;
+		}
+	};
+}
@@ -1,7 +1,11 @@
 #pragma once
 #include "Stream.hpp"
 #include "StreamWithEffects.hpp"
+#include "AudioSourceCache.hpp"
 #include "Sample.hpp"
+#include "ScheduledSampleMixer.hpp"
+#include "WavFileWriter.hpp"
+#include "OfflineRender.hpp"
 #include "AudioEffect/All.hpp"
 #include <string>
 #include <vector>
@@ -25,6 +29,10 @@ namespace ksmaudio
 
 	void Init(void* hWnd, int deviceId = -1, DWORD sampleRate = kDefaultSampleRate, DWORD bufferMs = kDefaultBufferSizeMs, DWORD updatePeriodMs = kDefaultUpdatePeriodMs);
 
+	/// @brief 出力デバイスを使用せずに初期化する(オフラインレンダリング用)
+	/// @note 音声の再生はできないため、Stream/StreamWithEffectsはdecodeOnlyを指定して作成する必要がある
+	void InitNoSound(DWORD sampleRate = kDefaultSampleRate);
+
 	void Terminate();
 
 	void SetMute(bool isMute);
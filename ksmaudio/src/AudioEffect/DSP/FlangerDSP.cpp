@@ -8,10 +8,7 @@ namespace ksmaudio::AudioEffect
 			static_cast<std::size_t>(info.sampleRate) * 3 * info.numChannels, // 3 seconds
 			info.numChannels)
 	{
-		for (auto& filter : m_lowShelfFilters)
-		{
-			filter.setLowShelfFilter(250.0f, 0.5f, -20.0f, static_cast<float>(info.sampleRate));
-		}
+		m_lowShelfFilter.setCoefficients(detail::BiquadCoefficients<float>::LowShelfFilter(250.0f, 0.5f, -20.0f, static_cast<float>(info.sampleRate)));
 	}
 
 	void FlangerDSP::process(float* pData, std::size_t dataSize, bool bypass, const FlangerDSPParams& params)
@@ -32,18 +29,25 @@ namespace ksmaudio::AudioEffect
 
 		const float periodSamples = params.period * m_info.sampleRate;
 		const float lfoSpeed = periodSamples == 0.0f ? 0.0f : (1.0f / periodSamples);
+		const float gain = std::lerp(1.0f, params.vol, params.mix);
 		for (std::size_t i = 0; i < numFrames; ++i)
 		{
+			// フィードバック成分のフィルタは両チャンネル分をまとめて適用する
+			std::array<float, 2> feedbackFrame = { 0.0f, 0.0f };
 			for (std::size_t channel = 0; channel < m_info.numChannels; ++channel)
 			{
 				const float lfoValue = detail::TriangleWithStereoWidth(m_lfoTimeRate, channel, params.stereoWidth);
 				const float delayFrames = (params.delay + lfoValue * params.depth) * m_info.sampleRateScale;
 				const float delayed = m_ringBuffer.lerpedDelay((std::max)(delayFrames - 1.0f, 0.0f), channel);
-				const float gain = std::lerp(1.0f, params.vol, params.mix);
-				m_ringBuffer.write(m_lowShelfFilters[channel].process((*pData + delayed * params.feedback) * gain), channel);
-				*pData = (*pData + delayed * params.mix) * gain;
-				++pData;
+				feedbackFrame[channel] = (pData[channel] + delayed * params.feedback) * gain;
+				pData[channel] = (pData[channel] + delayed * params.mix) * gain;
+			}
+			m_lowShelfFilter.processFrame(feedbackFrame.data(), feedbackFrame.data());
+			for (std::size_t channel = 0; channel < m_info.numChannels; ++channel)
+			{
+				m_ringBuffer.write(feedbackFrame[channel], channel);
 			}
+			pData += m_info.numChannels;
 			m_ringBuffer.advanceCursor();
 
 			m_lfoTimeRate += lfoSpeed;
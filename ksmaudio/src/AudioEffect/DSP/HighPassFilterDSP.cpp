@@ -40,32 +40,37 @@ namespace ksmaudio::AudioEffect
 		const std::size_t frameSize = dataSize / m_info.numChannels;
 		float freq = GetHighPassFilterFreqValue(m_vEasing.value());
 		bool mixSkipped = isBypassed || freq < kFreqThresholdMin; // 低周波数に対しては適用しない
-		for (std::size_t i = 0U; i < frameSize; ++i)
+		std::size_t i = 0U;
+		for (; i < frameSize; ++i)
 		{
 			// 値が飛ぶことでノイズが入らないようvの値に対して線形のイージングを入れる
-			const bool vUpdated = m_vEasing.update(params.v);
-			if (vUpdated)
+			// (イージングが完了した時点で係数が一定になるため、残りはまとめて処理する)
+			if (!m_vEasing.update(params.v))
 			{
-				freq = GetHighPassFilterFreqValue(m_vEasing.value());
-				mixSkipped = isBypassed || freq < kFreqThresholdMin; // 低周波数に対しては適用しない
+				break;
 			}
+			freq = GetHighPassFilterFreqValue(m_vEasing.value());
+			mixSkipped = isBypassed || freq < kFreqThresholdMin; // 低周波数に対しては適用しない
 
-			// 各チャンネルにフィルタを適用
+			// 両チャンネルに同じ係数のフィルタを適用
+			m_highPassFilter.setCoefficients(detail::BiquadCoefficients<float>::HighPassFilter(freq, params.q, m_info.sampleRateFloat));
+			const std::array<float, 2> frame = { pData[0], m_info.numChannels == 2U ? pData[1] : 0.0f };
+			std::array<float, 2> wet;
+			m_highPassFilter.processFrame(frame.data(), wet.data());
 			for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
 			{
-				if (vUpdated)
-				{
-					m_highPassFilters[ch].setHighPassFilter(freq, params.q, m_info.sampleRateFloat);
-				}
-
-				const float wet = m_highPassFilters[ch].process(*pData);
 				if (!mixSkipped)
 				{
-					*pData = std::lerp(*pData, wet, params.mix);
+					*pData = std::lerp(*pData, wet[ch], params.mix);
 				}
 				++pData;
 			}
 		}
+
+		if (i < frameSize)
+		{
+			m_highPassFilter.processBlock(pData, frameSize - i, m_info.numChannels, mixSkipped ? 0.0f : params.mix);
+		}
 	}
 
 	void HighPassFilterDSP::updateParams(const HighPassFilterDSPParams& params)
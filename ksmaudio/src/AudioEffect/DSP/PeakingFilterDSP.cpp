@@ -159,49 +159,45 @@ namespace ksmaudio::AudioEffect
 		assert(dataSize % m_info.numChannels == 0U);
 		const std::size_t frameSize = dataSize / m_info.numChannels;
 		m_valueController.updateGain(params.v);
+
+		// フィルタ係数とmixが変わらない区間はまとめてブロック処理する
+		std::size_t runBeginFrame = 0U;
+		float runMix = 0.0f;
+		const auto flushRun = [&](std::size_t endFrame)
+		{
+			if (runBeginFrame < endFrame)
+			{
+				m_peakingFilter.processBlock(pData + runBeginFrame * m_info.numChannels, endFrame - runBeginFrame, m_info.numChannels, runMix);
+			}
+			runBeginFrame = endFrame;
+		};
 		for (std::size_t i = 0U; i < frameSize; ++i)
 		{
 			m_valueController.updateFreq(params.v);
 			const bool mixSkipped = isBypassed || m_valueController.mixSkipped();
 			const bool shouldUseRelease = mixSkipped && params.releaseEnabled && m_release.hasValue();
+			const float mix = shouldUseRelease ? m_release.mix() : (mixSkipped ? 0.0f : params.mix);
 			if (shouldUseRelease)
 			{
 				// 余韻を適用する必要がある場合はフィルタ係数を毎回更新
-				for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
-				{
-					m_peakingFilters[ch].setPeakingFilter(m_release.freq(), params.bandwidth, m_release.baseGainDb() * params.gainRate, m_info.sampleRateFloat);
-				}
+				flushRun(i);
+				m_peakingFilter.setCoefficients(detail::BiquadCoefficients<float>::PeakingFilter(m_release.freq(), params.bandwidth, m_release.baseGainDb() * params.gainRate, m_info.sampleRateFloat));
 			}
-			else
+			else if (m_valueController.popUpdated())
 			{
-				const bool valueUpdated = m_valueController.popUpdated();
-				if (valueUpdated)
-				{
-					// 値が更新された場合はフィルタ係数を更新
-					for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
-					{
-						m_peakingFilters[ch].setPeakingFilter(m_valueController.freq(), params.bandwidth, m_valueController.baseGainDb() * params.gainRate, m_info.sampleRateFloat);
-					}
-				}
+				// 値が更新された場合はフィルタ係数を更新
+				flushRun(i);
+				m_peakingFilter.setCoefficients(detail::BiquadCoefficients<float>::PeakingFilter(m_valueController.freq(), params.bandwidth, m_valueController.baseGainDb() * params.gainRate, m_info.sampleRateFloat));
 			}
-
-			// 各チャンネルにフィルタを適用
-			for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
+			else if (mix != runMix)
 			{
-				const float wet = m_peakingFilters[ch].process(*pData);
-				if (shouldUseRelease)
-				{
-					*pData = std::lerp(*pData, wet, m_release.mix());
-				}
-				else if (!mixSkipped)
-				{
-					*pData = std::lerp(*pData, wet, params.mix);
-				}
-				++pData;
+				flushRun(i);
 			}
+			runMix = mix;
 
 			m_release.update(m_valueController.freq(), m_valueController.baseGainDb(), params.mix, mixSkipped);
 		}
+		flushRun(frameSize);
 	}
 
 	void PeakingFilterDSP::updateParams(const PeakingFilterDSPParams& params)
@@ -34,37 +34,45 @@ namespace ksmaudio::AudioEffect
 		const float log10Freq1 = detail::Log10Freq(params.freq1);
 		const float log10Freq2 = detail::Log10Freq(params.freq2);
 		const float centerFreq = detail::InterpolateFreqInLog10ScaleWithPrecalculatedLog10(0.5f, log10Freq1, log10Freq2);
-		for (std::size_t channel = 0; channel < m_info.numChannels; ++channel)
-		{
-			m_hiCutFilters[channel].setHighShelfFilter(centerFreq, kHiCutFilterQ, params.hiCutGain, m_info.sampleRateFloat);
-		}
+		m_hiCutFilter.setCoefficients(detail::BiquadCoefficients<float>::HighShelfFilter(centerFreq, kHiCutFilterQ, params.hiCutGain, m_info.sampleRateFloat));
 
 		const std::size_t stage = params.mix > 0.0f ? params.stage : 0U;
 		if (stage > 0U)
 		{
 			for (std::size_t i = 0; i < numFrames; ++i)
 			{
-				std::array<std::array<float, 2>, kMaxNumAllPassFilters> wetArray = m_prevWetArrayForFeedback;
+				// オールパスフィルタの係数は全段で共通のため、チャンネルごとに1回だけ計算する
+				std::array<detail::BiquadCoefficients<float>, 2> allPassCoefs;
+				std::array<float, 2> input = { 0.0f, 0.0f };
 				for (std::size_t channel = 0; channel < m_info.numChannels; ++channel)
 				{
 					const float lfoValue = detail::TriangleWithStereoWidth(m_lfoTimeRate, channel, params.stereoWidth);
 					const float freq = detail::InterpolateFreqInLog10ScaleWithPrecalculatedLog10(lfoValue, log10Freq1, log10Freq2);
-					for (std::size_t s = 0; s < kMaxNumAllPassFilters; ++s)
+					allPassCoefs[channel] = detail::BiquadCoefficients<float>::AllPassFilter(freq, params.q, m_info.sampleRateFloat);
+					input[channel] = pData[channel] + m_prevWetArrayForFeedback[kMaxNumAllPassFilters - 1U][channel] * params.feedback;
+				}
+
+				// 両チャンネルを同時に各段へ通す
+				std::array<std::array<float, 2>, kMaxNumAllPassFilters> wetArray;
+				for (std::size_t s = 0; s < kMaxNumAllPassFilters; ++s)
+				{
+					const std::array<float, 2>& stageInput = s == 0U ? input : wetArray[s - 1U];
+					if (s < stage)
 					{
-						const float input = s == 0U ? (*pData + m_prevWetArrayForFeedback[kMaxNumAllPassFilters - 1U][channel] * params.feedback) : wetArray[s - 1U][channel];
-						if (s < stage)
-						{
-							m_allPassFilters[s][channel].setAllPassFilter(freq, params.q, m_info.sampleRateFloat);
-							wetArray[s][channel] = m_allPassFilters[s][channel].process(input);
-						}
-						else
-						{
-							wetArray[s][channel] = input;
-						}
+						m_allPassFilters[s].setCoefficients(allPassCoefs[0], allPassCoefs[1]);
+						m_allPassFilters[s].processFrame(stageInput.data(), wetArray[s].data());
 					}
+					else
+					{
+						wetArray[s] = stageInput;
+					}
+				}
 
-					const float wetFiltered = m_hiCutFilters[channel].process(wetArray[kMaxNumAllPassFilters - 1U][channel]);
-					*pData = std::lerp(*pData, wetFiltered, params.mix / 2);
+				std::array<float, 2> wetFiltered;
+				m_hiCutFilter.processFrame(wetArray[kMaxNumAllPassFilters - 1U].data(), wetFiltered.data());
+				for (std::size_t channel = 0; channel < m_info.numChannels; ++channel)
+				{
+					*pData = std::lerp(*pData, wetFiltered[channel], params.mix / 2);
 					++pData;
 				}
 
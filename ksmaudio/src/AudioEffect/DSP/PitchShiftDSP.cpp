@@ -15,7 +15,6 @@ namespace ksmaudio::AudioEffect
 	PitchShiftDSP::PitchShiftDSP(const DSPCommonInfo& info)
 		: m_info(info)
 		, m_delayBuffer(info.numChannels)
-		, m_lowpassFilter(info.numChannels)
 	{
 		m_start = kDelayBufferMax - m_chunkSize;
 		m_prevStart = m_prevPrevStart = kDelayBufferMax - m_chunkSize - static_cast<std::size_t>(m_overlap * m_chunkSize);
@@ -59,23 +58,17 @@ namespace ksmaudio::AudioEffect
 			if (m_playSpeed > 1.0f)
 			{
 				const float cutoffFreq = m_info.sampleRateFloat / 2 / m_playSpeed * kLowpassCutoffCoeff;
-				for (std::size_t ch = 0; ch < m_lowpassFilter.size(); ++ch)
+				for (auto& filter : m_lowpassFilters)
 				{
-					for (std::size_t i = 0; i < kNumLowpassFilters; ++i)
-					{
-						m_lowpassFilter[ch][i].setLowPassFilter(cutoffFreq, 0.707f, m_info.sampleRateFloat);
-					}
+					filter.setCoefficients(detail::BiquadCoefficients<float>::LowPassFilter(cutoffFreq, 0.707f, m_info.sampleRateFloat));
 				}
 			}
 			else
 			{
 				const float cutoffFreq = m_info.sampleRateFloat * 0.5f * kLowpassCutoffCoeff;
-				for (std::size_t ch = 0; ch < m_lowpassFilter.size(); ++ch)
+				for (auto& filter : m_lowpassFilters)
 				{
-					for (std::size_t i = 0; i < kNumLowpassFilters; ++i)
-					{
-						m_lowpassFilter[ch][i].setLowPassFilter(cutoffFreq, 0.707f, m_info.sampleRateFloat);
-					}
+					filter.setCoefficients(detail::BiquadCoefficients<float>::LowPassFilter(cutoffFreq, 0.707f, m_info.sampleRateFloat));
 				}
 			}
 		}
@@ -87,21 +80,21 @@ namespace ksmaudio::AudioEffect
 		}
 
 		assert(m_delayBuffer.size() == m_info.numChannels);
-		assert(m_lowpassFilter.size() == m_info.numChannels);
 		for (std::size_t i = 0; i < numFrames; ++i)
 		{
-			for (std::size_t ch = 0; ch < m_info.numChannels; ++ch)
+			// ピッチを上げる場合、6次の急峻なLPF適用後の入力を使うことで折り返しノイズの発生を抑える
+			std::array<float, 2> inputFrame = { pData[0], m_info.numChannels == 2U ? pData[1] : 0.0f };
+			if (m_playSpeed > 1.0f)
 			{
-				// ピッチを上げる場合、6次の急峻なLPF適用後の入力を使うことで折り返しノイズの発生を抑える
-				float inputSample = *pData;
-				if (m_playSpeed > 1.0f)
+				for (auto& filter : m_lowpassFilters)
 				{
-					for (std::size_t i = 0; i < kNumLowpassFilters; ++i)
-					{
-						inputSample = m_lowpassFilter[ch][i].process(inputSample);
-					}
+					filter.processFrame(inputFrame.data(), inputFrame.data());
 				}
-				m_delayBuffer[ch][m_cursor] = inputSample;
+			}
+
+			for (std::size_t ch = 0; ch < m_info.numChannels; ++ch)
+			{
+				m_delayBuffer[ch][m_cursor] = inputFrame[ch];
 
 				const std::size_t countTimesPlaySpeed = static_cast<std::size_t>(m_count * m_playSpeed);
 				const std::size_t step = countTimesPlaySpeed % (m_chunkSize - overlapSample);
@@ -51,18 +51,10 @@ namespace ksmaudio::AudioEffect
             {
                 // Here, a fixed frequency is used to reduce computational costs
                 const float freq = WobbleFreq(m_triggerHandler.framesSincePrevTrigger(), numPeriodFrames, params.freq1, params.freq2);
-                for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
-                {
-                    m_lowPassFilters[ch].setLowPassFilter(freq, params.q, m_info.sampleRateFloat);
-                }
-                for (std::size_t i = 0U; i < frameSize; ++i)
-                {
-                    for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
-                    {
-                        m_lowPassFilters[ch].process(*pData);
-                        ++pData;
-                    }
-                }
+                m_lowPassFilter.setCoefficients(detail::BiquadCoefficients<float>::LowPassFilter(freq, params.q, m_info.sampleRateFloat));
+
+                // mixに0を指定してフィルタの状態のみ更新する
+                m_lowPassFilter.processBlock(pData, frameSize, m_info.numChannels, 0.0f);
             }
 
             return;
@@ -72,10 +64,14 @@ namespace ksmaudio::AudioEffect
         for (std::size_t i = 0U; i < frameSize; ++i)
         {
             const float freq = WobbleFreq(m_triggerHandler.framesSincePrevTrigger(), numPeriodFrames, params.freq1, params.freq2);
+            m_lowPassFilter.setCoefficients(detail::BiquadCoefficients<float>::LowPassFilter(freq, params.q, m_info.sampleRateFloat));
+
+            const std::array<float, 2> frame = { pData[0], m_info.numChannels == 2U ? pData[1] : 0.0f };
+            std::array<float, 2> wet;
+            m_lowPassFilter.processFrame(frame.data(), wet.data());
             for (std::size_t ch = 0U; ch < m_info.numChannels; ++ch)
             {
-                m_lowPassFilters[ch].setLowPassFilter(freq, params.q, m_info.sampleRateFloat);
-                *pData = m_lowPassFilters[ch].process(*pData);
+                *pData = wet[ch];
                 ++pData;
             }
             m_triggerHandler.advance();
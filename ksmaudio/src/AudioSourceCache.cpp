@@ -0,0 +1,292 @@
+﻿#include "ksmaudio/AudioSourceCache.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ksmaudio
+{
+	namespace
+	{
+		// 読み込み位置からこのサイズ先までを先読みする
+		constexpr std::uint64_t kReadAheadSize = 512 * 1024;
+
+		// 先読み済みの範囲の残りがこのサイズを下回ったら次を先読みする
+		constexpr std::uint64_t kReadAheadThreshold = kReadAheadSize / 2;
+
+		// ストリームの作成時(ヘッダの解析時)に先読みするサイズ
+		constexpr std::uint64_t kInitialPrefetchSize = 256 * 1024;
+
+		std::size_t PageSize()
+		{
+#ifdef _WIN32
+			SYSTEM_INFO systemInfo;
+			GetSystemInfo(&systemInfo);
+			return static_cast<std::size_t>(systemInfo.dwPageSize);
+#else
+			return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+		}
+
+		// Readerの寿命はStreamが管理するため、BASSからのclose呼び出しでは何もしない
+		void CALLBACK FileCloseProc(void*)
+		{
+		}
+
+		QWORD CALLBACK FileLenProc(void* user)
+		{
+			return static_cast<QWORD>(static_cast<AudioSourceReader*>(user)->length());
+		}
+
+		DWORD CALLBACK FileReadProc(void* buffer, DWORD length, void* user)
+		{
+			return static_cast<DWORD>(static_cast<AudioSourceReader*>(user)->read(buffer, static_cast<std::size_t>(length)));
+		}
+
+		BOOL CALLBACK FileSeekProc(QWORD offset, void* user)
+		{
+			return static_cast<AudioSourceReader*>(user)->seek(static_cast<std::uint64_t>(offset)) ? TRUE : FALSE;
+		}
+
+		constexpr BASS_FILEPROCS kFileProcs{ FileCloseProc, FileLenProc, FileReadProc, FileSeekProc };
+
+		std::string CacheKey(const std::string& filePath)
+		{
+			std::error_code ec;
+			const std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(std::filesystem::path(filePath), ec);
+			if (ec)
+			{
+				return filePath;
+			}
+			return canonicalPath.string();
+		}
+
+		std::mutex s_cacheMutex;
+		std::unordered_map<std::string, std::weak_ptr<const MappedAudioFile>> s_cache;
+	}
+
+	std::unique_ptr<MappedAudioFile> MappedAudioFile::Open(const std::string& filePath)
+	{
+		std::unique_ptr<MappedAudioFile> file(new MappedAudioFile());
+
+#ifdef _WIN32
+		const HANDLE hFile = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+		file->m_hFile = hFile;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart <= 0)
+		{
+			return nullptr;
+		}
+		file->m_size = static_cast<std::uint64_t>(fileSize.QuadPart);
+
+		const HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (hMapping == nullptr)
+		{
+			return nullptr;
+		}
+		file->m_hMapping = hMapping;
+
+		const void* pData = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+		if (pData == nullptr)
+		{
+			return nullptr;
+		}
+		file->m_pData = static_cast<const std::byte*>(pData);
+#else
+		const int fd = open(filePath.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size <= 0)
+		{
+			close(fd);
+			return nullptr;
+		}
+
+		// マッピングはファイルディスクリプタを閉じた後も有効
+		void* pData = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if (pData == MAP_FAILED)
+		{
+			return nullptr;
+		}
+		file->m_pData = static_cast<const std::byte*>(pData);
+		file->m_size = static_cast<std::uint64_t>(st.st_size);
+#endif
+
+		return file;
+	}
+
+	MappedAudioFile::~MappedAudioFile()
+	{
+#ifdef _WIN32
+		if (m_pData != nullptr)
+		{
+			UnmapViewOfFile(m_pData);
+		}
+		if (m_hMapping != nullptr)
+		{
+			CloseHandle(m_hMapping);
+		}
+		if (m_hFile != nullptr)
+		{
+			CloseHandle(m_hFile);
+		}
+#else
+		if (m_pData != nullptr)
+		{
+			munmap(const_cast<std::byte*>(m_pData), static_cast<std::size_t>(m_size));
+		}
+#endif
+	}
+
+	const std::byte* MappedAudioFile::data() const
+	{
+		return m_pData;
+	}
+
+	std::uint64_t MappedAudioFile::size() const
+	{
+		return m_size;
+	}
+
+	void MappedAudioFile::prefetch(std::uint64_t offset, std::uint64_t size) const
+	{
+		if (offset >= m_size || size == 0)
+		{
+			return;
+		}
+
+		// ページ境界に揃える
+		static const std::size_t pageSize = PageSize();
+		const std::uint64_t begin = offset - offset % pageSize;
+		const std::uint64_t end = std::min(offset + size, m_size);
+
+#ifdef _WIN32
+		WIN32_MEMORY_RANGE_ENTRY range{ const_cast<std::byte*>(m_pData + begin), static_cast<SIZE_T>(end - begin) };
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+		madvise(const_cast<std::byte*>(m_pData + begin), static_cast<std::size_t>(end - begin), MADV_WILLNEED);
+#endif
+	}
+
+	AudioSourceReader::AudioSourceReader(std::shared_ptr<const MappedAudioFile> file)
+		: m_file(std::move(file))
+	{
+	}
+
+	HSTREAM AudioSourceReader::createStream(DWORD flags)
+	{
+		m_pos = 0;
+		m_file->prefetch(0, kInitialPrefetchSize);
+		m_prefetchedEnd = kInitialPrefetchSize;
+		return BASS_StreamCreateFileUser(STREAMFILE_NOBUFFER, flags, &kFileProcs, this);
+	}
+
+	std::size_t AudioSourceReader::read(void* pBuffer, std::size_t length)
+	{
+		const std::uint64_t fileSize = m_file->size();
+		if (m_pos >= fileSize)
+		{
+			return 0U;
+		}
+
+		// 先読み済みの範囲の残りが少なくなったら、その続きを先読みする
+		if (m_prefetchedEnd < m_pos + length + kReadAheadThreshold)
+		{
+			const std::uint64_t prefetchBegin = std::max(m_pos, m_prefetchedEnd);
+			const std::uint64_t prefetchEnd = m_pos + length + kReadAheadSize;
+			m_file->prefetch(prefetchBegin, prefetchEnd - prefetchBegin);
+			m_prefetchedEnd = prefetchEnd;
+		}
+
+		const std::size_t readSize = static_cast<std::size_t>(std::min<std::uint64_t>(length, fileSize - m_pos));
+		std::memcpy(pBuffer, m_file->data() + m_pos, readSize);
+		m_pos += readSize;
+		return readSize;
+	}
+
+	bool AudioSourceReader::seek(std::uint64_t offset)
+	{
+		if (offset > m_file->size())
+		{
+			return false;
+		}
+		m_pos = offset;
+
+		// シーク先から先読みし直す
+		m_prefetchedEnd = offset;
+		return true;
+	}
+
+	std::uint64_t AudioSourceReader::length() const
+	{
+		return m_file->size();
+	}
+
+	std::uint64_t AudioSourceReader::position() const
+	{
+		return m_pos;
+	}
+
+	const MappedAudioFile& AudioSourceReader::file() const
+	{
+		return *m_file;
+	}
+
+	namespace AudioSourceCache
+	{
+		std::shared_ptr<const MappedAudioFile> Open(const std::string& filePath)
+		{
+			const std::string key = CacheKey(filePath);
+
+			const std::lock_guard lock(s_cacheMutex);
+
+			// 使用されなくなったファイルのエントリを削除
+			std::erase_if(s_cache, [](const auto& pair) { return pair.second.expired(); });
+
+			if (const auto it = s_cache.find(key); it != s_cache.end())
+			{
+				if (auto file = it->second.lock())
+				{
+					return file;
+				}
+			}
+
+			std::shared_ptr<const MappedAudioFile> file = MappedAudioFile::Open(filePath);
+			if (file == nullptr)
+			{
+				return nullptr;
+			}
+			s_cache[key] = file;
+			return file;
+		}
+
+		std::size_t NumOpenFiles()
+		{
+			const std::lock_guard lock(s_cacheMutex);
+			return static_cast<std::size_t>(std::count_if(s_cache.begin(), s_cache.end(), [](const auto& pair) { return !pair.second.expired(); }));
+		}
+	}
+}
@@ -0,0 +1,69 @@
+﻿#include "ksmaudio/OfflineRender.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace ksmaudio
+{
+	namespace
+	{
+		template <typename StreamType>
+		std::optional<std::size_t> RenderToWavFileImpl(const StreamType& stream, const std::string& filePath, const OfflineRenderOptions& options, const OfflineRenderBlockCallback& onBlock)
+		{
+			if (!stream.isDecodeOnly() || stream.numChannels() == 0U || options.blockFrames == 0U)
+			{
+				return std::nullopt;
+			}
+
+			WavFileWriter writer(filePath, stream.sampleRate(), stream.numChannels(), options.format);
+			if (!writer.isOpen())
+			{
+				return std::nullopt;
+			}
+
+			std::optional<std::size_t> maxFrames = std::nullopt;
+			if (options.maxDuration.has_value())
+			{
+				// 切り捨てると浮動小数点誤差でmaxDurationより1フレーム短くなる場合があるため四捨五入する
+				maxFrames = static_cast<std::size_t>(std::llround(options.maxDuration->count() * static_cast<double>(stream.sampleRate())));
+			}
+
+			std::vector<float> buffer(options.blockFrames * stream.numChannels());
+			std::size_t totalFrames = 0U;
+			while (!maxFrames.has_value() || totalFrames < *maxFrames)
+			{
+				if (onBlock)
+				{
+					onBlock(stream.posSec());
+				}
+
+				const std::size_t requestFrames = maxFrames.has_value() ? std::min(options.blockFrames, *maxFrames - totalFrames) : options.blockFrames;
+				const std::size_t renderedFrames = stream.render(buffer.data(), requestFrames);
+				writer.write(buffer.data(), renderedFrames);
+				totalFrames += renderedFrames;
+
+				if (renderedFrames < requestFrames)
+				{
+					// 曲の終端に達した
+					break;
+				}
+			}
+
+			if (!writer.close())
+			{
+				return std::nullopt;
+			}
+			return totalFrames;
+		}
+	}
+
+	std::optional<std::size_t> RenderToWavFile(const Stream& stream, const std::string& filePath, const OfflineRenderOptions& options, const OfflineRenderBlockCallback& onBlock)
+	{
+		return RenderToWavFileImpl(stream, filePath, options, onBlock);
+	}
+
+	std::optional<std::size_t> RenderToWavFile(const StreamWithEffects& stream, const std::string& filePath, const OfflineRenderOptions& options, const OfflineRenderBlockCallback& onBlock)
+	{
+		return RenderToWavFileImpl(stream, filePath, options, onBlock);
+	}
+}
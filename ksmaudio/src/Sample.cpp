@@ -1,5 +1,7 @@
 ﻿#include "ksmaudio/Sample.hpp"
 #include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <utility>
 
 namespace
@@ -9,12 +11,64 @@ namespace
 		assert(1 <= maxPolyphony && maxPolyphony <= 65535);
 		return BASS_SampleLoad(FALSE, filePath.c_str(), 0, 0, maxPolyphony, BASS_SAMPLE_OVER_POS);
 	}
+
+	std::shared_ptr<const ksmaudio::SamplePCM> CreateSamplePCM(HSAMPLE hSample)
+	{
+		if (hSample == 0)
+		{
+			return nullptr;
+		}
+
+		BASS_SAMPLE info;
+		if (!BASS_SampleGetInfo(hSample, &info) || info.chans == 0)
+		{
+			return nullptr;
+		}
+
+		std::vector<char> bytes(info.length);
+		if (!bytes.empty() && !BASS_SampleGetData(hSample, bytes.data()))
+		{
+			return nullptr;
+		}
+
+		// サンプルの形式によらずfloatに変換して保持する
+		auto pcm = std::make_shared<ksmaudio::SamplePCM>();
+		pcm->sampleRate = static_cast<std::size_t>(info.freq);
+		pcm->numChannels = static_cast<std::size_t>(info.chans);
+		if (info.flags & BASS_SAMPLE_FLOAT)
+		{
+			pcm->data.resize(bytes.size() / sizeof(float));
+			std::memcpy(pcm->data.data(), bytes.data(), pcm->data.size() * sizeof(float));
+		}
+		else if (info.flags & BASS_SAMPLE_8BITS)
+		{
+			pcm->data.resize(bytes.size());
+			for (std::size_t i = 0U; i < bytes.size(); ++i)
+			{
+				// 8bitの場合は符号なし
+				pcm->data[i] = (static_cast<float>(static_cast<std::uint8_t>(bytes[i])) - 128.0f) / 128.0f;
+			}
+		}
+		else
+		{
+			pcm->data.resize(bytes.size() / sizeof(std::int16_t));
+			for (std::size_t i = 0U; i < pcm->data.size(); ++i)
+			{
+				std::int16_t value;
+				std::memcpy(&value, bytes.data() + i * sizeof(std::int16_t), sizeof(std::int16_t));
+				pcm->data[i] = static_cast<float>(value) / 32768.0f;
+			}
+		}
+		return pcm;
+	}
 }
 
 namespace ksmaudio
 {
 	Sample::Sample(const std::string& filePath, DWORD maxPolyphony)
 		: m_hSample(LoadSample(filePath, maxPolyphony))
+		, m_maxPolyphony(maxPolyphony)
+		, m_pcm(CreateSamplePCM(m_hSample))
 	{
 	}
 
@@ -28,6 +82,8 @@ namespace ksmaudio
 
 	Sample::Sample(Sample&& other) noexcept
 		: m_hSample(std::exchange(other.m_hSample, 0))
+		, m_maxPolyphony(other.m_maxPolyphony)
+		, m_pcm(std::move(other.m_pcm))
 	{
 	}
 
@@ -40,6 +96,8 @@ namespace ksmaudio
 				BASS_SampleFree(m_hSample);
 			}
 			m_hSample = std::exchange(other.m_hSample, 0);
+			m_maxPolyphony = other.m_maxPolyphony;
+			m_pcm = std::move(other.m_pcm);
 		}
 		return *this;
 	}
@@ -58,4 +116,14 @@ namespace ksmaudio
 		BASS_ChannelSetAttribute(hChannel, BASS_ATTRIB_VOL, static_cast<float>(volume));
 		BASS_ChannelPlay(hChannel, TRUE);
 	}
+
+	DWORD Sample::maxPolyphony() const
+	{
+		return m_maxPolyphony;
+	}
+
+	const std::shared_ptr<const SamplePCM>& Sample::pcm() const
+	{
+		return m_pcm;
+	}
 }
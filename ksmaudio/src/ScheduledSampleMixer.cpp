@@ -0,0 +1,218 @@
+﻿#include "ksmaudio/ScheduledSampleMixer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace ksmaudio
+{
+	void ScheduledSampleMixer::receiveEvents()
+	{
+		// 予約を開始位置の順に並べる(同じ開始位置の場合は予約した順)
+		Event event;
+		while (m_queue.tryPop(&event))
+		{
+			if (m_numPendingEvents >= kMaxPendingEvents)
+			{
+				continue;
+			}
+
+			const auto begin = m_pendingEvents.begin();
+			const auto end = begin + m_numPendingEvents;
+			const auto itr = std::upper_bound(begin, end, event.startFrameIdx, [](std::int64_t frameIdx, const Event& e) { return frameIdx < e.startFrameIdx; });
+			std::move_backward(itr, end, end + 1);
+			*itr = std::move(event);
+			++m_numPendingEvents;
+		}
+	}
+
+	void ScheduledSampleMixer::startVoice(const Event& event, std::size_t offset)
+	{
+		// 同じ効果音の最大同時再生数を超える場合は最も古いものを止める(BASS_SAMPLE_OVER_POSと同様)
+		std::size_t numSameVoices = 0U;
+		Voice* pOldestSameVoice = nullptr;
+		Voice* pOldestVoice = nullptr;
+		Voice* pFreeVoice = nullptr;
+		for (Voice& voice : m_voices)
+		{
+			if (!voice.isActive)
+			{
+				if (pFreeVoice == nullptr)
+				{
+					pFreeVoice = &voice;
+				}
+				continue;
+			}
+
+			if (voice.endOffset != SIZE_MAX)
+			{
+				// このブロック内で止まる
+				continue;
+			}
+
+			if (pOldestVoice == nullptr || voice.startFrameIdx < pOldestVoice->startFrameIdx)
+			{
+				pOldestVoice = &voice;
+			}
+
+			if (voice.pcm == event.pcm)
+			{
+				++numSameVoices;
+				if (pOldestSameVoice == nullptr || voice.startFrameIdx < pOldestSameVoice->startFrameIdx)
+				{
+					pOldestSameVoice = &voice;
+				}
+			}
+		}
+
+		if (numSameVoices >= event.maxPolyphony && pOldestSameVoice != nullptr)
+		{
+			// 新しい効果音が鳴り始める位置まで鳴らす
+			pOldestSameVoice->endOffset = offset;
+		}
+
+		if (pFreeVoice == nullptr)
+		{
+			if (pOldestVoice == nullptr)
+			{
+				return;
+			}
+
+			// 空きがない場合は最も古いものを即座に止めて置き換える
+			pFreeVoice = pOldestVoice;
+		}
+
+		const SamplePCM& pcm = *event.pcm;
+		*pFreeVoice = Voice{
+			.pcm = event.pcm,
+			.isActive = true,
+			.startFrameIdx = event.startFrameIdx,
+			.volume = event.volume,
+			.srcPos = 0.0,
+			.srcStep = static_cast<double>(pcm.sampleRate) / static_cast<double>(m_sampleRate),
+			.beginOffset = offset,
+			.endOffset = SIZE_MAX,
+		};
+	}
+
+	ScheduledSampleMixer::ScheduledSampleMixer(std::size_t sampleRate, std::size_t numChannels, double playbackSpeed, std::int64_t frameIdx)
+		: m_sampleRate(sampleRate)
+		, m_numChannels(numChannels)
+		, m_frameIdxPerOutputFrame(playbackSpeed)
+		, m_frameIdx(static_cast<double>(frameIdx))
+	{
+	}
+
+	bool ScheduledSampleMixer::schedule(const Sample& sample, std::int64_t startFrameIdx, double volume)
+	{
+		if (sample.pcm() == nullptr || sample.pcm()->numFrames() == 0U)
+		{
+			return false;
+		}
+
+		return m_queue.tryPush(Event{
+			.pcm = sample.pcm(),
+			.startFrameIdx = startFrameIdx,
+			.volume = static_cast<float>(volume),
+			.maxPolyphony = static_cast<std::size_t>(sample.maxPolyphony()),
+		});
+	}
+
+	void ScheduledSampleMixer::seek(std::int64_t frameIdx)
+	{
+		m_frameIdx = static_cast<double>(frameIdx);
+	}
+
+	void ScheduledSampleMixer::process(float* pData, std::size_t dataSize)
+	{
+		const std::size_t numFrames = m_numChannels == 0U ? 0U : dataSize / m_numChannels;
+		if (numFrames == 0U || m_frameIdxPerOutputFrame <= 0.0)
+		{
+			return;
+		}
+
+		receiveEvents();
+
+		// このブロックの範囲内に開始位置がある予約を鳴らし始める
+		const double blockStartFrameIdx = m_frameIdx;
+		const double blockEndFrameIdx = m_frameIdx + static_cast<double>(numFrames) * m_frameIdxPerOutputFrame;
+		const double maxLateFrames = kMaxLateSec * static_cast<double>(m_sampleRate) * m_frameIdxPerOutputFrame;
+		std::size_t numStartedEvents = 0U;
+		for (; numStartedEvents < m_numPendingEvents; ++numStartedEvents)
+		{
+			const Event& event = m_pendingEvents[numStartedEvents];
+			const double startFrameIdx = static_cast<double>(event.startFrameIdx);
+			if (startFrameIdx >= blockEndFrameIdx)
+			{
+				break;
+			}
+
+			if (startFrameIdx < blockStartFrameIdx - maxLateFrames)
+			{
+				continue;
+			}
+
+			std::size_t offset = 0U;
+			if (startFrameIdx > blockStartFrameIdx)
+			{
+				offset = std::min(static_cast<std::size_t>(std::ceil((startFrameIdx - blockStartFrameIdx) / m_frameIdxPerOutputFrame)), numFrames - 1U);
+			}
+			startVoice(event, offset);
+		}
+		std::move(m_pendingEvents.begin() + numStartedEvents, m_pendingEvents.begin() + m_numPendingEvents, m_pendingEvents.begin());
+		for (std::size_t i = m_numPendingEvents - numStartedEvents; i < m_numPendingEvents; ++i)
+		{
+			m_pendingEvents[i] = Event{};
+		}
+		m_numPendingEvents -= numStartedEvents;
+
+		// 効果音を加算
+		for (Voice& voice : m_voices)
+		{
+			if (!voice.isActive)
+			{
+				continue;
+			}
+
+			const SamplePCM& pcm = *voice.pcm;
+			const std::size_t srcNumChannels = pcm.numChannels;
+			const std::size_t srcNumFrames = pcm.numFrames();
+			const std::size_t endOffset = std::min(voice.endOffset, numFrames);
+			for (std::size_t i = voice.beginOffset; i < endOffset; ++i)
+			{
+				const std::size_t srcIdx = static_cast<std::size_t>(voice.srcPos);
+				if (srcIdx >= srcNumFrames)
+				{
+					voice.isActive = false;
+					break;
+				}
+
+				// サンプリング周波数が異なる場合は線形補間する
+				// (チャンネル数が異なる場合、モノラルの効果音は全チャンネルに同じ値を加算する)
+				const float t = static_cast<float>(voice.srcPos - static_cast<double>(srcIdx));
+				const std::size_t nextSrcIdx = std::min(srcIdx + 1U, srcNumFrames - 1U);
+				float* pFrame = pData + i * m_numChannels;
+				for (std::size_t ch = 0U; ch < m_numChannels; ++ch)
+				{
+					const std::size_t srcCh = ch % srcNumChannels;
+					const float v0 = pcm.data[srcIdx * srcNumChannels + srcCh];
+					const float v1 = pcm.data[nextSrcIdx * srcNumChannels + srcCh];
+					pFrame[ch] += (t == 0.0f ? v0 : v0 + (v1 - v0) * t) * voice.volume;
+				}
+				voice.srcPos += voice.srcStep;
+			}
+
+			if (voice.endOffset != SIZE_MAX || static_cast<std::size_t>(voice.srcPos) >= srcNumFrames)
+			{
+				voice.isActive = false;
+			}
+			voice.beginOffset = 0U;
+		}
+
+		m_frameIdx = blockEndFrameIdx;
+	}
+
+	std::int64_t ScheduledSampleMixer::secToFrameIdx(double sec) const
+	{
+		return static_cast<std::int64_t>(std::llround(sec * static_cast<double>(m_sampleRate)));
+	}
+}
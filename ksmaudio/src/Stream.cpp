@@ -1,5 +1,6 @@
 ﻿#include "ksmaudio/Stream.hpp"
-#include <fstream>
+#include <cassert>
+#include <cmath>
 #include <optional>
 #include "ksmaudio/ksmaudio.hpp"
 
@@ -29,38 +30,47 @@ namespace
 	constexpr int kCompressorFXPriority = 0;
 	constexpr int kVolumeFXPriority = 10;
 
-	std::unique_ptr<std::vector<char>> Preload(const std::string& filePath)
+	// 効果音のミキサーは全てのエフェクトの後に適用する
+	// (ストリームの音量はミキサーの直前に適用し、効果音にはかけない)
+	constexpr int kScheduledSampleMixerPriority = -10;
+	constexpr int kScheduledSampleMixerVolumePriority = kScheduledSampleMixerPriority + 1;
+
+	std::unique_ptr<ksmaudio::AudioSourceReader> OpenSourceReader(const std::string& filePath, bool preload)
 	{
-		std::ifstream ifs(filePath, std::ios::in | std::ios::binary);
-		if (!ifs)
+		if (!preload)
+		{
+			return nullptr;
+		}
+
+		auto file = ksmaudio::AudioSourceCache::Open(filePath);
+		if (file == nullptr)
 		{
 			return nullptr;
 		}
-		ifs.seekg(0, std::ios::end);
-		const std::size_t fileSize = static_cast<std::size_t>(ifs.tellg());
-		auto binary = std::make_unique<std::vector<char>>(fileSize);
-		ifs.seekg(0, std::ios::beg);
-		ifs.read(binary->data(), fileSize);
-		return binary;
+		return std::make_unique<ksmaudio::AudioSourceReader>(std::move(file));
 	}
 
-	HSTREAM LoadStream(const std::string& filePath, const std::vector<char>* pPreloadedBinary, bool loop, bool forTempo)
+	HSTREAM LoadStream(const std::string& filePath, ksmaudio::AudioSourceReader* pSourceReader, bool loop, bool forTempo, bool decodeOnly)
 	{
 		const DWORD loopFlag = loop ? BASS_SAMPLE_LOOP : 0;
-		const DWORD decodeFlag = forTempo ? BASS_STREAM_DECODE : 0;
-		if (pPreloadedBinary == nullptr)
+		const DWORD decodeFlag = (forTempo || decodeOnly) ? BASS_STREAM_DECODE : 0;
+
+		// デコード専用の場合はrender()で取り出す値がエフェクト処理後の値と一致するようにfloatでデコードする
+		const DWORD floatFlag = decodeOnly ? BASS_SAMPLE_FLOAT : 0;
+
+		if (pSourceReader == nullptr)
 		{
-			return BASS_StreamCreateFile(FALSE, filePath.c_str(), 0, 0, BASS_STREAM_PRESCAN | loopFlag | decodeFlag);
+			return BASS_StreamCreateFile(FALSE, filePath.c_str(), 0, 0, BASS_STREAM_PRESCAN | loopFlag | decodeFlag | floatFlag);
 		}
 		else
 		{
-			return BASS_StreamCreateFile(TRUE, pPreloadedBinary->data(), 0, static_cast<QWORD>(pPreloadedBinary->size()), BASS_STREAM_PRESCAN | loopFlag | decodeFlag);
+			return pSourceReader->createStream(BASS_STREAM_PRESCAN | loopFlag | decodeFlag | floatFlag);
 		}
 	}
 
-	HSTREAM CreateTempoStream(HSTREAM hSourceStream, double playbackSpeed)
+	HSTREAM CreateTempoStream(HSTREAM hSourceStream, double playbackSpeed, bool decodeOnly)
 	{
-		HSTREAM hTempoStream = BASS_FX_TempoCreate(hSourceStream, 0);
+		HSTREAM hTempoStream = BASS_FX_TempoCreate(hSourceStream, decodeOnly ? BASS_STREAM_DECODE : 0);
 		const double tempo = (playbackSpeed - 1.0) * 100.0;
 		BASS_ChannelSetAttribute(hTempoStream, BASS_ATTRIB_TEMPO, static_cast<float>(tempo));
 		return hTempoStream;
@@ -79,39 +89,48 @@ namespace
 		const auto pData = reinterpret_cast<float*>(buffer);
 		pAudioEffect->process(pData, length / sizeof(float));
 	}
+
+	void ProcessScheduledSampleMixer(HDSP handle, DWORD channel, void* buffer, DWORD length, void* user)
+	{
+		const auto pMixer = reinterpret_cast<ksmaudio::ScheduledSampleMixer*>(user);
+		const auto pData = reinterpret_cast<float*>(buffer);
+		pMixer->process(pData, length / sizeof(float));
+	}
 }
 
 namespace ksmaudio
 {
 	namespace
 	{
-		std::optional<HSTREAM> CreateSourceStream(const std::vector<char>* pPreloadedBinary, const std::string& filePath, bool loop, double playbackSpeed)
+		std::optional<HSTREAM> CreateSourceStream(AudioSourceReader* pSourceReader, const std::string& filePath, bool loop, double playbackSpeed, bool decodeOnly)
 		{
 			if (playbackSpeed != 1.0)
 			{
-				return LoadStream(filePath, pPreloadedBinary, loop, true);
+				return LoadStream(filePath, pSourceReader, loop, true, decodeOnly);
 			}
 			return std::nullopt;
 		}
 
-		HSTREAM CreateMainStream(std::optional<HSTREAM> hStreamSource, const std::vector<char>* pPreloadedBinary, const std::string& filePath, bool loop, double playbackSpeed)
+		HSTREAM CreateMainStream(std::optional<HSTREAM> hStreamSource, AudioSourceReader* pSourceReader, const std::string& filePath, bool loop, double playbackSpeed, bool decodeOnly)
 		{
 			if (hStreamSource.has_value())
 			{
-				return CreateTempoStream(hStreamSource.value(), playbackSpeed);
+				return CreateTempoStream(hStreamSource.value(), playbackSpeed, decodeOnly);
 			}
-			return LoadStream(filePath, pPreloadedBinary, loop, false);
+			return LoadStream(filePath, pSourceReader, loop, false, decodeOnly);
 		}
 	}
 
-	Stream::Stream(const std::string& filePath, double volume, bool enableCompressor, bool preload, bool loop, double playbackSpeed)
-		: m_preloadedBinary(preload ? Preload(filePath) : nullptr)
-		, m_hStreamSource(CreateSourceStream(m_preloadedBinary.get(), filePath, loop, playbackSpeed))
-		, m_hStream(CreateMainStream(m_hStreamSource, m_preloadedBinary.get(), filePath, loop, playbackSpeed))
+	Stream::Stream(const std::string& filePath, double volume, bool enableCompressor, bool preload, bool loop, double playbackSpeed, bool decodeOnly)
+		: m_sourceReader(OpenSourceReader(filePath, preload))
+		, m_hStreamSource(CreateSourceStream(m_sourceReader.get(), filePath, loop, playbackSpeed, decodeOnly))
+		, m_hStream(CreateMainStream(m_hStreamSource, m_sourceReader.get(), filePath, loop, playbackSpeed, decodeOnly))
 		, m_playbackSpeed(playbackSpeed)
 		, m_info(GetChannelInfo(m_hStream))
 		, m_volume(volume)
 		, m_muted(false)
+		, m_decodeOnly(decodeOnly)
+		, m_volumeAttrib(BASS_ATTRIB_VOL)
 	{
 		// 音量を設定
 		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOL, static_cast<float>(volume));
@@ -156,6 +175,36 @@ namespace ksmaudio
 		BASS_ChannelUpdate(m_hStream, 0);
 	}
 
+	std::size_t Stream::render(float* pBuffer, std::size_t numFrames) const
+	{
+		if (!m_decodeOnly || m_info.chans == 0)
+		{
+			assert(false && "Stream::render() is only available for decode-only streams");
+			return 0U;
+		}
+
+		// BASS_ChannelGetDataはデコード専用チャンネルに対してDSP(音声エフェクト)を適用した結果を返す
+		// 要求より少ないバイト数が返る場合があるため、終端に達するまで繰り返し取り出す
+		const std::size_t frameBytes = sizeof(float) * m_info.chans;
+		const std::size_t totalBytes = numFrames * frameBytes;
+		std::size_t readBytes = 0U;
+		while (readBytes < totalBytes)
+		{
+			const DWORD result = BASS_ChannelGetData(m_hStream, reinterpret_cast<char*>(pBuffer) + readBytes, static_cast<DWORD>(totalBytes - readBytes) | BASS_DATA_FLOAT);
+			if (result == static_cast<DWORD>(-1) || result == 0)
+			{
+				break;
+			}
+			readBytes += result;
+		}
+		return readBytes / frameBytes;
+	}
+
+	bool Stream::isDecodeOnly() const
+	{
+		return m_decodeOnly;
+	}
+
 	SecondsF Stream::posSec() const
 	{
 		if (m_playbackSpeed == 0.0)
@@ -169,7 +218,17 @@ namespace ksmaudio
 	void Stream::seekPosSec(SecondsF time) const
 	{
 		const double scaledTime = time.count() * m_playbackSpeed;
+		if (m_scheduledSampleMixer == nullptr)
+		{
+			BASS_ChannelSetPosition(m_hStream, BASS_ChannelSeconds2Bytes(m_hStream, scaledTime), BASS_POS_BYTE);
+			return;
+		}
+
+		// ミキサーの処理と同時に再生位置を変更しないようロックする
+		lockBegin();
 		BASS_ChannelSetPosition(m_hStream, BASS_ChannelSeconds2Bytes(m_hStream, scaledTime), BASS_POS_BYTE);
+		m_scheduledSampleMixer->seek(m_scheduledSampleMixer->secToFrameIdx(time.count()));
+		lockEnd();
 	}
 
 	Duration Stream::duration() const
@@ -192,11 +251,44 @@ namespace ksmaudio
 		BASS_ChannelRemoveDSP(m_hStream, hDSP);
 	}
 
+	void Stream::enableScheduledSampleMixer()
+	{
+		if (m_scheduledSampleMixer != nullptr || m_info.chans == 0)
+		{
+			return;
+		}
+
+		// BASS_ATTRIB_VOLはDSPの後に適用されるため、代わりにミキサーの直前のDSPで音量を適用する
+		// (スライド中の音量は引き継がない)
+		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOLDSP_PRIORITY, static_cast<float>(kScheduledSampleMixerVolumePriority));
+		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOLDSP, m_muted ? 0.0f : static_cast<float>(m_volume));
+		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOL, 1.0f);
+		m_volumeAttrib = BASS_ATTRIB_VOLDSP;
+
+		const auto frameIdx = static_cast<std::int64_t>(std::llround(posSec().count() * static_cast<double>(sampleRate())));
+		m_scheduledSampleMixer = std::make_unique<ScheduledSampleMixer>(sampleRate(), numChannels(), m_playbackSpeed, frameIdx);
+		BASS_ChannelSetDSP(m_hStream, ProcessScheduledSampleMixer, m_scheduledSampleMixer.get(), kScheduledSampleMixerPriority);
+	}
+
+	bool Stream::hasScheduledSampleMixer() const
+	{
+		return m_scheduledSampleMixer != nullptr;
+	}
+
+	bool Stream::scheduleSample(const Sample& sample, SecondsF timeSec, double volume) const
+	{
+		if (m_scheduledSampleMixer == nullptr)
+		{
+			return false;
+		}
+		return m_scheduledSampleMixer->schedule(sample, m_scheduledSampleMixer->secToFrameIdx(timeSec.count()), volume);
+	}
+
 	void Stream::setFadeIn(Duration duration) const
 	{
 		// 音量を0からm_volumeまでdurationSec秒かけて推移させる
-		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOL, 0.0f);
-		BASS_ChannelSlideAttribute(m_hStream, BASS_ATTRIB_VOL, static_cast<float>(m_volume), static_cast<DWORD>(duration.count() * 1000));
+		BASS_ChannelSetAttribute(m_hStream, m_volumeAttrib, 0.0f);
+		BASS_ChannelSlideAttribute(m_hStream, m_volumeAttrib, static_cast<float>(m_volume), static_cast<DWORD>(duration.count() * 1000));
 	}
 
 	void Stream::setFadeIn(Duration duration, double volume)
@@ -208,8 +300,8 @@ namespace ksmaudio
 	void Stream::setFadeOut(Duration duration) const
 	{
 		// 音量をm_volumeから0までdurationSec秒かけて推移させる
-		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOL, static_cast<float>(m_volume));
-		BASS_ChannelSlideAttribute(m_hStream, BASS_ATTRIB_VOL, 0.0f, static_cast<DWORD>(duration.count() * 1000));
+		BASS_ChannelSetAttribute(m_hStream, m_volumeAttrib, static_cast<float>(m_volume));
+		BASS_ChannelSlideAttribute(m_hStream, m_volumeAttrib, 0.0f, static_cast<DWORD>(duration.count() * 1000));
 	}
 
 	void Stream::setFadeOut(Duration duration, double volume)
@@ -226,7 +318,7 @@ namespace ksmaudio
 
 	bool Stream::isFading() const
 	{
-		return BASS_ChannelIsSliding(m_hStream, BASS_ATTRIB_VOL);
+		return BASS_ChannelIsSliding(m_hStream, m_volumeAttrib);
 	}
 
 	void Stream::setVolume(double volume)
@@ -234,7 +326,7 @@ namespace ksmaudio
 		m_volume = volume;
 		if (!m_muted)
 		{
-			BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOL, static_cast<float>(volume));
+			BASS_ChannelSetAttribute(m_hStream, m_volumeAttrib, static_cast<float>(volume));
 		}
 	}
 
@@ -251,7 +343,7 @@ namespace ksmaudio
 	void Stream::setMuted(bool muted)
 	{
 		m_muted = muted;
-		BASS_ChannelSetAttribute(m_hStream, BASS_ATTRIB_VOL, muted ? 0.0f : static_cast<float>(m_volume));
+		BASS_ChannelSetAttribute(m_hStream, m_volumeAttrib, muted ? 0.0f : static_cast<float>(m_volume));
 	}
 
 	std::size_t Stream::sampleRate() const
@@ -266,9 +358,15 @@ namespace ksmaudio
 
 	SecondsF Stream::latency() const
 	{
+		// デコード専用の場合は再生バッファを持たないため遅延はない
+		if (m_decodeOnly)
+		{
+			return SecondsF{ 0.0 };
+		}
+
 #if defined(_WIN32)
 		// Windowsの場合はBASS_DATA_AVAILABLEで取得される値の変動が大きいため、バッファサイズを定数で返した方が音声エフェクトのタイミング計算が安定する
-		return SecondsF{ kBufferSizeMs / 1000.0f };
+		return SecondsF{ BASS_GetConfig(BASS_CONFIG_BUFFER) / 1000.0 };
 #else
 		// Linux/macOSの場合はBASS_DATA_AVAILABLEで取得される値がバッファサイズと異なるため、取得したものを返す
 		DWORD playbuf = BASS_ChannelGetData(m_hStream, NULL, BASS_DATA_AVAILABLE);
@@ -276,7 +374,7 @@ namespace ksmaudio
 		{
 			return SecondsF{ BASS_ChannelBytes2Seconds(m_hStream, playbuf) };
 		}
-		return SecondsF{ kBufferSizeMs / 1000.0f };
+		return SecondsF{ BASS_GetConfig(BASS_CONFIG_BUFFER) / 1000.0 };
 #endif
 	}
 
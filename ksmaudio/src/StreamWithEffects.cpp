@@ -9,8 +9,8 @@ namespace ksmaudio
 		return m_audioEffectBuses.emplace_back(std::make_unique<AudioEffect::AudioEffectBus>(isLaser, &m_stream)).get();
 	}
 
-	StreamWithEffects::StreamWithEffects(const std::string& filePath, double volume, bool enableCompressor, bool preload, double playbackSpeed)
-		: m_stream(filePath, volume, enableCompressor, preload, false, playbackSpeed)
+	StreamWithEffects::StreamWithEffects(const std::string& filePath, double volume, bool enableCompressor, bool preload, double playbackSpeed, bool decodeOnly)
+		: m_stream(filePath, volume, enableCompressor, preload, false, playbackSpeed, decodeOnly)
 	{
 	}
 
@@ -34,6 +34,16 @@ namespace ksmaudio
 		m_stream.updateManually();
 	}
 
+	std::size_t StreamWithEffects::render(float* pBuffer, std::size_t numFrames) const
+	{
+		return m_stream.render(pBuffer, numFrames);
+	}
+
+	bool StreamWithEffects::isDecodeOnly() const
+	{
+		return m_stream.isDecodeOnly();
+	}
+
 	SecondsF StreamWithEffects::posSec() const
 	{
 		return m_stream.posSec();
@@ -89,6 +99,21 @@ namespace ksmaudio
 		m_stream.setMuted(muted);
 	}
 
+	void StreamWithEffects::enableScheduledSampleMixer()
+	{
+		m_stream.enableScheduledSampleMixer();
+	}
+
+	bool StreamWithEffects::hasScheduledSampleMixer() const
+	{
+		return m_stream.hasScheduledSampleMixer();
+	}
+
+	bool StreamWithEffects::scheduleSample(const Sample& sample, SecondsF timeSec, double volume) const
+	{
+		return m_stream.scheduleSample(sample, timeSec, volume);
+	}
+
 	AudioEffect::AudioEffectBus* StreamWithEffects::emplaceAudioEffectBusFX()
 	{
 		return emplaceAudioEffectBusImpl(false);
@@ -0,0 +1,142 @@
+﻿#include "ksmaudio/WavFileWriter.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace ksmaudio
+{
+	namespace
+	{
+		constexpr std::uint16_t kWaveFormatPCM = 1;
+		constexpr std::uint16_t kWaveFormatIEEEFloat = 3;
+
+		// RIFFヘッダ + fmtチャンク + dataチャンクヘッダ
+		constexpr std::size_t kHeaderBytes = 44U;
+
+		std::size_t BytesPerSample(WavSampleFormat format)
+		{
+			return format == WavSampleFormat::kFloat32 ? sizeof(float) : sizeof(std::int16_t);
+		}
+
+		template <typename T>
+		char* PutLE(char* pDst, T value)
+		{
+			for (std::size_t i = 0U; i < sizeof(T); ++i)
+			{
+				pDst[i] = static_cast<char>((static_cast<std::uint64_t>(value) >> (i * 8U)) & 0xFFU);
+			}
+			return pDst + sizeof(T);
+		}
+
+		std::int16_t FloatToInt16(float value)
+		{
+			// 丸め方向を固定して、実行環境の丸めモードによらず同じ値になるようにする
+			const float scaled = std::clamp(value, -1.0f, 1.0f) * 32767.0f;
+			return static_cast<std::int16_t>(scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+		}
+	}
+
+	WavFileWriter::WavFileWriter(const std::string& filePath, std::size_t sampleRate, std::size_t numChannels, WavSampleFormat format)
+		: m_ofs(filePath, std::ios::out | std::ios::binary | std::ios::trunc)
+		, m_sampleRate(sampleRate)
+		, m_numChannels(numChannels)
+		, m_format(format)
+	{
+		if (m_ofs)
+		{
+			// サイズ欄は仮の値で書き込み、close()で書き直す
+			writeHeader(0U);
+		}
+	}
+
+	WavFileWriter::~WavFileWriter()
+	{
+		close();
+	}
+
+	void WavFileWriter::writeHeader(std::uint32_t dataBytes)
+	{
+		const std::size_t bytesPerSample = BytesPerSample(m_format);
+		const std::uint16_t blockAlign = static_cast<std::uint16_t>(bytesPerSample * m_numChannels);
+
+		char header[kHeaderBytes];
+		char* p = header;
+		std::memcpy(p, "RIFF", 4); p += 4;
+		p = PutLE<std::uint32_t>(p, static_cast<std::uint32_t>(kHeaderBytes - 8U + dataBytes));
+		std::memcpy(p, "WAVE", 4); p += 4;
+		std::memcpy(p, "fmt ", 4); p += 4;
+		p = PutLE<std::uint32_t>(p, 16U);
+		p = PutLE<std::uint16_t>(p, m_format == WavSampleFormat::kFloat32 ? kWaveFormatIEEEFloat : kWaveFormatPCM);
+		p = PutLE<std::uint16_t>(p, static_cast<std::uint16_t>(m_numChannels));
+		p = PutLE<std::uint32_t>(p, static_cast<std::uint32_t>(m_sampleRate));
+		p = PutLE<std::uint32_t>(p, static_cast<std::uint32_t>(m_sampleRate * blockAlign));
+		p = PutLE<std::uint16_t>(p, blockAlign);
+		p = PutLE<std::uint16_t>(p, static_cast<std::uint16_t>(bytesPerSample * 8U));
+		std::memcpy(p, "data", 4); p += 4;
+		PutLE<std::uint32_t>(p, dataBytes);
+
+		m_ofs.write(header, kHeaderBytes);
+	}
+
+	bool WavFileWriter::isOpen() const
+	{
+		return m_ofs.is_open();
+	}
+
+	void WavFileWriter::write(const float* pData, std::size_t numFrames)
+	{
+		if (!m_ofs.is_open())
+		{
+			return;
+		}
+
+		const std::size_t numSamples = numFrames * m_numChannels;
+		const std::size_t bytesPerSample = BytesPerSample(m_format);
+		m_encodeBuffer.resize(numSamples * bytesPerSample);
+
+		char* p = m_encodeBuffer.data();
+		if (m_format == WavSampleFormat::kFloat32)
+		{
+			for (std::size_t i = 0U; i < numSamples; ++i)
+			{
+				std::uint32_t bits;
+				std::memcpy(&bits, &pData[i], sizeof(bits));
+				p = PutLE<std::uint32_t>(p, bits);
+			}
+		}
+		else
+		{
+			for (std::size_t i = 0U; i < numSamples; ++i)
+			{
+				p = PutLE<std::uint16_t>(p, static_cast<std::uint16_t>(FloatToInt16(pData[i])));
+			}
+		}
+
+		m_ofs.write(m_encodeBuffer.data(), static_cast<std::streamsize>(m_encodeBuffer.size()));
+		m_numDataBytes += m_encodeBuffer.size();
+	}
+
+	std::size_t WavFileWriter::numFramesWritten() const
+	{
+		const std::size_t frameBytes = BytesPerSample(m_format) * m_numChannels;
+		return frameBytes == 0U ? 0U : static_cast<std::size_t>(m_numDataBytes / frameBytes);
+	}
+
+	bool WavFileWriter::close()
+	{
+		if (!m_ofs.is_open())
+		{
+			return false;
+		}
+
+		// WAVのサイズ欄は32bitのため、超過した分はヘッダ上で切り詰める
+		const std::uint64_t maxDataBytes = std::numeric_limits<std::uint32_t>::max() - kHeaderBytes;
+		const std::uint32_t dataBytes = static_cast<std::uint32_t>(std::min(m_numDataBytes, maxDataBytes));
+
+		m_ofs.seekp(0, std::ios::beg);
+		writeHeader(dataBytes);
+		const bool succeeded = m_ofs.good();
+		m_ofs.close();
+		return succeeded;
+	}
+}
@@ -69,6 +69,16 @@ namespace ksmaudio
 		BASS_FX_GetVersion(); // bass_fx.dllをロードするために呼ぶ必要あり
 	}
 
+	void InitNoSound(DWORD sampleRate)
+	{
+		// デバイス0は"No Sound"デバイス
+		BASS_Init(0, sampleRate, 0, 0, nullptr);
+
+		BASS_SetConfig(BASS_CONFIG_FLOATDSP, TRUE);
+
+		BASS_FX_GetVersion(); // bass_fx.dllをロードするために呼ぶ必要あり
+	}
+
 	void Terminate()
 	{
 		BASS_Free();
@@ -0,0 +1,49 @@
+#pragma once
+#include <optional>
+#include "kson/ChartData.hpp"
+#include "kson/Util/TimingUtils.hpp"
+
+namespace kson
+{
+	// Binary format version of compiled charts
+	// Increment this when the layout or the passes in CompileChartData change, so that stale caches are rebuilt
+	inline constexpr std::uint32_t kKsonBinaryFormatVersion = 1;
+
+	// Chart data with the load-time expansion passes already applied
+	struct CompiledChartData
+	{
+		// Laser sections and scroll_speed contain linear segments only, and stops are baked into scroll_speed
+		ChartData chartData;
+
+		// Built from chartData.beat (becomes stale if BPMs are modified afterwards)
+		TimingCache timingCache;
+	};
+
+	// Expands curves of laser sections and scroll_speed, bakes stops into scroll_speed, and builds the timing cache
+	// The passes do not depend on play options, so the result can be cached per source chart content
+	[[nodiscard]]
+	CompiledChartData CompileChartData(ChartData&& chartData);
+
+	// 64-bit FNV-1a hash of the source chart file content (used as the key of compiled chart caches)
+	[[nodiscard]]
+	std::uint64_t ChartContentHash(const void* data, std::size_t size);
+
+	// Serializes compiled chart data into the binary format
+	// sourceHash is stored in the header and checked on loading
+	[[nodiscard]]
+	std::string SerializeKsonBinaryChartData(const CompiledChartData& compiledChartData, std::uint64_t sourceHash);
+
+	ErrorType SaveKsonBinaryChartData(std::ostream& stream, const CompiledChartData& compiledChartData, std::uint64_t sourceHash);
+
+	// Writes to a temporary file first and renames it, so readers never see a partially written file
+	ErrorType SaveKsonBinaryChartData(const std::string& filePath, const CompiledChartData& compiledChartData, std::uint64_t sourceHash);
+
+	// Deserializes compiled chart data from a memory block (e.g., a memory-mapped file)
+	// Returns std::nullopt if the data is truncated, has a different format version, or was compiled from different content
+	[[nodiscard]]
+	std::optional<CompiledChartData> LoadKsonBinaryChartData(const void* data, std::size_t size, std::uint64_t sourceHash);
+
+	// Reads only the header and returns whether the data is a compiled chart of the current format version for sourceHash
+	[[nodiscard]]
+	bool IsKsonBinaryChartDataUpToDate(const void* data, std::size_t size, std::uint64_t sourceHash);
+}
@@ -6,12 +6,54 @@
 
 namespace kson
 {
+	// Timing table stored as contiguous arrays (SoA) so that lookups are binary searches over flat memory
+	// The first element of each table is always placed at zero
 	struct TimingCache
 	{
-		std::map<Pulse, double> bpmChangeSec;
-		std::map<double, Pulse> bpmChangePulse;
-		std::map<std::int64_t, Pulse> timeSigChangePulse;
-		std::map<Pulse, std::int64_t> timeSigChangeMeasureIdx;
+		// Tempo changes (sorted by both pulse and sec)
+		std::vector<Pulse> bpmChangePulses;
+		std::vector<double> bpmChangeSecs;
+		std::vector<double> bpmChangeBPMs;
+
+		// Time signature changes (sorted by both measure index and pulse)
+		std::vector<std::int64_t> timeSigChangeMeasureIdxs;
+		std::vector<Pulse> timeSigChangePulses;
+		std::vector<TimeSig> timeSigChangeTimeSigs;
+	};
+
+	// Stateful cursor over TimingCache for lookups that move almost monotonically (e.g., the playhead)
+	// Each lookup starts from the previously found tempo change, so advancing time costs amortized O(1)
+	// Large jumps fall back to a binary search, so results are always identical to the free functions
+	class TimingCursor
+	{
+	private:
+		const TimingCache* m_pCache;
+
+		std::size_t m_bpmChangeIdx = 0U;
+
+		void seekByPulse(Pulse pulse);
+
+		void seekBySec(double sec);
+
+	public:
+		explicit TimingCursor(const TimingCache& cache);
+
+		[[nodiscard]]
+		double pulseToSec(Pulse pulse);
+
+		[[nodiscard]]
+		double pulseDoubleToSec(double pulseDouble);
+
+		[[nodiscard]]
+		Pulse secToPulse(double sec);
+
+		[[nodiscard]]
+		double secToPulseDouble(double sec);
+
+		[[nodiscard]]
+		double tempoAt(Pulse pulse);
+
+		void reset();
 	};
 
 	[[nodiscard]]
@@ -72,6 +114,8 @@ namespace kson
 
 	[[nodiscard]]
 	double TempoAt(Pulse pulse, const BeatInfo& beatInfo);
+	[[nodiscard]]
+	double TempoAt(Pulse pulse, const TimingCache& cache);
 
 	[[nodiscard]]
 	const TimeSig& TimeSigAt(Pulse pulse, const BeatInfo& beatInfo, const TimingCache& cache);
@@ -1,5 +1,6 @@
 #include "kson/Util/TimingUtils.hpp"
 #include <optional>
+#include <algorithm>
 #include <iostream>
 
 kson::Pulse kson::TimeSigOneMeasurePulse(const TimeSig& timeSig)
@@ -36,58 +37,132 @@ kson::TimingCache kson::CreateTimingCache(const BeatInfo& beatInfo)
 
 	TimingCache cache;
 
-	// The first tempo change should be placed at 0.0s
-	cache.bpmChangeSec.emplace(0, 0.0);
-	cache.bpmChangePulse.emplace(0.0, 0);
-
-	// The first time signature change should be placed at zero
-	cache.timeSigChangePulse.emplace(0, 0);
-	cache.timeSigChangeMeasureIdx.emplace(0, 0);
-
 	// Calculate sec for each tempo change
+	// (The first tempo change is placed at 0.0s)
 	{
+		cache.bpmChangePulses.reserve(beatInfoClone.bpm.size());
+		cache.bpmChangeSecs.reserve(beatInfoClone.bpm.size());
+		cache.bpmChangeBPMs.reserve(beatInfoClone.bpm.size());
+
 		double sec = 0.0;
-		auto prevItr = beatInfoClone.bpm.cbegin();
-		for (auto itr = std::next(prevItr); itr != beatInfoClone.bpm.cend(); ++itr)
+		Pulse prevPulse = 0;
+		double prevBPM = beatInfoClone.bpm.begin()->second;
+		for (const auto& [pulse, bpm] : beatInfoClone.bpm)
 		{
-			sec += static_cast<double>(itr->first - prevItr->first) / kResolution * 60 / prevItr->second;
-			cache.bpmChangeSec[itr->first] = sec;
-			cache.bpmChangePulse[sec] = itr->first;
-			prevItr = itr;
+			sec += static_cast<double>(pulse - prevPulse) / kResolution * 60 / prevBPM;
+			cache.bpmChangePulses.push_back(pulse);
+			cache.bpmChangeSecs.push_back(sec);
+			cache.bpmChangeBPMs.push_back(bpm);
+			prevPulse = pulse;
+			prevBPM = bpm;
 		}
 	}
 
-	// Calculate measure count for each time signature change
+	// Calculate pulse for each time signature change
+	// (The first time signature change is placed at zero)
 	{
+		cache.timeSigChangeMeasureIdxs.reserve(beatInfoClone.timeSig.size());
+		cache.timeSigChangePulses.reserve(beatInfoClone.timeSig.size());
+		cache.timeSigChangeTimeSigs.reserve(beatInfoClone.timeSig.size());
+
 		Pulse pulse = 0;
-		auto prevItr = beatInfoClone.timeSig.cbegin();
-		for (auto itr = std::next(prevItr); itr != beatInfoClone.timeSig.cend(); ++itr)
+		std::int64_t prevMeasureIdx = 0;
+		Pulse prevOneMeasurePulse = 0;
+		for (const auto& [measureIdx, timeSig] : beatInfoClone.timeSig)
 		{
-			pulse += (itr->first - prevItr->first) * TimeSigOneMeasurePulse(prevItr->second);
-			cache.timeSigChangePulse[itr->first] = pulse;
-			cache.timeSigChangeMeasureIdx[pulse] = itr->first;
-			prevItr = itr;
+			pulse += (measureIdx - prevMeasureIdx) * prevOneMeasurePulse;
+			cache.timeSigChangeMeasureIdxs.push_back(measureIdx);
+			cache.timeSigChangePulses.push_back(pulse);
+			cache.timeSigChangeTimeSigs.push_back(timeSig);
+			prevMeasureIdx = measureIdx;
+			prevOneMeasurePulse = TimeSigOneMeasurePulse(timeSig);
 		}
 	}
 
 	return cache;
 }
 
+namespace
+{
+	// Returns the index of the last element less than or equal to the value
+	// Falls back to the first element if there is no such element (same behavior as ValueItrAt)
+	template <typename T>
+	std::size_t FloorIdx(const std::vector<T>& sortedValues, const T& value)
+	{
+		assert(!sortedValues.empty());
+		const auto itr = std::upper_bound(sortedValues.begin(), sortedValues.end(), value);
+		if (itr == sortedValues.begin())
+		{
+			return 0U;
+		}
+		return static_cast<std::size_t>(std::distance(sortedValues.begin(), itr)) - 1U;
+	}
+
+	double PulseToSecAtIdx(double pulseDouble, const kson::TimingCache& cache, std::size_t idx)
+	{
+		return cache.bpmChangeSecs[idx] + (pulseDouble - static_cast<double>(cache.bpmChangePulses[idx])) / kson::kResolution * 60 / cache.bpmChangeBPMs[idx];
+	}
+
+	double SecToPulseDoubleAtIdx(double sec, const kson::TimingCache& cache, std::size_t idx)
+	{
+		return static_cast<double>(cache.bpmChangePulses[idx]) + kson::kResolution * (sec - cache.bpmChangeSecs[idx]) * cache.bpmChangeBPMs[idx] / 60;
+	}
+
+	kson::Pulse SecToPulseAtIdx(double sec, const kson::TimingCache& cache, std::size_t idx)
+	{
+		return cache.bpmChangePulses[idx] + static_cast<kson::Pulse>(kson::kResolution * (sec - cache.bpmChangeSecs[idx]) * cache.bpmChangeBPMs[idx] / 60);
+	}
+
+	// Moves the index from the hint toward the value, and falls back to a binary search if it is far away
+	template <typename T>
+	std::size_t SeekFloorIdx(const std::vector<T>& sortedValues, const T& value, std::size_t hintIdx)
+	{
+		constexpr std::size_t kMaxLinearSteps = 4U;
+
+		assert(!sortedValues.empty());
+		std::size_t idx = (std::min)(hintIdx, sortedValues.size() - 1U);
+		if (sortedValues[idx] <= value)
+		{
+			// Forward
+			for (std::size_t i = 0U; i < kMaxLinearSteps; ++i)
+			{
+				if (idx + 1U >= sortedValues.size() || value < sortedValues[idx + 1U])
+				{
+					return idx;
+				}
+				++idx;
+			}
+		}
+		else
+		{
+			// Backward
+			for (std::size_t i = 0U; i < kMaxLinearSteps; ++i)
+			{
+				if (idx == 0U)
+				{
+					return 0U;
+				}
+				--idx;
+				if (sortedValues[idx] <= value)
+				{
+					return idx;
+				}
+			}
+		}
+		return FloorIdx(sortedValues, value);
+	}
+}
+
 double kson::PulseToMs(Pulse pulse, const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	return PulseToSec(pulse, beatInfo, cache) * 1000;
 }
 
-double kson::PulseToSec(Pulse pulse, const BeatInfo& beatInfo, const TimingCache& cache)
+double kson::PulseToSec(Pulse pulse, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
-	// Fetch the nearest BPM change
-	assert(!beatInfo.bpm.empty());
-	const auto itr = ValueItrAt(beatInfo.bpm, pulse);
-	const Pulse nearestBPMChangePulse = itr->first;
-	const double nearestBPM = itr->second;
-
 	// Calculate sec using pulse difference from nearest tempo change
-	return cache.bpmChangeSec.at(nearestBPMChangePulse) + static_cast<double>(pulse - nearestBPMChangePulse) / kResolution * 60 / nearestBPM;
+	const std::size_t idx = FloorIdx(cache.bpmChangePulses, pulse);
+	return cache.bpmChangeSecs[idx] + static_cast<double>(pulse - cache.bpmChangePulses[idx]) / kResolution * 60 / cache.bpmChangeBPMs[idx];
 }
 
 double kson::PulseDoubleToMs(double pulseDouble, const BeatInfo& beatInfo, const TimingCache& cache)
@@ -95,16 +170,11 @@ double kson::PulseDoubleToMs(double pulseDouble, const BeatInfo& beatInfo, const
 	return PulseDoubleToSec(pulseDouble, beatInfo, cache) * 1000;
 }
 
-double kson::PulseDoubleToSec(double pulseDouble, const BeatInfo& beatInfo, const TimingCache& cache)
+double kson::PulseDoubleToSec(double pulseDouble, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
-	// Fetch the nearest BPM change
-	assert(!beatInfo.bpm.empty());
-	const auto itr = ValueItrAt(beatInfo.bpm, static_cast<Pulse>(pulseDouble));
-	const Pulse nearestBPMChangePulse = itr->first;
-	const double nearestBPM = itr->second;
-
 	// Calculate sec using pulse difference from nearest tempo change
-	return cache.bpmChangeSec.at(nearestBPMChangePulse) + (pulseDouble - static_cast<double>(nearestBPMChangePulse)) / kResolution * 60 / nearestBPM;
+	const std::size_t idx = FloorIdx(cache.bpmChangePulses, static_cast<Pulse>(pulseDouble));
+	return PulseToSecAtIdx(pulseDouble, cache, idx);
 }
 
 kson::Pulse kson::MsToPulse(double ms, const BeatInfo& beatInfo, const TimingCache& cache)
@@ -112,19 +182,11 @@ kson::Pulse kson::MsToPulse(double ms, const BeatInfo& beatInfo, const TimingCac
 	return SecToPulse(ms / 1000, beatInfo, cache);
 }
 
-kson::Pulse kson::SecToPulse(double sec, const BeatInfo& beatInfo, const TimingCache& cache)
+kson::Pulse kson::SecToPulse(double sec, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
-	// Fetch the nearest tempo change
-	assert(!cache.bpmChangePulse.empty());
-	const auto itr = ValueItrAt(cache.bpmChangePulse, sec);
-	const double nearestBPMChangeSec = itr->first;
-	const Pulse nearestBPMChangePulse = itr->second;
-	const double nearestBPM = beatInfo.bpm.at(nearestBPMChangePulse);
-
 	// Calculate pulse using time difference from nearest tempo change
-	const Pulse pulse = nearestBPMChangePulse + static_cast<Pulse>(kResolution * (sec - nearestBPMChangeSec) * nearestBPM / 60);
-
-	return pulse;
+	const std::size_t idx = FloorIdx(cache.bpmChangeSecs, sec);
+	return SecToPulseAtIdx(sec, cache, idx);
 }
 
 double kson::MsToPulseDouble(double ms, const BeatInfo& beatInfo, const TimingCache& cache)
@@ -132,29 +194,20 @@ double kson::MsToPulseDouble(double ms, const BeatInfo& beatInfo, const TimingCa
 	return SecToPulseDouble(ms / 1000, beatInfo, cache);
 }
 
-double kson::SecToPulseDouble(double sec, const BeatInfo& beatInfo, const TimingCache& cache)
+double kson::SecToPulseDouble(double sec, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
-	// Fetch the nearest tempo change
-	assert(!cache.bpmChangePulse.empty());
-	const auto itr = ValueItrAt(cache.bpmChangePulse, sec);
-	const double nearestBPMChangeSec = itr->first;
-	const Pulse nearestBPMChangePulse = itr->second;
-	const double nearestBPM = beatInfo.bpm.at(nearestBPMChangePulse);
-
 	// Calculate pulse using time difference from nearest tempo change
-	const double pulseDouble = static_cast<double>(nearestBPMChangePulse) + kResolution * (sec - nearestBPMChangeSec) * nearestBPM / 60;
-
-	return pulseDouble;
+	const std::size_t idx = FloorIdx(cache.bpmChangeSecs, sec);
+	return SecToPulseDoubleAtIdx(sec, cache, idx);
 }
 
-std::int64_t kson::PulseToMeasureIdx(Pulse pulse, const BeatInfo& beatInfo, const TimingCache& cache)
+std::int64_t kson::PulseToMeasureIdx(Pulse pulse, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	// Fetch the nearest time signature change
-	assert(!cache.timeSigChangeMeasureIdx.empty());
-	const auto itr = ValueItrAt(cache.timeSigChangeMeasureIdx, pulse);
-	const Pulse nearestTimeSigChangePulse = itr->first;
-	const std::int64_t nearestTimeSigChangeMeasureIdx = itr->second;
-	const TimeSig& nearestTimeSig = beatInfo.timeSig.at(nearestTimeSigChangeMeasureIdx);
+	const std::size_t idx = FloorIdx(cache.timeSigChangePulses, pulse);
+	const Pulse nearestTimeSigChangePulse = cache.timeSigChangePulses[idx];
+	const std::int64_t nearestTimeSigChangeMeasureIdx = cache.timeSigChangeMeasureIdxs[idx];
+	const TimeSig& nearestTimeSig = cache.timeSigChangeTimeSigs[idx];
 
 	// Calculate measure count using time difference from nearest time signature change
 	const std::int64_t measureCount = nearestTimeSigChangeMeasureIdx + static_cast<std::int64_t>((pulse - nearestTimeSigChangePulse) / TimeSigOneMeasurePulse(nearestTimeSig));
@@ -172,14 +225,13 @@ std::int64_t kson::SecToMeasureIdx(double sec, const BeatInfo& beatInfo, const T
 	return PulseToMeasureIdx(SecToPulse(sec, beatInfo, cache), beatInfo, cache);
 }
 
-kson::Pulse kson::MeasureIdxToPulse(std::int64_t measureIdx, const BeatInfo& beatInfo, const TimingCache& cache)
+kson::Pulse kson::MeasureIdxToPulse(std::int64_t measureIdx, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	// Fetch the nearest time signature change
-	assert(!cache.timeSigChangePulse.empty());
-	const auto itr = ValueItrAt(cache.timeSigChangePulse, measureIdx);
-	const std::int64_t nearestTimeSigChangeMeasureIdx = itr->first;
-	const Pulse nearestTimeSigChangePulse = itr->second;
-	const TimeSig& nearestTimeSig = beatInfo.timeSig.at(nearestTimeSigChangeMeasureIdx);
+	const std::size_t idx = FloorIdx(cache.timeSigChangeMeasureIdxs, measureIdx);
+	const std::int64_t nearestTimeSigChangeMeasureIdx = cache.timeSigChangeMeasureIdxs[idx];
+	const Pulse nearestTimeSigChangePulse = cache.timeSigChangePulses[idx];
+	const TimeSig& nearestTimeSig = cache.timeSigChangeTimeSigs[idx];
 
 	// Calculate pulse using measure count difference from nearest time signature change
 	const Pulse pulse = nearestTimeSigChangePulse + static_cast<Pulse>((measureIdx - nearestTimeSigChangeMeasureIdx) * TimeSigOneMeasurePulse(nearestTimeSig));
@@ -187,15 +239,14 @@ kson::Pulse kson::MeasureIdxToPulse(std::int64_t measureIdx, const BeatInfo& bea
 	return pulse;
 }
 
-kson::Pulse kson::MeasureValueToPulse(double measureValue, const BeatInfo& beatInfo, const TimingCache& cache)
+kson::Pulse kson::MeasureValueToPulse(double measureValue, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	// Fetch the nearest time signature change
-	assert(!cache.timeSigChangePulse.empty());
 	const std::int64_t measureIdx = static_cast<std::int64_t>(measureValue);
-	const auto itr = ValueItrAt(cache.timeSigChangePulse, measureIdx);
-	const std::int64_t nearestTimeSigChangeMeasureIdx = itr->first;
-	const Pulse nearestTimeSigChangePulse = itr->second;
-	const TimeSig& nearestTimeSig = beatInfo.timeSig.at(nearestTimeSigChangeMeasureIdx);
+	const std::size_t idx = FloorIdx(cache.timeSigChangeMeasureIdxs, measureIdx);
+	const std::int64_t nearestTimeSigChangeMeasureIdx = cache.timeSigChangeMeasureIdxs[idx];
+	const Pulse nearestTimeSigChangePulse = cache.timeSigChangePulses[idx];
+	const TimeSig& nearestTimeSig = cache.timeSigChangeTimeSigs[idx];
 
 	// Calculate pulse using measure count difference from nearest time signature change
 	const Pulse pulse = nearestTimeSigChangePulse + static_cast<Pulse>((measureValue - nearestTimeSigChangeMeasureIdx) * TimeSigOneMeasurePulse(nearestTimeSig));
@@ -203,15 +254,14 @@ kson::Pulse kson::MeasureValueToPulse(double measureValue, const BeatInfo& beatI
 	return pulse;
 }
 
-double kson::MeasureValueToPulseDouble(double measureValue, const BeatInfo& beatInfo, const TimingCache& cache)
+double kson::MeasureValueToPulseDouble(double measureValue, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	// Fetch the nearest time signature change
-	assert(!cache.timeSigChangePulse.empty());
 	const std::int64_t measureIdx = static_cast<std::int64_t>(measureValue);
-	const auto itr = ValueItrAt(cache.timeSigChangePulse, measureIdx);
-	const std::int64_t nearestTimeSigChangeMeasureIdx = itr->first;
-	const Pulse nearestTimeSigChangePulse = itr->second;
-	const TimeSig& nearestTimeSig = beatInfo.timeSig.at(nearestTimeSigChangeMeasureIdx);
+	const std::size_t idx = FloorIdx(cache.timeSigChangeMeasureIdxs, measureIdx);
+	const std::int64_t nearestTimeSigChangeMeasureIdx = cache.timeSigChangeMeasureIdxs[idx];
+	const Pulse nearestTimeSigChangePulse = cache.timeSigChangePulses[idx];
+	const TimeSig& nearestTimeSig = cache.timeSigChangeTimeSigs[idx];
 
 	// Calculate pulse using measure count difference from nearest time signature change
 	const double pulseDouble = nearestTimeSigChangePulse + (measureValue - static_cast<double>(nearestTimeSigChangeMeasureIdx)) * TimeSigOneMeasurePulse(nearestTimeSig);
@@ -239,14 +289,12 @@ double kson::MeasureValueToSec(double measureValue, const BeatInfo& beatInfo, co
 	return PulseToSec(MeasureValueToPulse(measureValue, beatInfo, cache), beatInfo, cache);
 }
 
-bool kson::IsBarLinePulse(Pulse pulse, const BeatInfo& beatInfo, const TimingCache& cache)
+bool kson::IsBarLinePulse(Pulse pulse, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	// Fetch the nearest time signature change
-	assert(!cache.timeSigChangeMeasureIdx.empty());
-	const auto itr = ValueItrAt(cache.timeSigChangeMeasureIdx, pulse);
-	const Pulse nearestTimeSigChangePulse = itr->first;
-	const std::int64_t nearestTimeSigChangeMeasureIdx = itr->second;
-	const TimeSig& nearestTimeSig = beatInfo.timeSig.at(nearestTimeSigChangeMeasureIdx);
+	const std::size_t idx = FloorIdx(cache.timeSigChangePulses, pulse);
+	const Pulse nearestTimeSigChangePulse = cache.timeSigChangePulses[idx];
+	const TimeSig& nearestTimeSig = cache.timeSigChangeTimeSigs[idx];
 
 	return ((pulse - nearestTimeSigChangePulse) % TimeSigOneMeasurePulse(nearestTimeSig)) == 0;
 }
@@ -258,13 +306,68 @@ double kson::TempoAt(Pulse pulse, const BeatInfo& beatInfo)
 	return ValueItrAt(beatInfo.bpm, pulse)->second;
 }
 
-const kson::TimeSig& kson::TimeSigAt(Pulse pulse, const BeatInfo& beatInfo, const TimingCache& cache)
+double kson::TempoAt(Pulse pulse, const TimingCache& cache)
+{
+	// Fetch the nearest BPM change
+	return cache.bpmChangeBPMs[FloorIdx(cache.bpmChangePulses, pulse)];
+}
+
+const kson::TimeSig& kson::TimeSigAt(Pulse pulse, [[maybe_unused]] const BeatInfo& beatInfo, const TimingCache& cache)
 {
 	// Fetch the nearest time signature change
-	assert(!cache.timeSigChangeMeasureIdx.empty());
-	const auto itr = ValueItrAt(cache.timeSigChangeMeasureIdx, pulse);
-	const std::int64_t nearestTimeSigChangeMeasureIdx = itr->second;
-	return beatInfo.timeSig.at(nearestTimeSigChangeMeasureIdx);
+	return cache.timeSigChangeTimeSigs[FloorIdx(cache.timeSigChangePulses, pulse)];
+}
+
+kson::TimingCursor::TimingCursor(const TimingCache& cache)
+	: m_pCache(&cache)
+{
+	assert(!cache.bpmChangePulses.empty());
+}
+
+void kson::TimingCursor::seekByPulse(Pulse pulse)
+{
+	m_bpmChangeIdx = SeekFloorIdx(m_pCache->bpmChangePulses, pulse, m_bpmChangeIdx);
+}
+
+void kson::TimingCursor::seekBySec(double sec)
+{
+	m_bpmChangeIdx = SeekFloorIdx(m_pCache->bpmChangeSecs, sec, m_bpmChangeIdx);
+}
+
+double kson::TimingCursor::pulseToSec(Pulse pulse)
+{
+	seekByPulse(pulse);
+	const TimingCache& cache = *m_pCache;
+	return cache.bpmChangeSecs[m_bpmChangeIdx] + static_cast<double>(pulse - cache.bpmChangePulses[m_bpmChangeIdx]) / kResolution * 60 / cache.bpmChangeBPMs[m_bpmChangeIdx];
+}
+
+double kson::TimingCursor::pulseDoubleToSec(double pulseDouble)
+{
+	seekByPulse(static_cast<Pulse>(pulseDouble));
+	return PulseToSecAtIdx(pulseDouble, *m_pCache, m_bpmChangeIdx);
+}
+
+kson::Pulse kson::TimingCursor::secToPulse(double sec)
+{
+	seekBySec(sec);
+	return SecToPulseAtIdx(sec, *m_pCache, m_bpmChangeIdx);
+}
+
+double kson::TimingCursor::secToPulseDouble(double sec)
+{
+	seekBySec(sec);
+	return SecToPulseDoubleAtIdx(sec, *m_pCache, m_bpmChangeIdx);
+}
+
+double kson::TimingCursor::tempoAt(Pulse pulse)
+{
+	seekByPulse(pulse);
+	return m_pCache->bpmChangeBPMs[m_bpmChangeIdx];
+}
+
+void kson::TimingCursor::reset()
+{
+	m_bpmChangeIdx = 0U;
 }
 
 kson::Pulse kson::LastNoteEndY(const kson::NoteInfo& noteInfo)
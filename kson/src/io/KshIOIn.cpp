@@ -7,6 +7,7 @@
 #include <optional>
 #include <charconv>
 #include <cmath>
+#include <limits>
 
 namespace
 {
@@ -75,6 +76,42 @@ namespace
 
 		return defaultValue;
 #else
+		// Fast path without allocation for plain decimal numbers
+		// (Inputs that std::stoll/std::stod would interpret differently from std::from_chars, such as leading whitespace, '+' sign, hexadecimal and subnormal values, fall through to the slow path below)
+		if (!str.empty())
+		{
+			const char firstChar = str.front();
+			const bool isDigit = '0' <= firstChar && firstChar <= '9';
+			const char* const first = str.data();
+			const char* const last = str.data() + str.size();
+			if constexpr (std::is_integral_v<T>)
+			{
+				using ParseType = std::conditional_t<std::is_unsigned_v<T>, unsigned long long, long long>;
+				if (isDigit || (std::is_signed_v<T> && firstChar == '-'))
+				{
+					ParseType result;
+					const auto [ptr, ec] = std::from_chars(first, last, result, 10);
+					return (ec == std::errc{}) ? static_cast<T>(result) : defaultValue;
+				}
+			}
+			else
+			{
+#ifdef __cpp_lib_to_chars
+				if (isDigit || firstChar == '-' || firstChar == '.')
+				{
+					double result;
+					const auto [ptr, ec] = std::from_chars(first, last, result, std::chars_format::general);
+					const bool isHex = ptr != last && (*ptr == 'x' || *ptr == 'X');
+					const bool isSubnormal = ec == std::errc{} && result != 0.0 && std::abs(result) < std::numeric_limits<double>::min();
+					if (!isHex && !isSubnormal)
+					{
+						return (ec == std::errc{}) ? static_cast<T>(result) : defaultValue;
+					}
+				}
+#endif
+			}
+		}
+
 		try
 		{
 			if constexpr (std::is_integral_v<T>)
@@ -110,9 +147,16 @@ namespace
 		return ParseNumeric<T>(std::basic_string_view<U>(str), defaultValue);
 	}
 
+	bool IsASCII(std::string_view str)
+	{
+		// Note: NUL is excluded because the encoding conversion treats it as the end of the string
+		return std::all_of(str.cbegin(), str.cend(), [](char c) { const auto u = static_cast<unsigned char>(c); return 0x00 < u && u < 0x80; });
+	}
+
 	std::string ToUTF8(std::string_view str, bool isUTF8)
 	{
-		if (isUTF8)
+		// ASCII characters are the same in Shift-JIS and UTF-8, so the conversion can be skipped
+		if (isUTF8 || IsASCII(str))
 		{
 			return std::string(str.cbegin(), str.cend());
 		}
@@ -374,27 +418,150 @@ namespace
 		};
 	}
 
-	bool EliminateUTF8BOM(std::istream& stream)
+	bool EliminateUTF8BOM(std::string_view* pBuffer)
 	{
-		bool isUTF8;
-		char bom[3];
-		stream.read(bom, 3);
-		if (stream.gcount() == 3 &&
-			bom[0] == '\xEF' &&
-			bom[1] == '\xBB' &&
-			bom[2] == '\xBF')
+		if (pBuffer->starts_with("\xEF\xBB\xBF"))
 		{
-			isUTF8 = true;
-			// BOM found, stream position is already after BOM
+			pBuffer->remove_prefix(3);
+			return true;
 		}
-		else
+		return false;
+	}
+
+	// Reads lines from a KSH file content loaded into memory at once
+	// Returned lines are views into the buffer, so no allocation is needed per line
+	class KshBufferLineReader
+	{
+	private:
+		std::string_view m_buffer;
+
+		std::size_t m_cursor = 0;
+
+	public:
+		explicit KshBufferLineReader(std::string_view buffer)
+			: m_buffer(buffer)
+		{
+		}
+
+		// Same behavior as std::getline except that CR at the end of the line is eliminated
+		bool readLine(std::string_view* pLine)
+		{
+			if (m_cursor >= m_buffer.size())
+			{
+				return false;
+			}
+
+			const std::size_t lfIdx = m_buffer.find('\n', m_cursor);
+			const std::size_t lineEnd = (lfIdx == std::string_view::npos) ? m_buffer.size() : lfIdx;
+			std::string_view line = m_buffer.substr(m_cursor, lineEnd - m_cursor);
+			m_cursor = (lfIdx == std::string_view::npos) ? m_buffer.size() : lfIdx + 1;
+
+			// Eliminate CR
+			if (line.ends_with('\r'))
+			{
+				line.remove_suffix(1);
+			}
+
+			*pLine = line;
+			return true;
+		}
+
+		int peek() const
+		{
+			if (m_cursor >= m_buffer.size())
+			{
+				return std::char_traits<char>::eof();
+			}
+			return std::char_traits<char>::to_int_type(m_buffer[m_cursor]);
+		}
+	};
+
+	std::string ReadAllFromStream(std::istream& stream)
+	{
+		std::string buffer;
+
+		// Read at once if the stream size is available
+		const std::istream::pos_type startPos = stream.tellg();
+		if (startPos != std::istream::pos_type(-1) && stream.seekg(0, std::ios_base::end))
+		{
+			const std::istream::pos_type endPos = stream.tellg();
+			stream.seekg(startPos);
+			if (endPos != std::istream::pos_type(-1) && endPos >= startPos)
+			{
+				buffer.resize(static_cast<std::size_t>(endPos - startPos));
+				stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+				buffer.resize(static_cast<std::size_t>(stream.gcount()));
+				return buffer;
+			}
+		}
+
+		// Otherwise, read until the end of the stream
+		stream.clear();
+		buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		return buffer;
+	}
+
+	// Reads the beginning of a KSH file up to the first bar line ("--")
+	// Used for loading meta data, where the chart body is unnecessary
+	std::string ReadHeaderFromStream(std::istream& stream)
+	{
+		constexpr std::size_t kChunkSize = 4096;
+
+		std::string buffer;
+		std::size_t lineStartIdx = 0;
+		while (true)
+		{
+			const std::size_t prevSize = buffer.size();
+			buffer.resize(prevSize + kChunkSize);
+			stream.read(buffer.data() + prevSize, static_cast<std::streamsize>(kChunkSize));
+			buffer.resize(prevSize + static_cast<std::size_t>(stream.gcount()));
+
+			// Stop at the first bar line
+			std::size_t lfIdx;
+			while ((lfIdx = buffer.find('\n', lineStartIdx)) != std::string::npos)
+			{
+				std::string_view line = std::string_view(buffer).substr(lineStartIdx, lfIdx - lineStartIdx);
+				if (lineStartIdx == 0 && line.starts_with("\xEF\xBB\xBF"))
+				{
+					line.remove_prefix(3);
+				}
+				if (line.ends_with('\r'))
+				{
+					line.remove_suffix(1);
+				}
+				if (IsBarLine(line))
+				{
+					buffer.resize(lfIdx + 1);
+					return buffer;
+				}
+				lineStartIdx = lfIdx + 1;
+			}
+
+			if (!stream)
+			{
+				return buffer;
+			}
+		}
+	}
+
+	// Converts "\n" in KSH comments to a line break
+	std::string UnescapeKshCommentText(std::string_view commentText)
+	{
+		std::string result;
+		result.reserve(commentText.size());
+		for (std::size_t i = 0; i < commentText.size(); ++i)
 		{
-			isUTF8 = false;
-			// No BOM or incomplete read, reset to beginning
-			stream.clear();
-			stream.seekg(0, std::ios_base::beg);
+			if (commentText[i] == '\\' && i + 1 < commentText.size() && commentText[i + 1] == 'n')
+			{
+				result.push_back('\n');
+				++i;
+			}
+			else
+			{
+				result.push_back(commentText[i]);
+			}
 		}
-		return isUTF8;
+		return result;
 	}
 
 	double RoundToKshDoubleValue(double value)
@@ -1249,26 +1416,16 @@ namespace
 		{ "infinite", 3 },
 	};
 
-	template <typename ChartDataType>
-	ChartDataType CreateChartDataFromMetaDataStream(std::istream& stream, bool* pIsUTF8, KshLoadingDiag* pKshDiag = nullptr, std::int64_t* pFileLineNo = nullptr)
+	template <typename ChartDataType, typename LineReader>
+	ChartDataType CreateChartDataFromMetaData(LineReader& reader, bool isUTF8, KshLoadingDiag* pKshDiag = nullptr, std::int64_t* pFileLineNo = nullptr)
 #ifdef __cpp_concepts
 		requires std::is_same_v<ChartDataType, kson::ChartData> || std::is_same_v<ChartDataType, kson::MetaChartData>
 #endif
 	{
-		if (!stream.good())
-		{
-			return { .error = ErrorType::GeneralIOError };
-		}
-
 		ChartDataType chartData;
-		const bool isUTF8 = EliminateUTF8BOM(stream);
-		if (pIsUTF8)
-		{
-			*pIsUTF8 = isUTF8;
-		}
 
 		// First option line must be "title="
-		if (stream.peek() != 't')
+		if (reader.peek() != 't')
 		{
 			if (pKshDiag)
 			{
@@ -1285,17 +1442,11 @@ namespace
 		[[maybe_unused]] bool barLineExists = false;
 		std::unordered_map<std::string, std::string> metaDataHashMap;
 		std::int64_t headerLineNo = 0;
-		std::string line;
-		while (std::getline(stream, line, '\n'))
+		std::string_view line;
+		while (reader.readLine(&line))
 		{
 			++headerLineNo;
 
-			// Eliminate CR
-			if (!line.empty() && *line.crbegin() == '\r')
-			{
-				line.pop_back();
-			}
-
 			if (IsBarLine(line))
 			{
 				// Chart meta data is before the first bar line ("--")
@@ -1308,14 +1459,7 @@ namespace
 			{
 				if constexpr (std::is_same_v<ChartDataType, ChartData>)
 				{
-					std::string commentText = line.substr(2); // 2 = strlen("//")
-					std::size_t pos = 0;
-					while ((pos = commentText.find("\\n", pos)) != std::string::npos)
-					{
-						commentText.replace(pos, 2, "\n"); // 2 = strlen("\\n")
-						pos += 1; // 1 = strlen("\n")
-					}
-					chartData.editor.comment.emplace(0, commentText);
+					chartData.editor.comment.emplace(0, UnescapeKshCommentText(line.substr(2))); // 2 = strlen("//")
 				}
 				continue;
 			}
@@ -1330,13 +1474,23 @@ namespace
 				continue;
 			}
 
-			const auto [key, value] = SplitOptionLine(line, isUTF8);
-			if (key.empty())
+			if constexpr (std::is_same_v<ChartDataType, MetaChartData>)
+			{
+				// Encoding conversion is deferred until the values actually used are known
+				// (Note: '=' never appears as a part of a multibyte character in Shift-JIS)
+				const std::size_t equalIdx = line.find(kOptionSeparator);
+				metaDataHashMap.insert_or_assign(std::string(line.substr(0, equalIdx)), std::string(line.substr(equalIdx + 1)));
+			}
+			else
 			{
-				// Encoding error (the key must not be empty because IsOptionLine() is true)
-				return { .error = ErrorType::EncodingError };
+				const auto [key, value] = SplitOptionLine(line, isUTF8);
+				if (key.empty())
+				{
+					// Encoding error (the key must not be empty because IsOptionLine() is true)
+					return { .error = ErrorType::EncodingError };
+				}
+				metaDataHashMap.insert_or_assign(key, value);
 			}
-			metaDataHashMap.insert_or_assign(key, value);
 		}
 
 		// .ksh files must have at least one bar line ("--")
@@ -1499,11 +1653,49 @@ namespace
 			}
 		}
 
+		// Convert the deferred text fields to UTF-8
+		if constexpr (std::is_same_v<ChartDataType, MetaChartData>)
+		{
+			if (!isUTF8)
+			{
+				const std::array<std::string*, 14> textFields = {
+					&chartData.meta.title,
+					&chartData.meta.titleTranslit,
+					&chartData.meta.titleImgFilename,
+					&chartData.meta.artist,
+					&chartData.meta.artistTranslit,
+					&chartData.meta.artistImgFilename,
+					&chartData.meta.chartAuthor,
+					&chartData.meta.difficulty.name,
+					&chartData.meta.dispBPM,
+					&chartData.meta.jacketFilename,
+					&chartData.meta.jacketAuthor,
+					&chartData.meta.iconFilename,
+					&chartData.meta.information,
+					&chartData.audio.bgm.filename,
+				};
+				for (std::string* pText : textFields)
+				{
+					if (pText->empty())
+					{
+						continue;
+					}
+
+					std::string textUTF8 = ToUTF8(*pText, false);
+					if (textUTF8.empty())
+					{
+						return { .error = ErrorType::EncodingError };
+					}
+					*pText = std::move(textUTF8);
+				}
+			}
+		}
+
 		return chartData;
 	}
 
 	void ParseKshChartBody(
-		std::istream& stream,
+		KshBufferLineReader& reader,
 		ChartData* pChartData,
 		KshLoadingDiag* pKshDiag,
 		bool isUTF8,
@@ -1536,7 +1728,7 @@ namespace
 
 		// Buffers
 		// (needed because actual addition cannot come before the pulse value calculation)
-		std::vector<std::string> chartLines;
+		std::vector<std::string_view> chartLines; // Views into the file content buffer
 		std::vector<BufOptionLine> optionLines;
 		std::vector<BufCommentLine> commentLines;
 		std::vector<BufUnknownLine> unknownLines;
@@ -1559,18 +1751,12 @@ namespace
 		bool useLegacyScaleForManualTilt = false;
 
 		// Read chart body
-		// The stream start from the next of the first bar line ("--")
-		std::string line;
-		while (std::getline(stream, line, '\n'))
+		// The reader starts from the next of the first bar line ("--")
+		std::string_view line;
+		while (reader.readLine(&line))
 		{
 			++fileLineNo;
 
-			// Eliminate CR
-			if (!line.empty() && *line.crbegin() == '\r')
-			{
-				line.pop_back();
-			}
-
 			// Skip empty lines
 			if (line.empty())
 			{
@@ -1580,16 +1766,9 @@ namespace
 			// Comments
 			if (IsCommentLine(line))
 			{
-				std::string commentText = line.substr(2); // 2 = strlen("//")
-				std::size_t pos = 0;
-				while ((pos = commentText.find("\\n", pos)) != std::string::npos)
-				{
-					commentText.replace(pos, 2, "\n"); // 2 = strlen("\\n")
-					pos += 1; // 1 = strlen("\n")
-				}
 				commentLines.push_back({
 					.lineIdx = chartLines.size(),
-					.value = commentText,
+					.value = UnescapeKshCommentText(line.substr(2)), // 2 = strlen("//")
 				});
 				continue;
 			}
@@ -2234,7 +2413,7 @@ namespace
 			// Insert unrecognized line
 			unknownLines.push_back({
 				.lineIdx = chartLines.size(),
-				.value = line,
+				.value = std::string(line),
 			});
 		}
 
@@ -2505,7 +2684,17 @@ std::vector<std::string> kson::KshLoadingDiag::editorWarnings() const
 
 MetaChartData kson::LoadKshMetaChartData(std::istream& stream)
 {
-	return CreateChartDataFromMetaDataStream<MetaChartData>(stream, nullptr);
+	if (!stream.good())
+	{
+		return { .error = ErrorType::GeneralIOError };
+	}
+
+	// Read only the lines before the first bar line ("--")
+	const std::string buffer = ReadHeaderFromStream(stream);
+	std::string_view bufferView = buffer;
+	const bool isUTF8 = EliminateUTF8BOM(&bufferView);
+	KshBufferLineReader reader(bufferView);
+	return CreateChartDataFromMetaData<MetaChartData>(reader, isUTF8);
 }
 
 MetaChartData kson::LoadKshMetaChartData(const std::string& filePath)
@@ -2539,10 +2728,15 @@ kson::ChartData kson::LoadKshChartData(std::istream& stream, KshLoadingDiag* pKs
 		return { .error = ErrorType::GeneralIOError };
 	}
 
+	// Read the whole file content at once and parse lines as views into it
+	const std::string buffer = ReadAllFromStream(stream);
+	std::string_view bufferView = buffer;
+	const bool isUTF8 = EliminateUTF8BOM(&bufferView);
+	KshBufferLineReader reader(bufferView);
+
 	// Load chart meta data
-	bool isUTF8;
 	std::int64_t fileLineNo = 0;
-	ChartData chartData = CreateChartDataFromMetaDataStream<ChartData>(stream, &isUTF8, pKshDiag, &fileLineNo);
+	ChartData chartData = CreateChartDataFromMetaData<ChartData>(reader, isUTF8, pKshDiag, &fileLineNo);
 	if (chartData.error != ErrorType::None)
 	{
 		return chartData;
@@ -2550,7 +2744,7 @@ kson::ChartData kson::LoadKshChartData(std::istream& stream, KshLoadingDiag* pKs
 
 	try
 	{
-		ParseKshChartBody(stream, &chartData, pKshDiag, isUTF8, &fileLineNo);
+		ParseKshChartBody(reader, &chartData, pKshDiag, isUTF8, &fileLineNo);
 	}
 	catch (const std::exception& e)
 	{
@@ -0,0 +1,911 @@
+#include "kson/IO/KsonBinaryIO.hpp"
+#include "kson/Util/GraphCurve.hpp"
+#include "kson/Util/GraphUtils.hpp"
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <type_traits>
+#include <variant>
+
+namespace
+{
+	using namespace kson;
+
+	constexpr std::array<char, 8> kMagic = { 'K', 'S', 'O', 'N', 'B', 'I', 'N', '\0' };
+
+	std::filesystem::path U8Path(const std::string& utf8Str)
+	{
+		return std::filesystem::path(
+			std::u8string_view(reinterpret_cast<const char8_t*>(utf8Str.data()), utf8Str.size()));
+	}
+
+	// Values are written in their in-memory representation (little-endian is assumed)
+	class BinaryWriter
+	{
+	private:
+		std::string m_buffer;
+
+	public:
+		template <typename T>
+		void write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		// Writes the element count followed by the elements as one contiguous block
+		template <typename T>
+		void writeArray(const std::vector<T>& values)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			write(static_cast<std::uint32_t>(values.size()));
+			m_buffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+		}
+
+		void writeString(const std::string& str)
+		{
+			write(static_cast<std::uint32_t>(str.size()));
+			m_buffer.append(str);
+		}
+
+		std::string& buffer()
+		{
+			return m_buffer;
+		}
+	};
+
+	// Once an out-of-range read occurs, failed() becomes true and all subsequent reads return default values
+	class BinaryReader
+	{
+	private:
+		const char* m_pos;
+
+		const char* m_end;
+
+		bool m_failed = false;
+
+		bool require(std::size_t size)
+		{
+			if (m_failed || static_cast<std::size_t>(m_end - m_pos) < size)
+			{
+				m_failed = true;
+				return false;
+			}
+			return true;
+		}
+
+	public:
+		BinaryReader(const void* data, std::size_t size)
+			: m_pos(static_cast<const char*>(data))
+			, m_end(static_cast<const char*>(data) + size)
+		{
+		}
+
+		template <typename T>
+		T read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			T value{};
+			if (!require(sizeof(T)))
+			{
+				return value;
+			}
+			std::memcpy(&value, m_pos, sizeof(T));
+			m_pos += sizeof(T);
+			return value;
+		}
+
+		// Reads an array written by BinaryWriter::writeArray with a single copy
+		template <typename T>
+		std::vector<T> readArray()
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			const std::size_t count = read<std::uint32_t>();
+			if (!require(count * sizeof(T)))
+			{
+				return {};
+			}
+			std::vector<T> values(count);
+			std::memcpy(values.data(), m_pos, count * sizeof(T));
+			m_pos += count * sizeof(T);
+			return values;
+		}
+
+		std::string readString()
+		{
+			const std::size_t size = read<std::uint32_t>();
+			if (!require(size))
+			{
+				return std::string{};
+			}
+			std::string str(m_pos, size);
+			m_pos += size;
+			return str;
+		}
+
+		// Returns a count that is guaranteed not to exceed the remaining bytes (for element-wise containers)
+		std::size_t readCount()
+		{
+			const std::size_t count = read<std::uint32_t>();
+			if (!require(count))
+			{
+				return 0U;
+			}
+			return count;
+		}
+
+		[[nodiscard]]
+		bool failed() const
+		{
+			return m_failed;
+		}
+	};
+
+	// Packed representation of GraphPoint (v, vf, curve.a, curve.b)
+	using PackedGraphPoint = std::array<double, 4>;
+
+	PackedGraphPoint Pack(const GraphPoint& point)
+	{
+		return { point.v.v, point.v.vf, point.curve.a, point.curve.b };
+	}
+
+	GraphPoint Unpack(const PackedGraphPoint& packed)
+	{
+		return GraphPoint{ GraphValue{ packed[0], packed[1] }, GraphCurveValue{ packed[2], packed[3] } };
+	}
+
+	// Maps with trivially copyable values are stored as a key column followed by a value column,
+	// so that both can be read with one copy each and the map is rebuilt by appending at the end
+	template <typename K, typename V, typename F>
+	void WriteColumns(BinaryWriter& writer, const std::map<K, V>& map, F fnToColumnValue)
+	{
+		using ColumnValue = std::invoke_result_t<F, const V&>;
+		std::vector<K> keys;
+		std::vector<ColumnValue> values;
+		keys.reserve(map.size());
+		values.reserve(map.size());
+		for (const auto& [key, value] : map)
+		{
+			keys.push_back(key);
+			values.push_back(fnToColumnValue(value));
+		}
+		writer.writeArray(keys);
+		writer.writeArray(values);
+	}
+
+	template <typename ColumnValue, typename K, typename V, typename F>
+	void ReadColumns(BinaryReader& reader, std::map<K, V>* pMap, F fnFromColumnValue)
+	{
+		const std::vector<K> keys = reader.readArray<K>();
+		const std::vector<ColumnValue> values = reader.readArray<ColumnValue>();
+		if (reader.failed() || keys.size() != values.size())
+		{
+			return;
+		}
+		pMap->clear();
+		for (std::size_t i = 0U; i < keys.size(); ++i)
+		{
+			pMap->emplace_hint(pMap->end(), keys[i], fnFromColumnValue(values[i]));
+		}
+	}
+
+	template <typename K, typename V>
+	void WriteColumns(BinaryWriter& writer, const std::map<K, V>& map)
+	{
+		WriteColumns(writer, map, [](const V& value) { return value; });
+	}
+
+	template <typename K, typename V>
+	void ReadColumns(BinaryReader& reader, std::map<K, V>* pMap)
+	{
+		ReadColumns<V>(reader, pMap, [](const V& value) { return value; });
+	}
+
+	void WriteGraph(BinaryWriter& writer, const ByPulse<GraphPoint>& graph)
+	{
+		WriteColumns(writer, graph, [](const GraphPoint& point) { return Pack(point); });
+	}
+
+	void ReadGraph(BinaryReader& reader, ByPulse<GraphPoint>* pGraph)
+	{
+		ReadColumns<PackedGraphPoint>(reader, pGraph, [](const PackedGraphPoint& packed) { return Unpack(packed); });
+	}
+
+	void WritePulseSet(BinaryWriter& writer, const std::set<Pulse>& pulseSet)
+	{
+		writer.writeArray(std::vector<Pulse>(pulseSet.begin(), pulseSet.end()));
+	}
+
+	void ReadPulseSet(BinaryReader& reader, std::set<Pulse>* pPulseSet)
+	{
+		const std::vector<Pulse> pulses = reader.readArray<Pulse>();
+		pPulseSet->clear();
+		for (const Pulse pulse : pulses)
+		{
+			pPulseSet->emplace_hint(pPulseSet->end(), pulse);
+		}
+	}
+
+	void WriteStringMulti(BinaryWriter& writer, const ByPulseMulti<std::string>& byPulse)
+	{
+		writer.write(static_cast<std::uint32_t>(byPulse.size()));
+		for (const auto& [y, str] : byPulse)
+		{
+			writer.write(y);
+			writer.writeString(str);
+		}
+	}
+
+	void ReadStringMulti(BinaryReader& reader, ByPulseMulti<std::string>* pByPulse)
+	{
+		const std::size_t count = reader.readCount();
+		pByPulse->clear();
+		for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+		{
+			const Pulse y = reader.read<Pulse>();
+			pByPulse->emplace_hint(pByPulse->end(), y, reader.readString());
+		}
+	}
+
+	void WriteStringByPulse(BinaryWriter& writer, const ByPulse<std::string>& byPulse)
+	{
+		writer.write(static_cast<std::uint32_t>(byPulse.size()));
+		for (const auto& [y, str] : byPulse)
+		{
+			writer.write(y);
+			writer.writeString(str);
+		}
+	}
+
+	void ReadStringByPulse(BinaryReader& reader, ByPulse<std::string>* pByPulse)
+	{
+		const std::size_t count = reader.readCount();
+		pByPulse->clear();
+		for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+		{
+			const Pulse y = reader.read<Pulse>();
+			pByPulse->emplace_hint(pByPulse->end(), y, reader.readString());
+		}
+	}
+
+	template <typename Map, typename F>
+	void WriteDict(BinaryWriter& writer, const Map& dict, F fnWriteValue)
+	{
+		writer.write(static_cast<std::uint32_t>(dict.size()));
+		for (const auto& [key, value] : dict)
+		{
+			writer.writeString(key);
+			fnWriteValue(value);
+		}
+	}
+
+	template <typename Map, typename F>
+	void ReadDict(BinaryReader& reader, Map* pDict, F fnReadValue)
+	{
+		const std::size_t count = reader.readCount();
+		pDict->clear();
+		pDict->reserve(count);
+		for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+		{
+			std::string key = reader.readString();
+			fnReadValue(&(*pDict)[std::move(key)]);
+		}
+	}
+
+	void WriteStringDict(BinaryWriter& writer, const Dict<std::string>& dict)
+	{
+		WriteDict(writer, dict, [&](const std::string& value) { writer.writeString(value); });
+	}
+
+	void ReadStringDict(BinaryReader& reader, Dict<std::string>* pDict)
+	{
+		ReadDict(reader, pDict, [&](std::string* pValue) { *pValue = reader.readString(); });
+	}
+
+	void WriteMetaInfo(BinaryWriter& writer, const MetaInfo& meta)
+	{
+		writer.writeString(meta.title);
+		writer.writeString(meta.titleTranslit);
+		writer.writeString(meta.titleImgFilename);
+		writer.writeString(meta.artist);
+		writer.writeString(meta.artistTranslit);
+		writer.writeString(meta.artistImgFilename);
+		writer.writeString(meta.chartAuthor);
+		writer.write(meta.difficulty.idx);
+		writer.writeString(meta.difficulty.name);
+		writer.write(meta.level);
+		writer.writeString(meta.dispBPM);
+		writer.write(meta.stdBPM);
+		writer.writeString(meta.jacketFilename);
+		writer.writeString(meta.jacketAuthor);
+		writer.writeString(meta.iconFilename);
+		writer.writeString(meta.information);
+	}
+
+	void ReadMetaInfo(BinaryReader& reader, MetaInfo* pMeta)
+	{
+		pMeta->title = reader.readString();
+		pMeta->titleTranslit = reader.readString();
+		pMeta->titleImgFilename = reader.readString();
+		pMeta->artist = reader.readString();
+		pMeta->artistTranslit = reader.readString();
+		pMeta->artistImgFilename = reader.readString();
+		pMeta->chartAuthor = reader.readString();
+		pMeta->difficulty.idx = reader.read<std::int32_t>();
+		pMeta->difficulty.name = reader.readString();
+		pMeta->level = reader.read<std::int32_t>();
+		pMeta->dispBPM = reader.readString();
+		pMeta->stdBPM = reader.read<double>();
+		pMeta->jacketFilename = reader.readString();
+		pMeta->jacketAuthor = reader.readString();
+		pMeta->iconFilename = reader.readString();
+		pMeta->information = reader.readString();
+	}
+
+	void WriteBeatInfo(BinaryWriter& writer, const BeatInfo& beat)
+	{
+		WriteColumns(writer, beat.bpm);
+		WriteColumns(writer, beat.timeSig, [](const TimeSig& timeSig) { return std::array<std::int32_t, 2>{ timeSig.n, timeSig.d }; });
+		WriteGraph(writer, beat.scrollSpeed);
+		WriteColumns(writer, beat.stop);
+	}
+
+	void ReadBeatInfo(BinaryReader& reader, BeatInfo* pBeat)
+	{
+		ReadColumns(reader, &pBeat->bpm);
+		ReadColumns<std::array<std::int32_t, 2>>(reader, &pBeat->timeSig, [](const std::array<std::int32_t, 2>& v) { return TimeSig{ v[0], v[1] }; });
+		ReadGraph(reader, &pBeat->scrollSpeed);
+		ReadColumns(reader, &pBeat->stop);
+	}
+
+	void WriteNoteInfo(BinaryWriter& writer, const NoteInfo& note)
+	{
+		const auto fnLength = [](const Interval& interval) { return interval.length; };
+		for (const auto& lane : note.bt)
+		{
+			WriteColumns(writer, lane, fnLength);
+		}
+		for (const auto& lane : note.fx)
+		{
+			WriteColumns(writer, lane, fnLength);
+		}
+		for (const auto& lane : note.laser)
+		{
+			writer.write(static_cast<std::uint32_t>(lane.size()));
+			for (const auto& [y, section] : lane)
+			{
+				writer.write(y);
+				writer.write(section.w);
+				WriteGraph(writer, section.v);
+			}
+		}
+	}
+
+	void ReadNoteInfo(BinaryReader& reader, NoteInfo* pNote)
+	{
+		const auto fnInterval = [](RelPulse length) { return Interval{ .length = length }; };
+		for (auto& lane : pNote->bt)
+		{
+			ReadColumns<RelPulse>(reader, &lane, fnInterval);
+		}
+		for (auto& lane : pNote->fx)
+		{
+			ReadColumns<RelPulse>(reader, &lane, fnInterval);
+		}
+		for (auto& lane : pNote->laser)
+		{
+			const std::size_t count = reader.readCount();
+			lane.clear();
+			for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+			{
+				const Pulse y = reader.read<Pulse>();
+				LaserSection section;
+				section.w = reader.read<std::int32_t>();
+				ReadGraph(reader, &section.v);
+				lane.emplace_hint(lane.end(), y, std::move(section));
+			}
+		}
+	}
+
+	void WriteAudioEffectDef(BinaryWriter& writer, const std::vector<AudioEffectDefKVP>& def)
+	{
+		writer.write(static_cast<std::uint32_t>(def.size()));
+		for (const auto& kvp : def)
+		{
+			writer.writeString(kvp.name);
+			writer.write(static_cast<std::int32_t>(kvp.v.type));
+			WriteStringDict(writer, kvp.v.v);
+		}
+	}
+
+	void ReadAudioEffectDef(BinaryReader& reader, std::vector<AudioEffectDefKVP>* pDef)
+	{
+		const std::size_t count = reader.readCount();
+		pDef->clear();
+		pDef->reserve(count);
+		for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+		{
+			AudioEffectDefKVP& kvp = pDef->emplace_back();
+			kvp.name = reader.readString();
+			kvp.v.type = static_cast<AudioEffectType>(reader.read<std::int32_t>());
+			ReadStringDict(reader, &kvp.v.v);
+		}
+	}
+
+	void WriteAudioEffectParamChange(BinaryWriter& writer, const Dict<Dict<ByPulse<std::string>>>& paramChange)
+	{
+		WriteDict(writer, paramChange, [&](const Dict<ByPulse<std::string>>& params)
+		{
+			WriteDict(writer, params, [&](const ByPulse<std::string>& byPulse) { WriteStringByPulse(writer, byPulse); });
+		});
+	}
+
+	void ReadAudioEffectParamChange(BinaryReader& reader, Dict<Dict<ByPulse<std::string>>>* pParamChange)
+	{
+		ReadDict(reader, pParamChange, [&](Dict<ByPulse<std::string>>* pParams)
+		{
+			ReadDict(reader, pParams, [&](ByPulse<std::string>* pByPulse) { ReadStringByPulse(reader, pByPulse); });
+		});
+	}
+
+	void WriteAudioInfo(BinaryWriter& writer, const AudioInfo& audio)
+	{
+		// BGM
+		const BGMInfo& bgm = audio.bgm;
+		writer.writeString(bgm.filename);
+		writer.write(bgm.vol);
+		writer.write(bgm.offset);
+		writer.write(bgm.preview.offset);
+		writer.write(bgm.preview.duration);
+		writer.writeString(bgm.legacy.filenameF);
+		writer.writeString(bgm.legacy.filenameP);
+		writer.writeString(bgm.legacy.filenameFP);
+
+		// Key sounds
+		const KeySoundInfo& keySound = audio.keySound;
+		WriteDict(writer, keySound.fx.chipEvent, [&](const FXLane<KeySoundInvokeFX>& lanes)
+		{
+			for (const auto& lane : lanes)
+			{
+				WriteColumns(writer, lane, [](const KeySoundInvokeFX& invoke) { return invoke.vol; });
+			}
+		});
+		WriteColumns(writer, keySound.laser.vol);
+		WriteDict(writer, keySound.laser.slamEvent, [&](const std::set<Pulse>& pulseSet) { WritePulseSet(writer, pulseSet); });
+		writer.write(static_cast<std::uint8_t>(keySound.laser.legacy.volAuto));
+
+		// Audio effects
+		const AudioEffectFXInfo& fx = audio.audioEffect.fx;
+		WriteAudioEffectDef(writer, fx.def);
+		WriteAudioEffectParamChange(writer, fx.paramChange);
+		WriteDict(writer, fx.longEvent, [&](const FXLane<AudioEffectParams>& lanes)
+		{
+			for (const auto& lane : lanes)
+			{
+				writer.write(static_cast<std::uint32_t>(lane.size()));
+				for (const auto& [y, params] : lane)
+				{
+					writer.write(y);
+					WriteStringDict(writer, params);
+				}
+			}
+		});
+
+		const AudioEffectLaserInfo& laser = audio.audioEffect.laser;
+		WriteAudioEffectDef(writer, laser.def);
+		WriteAudioEffectParamChange(writer, laser.paramChange);
+		WriteDict(writer, laser.pulseEvent, [&](const std::set<Pulse>& pulseSet) { WritePulseSet(writer, pulseSet); });
+		writer.write(laser.peakingFilterDelay);
+		WriteColumns(writer, laser.legacy.filterGain);
+	}
+
+	void ReadAudioInfo(BinaryReader& reader, AudioInfo* pAudio)
+	{
+		// BGM
+		BGMInfo& bgm = pAudio->bgm;
+		bgm.filename = reader.readString();
+		bgm.vol = reader.read<double>();
+		bgm.offset = reader.read<std::int32_t>();
+		bgm.preview.offset = reader.read<std::int32_t>();
+		bgm.preview.duration = reader.read<std::int32_t>();
+		bgm.legacy.filenameF = reader.readString();
+		bgm.legacy.filenameP = reader.readString();
+		bgm.legacy.filenameFP = reader.readString();
+
+		// Key sounds
+		KeySoundInfo& keySound = pAudio->keySound;
+		ReadDict(reader, &keySound.fx.chipEvent, [&](FXLane<KeySoundInvokeFX>* pLanes)
+		{
+			for (auto& lane : *pLanes)
+			{
+				ReadColumns<double>(reader, &lane, [](double vol) { return KeySoundInvokeFX{ .vol = vol }; });
+			}
+		});
+		ReadColumns(reader, &keySound.laser.vol);
+		ReadDict(reader, &keySound.laser.slamEvent, [&](std::set<Pulse>* pPulseSet) { ReadPulseSet(reader, pPulseSet); });
+		keySound.laser.legacy.volAuto = reader.read<std::uint8_t>() != 0U;
+
+		// Audio effects
+		AudioEffectFXInfo& fx = pAudio->audioEffect.fx;
+		ReadAudioEffectDef(reader, &fx.def);
+		ReadAudioEffectParamChange(reader, &fx.paramChange);
+		ReadDict(reader, &fx.longEvent, [&](FXLane<AudioEffectParams>* pLanes)
+		{
+			for (auto& lane : *pLanes)
+			{
+				const std::size_t count = reader.readCount();
+				lane.clear();
+				for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+				{
+					const Pulse y = reader.read<Pulse>();
+					AudioEffectParams params;
+					ReadStringDict(reader, &params);
+					lane.emplace_hint(lane.end(), y, std::move(params));
+				}
+			}
+		});
+
+		AudioEffectLaserInfo& laser = pAudio->audioEffect.laser;
+		ReadAudioEffectDef(reader, &laser.def);
+		ReadAudioEffectParamChange(reader, &laser.paramChange);
+		ReadDict(reader, &laser.pulseEvent, [&](std::set<Pulse>* pPulseSet) { ReadPulseSet(reader, pPulseSet); });
+		laser.peakingFilterDelay = reader.read<std::int32_t>();
+		ReadColumns(reader, &laser.legacy.filterGain);
+	}
+
+	// Packed representations of camera pattern invocations (laid out without implicit padding)
+	struct PackedSpin
+	{
+		RelPulse length = 0;
+		std::int64_t d = 0;
+	};
+
+	struct PackedSwing
+	{
+		RelPulse length = 0;
+		double scale = 0.0;
+		std::int32_t d = 0;
+		std::int32_t repeat = 0;
+		std::int32_t decayOrder = 0;
+		std::int32_t reserved = 0;
+	};
+
+	void WriteTiltValue(BinaryWriter& writer, const TiltValue& tiltValue)
+	{
+		writer.write(static_cast<std::uint8_t>(tiltValue.index()));
+		if (const auto pAutoTiltType = std::get_if<AutoTiltType>(&tiltValue))
+		{
+			writer.write(static_cast<std::int32_t>(*pAutoTiltType));
+			return;
+		}
+
+		const TiltGraphPoint& point = std::get<TiltGraphPoint>(tiltValue);
+		writer.write(point.v.v);
+		writer.write(static_cast<std::uint8_t>(point.v.vf.index()));
+		if (const auto pVf = std::get_if<double>(&point.v.vf))
+		{
+			writer.write(*pVf);
+		}
+		else
+		{
+			writer.write(static_cast<std::int32_t>(std::get<AutoTiltType>(point.v.vf)));
+		}
+		writer.write(point.curve.a);
+		writer.write(point.curve.b);
+	}
+
+	TiltValue ReadTiltValue(BinaryReader& reader)
+	{
+		if (reader.read<std::uint8_t>() == 0U)
+		{
+			return static_cast<AutoTiltType>(reader.read<std::int32_t>());
+		}
+
+		TiltGraphValue value;
+		value.v = reader.read<double>();
+		if (reader.read<std::uint8_t>() == 0U)
+		{
+			value.vf = reader.read<double>();
+		}
+		else
+		{
+			value.vf = static_cast<AutoTiltType>(reader.read<std::int32_t>());
+		}
+		const double a = reader.read<double>();
+		const double b = reader.read<double>();
+		return TiltGraphPoint{ value, GraphCurveValue{ a, b } };
+	}
+
+	void WriteCameraInfo(BinaryWriter& writer, const CameraInfo& camera)
+	{
+		const CamGraphs& body = camera.cam.body;
+		WriteGraph(writer, body.zoomBottom);
+		WriteGraph(writer, body.zoomSide);
+		WriteGraph(writer, body.zoomTop);
+		WriteGraph(writer, body.rotationDeg);
+		WriteGraph(writer, body.centerSplit);
+
+		const CamPatternLaserInvokeList& slamEvent = camera.cam.pattern.laser.slamEvent;
+		const auto fnPackSpin = [](const CamPatternInvokeSpin& spin) { return PackedSpin{ .length = spin.length, .d = spin.d }; };
+		WriteColumns(writer, slamEvent.spin, fnPackSpin);
+		WriteColumns(writer, slamEvent.halfSpin, fnPackSpin);
+		WriteColumns(writer, slamEvent.swing, [](const CamPatternInvokeSwing& swing)
+		{
+			return PackedSwing{ .length = swing.length, .scale = swing.v.scale, .d = swing.d, .repeat = swing.v.repeat, .decayOrder = swing.v.decayOrder };
+		});
+
+		writer.write(static_cast<std::uint32_t>(camera.tilt.size()));
+		for (const auto& [y, tiltValue] : camera.tilt)
+		{
+			writer.write(y);
+			WriteTiltValue(writer, tiltValue);
+		}
+	}
+
+	void ReadCameraInfo(BinaryReader& reader, CameraInfo* pCamera)
+	{
+		CamGraphs& body = pCamera->cam.body;
+		ReadGraph(reader, &body.zoomBottom);
+		ReadGraph(reader, &body.zoomSide);
+		ReadGraph(reader, &body.zoomTop);
+		ReadGraph(reader, &body.rotationDeg);
+		ReadGraph(reader, &body.centerSplit);
+
+		CamPatternLaserInvokeList& slamEvent = pCamera->cam.pattern.laser.slamEvent;
+		const auto fnUnpackSpin = [](const PackedSpin& v) { return CamPatternInvokeSpin{ .d = static_cast<std::int32_t>(v.d), .length = v.length }; };
+		ReadColumns<PackedSpin>(reader, &slamEvent.spin, fnUnpackSpin);
+		ReadColumns<PackedSpin>(reader, &slamEvent.halfSpin, fnUnpackSpin);
+		ReadColumns<PackedSwing>(reader, &slamEvent.swing, [](const PackedSwing& v)
+		{
+			return CamPatternInvokeSwing{
+				.d = v.d,
+				.length = v.length,
+				.v = CamPatternInvokeSwingValue{ .scale = v.scale, .repeat = v.repeat, .decayOrder = v.decayOrder },
+			};
+		});
+
+		const std::size_t count = reader.readCount();
+		pCamera->tilt.clear();
+		for (std::size_t i = 0U; i < count && !reader.failed(); ++i)
+		{
+			const Pulse y = reader.read<Pulse>();
+			pCamera->tilt.emplace_hint(pCamera->tilt.end(), y, ReadTiltValue(reader));
+		}
+	}
+
+	void WriteBGInfo(BinaryWriter& writer, const BGInfo& bg)
+	{
+		writer.writeString(bg.filename);
+		for (const auto& kshBG : bg.legacy.bg)
+		{
+			writer.writeString(kshBG.filename);
+		}
+		writer.writeString(bg.legacy.layer.filename);
+		writer.write(bg.legacy.layer.duration);
+		writer.write(static_cast<std::uint8_t>(bg.legacy.layer.rotation.tilt));
+		writer.write(static_cast<std::uint8_t>(bg.legacy.layer.rotation.spin));
+		writer.writeString(bg.legacy.movie.filename);
+		writer.write(bg.legacy.movie.offset);
+	}
+
+	void ReadBGInfo(BinaryReader& reader, BGInfo* pBG)
+	{
+		pBG->filename = reader.readString();
+		for (auto& kshBG : pBG->legacy.bg)
+		{
+			kshBG.filename = reader.readString();
+		}
+		pBG->legacy.layer.filename = reader.readString();
+		pBG->legacy.layer.duration = reader.read<std::int32_t>();
+		pBG->legacy.layer.rotation.tilt = reader.read<std::uint8_t>() != 0U;
+		pBG->legacy.layer.rotation.spin = reader.read<std::uint8_t>() != 0U;
+		pBG->legacy.movie.filename = reader.readString();
+		pBG->legacy.movie.offset = reader.read<std::int32_t>();
+	}
+
+	void WriteEditorAndCompatInfo(BinaryWriter& writer, const EditorInfo& editor, const CompatInfo& compat)
+	{
+		writer.writeString(editor.appName);
+		writer.writeString(editor.appVersion);
+		WriteStringMulti(writer, editor.comment);
+
+		writer.writeString(compat.kshVersion);
+		WriteStringDict(writer, compat.kshUnknown.meta);
+		WriteDict(writer, compat.kshUnknown.option, [&](const ByPulseMulti<std::string>& byPulse) { WriteStringMulti(writer, byPulse); });
+		WriteStringMulti(writer, compat.kshUnknown.line);
+	}
+
+	void ReadEditorAndCompatInfo(BinaryReader& reader, EditorInfo* pEditor, CompatInfo* pCompat)
+	{
+		pEditor->appName = reader.readString();
+		pEditor->appVersion = reader.readString();
+		ReadStringMulti(reader, &pEditor->comment);
+
+		pCompat->kshVersion = reader.readString();
+		ReadStringDict(reader, &pCompat->kshUnknown.meta);
+		ReadDict(reader, &pCompat->kshUnknown.option, [&](ByPulseMulti<std::string>* pByPulse) { ReadStringMulti(reader, pByPulse); });
+		ReadStringMulti(reader, &pCompat->kshUnknown.line);
+	}
+
+	void WriteTimingCache(BinaryWriter& writer, const TimingCache& cache)
+	{
+		writer.writeArray(cache.bpmChangePulses);
+		writer.writeArray(cache.bpmChangeSecs);
+		writer.writeArray(cache.bpmChangeBPMs);
+		writer.writeArray(cache.timeSigChangeMeasureIdxs);
+		writer.writeArray(cache.timeSigChangePulses);
+		writer.writeArray(cache.timeSigChangeTimeSigs);
+	}
+
+	void ReadTimingCache(BinaryReader& reader, TimingCache* pCache)
+	{
+		pCache->bpmChangePulses = reader.readArray<Pulse>();
+		pCache->bpmChangeSecs = reader.readArray<double>();
+		pCache->bpmChangeBPMs = reader.readArray<double>();
+		pCache->timeSigChangeMeasureIdxs = reader.readArray<std::int64_t>();
+		pCache->timeSigChangePulses = reader.readArray<Pulse>();
+		pCache->timeSigChangeTimeSigs = reader.readArray<TimeSig>();
+	}
+
+	bool ReadHeader(BinaryReader& reader, std::uint64_t sourceHash)
+	{
+		const auto magic = reader.read<std::array<char, 8>>();
+		const std::uint32_t formatVersion = reader.read<std::uint32_t>();
+		const std::uint64_t storedSourceHash = reader.read<std::uint64_t>();
+		return !reader.failed() && magic == kMagic && formatVersion == kKsonBinaryFormatVersion && storedSourceHash == sourceHash;
+	}
+}
+
+kson::CompiledChartData kson::CompileChartData(ChartData&& chartData)
+{
+	// Expand laser sections into linear segments only
+	for (auto& lane : chartData.note.laser)
+	{
+		for (auto& [y, section] : lane)
+		{
+			section = ExpandCurveSegments(section, kCurveSubdivisionInterval);
+		}
+	}
+
+	// Expand scroll_speed into linear segments only, then bake stops into it
+	chartData.beat.scrollSpeed = ExpandCurveSegments(chartData.beat.scrollSpeed, kCurveSubdivisionInterval);
+	chartData.beat.scrollSpeed = BakeStopIntoScrollSpeed(chartData.beat.scrollSpeed, chartData.beat.stop);
+
+	TimingCache timingCache = CreateTimingCache(chartData.beat);
+	return CompiledChartData{
+		.chartData = std::move(chartData),
+		.timingCache = std::move(timingCache),
+	};
+}
+
+std::uint64_t kson::ChartContentHash(const void* data, std::size_t size)
+{
+	// FNV-1a (64-bit)
+	const auto* const bytes = static_cast<const std::uint8_t*>(data);
+	std::uint64_t hash = 14695981039346656037ULL;
+	for (std::size_t i = 0U; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+std::string kson::SerializeKsonBinaryChartData(const CompiledChartData& compiledChartData, std::uint64_t sourceHash)
+{
+	const ChartData& chartData = compiledChartData.chartData;
+
+	BinaryWriter writer;
+	writer.write(kMagic);
+	writer.write(kKsonBinaryFormatVersion);
+	writer.write(sourceHash);
+
+	WriteMetaInfo(writer, chartData.meta);
+	WriteBeatInfo(writer, chartData.beat);
+	writer.write(chartData.gauge.total);
+	WriteNoteInfo(writer, chartData.note);
+	WriteAudioInfo(writer, chartData.audio);
+	WriteCameraInfo(writer, chartData.camera);
+	WriteBGInfo(writer, chartData.bg);
+	WriteEditorAndCompatInfo(writer, chartData.editor, chartData.compat);
+#ifndef KSON_WITHOUT_JSON_DEPENDENCY
+	writer.writeString(chartData.impl.dump());
+#else
+	writer.writeString(std::string{});
+#endif
+	writer.write(static_cast<std::int32_t>(chartData.error));
+
+	WriteTimingCache(writer, compiledChartData.timingCache);
+
+	return std::move(writer.buffer());
+}
+
+kson::ErrorType kson::SaveKsonBinaryChartData(std::ostream& stream, const CompiledChartData& compiledChartData, std::uint64_t sourceHash)
+{
+	const std::string buffer = SerializeKsonBinaryChartData(compiledChartData, sourceHash);
+	stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	return stream.good() ? ErrorType::None : ErrorType::GeneralIOError;
+}
+
+kson::ErrorType kson::SaveKsonBinaryChartData(const std::string& filePath, const CompiledChartData& compiledChartData, std::uint64_t sourceHash)
+{
+	const auto fsPath = U8Path(filePath);
+	auto tempPath = fsPath;
+	tempPath += ".tmp";
+
+	{
+		std::ofstream ofs(tempPath, std::ios_base::binary | std::ios_base::trunc);
+		if (!ofs.good())
+		{
+			return ErrorType::CouldNotOpenOutputFileStream;
+		}
+
+		const ErrorType error = SaveKsonBinaryChartData(ofs, compiledChartData, sourceHash);
+		ofs.close();
+		if (error != ErrorType::None || ofs.fail())
+		{
+			std::error_code ec;
+			std::filesystem::remove(tempPath, ec);
+			return ErrorType::GeneralIOError;
+		}
+	}
+
+	std::error_code ec;
+	std::filesystem::rename(tempPath, fsPath, ec);
+	if (ec)
+	{
+		std::filesystem::remove(tempPath, ec);
+		return ErrorType::GeneralIOError;
+	}
+	return ErrorType::None;
+}
+
+std::optional<kson::CompiledChartData> kson::LoadKsonBinaryChartData(const void* data, std::size_t size, std::uint64_t sourceHash)
+{
+	BinaryReader reader{ data, size };
+	if (!ReadHeader(reader, sourceHash))
+	{
+		return std::nullopt;
+	}
+
+	CompiledChartData compiledChartData;
+	ChartData& chartData = compiledChartData.chartData;
+	ReadMetaInfo(reader, &chartData.meta);
+	ReadBeatInfo(reader, &chartData.beat);
+	chartData.gauge.total = reader.read<std::int32_t>();
+	ReadNoteInfo(reader, &chartData.note);
+	ReadAudioInfo(reader, &chartData.audio);
+	ReadCameraInfo(reader, &chartData.camera);
+	ReadBGInfo(reader, &chartData.bg);
+	ReadEditorAndCompatInfo(reader, &chartData.editor, &chartData.compat);
+	const std::string implStr = reader.readString();
+	chartData.error = static_cast<ErrorType>(reader.read<std::int32_t>());
+
+	ReadTimingCache(reader, &compiledChartData.timingCache);
+
+	if (reader.failed())
+	{
+		return std::nullopt;
+	}
+
+#ifndef KSON_WITHOUT_JSON_DEPENDENCY
+	if (!implStr.empty())
+	{
+		chartData.impl = nlohmann::json::parse(implStr, nullptr, false);
+		if (chartData.impl.is_discarded())
+		{
+			return std::nullopt;
+		}
+	}
+#endif
+
+	return compiledChartData;
+}
+
+bool kson::IsKsonBinaryChartDataUpToDate(const void* data, std::size_t size, std::uint64_t sourceHash)
+{
+	BinaryReader reader{ data, size };
+	return ReadHeader(reader, sourceHash);
+}
@@ -724,6 +724,140 @@ TEST_CASE("KSH scroll_speed Loading", "[ksh_io][scroll_speed]") {
 	}
 }
 
+TEST_CASE("KSH line parsing", "[ksh_io][line_parsing]") {
+	auto toKsonString = [](const kson::ChartData& chart) {
+		std::ostringstream oss;
+		REQUIRE(kson::SaveKsonChartData(oss, chart) == kson::ErrorType::None);
+		return oss.str();
+	};
+
+	SECTION("Line endings do not affect the result") {
+		std::ifstream ifs(g_assetsDir + "/Gram_ex.ksh", std::ios_base::binary);
+		REQUIRE(ifs.good());
+		std::ostringstream content;
+		content << ifs.rdbuf();
+		const std::string lf = content.str();
+
+		std::string crlf;
+		for (const char c : lf) {
+			if (c == '\n') {
+				crlf.push_back('\r');
+			}
+			crlf.push_back(c);
+		}
+
+		std::string noTrailingLineBreak = lf;
+		while (!noTrailingLineBreak.empty() && (noTrailingLineBreak.back() == '\n' || noTrailingLineBreak.back() == '\r')) {
+			noTrailingLineBreak.pop_back();
+		}
+
+		std::istringstream lfStream(lf);
+		std::istringstream crlfStream(crlf);
+		std::istringstream noTrailingLineBreakStream(noTrailingLineBreak);
+		const kson::ChartData lfChart = kson::LoadKshChartData(lfStream);
+		const kson::ChartData crlfChart = kson::LoadKshChartData(crlfStream);
+		const kson::ChartData noTrailingLineBreakChart = kson::LoadKshChartData(noTrailingLineBreakStream);
+		REQUIRE(lfChart.error == kson::ErrorType::None);
+		REQUIRE(crlfChart.error == kson::ErrorType::None);
+		REQUIRE(noTrailingLineBreakChart.error == kson::ErrorType::None);
+
+		const std::string lfKson = toKsonString(lfChart);
+		REQUIRE(toKsonString(crlfChart) == lfKson);
+		REQUIRE(toKsonString(noTrailingLineBreakChart) == lfKson);
+		REQUIRE(toKsonString(kson::LoadKshChartData(g_assetsDir + "/Gram_ex.ksh")) == lfKson);
+	}
+
+	SECTION("Comments and numeric values with CRLF") {
+		std::stringstream ss;
+		ss << "title=Line Parsing Test\r\n";
+		ss << "//header\\ncomment\r\n";
+		ss << "t=150\r\n";
+		ss << "level=7\r\n";
+		ss << "--\r\n";
+		ss << "//body\\\\ncomment\r\n";
+		ss << "t=120.5\r\n";
+		ss << "0000|00|--\r\n";
+		ss << "--\r\n";
+		ss << "t=-0\r\n";
+		ss << "0000|00|--\r\n";
+		ss << "--";
+
+		const kson::ChartData chart = kson::LoadKshChartData(ss);
+		REQUIRE(chart.error == kson::ErrorType::None);
+
+		// "\n" in comments is converted to a line break
+		REQUIRE(chart.editor.comment.size() == 2);
+		REQUIRE(chart.editor.comment.begin()->second == "header\ncomment");
+		REQUIRE(std::next(chart.editor.comment.begin())->second == "body\\\ncomment");
+
+		REQUIRE(chart.meta.level == 7);
+		REQUIRE(chart.beat.bpm.at(0) == Approx(120.5));
+		REQUIRE(!chart.beat.bpm.contains(kson::kResolution4));
+	}
+}
+
+TEST_CASE("KSH meta data loading", "[ksh_io][meta]") {
+	SECTION("Same meta data as full chart loading (bundled charts)") {
+		for (const std::string filename : { "Gram_lt.ksh", "Gram_ch.ksh", "Gram_ex.ksh", "Gram_in.ksh" }) {
+			INFO("Testing file: " << filename);
+			const kson::MetaChartData metaChart = kson::LoadKshMetaChartData(g_assetsDir + "/" + filename);
+			const kson::ChartData chart = kson::LoadKshChartData(g_assetsDir + "/" + filename);
+			REQUIRE(metaChart.error == kson::ErrorType::None);
+			REQUIRE(chart.error == kson::ErrorType::None);
+			REQUIRE(metaChart.meta.title == chart.meta.title);
+			REQUIRE(metaChart.meta.artist == chart.meta.artist);
+			REQUIRE(metaChart.meta.chartAuthor == chart.meta.chartAuthor);
+			REQUIRE(metaChart.meta.jacketFilename == chart.meta.jacketFilename);
+			REQUIRE(metaChart.meta.jacketAuthor == chart.meta.jacketAuthor);
+			REQUIRE(metaChart.meta.difficulty.idx == chart.meta.difficulty.idx);
+			REQUIRE(metaChart.meta.level == chart.meta.level);
+			REQUIRE(metaChart.meta.dispBPM == chart.meta.dispBPM);
+			REQUIRE(metaChart.meta.information == chart.meta.information);
+			REQUIRE(metaChart.audio.bgm.filename == chart.audio.bgm.filename);
+			REQUIRE(metaChart.audio.bgm.vol == Approx(chart.audio.bgm.vol));
+			REQUIRE(metaChart.audio.bgm.preview.offset == chart.audio.bgm.preview.offset);
+			REQUIRE(metaChart.audio.bgm.preview.duration == chart.audio.bgm.preview.duration);
+		}
+	}
+
+	SECTION("Shift-JIS header") {
+		// "テスト" in Shift-JIS
+		const std::string kTestSJIS = "\x83\x65\x83\x58\x83\x67";
+		std::istringstream ss(
+			"title=" + kTestSJIS + "\r\n"
+			"artist=" + kTestSJIS + "2\r\n"
+			"difficulty=" + kTestSJIS + "\r\n"
+			"unknown=" + kTestSJIS + "\r\n"
+			"m=" + kTestSJIS + ".ogg;f.ogg\r\n"
+			"level=12\r\n"
+			"--\r\n");
+		const kson::MetaChartData metaChart = kson::LoadKshMetaChartData(ss);
+		REQUIRE(metaChart.error == kson::ErrorType::None);
+		REQUIRE(metaChart.meta.title == "\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88");
+		REQUIRE(metaChart.meta.artist == "\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88" "2");
+		REQUIRE(metaChart.meta.difficulty.idx == 3);
+		REQUIRE(metaChart.meta.difficulty.name == "\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88");
+		REQUIRE(metaChart.audio.bgm.filename == "\xE3\x83\x86\xE3\x82\xB9\xE3\x83\x88.ogg");
+		REQUIRE(metaChart.meta.level == 12);
+	}
+
+	SECTION("Lines after the first bar line are not read") {
+		std::string content = "title=Header Only\nlevel=5\n--\n";
+		content += std::string(100000, 'x');
+		std::istringstream ss(content);
+		const kson::MetaChartData metaChart = kson::LoadKshMetaChartData(ss);
+		REQUIRE(metaChart.error == kson::ErrorType::None);
+		REQUIRE(metaChart.meta.title == "Header Only");
+		REQUIRE(metaChart.meta.level == 5);
+		REQUIRE(ss.tellg() < static_cast<std::streamoff>(content.size()));
+	}
+
+	SECTION("Missing bar line") {
+		std::istringstream ss("title=No Bar Line\nlevel=5\n");
+		REQUIRE(kson::LoadKshMetaChartData(ss).error == kson::ErrorType::GeneralChartFormatError);
+	}
+}
+
 TEST_CASE("KSH I/O lossless test (bundled charts)", "[ksh_io][kson_io][ksh_lossless][bundled]") {
 	auto testKsonRoundTrip = [](const std::string& filename) {
 		// ksh1 → kson1
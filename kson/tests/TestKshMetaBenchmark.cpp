@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+#include <kson/kson.hpp>
+#include <kson/IO/KshIO.hpp>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+extern std::string g_assetsDir;
+extern std::filesystem::path g_exeDir;
+
+namespace
+{
+	std::vector<std::string> CollectKshFiles()
+	{
+		std::vector<std::string> kshFiles;
+
+		std::filesystem::path songsPath = g_exeDir / "../../../kshootmania/App/songs";
+		songsPath = std::filesystem::weakly_canonical(songsPath);
+		const std::filesystem::path searchPath = (std::filesystem::exists(songsPath) && std::filesystem::is_directory(songsPath)) ? songsPath : std::filesystem::path(g_assetsDir);
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(searchPath)) {
+			if (entry.is_regular_file() && entry.path().extension() == ".ksh") {
+				kshFiles.push_back(entry.path().string());
+			}
+		}
+		return kshFiles;
+	}
+
+	template <typename Func>
+	std::vector<double> MeasurePerFileMicroseconds(const std::vector<std::string>& kshFiles, int numIterations, Func func)
+	{
+		std::vector<double> result;
+		result.reserve(kshFiles.size());
+		for (const auto& file : kshFiles) {
+			const auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < numIterations; ++i) {
+				func(file);
+			}
+			const auto end = std::chrono::steady_clock::now();
+			result.push_back(std::chrono::duration<double, std::micro>(end - start).count() / numIterations);
+		}
+		return result;
+	}
+
+	void PrintStats(const std::string& label, std::vector<double> microseconds)
+	{
+		std::sort(microseconds.begin(), microseconds.end());
+		double total = 0.0;
+		for (const double us : microseconds) {
+			total += us;
+		}
+		std::cout << label
+			<< ": mean " << total / microseconds.size() << " us"
+			<< ", median " << microseconds[microseconds.size() / 2] << " us"
+			<< ", max " << microseconds.back() << " us"
+			<< ", total " << total / 1000 << " ms"
+			<< std::endl;
+	}
+}
+
+// Measures the per-file cost of loading chart meta data, which is what song select does when a folder is opened
+// Uses the songs directory if available (same as the "all songs" tests), otherwise the bundled charts
+TEST_CASE("KSH meta data loading benchmark", "[.][ksh_io][benchmark]") {
+	constexpr int kNumIterations = 20;
+
+	const std::vector<std::string> kshFiles = CollectKshFiles();
+	if (kshFiles.empty()) {
+		WARN("No KSH files found");
+		return;
+	}
+	std::cout << "Files: " << kshFiles.size() << std::endl;
+
+	// Warm up the file system cache
+	for (const auto& file : kshFiles) {
+		REQUIRE(kson::LoadKshMetaChartData(file).error == kson::ErrorType::None);
+	}
+
+	PrintStats("LoadKshMetaChartData", MeasurePerFileMicroseconds(kshFiles, kNumIterations, [](const std::string& file) {
+		const kson::MetaChartData chartData = kson::LoadKshMetaChartData(file);
+		REQUIRE(chartData.error == kson::ErrorType::None);
+	}));
+
+	PrintStats("LoadKshChartData (for comparison)", MeasurePerFileMicroseconds(kshFiles, kNumIterations, [](const std::string& file) {
+		const kson::ChartData chartData = kson::LoadKshChartData(file);
+		REQUIRE(chartData.error == kson::ErrorType::None);
+	}));
+}
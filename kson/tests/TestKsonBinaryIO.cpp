@@ -0,0 +1,120 @@
+#include <catch2/catch.hpp>
+#include <kson/kson.hpp>
+#include <kson/IO/KsonBinaryIO.hpp>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	std::string ReadFileContent(const std::string& filePath)
+	{
+		std::ifstream ifs(filePath, std::ios_base::binary);
+		std::ostringstream oss;
+		oss << ifs.rdbuf();
+		return oss.str();
+	}
+
+	std::string ToKsonString(const kson::ChartData& chartData)
+	{
+		std::ostringstream oss;
+		kson::SaveKsonChartData(oss, chartData);
+		return oss.str();
+	}
+
+	kson::CompiledChartData CompileAsset(const std::string& filePath, std::uint64_t* pSourceHash)
+	{
+		const std::string content = ReadFileContent(filePath);
+		*pSourceHash = kson::ChartContentHash(content.data(), content.size());
+
+		std::istringstream iss(content);
+		return kson::CompileChartData(kson::LoadKshChartData(iss));
+	}
+}
+
+TEST_CASE("CompileChartData expands curves and builds timing cache", "[kson_binary]")
+{
+	kson::ChartData chartData;
+	chartData.beat.bpm[0] = 120.0;
+	chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+	chartData.beat.scrollSpeed[0] = kson::GraphPoint{ kson::GraphValue{ 1.0 }, kson::GraphCurveValue{ 0.25, 0.75 } };
+	chartData.beat.scrollSpeed[960] = kson::GraphValue{ 2.0 };
+	chartData.beat.stop[1920] = 240;
+
+	const kson::CompiledChartData compiled = kson::CompileChartData(std::move(chartData));
+
+	// Curve segment is subdivided and the stop is baked into scroll_speed
+	REQUIRE(compiled.chartData.beat.scrollSpeed.size() > 3U);
+	for (const auto& [y, point] : compiled.chartData.beat.scrollSpeed)
+	{
+		REQUIRE(point.curve.isLinear());
+	}
+	REQUIRE(compiled.chartData.beat.scrollSpeed.count(1920 + 240) == 1U);
+
+	REQUIRE(compiled.timingCache.bpmChangePulses == std::vector<kson::Pulse>{ 0 });
+	REQUIRE(compiled.timingCache.bpmChangeBPMs == std::vector<double>{ 120.0 });
+}
+
+TEST_CASE("Compiled chart round trip", "[kson_binary]")
+{
+	for (const std::string filePath : { "assets/Gram_ch.ksh", "assets/Gram_ex.ksh", "assets/Gram_in.ksh", "assets/Gram_lt.ksh" })
+	{
+		INFO(filePath);
+
+		std::uint64_t sourceHash = 0U;
+		const kson::CompiledChartData compiled = CompileAsset(filePath, &sourceHash);
+		REQUIRE(compiled.chartData.error == kson::ErrorType::None);
+
+		const std::string binary = kson::SerializeKsonBinaryChartData(compiled, sourceHash);
+		REQUIRE(kson::IsKsonBinaryChartDataUpToDate(binary.data(), binary.size(), sourceHash));
+
+		const auto loaded = kson::LoadKsonBinaryChartData(binary.data(), binary.size(), sourceHash);
+		REQUIRE(loaded.has_value());
+		REQUIRE(ToKsonString(loaded->chartData) == ToKsonString(compiled.chartData));
+
+		// Values must be bit-identical (kson output rounds floating-point values)
+		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumLaserLanes; ++laneIdx)
+		{
+			const auto& expectedLane = compiled.chartData.note.laser[laneIdx];
+			const auto& actualLane = loaded->chartData.note.laser[laneIdx];
+			REQUIRE(actualLane.size() == expectedLane.size());
+			for (auto itrExpected = expectedLane.begin(), itrActual = actualLane.begin(); itrExpected != expectedLane.end(); ++itrExpected, ++itrActual)
+			{
+				REQUIRE(itrActual->first == itrExpected->first);
+				REQUIRE(itrActual->second.w == itrExpected->second.w);
+				REQUIRE(itrActual->second.v.size() == itrExpected->second.v.size());
+				for (auto p = itrExpected->second.v.begin(), q = itrActual->second.v.begin(); p != itrExpected->second.v.end(); ++p, ++q)
+				{
+					REQUIRE(q->first == p->first);
+					REQUIRE(q->second.v.v == p->second.v.v);
+					REQUIRE(q->second.v.vf == p->second.v.vf);
+				}
+			}
+		}
+
+		REQUIRE(loaded->timingCache.bpmChangePulses == compiled.timingCache.bpmChangePulses);
+		REQUIRE(loaded->timingCache.bpmChangeSecs == compiled.timingCache.bpmChangeSecs);
+		REQUIRE(loaded->timingCache.bpmChangeBPMs == compiled.timingCache.bpmChangeBPMs);
+		REQUIRE(loaded->timingCache.timeSigChangeMeasureIdxs == compiled.timingCache.timeSigChangeMeasureIdxs);
+		REQUIRE(loaded->timingCache.timeSigChangePulses == compiled.timingCache.timeSigChangePulses);
+	}
+}
+
+TEST_CASE("Compiled chart rejects stale or broken data", "[kson_binary]")
+{
+	std::uint64_t sourceHash = 0U;
+	const kson::CompiledChartData compiled = CompileAsset("assets/Gram_ex.ksh", &sourceHash);
+	const std::string binary = kson::SerializeKsonBinaryChartData(compiled, sourceHash);
+
+	// Source content changed
+	REQUIRE_FALSE(kson::IsKsonBinaryChartDataUpToDate(binary.data(), binary.size(), sourceHash + 1U));
+	REQUIRE_FALSE(kson::LoadKsonBinaryChartData(binary.data(), binary.size(), sourceHash + 1U).has_value());
+
+	// Truncated (e.g., interrupted while writing)
+	REQUIRE_FALSE(kson::LoadKsonBinaryChartData(binary.data(), binary.size() / 2U, sourceHash).has_value());
+	REQUIRE_FALSE(kson::LoadKsonBinaryChartData(binary.data(), 4U, sourceHash).has_value());
+
+	// Different format version
+	std::string otherVersion = binary;
+	otherVersion[8] = static_cast<char>(kson::kKsonBinaryFormatVersion + 1U);
+	REQUIRE_FALSE(kson::LoadKsonBinaryChartData(otherVersion.data(), otherVersion.size(), sourceHash).has_value());
+}
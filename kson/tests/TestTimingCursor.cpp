@@ -0,0 +1,93 @@
+#include <catch2/catch.hpp>
+#include <kson/kson.hpp>
+#include <kson/Util/TimingUtils.hpp>
+
+namespace
+{
+	kson::BeatInfo CreateBeatInfoWithManyTempoChanges()
+	{
+		kson::BeatInfo beat;
+		beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+		for (int i = 0; i < 64; ++i)
+		{
+			beat.bpm[i * 480] = 100.0 + (i * 37 % 150);
+		}
+		return beat;
+	}
+}
+
+TEST_CASE("TimingCache layout", "[timing]")
+{
+	kson::BeatInfo beat;
+	beat.bpm[0] = 120.0;
+	beat.bpm[960] = 240.0;
+	beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+	beat.timeSig[2] = kson::TimeSig{ 3, 4 };
+
+	const auto cache = kson::CreateTimingCache(beat);
+
+	REQUIRE(cache.bpmChangePulses == std::vector<kson::Pulse>{ 0, 960 });
+	REQUIRE(cache.bpmChangeSecs.size() == 2U);
+	REQUIRE(cache.bpmChangeSecs[0] == Approx(0.0));
+	REQUIRE(cache.bpmChangeSecs[1] == Approx(2.0));
+	REQUIRE(cache.bpmChangeBPMs == std::vector<double>{ 120.0, 240.0 });
+
+	REQUIRE(cache.timeSigChangeMeasureIdxs == std::vector<std::int64_t>{ 0, 2 });
+	REQUIRE(cache.timeSigChangePulses == std::vector<kson::Pulse>{ 0, 1920 });
+	REQUIRE(kson::TimeSigAt(1920, beat, cache).n == 3);
+	REQUIRE(kson::MeasureIdxToPulse(3, beat, cache) == 1920 + 720);
+	REQUIRE(kson::PulseToMeasureIdx(1920 + 719, beat, cache) == 2);
+	REQUIRE(kson::IsBarLinePulse(1920 + 720, beat, cache));
+	REQUIRE_FALSE(kson::IsBarLinePulse(1920 + 960, beat, cache));
+}
+
+TEST_CASE("TimingCache without changes at zero", "[timing]")
+{
+	kson::BeatInfo beat;
+	beat.bpm[480] = 150.0;
+
+	const auto cache = kson::CreateTimingCache(beat);
+
+	// The first tempo is extended to zero, and 4/4 is used as the default time signature
+	REQUIRE(cache.bpmChangePulses.front() == 0);
+	REQUIRE(kson::TempoAt(0, cache) == Approx(150.0));
+	REQUIRE(kson::PulseToSec(480, beat, cache) == Approx(0.8));
+	REQUIRE(kson::MeasureIdxToPulse(1, beat, cache) == 960);
+}
+
+TEST_CASE("TimingCursor matches free functions", "[timing]")
+{
+	const kson::BeatInfo beat = CreateBeatInfoWithManyTempoChanges();
+	const auto cache = kson::CreateTimingCache(beat);
+
+	SECTION("Forward playback") {
+		kson::TimingCursor cursor(cache);
+		for (double sec = -1.0; sec < 120.0; sec += 1.0 / 240)
+		{
+			REQUIRE(cursor.secToPulse(sec) == kson::SecToPulse(sec, beat, cache));
+			REQUIRE(cursor.secToPulseDouble(sec) == kson::SecToPulseDouble(sec, beat, cache));
+		}
+	}
+
+	SECTION("Pulse to sec") {
+		kson::TimingCursor cursor(cache);
+		for (kson::Pulse pulse = -480; pulse < 64 * 480 + 960; pulse += 7)
+		{
+			REQUIRE(cursor.pulseToSec(pulse) == kson::PulseToSec(pulse, beat, cache));
+			REQUIRE(cursor.pulseDoubleToSec(pulse + 0.5) == kson::PulseDoubleToSec(pulse + 0.5, beat, cache));
+			REQUIRE(cursor.tempoAt(pulse) == kson::TempoAt(pulse, beat));
+		}
+	}
+
+	SECTION("Backward seeks and large jumps") {
+		kson::TimingCursor cursor(cache);
+		const std::vector<double> secs = { 50.0, 49.9, 3.0, 100.0, -5.0, 0.0, 80.0, 79.0, 78.5, 10.0 };
+		for (double sec : secs)
+		{
+			REQUIRE(cursor.secToPulse(sec) == kson::SecToPulse(sec, beat, cache));
+		}
+
+		cursor.reset();
+		REQUIRE(cursor.secToPulseDouble(0.25) == kson::SecToPulseDouble(0.25, beat, cache));
+	}
+}
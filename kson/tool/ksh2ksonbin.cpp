@@ -0,0 +1,143 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <cstdio>
+#include <stdexcept>
+#include "kson/kson.hpp"
+#include "kson/IO/KsonBinaryIO.hpp"
+
+enum ExitCode : int
+{
+	kExitSuccess = 0,
+	kExitNoArgument,
+	kExitError,
+};
+
+void PrintHelp()
+{
+	std::cerr <<
+		"ksh2ksonbin compiled chart cache builder\n"
+		"  Usage:\n"
+		"    ksh2ksonbin <songs folder> <cache folder>\n"
+		"  Compiles every .ksh file under <songs folder> (recursively) and writes\n"
+		"  <content hash>.kson.bin into <cache folder>. Up-to-date caches are skipped.\n"
+		"  KSM reads compiled charts from \"cache/chart\" in its app data folder.\n";
+}
+
+std::string ReadFileContent(const std::filesystem::path& path)
+{
+	std::ifstream ifs(path, std::ios_base::binary);
+	if (!ifs)
+	{
+		throw std::runtime_error("Cannot open file");
+	}
+	std::ostringstream oss;
+	oss << ifs.rdbuf();
+	return oss.str();
+}
+
+std::string CacheFilename(std::uint64_t sourceHash)
+{
+	char buf[32];
+	std::snprintf(buf, sizeof(buf), "%016llX.kson.bin", static_cast<unsigned long long>(sourceHash));
+	return buf;
+}
+
+bool IsCacheUpToDate(const std::filesystem::path& cachePath, std::uint64_t sourceHash)
+{
+	// Only the header needs to be checked
+	std::ifstream ifs(cachePath, std::ios_base::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+	char header[20] = {};
+	ifs.read(header, sizeof(header));
+	return ifs.gcount() == sizeof(header) && kson::IsKsonBinaryChartDataUpToDate(header, sizeof(header), sourceHash);
+}
+
+int DoBuild(const std::filesystem::path& songsDir, const std::filesystem::path& cacheDir)
+{
+	std::filesystem::create_directories(cacheDir);
+
+	std::size_t numCompiled = 0U;
+	std::size_t numSkipped = 0U;
+	std::size_t numFailed = 0U;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(songsDir, std::filesystem::directory_options::skip_permission_denied))
+	{
+		if (!entry.is_regular_file() || entry.path().extension() != ".ksh")
+		{
+			continue;
+		}
+
+		const std::filesystem::path& chartPath = entry.path();
+		try
+		{
+			const std::string content = ReadFileContent(chartPath);
+			const std::uint64_t sourceHash = kson::ChartContentHash(content.data(), content.size());
+			const std::filesystem::path cachePath = cacheDir / CacheFilename(sourceHash);
+			if (IsCacheUpToDate(cachePath, sourceHash))
+			{
+				++numSkipped;
+				continue;
+			}
+
+			std::istringstream iss(content);
+			kson::ChartData chartData = kson::LoadKshChartData(iss);
+			if (chartData.error != kson::ErrorType::None)
+			{
+				std::cerr << "Error: " << kson::GetErrorString(chartData.error) << ": " << chartPath.string() << '\n';
+				++numFailed;
+				continue;
+			}
+
+			const kson::ErrorType error = kson::SaveKsonBinaryChartData(cachePath.string(), kson::CompileChartData(std::move(chartData)), sourceHash);
+			if (error != kson::ErrorType::None)
+			{
+				std::cerr << "Error: " << kson::GetErrorString(error) << ": " << cachePath.string() << '\n';
+				++numFailed;
+				continue;
+			}
+			++numCompiled;
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << "Error: " << e.what() << ": " << chartPath.string() << '\n';
+			++numFailed;
+		}
+	}
+
+	std::cerr << "Compiled: " << numCompiled << ", Up-to-date: " << numSkipped << ", Failed: " << numFailed << '\n';
+	return numFailed == 0U ? kExitSuccess : kExitError;
+}
+
+int main(int argc, char *argv[])
+{
+	try
+	{
+		if (argc != 3)
+		{
+			PrintHelp();
+			return kExitNoArgument;
+		}
+
+		const std::filesystem::path songsDir{ argv[1] };
+		if (!std::filesystem::is_directory(songsDir))
+		{
+			std::cerr << "Error: Not a directory: " << argv[1] << '\n';
+			return kExitError;
+		}
+		return DoBuild(songsDir, std::filesystem::path{ argv[2] });
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "Error: Uncaught exception '" << e.what() << "'\n";
+		return kExitError;
+	}
+	catch (...)
+	{
+		std::cerr << "Error: Uncaught exception (unknown)\n";
+		return kExitError;
+	}
+}
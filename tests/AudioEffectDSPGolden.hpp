@@ -0,0 +1,750 @@
+#pragma once
+#include "AudioEffectDSPHarness.hpp"
+
+// Note: This file is generated by the "[golden-update]" test case in TestAudioEffectDSPGolden.cpp. Do not edit manually.
+namespace AudioEffectDSPGolden
+{
+	inline const std::vector<AudioEffectDSPHarness::GoldenEntry> kEntries = {
+		{ "Retrigger", 44100U, 1U, {
+			0.358305f, 0.000602051f, 0.208184f, 0.278371f, 0.358305f, 0.511751f, 0.208184f, 0.393014f, 0.358305f, 0.501781f, 0.208184f, 0.411572f,
+			0.358305f, 0.503872f, 0.208184f, 0.410617f, 0.358305f, 0.503604f, 0.208187f, 0.410218f, 0.35233f, 0.0169748f, 0.224393f, 0.272262f,
+			0.35233f, 0.3534f, 0.224393f, 0.224237f, 0.35233f, 0.35237f, 0.224393f, 0.226024f, 0.35233f, 0.354475f, 0.224393f, 0.224519f,
+			0.35233f, 0.391287f, 0.224391f, 0.281271f, 0.174921f, 0.0126998f, 0.106452f, 0.131993f, 0.174921f, 0.251348f, 0.106452f, 0.204932f,
+			0.174921f, 0.246881f, 0.106452f, 0.196647f, 0.174921f, 0.255885f, 0.106452f, 0.199252f, 0.174921f, 0.251355f, 0.106451f, 0.200505f,
+		} },
+		{ "Retrigger", 44100U, 2U, {
+			0.358305f, 0.000602051f, 0.346075f, 0.0295326f, 0.208184f, 0.278371f, 0.239762f, 0.265908f, 0.358305f, 0.511751f, 0.346075f, 0.502543f,
+			0.208184f, 0.393014f, 0.239762f, 0.395859f, 0.358305f, 0.501781f, 0.346075f, 0.499398f, 0.208184f, 0.411572f, 0.239762f, 0.43484f,
+			0.358305f, 0.503872f, 0.346075f, 0.49819f, 0.208184f, 0.410617f, 0.239762f, 0.425808f, 0.358305f, 0.503604f, 0.346075f, 0.494863f,
+			0.208187f, 0.410218f, 0.239763f, 0.426642f, 0.35233f, 0.0169748f, 0.352476f, 0.0197761f, 0.224393f, 0.272262f, 0.224162f, 0.272514f,
+			0.35233f, 0.3534f, 0.352476f, 0.352765f, 0.224393f, 0.224237f, 0.224162f, 0.225794f, 0.35233f, 0.35237f, 0.352476f, 0.352476f,
+			0.224393f, 0.226024f, 0.224162f, 0.224024f, 0.35233f, 0.354475f, 0.352476f, 0.353287f, 0.224393f, 0.224519f, 0.224162f, 0.227365f,
+			0.35233f, 0.388376f, 0.352476f, 0.393609f, 0.224392f, 0.283421f, 0.224162f, 0.283964f, 0.173838f, 0.00807098f, 0.169884f, 0.00792464f,
+			0.111571f, 0.133795f, 0.109925f, 0.131537f, 0.173838f, 0.249731f, 0.169884f, 0.244101f, 0.111571f, 0.206521f, 0.109925f, 0.207372f,
+			0.173838f, 0.246894f, 0.169884f, 0.2456f, 0.111571f, 0.207931f, 0.109925f, 0.205157f, 0.173838f, 0.241773f, 0.169884f, 0.241655f,
+			0.111571f, 0.208095f, 0.109925f, 0.205688f, 0.173838f, 0.238768f, 0.169884f, 0.243069f, 0.111569f, 0.198969f, 0.109926f, 0.205541f,
+		} },
+		{ "Retrigger", 48000U, 1U, {
+			0.358706f, 0.000530035f, 0.206345f, 0.276927f, 0.358706f, 0.503314f, 0.206345f, 0.397906f, 0.358706f, 0.502434f, 0.206345f, 0.409403f,
+			0.358706f, 0.505228f, 0.206345f, 0.406685f, 0.358706f, 0.503464f, 0.206346f, 0.409696f, 0.352438f, 0.0166179f, 0.224372f, 0.272709f,
+			0.352438f, 0.353376f, 0.224372f, 0.224292f, 0.352438f, 0.352337f, 0.224372f, 0.225871f, 0.352438f, 0.35278f, 0.224372f, 0.224494f,
+			0.352438f, 0.391725f, 0.224371f, 0.276445f, 0.173492f, 0.00563041f, 0.107715f, 0.130319f, 0.173492f, 0.245775f, 0.107715f, 0.205146f,
+			0.173492f, 0.247303f, 0.107715f, 0.206646f, 0.173492f, 0.249842f, 0.107715f, 0.210618f, 0.173492f, 0.244248f, 0.107713f, 0.201991f,
+		} },
+		{ "Retrigger", 48000U, 2U, {
+			0.358706f, 0.000530035f, 0.345877f, 0.028302f, 0.206345f, 0.276927f, 0.241295f, 0.267606f, 0.358706f, 0.503314f, 0.345877f, 0.490334f,
+			0.206345f, 0.397906f, 0.241295f, 0.416193f, 0.358706f, 0.502434f, 0.345877f, 0.486174f, 0.206345f, 0.409403f, 0.241295f, 0.426713f,
+			0.358706f, 0.505228f, 0.345877f, 0.494269f, 0.206345f, 0.406685f, 0.241295f, 0.429363f, 0.358706f, 0.503464f, 0.345877f, 0.494003f,
+			0.206346f, 0.409696f, 0.241296f, 0.428369f, 0.352438f, 0.0166179f, 0.352557f, 0.0186444f, 0.224372f, 0.272709f, 0.224168f, 0.272294f,
+			0.352438f, 0.353376f, 0.352557f, 0.35451f, 0.224372f, 0.224292f, 0.224168f, 0.225669f, 0.352438f, 0.352337f, 0.352557f, 0.352557f,
+			0.224372f, 0.225871f, 0.224168f, 0.225223f, 0.352438f, 0.35278f, 0.352557f, 0.352583f, 0.224372f, 0.224494f, 0.224168f, 0.224526f,
+			0.352438f, 0.384537f, 0.352557f, 0.394277f, 0.224371f, 0.277669f, 0.224167f, 0.287225f, 0.176132f, 0.00980929f, 0.170438f, 0.00819958f,
+			0.110502f, 0.133646f, 0.108551f, 0.134322f, 0.176132f, 0.24299f, 0.170438f, 0.24051f, 0.110502f, 0.204863f, 0.108551f, 0.206463f,
+			0.176132f, 0.248478f, 0.170438f, 0.24695f, 0.110502f, 0.205989f, 0.108551f, 0.203859f, 0.176132f, 0.244168f, 0.170438f, 0.24703f,
+			0.110502f, 0.202381f, 0.108551f, 0.205455f, 0.176132f, 0.244217f, 0.170438f, 0.242008f, 0.110503f, 0.20567f, 0.108552f, 0.202576f,
+		} },
+		{ "Retrigger", 96000U, 1U, {
+			0.360397f, 0.000187313f, 0.202401f, 0.282108f, 0.360397f, 0.503949f, 0.202401f, 0.39798f, 0.360397f, 0.505281f, 0.202401f, 0.407089f,
+			0.360397f, 0.504547f, 0.202401f, 0.408493f, 0.360397f, 0.505294f, 0.202401f, 0.407025f, 0.35306f, 0.0122544f, 0.223886f, 0.273102f,
+			0.35306f, 0.353567f, 0.223886f, 0.224538f, 0.35306f, 0.353284f, 0.223886f, 0.224639f, 0.35306f, 0.353239f, 0.223886f, 0.223974f,
+			0.35306f, 0.393926f, 0.223886f, 0.278786f, 0.173556f, 0.00593122f, 0.109312f, 0.134473f, 0.173556f, 0.241932f, 0.109312f, 0.205418f,
+			0.173556f, 0.247992f, 0.109312f, 0.204788f, 0.173556f, 0.245788f, 0.109312f, 0.203496f, 0.173556f, 0.243281f, 0.109312f, 0.204012f,
+		} },
+		{ "Retrigger", 96000U, 2U, {
+			0.360397f, 0.000187313f, 0.345347f, 0.0200151f, 0.202401f, 0.282108f, 0.243792f, 0.263753f, 0.360397f, 0.503949f, 0.345347f, 0.479606f,
+			0.202401f, 0.39798f, 0.243792f, 0.42157f, 0.360397f, 0.505281f, 0.345347f, 0.489044f, 0.202401f, 0.407089f, 0.243792f, 0.4313f,
+			0.360397f, 0.504547f, 0.345347f, 0.492684f, 0.202401f, 0.408493f, 0.243792f, 0.428907f, 0.360397f, 0.505294f, 0.345347f, 0.494249f,
+			0.202401f, 0.407025f, 0.243793f, 0.429688f, 0.35306f, 0.0122544f, 0.352991f, 0.0127167f, 0.223886f, 0.273102f, 0.223991f, 0.273236f,
+			0.35306f, 0.353567f, 0.352991f, 0.353677f, 0.223886f, 0.224538f, 0.223991f, 0.224743f, 0.35306f, 0.353284f, 0.352991f, 0.352991f,
+			0.223886f, 0.224639f, 0.223991f, 0.223917f, 0.35306f, 0.353239f, 0.352991f, 0.352995f, 0.223886f, 0.223974f, 0.223991f, 0.224518f,
+			0.35306f, 0.393002f, 0.352991f, 0.39158f, 0.223886f, 0.283477f, 0.22399f, 0.281776f, 0.174623f, 0.00582052f, 0.173235f, 0.00583608f,
+			0.108855f, 0.131773f, 0.110384f, 0.134104f, 0.174623f, 0.244414f, 0.173235f, 0.249584f, 0.108855f, 0.203436f, 0.110384f, 0.200674f,
+			0.174623f, 0.244067f, 0.173235f, 0.243971f, 0.108855f, 0.207014f, 0.110384f, 0.207769f, 0.174623f, 0.249475f, 0.173235f, 0.243791f,
+			0.108855f, 0.203831f, 0.110384f, 0.20678f, 0.174623f, 0.245744f, 0.173235f, 0.25168f, 0.108855f, 0.208702f, 0.110385f, 0.205893f,
+		} },
+		{ "Gate", 44100U, 1U, {
+			0.358307f, 0.0f, 0.246745f, 0.220168f, 0.253489f, 0.220457f, 0.357421f, 0.000782821f, 0.0392525f, 0.315583f, 0.353221f, 0.0f,
+			0.253209f, 0.223713f, 0.25147f, 0.224528f, 0.353583f, 0.000886183f, 0.0431736f, 0.317014f, 0.353381f, 0.0f, 0.251978f, 0.223541f,
+			0.00271114f, 0.0244002f, 0.0270991f, 0.0f, 0.00271114f, 0.0244002f, 0.0270991f, 0.0f, 0.00271114f, 0.0244002f, 0.00866444f, 0.0f,
+			0.171882f, 0.00119071f, 0.018386f, 0.153895f, 0.175874f, 0.0f, 0.119228f, 0.108905f, 0.123353f, 0.107042f, 0.173689f, 0.000291475f,
+			0.02124f, 0.156769f, 0.171218f, 0.0f, 0.124125f, 0.111285f, 0.124232f, 0.108782f, 0.17615f, 0.00031154f, 0.0210926f, 0.15601f,
+		} },
+		{ "Gate", 44100U, 2U, {
+			0.358307f, 0.0f, 0.348735f, 0.0f, 0.246745f, 0.220168f, 0.257305f, 0.226651f, 0.253489f, 0.220457f, 0.248985f, 0.229453f,
+			0.357421f, 0.000782821f, 0.3496f, 0.000688131f, 0.0392525f, 0.315583f, 0.0414336f, 0.318735f, 0.353221f, 0.0f, 0.353886f, 0.0f,
+			0.253209f, 0.223713f, 0.250724f, 0.223357f, 0.25147f, 0.224528f, 0.251246f, 0.225267f, 0.353583f, 0.000886183f, 0.353481f, 0.000549545f,
+			0.0431736f, 0.317014f, 0.0402149f, 0.317024f, 0.353381f, 0.0f, 0.353726f, 0.0f, 0.251978f, 0.223541f, 0.251736f, 0.223736f,
+			0.00271114f, 0.0244002f, 0.0271114f, 0.0f, 0.0270991f, 0.0f, 0.0270991f, 0.0f, 0.00271114f, 0.0244002f, 0.0f, 0.0f,
+			0.0270991f, 0.0f, 0.0270991f, 0.0f, 0.00271114f, 0.0244002f, 0.0271114f, 0.0f, 0.00866444f, 0.0f, 0.00914482f, 0.0243892f,
+			0.167721f, 0.000509795f, 0.175213f, 0.000657193f, 0.0236032f, 0.154918f, 0.0203977f, 0.154611f, 0.174352f, 0.0f, 0.170333f, 0.0f,
+			0.125718f, 0.10897f, 0.123311f, 0.107657f, 0.123179f, 0.112143f, 0.122818f, 0.110437f, 0.175615f, 0.000295883f, 0.174484f, 0.000835027f,
+			0.020422f, 0.154524f, 0.0185521f, 0.154994f, 0.172935f, 0.0f, 0.172375f, 0.0f, 0.118374f, 0.1087f, 0.125425f, 0.108158f,
+			0.125056f, 0.111354f, 0.123251f, 0.111727f, 0.169344f, 0.000545383f, 0.17399f, 0.00124046f, 0.020123f, 0.151173f, 0.0213872f, 0.156107f,
+		} },
+		{ "Gate", 48000U, 1U, {
+			0.358708f, 0.0f, 0.247685f, 0.216622f, 0.257565f, 0.22328f, 0.350595f, 0.0f, 0.042498f, 0.319053f, 0.353297f, 0.0f,
+			0.251468f, 0.2234f, 0.250697f, 0.225074f, 0.353593f, 0.0f, 0.0431891f, 0.317011f, 0.353425f, 0.0f, 0.252011f, 0.223885f,
+			0.00259808f, 0.0233827f, 0.0259808f, 0.0f, 0.00259808f, 0.0233827f, 0.0259808f, 0.0f, 0.00259808f, 0.0233827f, 0.00830687f, 0.0f,
+			0.171783f, 0.000220386f, 0.0216445f, 0.154244f, 0.17374f, 0.0f, 0.122586f, 0.105332f, 0.125804f, 0.109816f, 0.172778f, 0.000510764f,
+			0.0201853f, 0.155615f, 0.173369f, 0.0f, 0.125005f, 0.109864f, 0.124242f, 0.110128f, 0.174124f, 0.00041843f, 0.0202002f, 0.155886f,
+		} },
+		{ "Gate", 48000U, 2U, {
+			0.358708f, 0.0f, 0.348322f, 0.0f, 0.247685f, 0.216622f, 0.256469f, 0.230107f, 0.257565f, 0.22328f, 0.244766f, 0.226707f,
+			0.350595f, 0.0f, 0.356488f, 0.0f, 0.042498f, 0.319053f, 0.0395974f, 0.315165f, 0.353297f, 0.0f, 0.353809f, 0.0f,
+			0.251468f, 0.2234f, 0.252761f, 0.223532f, 0.250697f, 0.225074f, 0.251796f, 0.224926f, 0.353593f, 0.0f, 0.353514f, 0.0f,
+			0.0431891f, 0.317011f, 0.0414125f, 0.316953f, 0.353425f, 0.0f, 0.353682f, 0.0f, 0.252011f, 0.223885f, 0.25181f, 0.223424f,
+			0.00259808f, 0.0233827f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00259808f, 0.0233827f, 0.0f, 0.0f,
+			0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00259808f, 0.0233827f, 0.0259808f, 0.0f, 0.00830687f, 0.0f, 0.00876743f, 0.0233827f,
+			0.168313f, 0.000524331f, 0.175372f, 8.44648e-05f, 0.0199566f, 0.154115f, 0.0176606f, 0.154011f, 0.176728f, 0.0f, 0.170859f, 0.0f,
+			0.123341f, 0.110612f, 0.123783f, 0.109044f, 0.124075f, 0.110821f, 0.12346f, 0.111106f, 0.175374f, 6.60247e-05f, 0.172723f, 0.000490343f,
+			0.0205836f, 0.1526f, 0.0203085f, 0.156666f, 0.171727f, 0.0f, 0.172946f, 0.0f, 0.121349f, 0.112945f, 0.119765f, 0.11053f,
+			0.119696f, 0.110502f, 0.124205f, 0.111774f, 0.167564f, 6.64973e-05f, 0.173193f, 0.000535986f, 0.020847f, 0.154191f, 0.0206506f, 0.154474f,
+		} },
+		{ "Gate", 96000U, 1U, {
+			0.360397f, 0.0f, 0.248852f, 0.219386f, 0.252238f, 0.218563f, 0.357252f, 0.0f, 0.0366786f, 0.317396f, 0.352855f, 0.0f,
+			0.252123f, 0.224307f, 0.250907f, 0.224907f, 0.353756f, 0.0f, 0.038012f, 0.317628f, 0.353581f, 0.0f, 0.251526f, 0.224257f,
+			0.00183712f, 0.0165341f, 0.0183712f, 0.0f, 0.00183712f, 0.0165341f, 0.0183712f, 0.0f, 0.00183712f, 0.0165341f, 0.00587384f, 0.0f,
+			0.171979f, 0.000370758f, 0.0180491f, 0.154254f, 0.173819f, 0.0f, 0.1234f, 0.110079f, 0.123768f, 0.110966f, 0.173991f, 4.66865e-05f,
+			0.0189791f, 0.155007f, 0.172382f, 0.0f, 0.120405f, 0.112026f, 0.121935f, 0.111142f, 0.170352f, 4.70207e-05f, 0.0194727f, 0.154632f,
+		} },
+		{ "Gate", 96000U, 2U, {
+			0.360397f, 0.0f, 0.346575f, 0.0f, 0.248852f, 0.219386f, 0.254479f, 0.22898f, 0.252238f, 0.218563f, 0.250252f, 0.231258f,
+			0.357252f, 0.0f, 0.349816f, 0.0f, 0.0366786f, 0.317396f, 0.0398962f, 0.317918f, 0.352855f, 0.0f, 0.354251f, 0.0f,
+			0.252123f, 0.224307f, 0.251239f, 0.224161f, 0.250907f, 0.224907f, 0.251587f, 0.225093f, 0.353756f, 0.0f, 0.353351f, 0.0f,
+			0.038012f, 0.317628f, 0.0399404f, 0.317553f, 0.353581f, 0.0f, 0.353525f, 0.0f, 0.251526f, 0.224257f, 0.251632f, 0.224399f,
+			0.00183712f, 0.0165341f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00183712f, 0.0165341f, 0.0f, 0.0f,
+			0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00183712f, 0.0165341f, 0.0183712f, 0.0f, 0.00587384f, 0.0f, 0.00619951f, 0.0165341f,
+			0.17007f, 0.000253739f, 0.173355f, 6.25625e-06f, 0.0197316f, 0.157422f, 0.0182506f, 0.154555f, 0.174873f, 0.0f, 0.17345f, 0.0f,
+			0.121252f, 0.108999f, 0.124241f, 0.109812f, 0.121606f, 0.110892f, 0.124481f, 0.109028f, 0.169775f, 0.000300171f, 0.17281f, 0.000281038f,
+			0.0185815f, 0.155294f, 0.018162f, 0.155602f, 0.176669f, 0.0f, 0.172487f, 0.0f, 0.125936f, 0.113491f, 0.121705f, 0.10925f,
+			0.121963f, 0.110262f, 0.122155f, 0.112414f, 0.170445f, 0.000197594f, 0.175927f, 9.25817e-05f, 0.0191881f, 0.156084f, 0.0191511f, 0.154914f,
+		} },
+		{ "Flanger", 44100U, 1U, {
+			0.308374f, 0.0502481f, 0.302304f, 0.0462155f, 0.31787f, 0.034588f, 0.337266f, 0.0452114f, 0.25678f, 0.130942f, 0.302414f, 0.155438f,
+			0.32062f, 0.186459f, 0.352288f, 0.211967f, 0.349586f, 0.210525f, 0.340438f, 0.203618f, 0.33764f, 0.184197f, 0.309419f, 0.15618f,
+			0.0438309f, 0.0361838f, 0.0242614f, 0.0121655f, 0.0259476f, 0.0152402f, 0.0240564f, 0.0117513f, 0.024886f, 0.0133527f, 0.00693409f, 0.00174301f,
+			0.157195f, 0.0806051f, 0.153723f, 0.0819971f, 0.159099f, 0.0860586f, 0.15848f, 0.0832113f, 0.153428f, 0.0825214f, 0.157207f, 0.0857121f,
+			0.158616f, 0.0843569f, 0.158081f, 0.0822925f, 0.156652f, 0.0838225f, 0.15232f, 0.0842838f, 0.164035f, 0.0861584f, 0.155756f, 0.0828299f,
+		} },
+		{ "Flanger", 44100U, 2U, {
+			0.308374f, 0.0502481f, 0.300905f, 0.0512371f, 0.302304f, 0.0462155f, 0.313406f, 0.0459122f, 0.31787f, 0.034588f, 0.320606f, 0.0364305f,
+			0.337266f, 0.0452114f, 0.308572f, 0.0708018f, 0.25678f, 0.130942f, 0.228615f, 0.140365f, 0.302414f, 0.155438f, 0.361962f, 0.153437f,
+			0.32062f, 0.186459f, 0.313962f, 0.191476f, 0.352288f, 0.211967f, 0.312336f, 0.19754f, 0.349586f, 0.210525f, 0.36104f, 0.205576f,
+			0.340438f, 0.203618f, 0.341347f, 0.214141f, 0.33764f, 0.184197f, 0.332134f, 0.186606f, 0.309419f, 0.15618f, 0.316509f, 0.150368f,
+			0.0438309f, 0.0361838f, 0.0271695f, 0.0172386f, 0.0242614f, 0.0121655f, 0.0248732f, 0.0133439f, 0.0259476f, 0.0152402f, 0.000187663f, 0.000187663f,
+			0.0240564f, 0.0117513f, 0.02496f, 0.013505f, 0.024886f, 0.0133527f, 0.0240095f, 0.0116379f, 0.00693409f, 0.00174301f, 0.0267999f, 0.0152265f,
+			0.157346f, 0.0787908f, 0.160883f, 0.0832791f, 0.157546f, 0.0828045f, 0.159055f, 0.0843803f, 0.160067f, 0.0851644f, 0.156508f, 0.0841886f,
+			0.162713f, 0.0854589f, 0.157853f, 0.0830044f, 0.158621f, 0.0844895f, 0.156311f, 0.0819452f, 0.166139f, 0.0860341f, 0.159285f, 0.0843808f,
+			0.154801f, 0.0835802f, 0.161851f, 0.0838261f, 0.155242f, 0.0852001f, 0.159029f, 0.0840767f, 0.154237f, 0.0838805f, 0.160073f, 0.0847718f,
+			0.159248f, 0.0839763f, 0.164015f, 0.0845599f, 0.153028f, 0.0835534f, 0.161848f, 0.0850594f, 0.156367f, 0.0816053f, 0.155698f, 0.0851558f,
+		} },
+		{ "Flanger", 48000U, 1U, {
+			0.308725f, 0.0502983f, 0.300538f, 0.0458011f, 0.323191f, 0.0344198f, 0.33114f, 0.0491653f, 0.253886f, 0.135036f, 0.329591f, 0.156228f,
+			0.32256f, 0.187087f, 0.325585f, 0.211589f, 0.352451f, 0.209736f, 0.347662f, 0.206335f, 0.330593f, 0.191719f, 0.316142f, 0.152266f,
+			0.0301498f, 0.0243396f, 0.0233296f, 0.0118013f, 0.0239743f, 0.0130294f, 0.0250453f, 0.0149086f, 0.0242891f, 0.0136f, 0.00664801f, 0.0016714f,
+			0.158529f, 0.0808076f, 0.16134f, 0.0836422f, 0.158723f, 0.0841962f, 0.154767f, 0.0841305f, 0.157499f, 0.0849246f, 0.160384f, 0.0854759f,
+			0.157858f, 0.0847502f, 0.154465f, 0.0830705f, 0.157922f, 0.0842205f, 0.159319f, 0.0856132f, 0.156975f, 0.0833704f, 0.159194f, 0.0854134f,
+		} },
+		{ "Flanger", 48000U, 2U, {
+			0.308725f, 0.0502983f, 0.300571f, 0.0511508f, 0.300538f, 0.0458011f, 0.315423f, 0.0460163f, 0.323191f, 0.0344198f, 0.316473f, 0.0359026f,
+			0.33114f, 0.0491653f, 0.311436f, 0.0749916f, 0.253886f, 0.135036f, 0.222561f, 0.141796f, 0.329591f, 0.156228f, 0.360224f, 0.156757f,
+			0.32256f, 0.187087f, 0.311334f, 0.191204f, 0.325585f, 0.211589f, 0.346034f, 0.194994f, 0.352451f, 0.209736f, 0.343524f, 0.221414f,
+			0.347662f, 0.206335f, 0.346533f, 0.197808f, 0.330593f, 0.191719f, 0.327487f, 0.192526f, 0.316142f, 0.152266f, 0.313564f, 0.154017f,
+			0.0301498f, 0.0243396f, 0.0426899f, 0.0376487f, 0.0233296f, 0.0118013f, 0.0242946f, 0.0136098f, 0.0239743f, 0.0130294f, 0.00018273f, 0.00018273f,
+			0.0250453f, 0.0149086f, 0.023504f, 0.0121424f, 0.0242891f, 0.0136f, 0.023062f, 0.0112631f, 0.00664801f, 0.0016714f, 0.0245913f, 0.0125563f,
+			0.151727f, 0.0796764f, 0.158137f, 0.0837844f, 0.163384f, 0.083483f, 0.15694f, 0.0840156f, 0.163063f, 0.0862075f, 0.156998f, 0.0833967f,
+			0.158107f, 0.0837958f, 0.160855f, 0.0860401f, 0.156397f, 0.0856571f, 0.160011f, 0.0838939f, 0.160498f, 0.0860424f, 0.154822f, 0.0839579f,
+			0.15795f, 0.0830758f, 0.156103f, 0.0852158f, 0.160697f, 0.0831244f, 0.156347f, 0.0847702f, 0.156308f, 0.0856258f, 0.160232f, 0.0834565f,
+			0.155521f, 0.0839425f, 0.163948f, 0.0872239f, 0.151763f, 0.0827225f, 0.156905f, 0.0830945f, 0.154258f, 0.0831529f, 0.156354f, 0.083801f,
+		} },
+		{ "Flanger", 96000U, 1U, {
+			0.310215f, 0.0504981f, 0.304333f, 0.0442031f, 0.321584f, 0.0298229f, 0.323262f, 0.0811101f, 0.217674f, 0.155157f, 0.351365f, 0.179153f,
+			0.359043f, 0.195285f, 0.337166f, 0.213576f, 0.342986f, 0.220442f, 0.348972f, 0.206302f, 0.333256f, 0.193871f, 0.316186f, 0.155473f,
+			0.0282206f, 0.0249103f, 0.0165102f, 0.00837181f, 0.0164788f, 0.00830971f, 0.0172646f, 0.00977578f, 0.0169798f, 0.00926351f, 0.00470129f, 0.00118359f,
+			0.157086f, 0.0821028f, 0.158198f, 0.0851008f, 0.159732f, 0.0855225f, 0.160222f, 0.0845771f, 0.158723f, 0.0858268f, 0.159081f, 0.0856697f,
+			0.160306f, 0.0843794f, 0.160709f, 0.0861914f, 0.15891f, 0.0852531f, 0.15741f, 0.0853887f, 0.155835f, 0.0847349f, 0.160476f, 0.0855927f,
+		} },
+		{ "Flanger", 96000U, 2U, {
+			0.310215f, 0.0504981f, 0.299299f, 0.0508706f, 0.304333f, 0.0442031f, 0.314779f, 0.0446927f, 0.321584f, 0.0298229f, 0.325538f, 0.037952f,
+			0.323262f, 0.0811101f, 0.280187f, 0.103488f, 0.217674f, 0.155157f, 0.267797f, 0.146038f, 0.351365f, 0.179153f, 0.333047f, 0.174115f,
+			0.359043f, 0.195285f, 0.341572f, 0.206961f, 0.337166f, 0.213576f, 0.358006f, 0.217677f, 0.342986f, 0.220442f, 0.346212f, 0.20787f,
+			0.348972f, 0.206302f, 0.348465f, 0.209182f, 0.333256f, 0.193871f, 0.332779f, 0.193333f, 0.316186f, 0.155473f, 0.314274f, 0.155541f,
+			0.0282206f, 0.0249103f, 0.0363408f, 0.0334388f, 0.0165102f, 0.00837181f, 0.0168531f, 0.00902928f, 0.0164788f, 0.00830971f, 0.000143954f, 0.000143954f,
+			0.0172646f, 0.00977578f, 0.0163777f, 0.00810731f, 0.0169798f, 0.00926351f, 0.0167649f, 0.00886344f, 0.00470129f, 0.00118359f, 0.0171432f, 0.00838777f,
+			0.154459f, 0.0814203f, 0.155895f, 0.083999f, 0.160088f, 0.0860026f, 0.159052f, 0.0852443f, 0.158329f, 0.0863663f, 0.16119f, 0.0848485f,
+			0.156829f, 0.0843376f, 0.159609f, 0.0857886f, 0.161764f, 0.0862822f, 0.158699f, 0.0864517f, 0.154813f, 0.0844862f, 0.158665f, 0.0853697f,
+			0.15755f, 0.0856215f, 0.156456f, 0.0839671f, 0.160712f, 0.0863548f, 0.156844f, 0.0853618f, 0.163906f, 0.0874392f, 0.158288f, 0.0859294f,
+			0.155336f, 0.0862018f, 0.158077f, 0.0844238f, 0.157347f, 0.0846164f, 0.163608f, 0.0872525f, 0.162673f, 0.0860219f, 0.154949f, 0.0850369f,
+		} },
+		{ "Bitcrusher", 44100U, 1U, {
+			0.35796f, 0.00346279f, 0.348466f, 0.0139434f, 0.350703f, 0.0368769f, 0.357731f, 0.0816059f, 0.351281f, 0.171706f, 0.357529f, 0.322751f,
+			0.321181f, 0.479398f, 0.349901f, 0.497266f, 0.380541f, 0.512433f, 0.321824f, 0.475916f, 0.361936f, 0.500854f, 0.35378f, 0.49466f,
+			0.042089f, 0.0446788f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.00866444f,
+			0.164979f, 0.222728f, 0.174622f, 0.214311f, 0.173369f, 0.205506f, 0.16951f, 0.220074f, 0.174418f, 0.232988f, 0.16811f, 0.230448f,
+			0.171721f, 0.233489f, 0.173342f, 0.231825f, 0.14806f, 0.223168f, 0.170111f, 0.23917f, 0.186806f, 0.252869f, 0.177322f, 0.236561f,
+		} },
+		{ "Bitcrusher", 44100U, 2U, {
+			0.35796f, 0.00346279f, 0.348115f, 0.0264392f, 0.348466f, 0.0139434f, 0.358569f, 0.0142662f, 0.350703f, 0.0368769f, 0.356381f, 0.0359897f,
+			0.357731f, 0.0816059f, 0.349326f, 0.0829547f, 0.351281f, 0.171706f, 0.355811f, 0.170206f, 0.357529f, 0.322751f, 0.349532f, 0.324369f,
+			0.321181f, 0.479398f, 0.383201f, 0.520819f, 0.349901f, 0.497266f, 0.357169f, 0.498927f, 0.380541f, 0.512433f, 0.324328f, 0.482841f,
+			0.321824f, 0.475916f, 0.382661f, 0.521155f, 0.361936f, 0.500854f, 0.344967f, 0.491401f, 0.35378f, 0.49466f, 0.353326f, 0.495472f,
+			0.042089f, 0.0446788f, 0.0525902f, 0.0591672f, 0.0f, 0.0270991f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.0f,
+			0.0f, 0.0270991f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.0271114f, 0.0f, 0.00866444f, 0.0f, 0.0284718f,
+			0.168012f, 0.22254f, 0.178633f, 0.230063f, 0.181017f, 0.215134f, 0.173988f, 0.213517f, 0.168408f, 0.195404f, 0.170013f, 0.189978f,
+			0.168707f, 0.221446f, 0.16925f, 0.225157f, 0.178406f, 0.239603f, 0.173446f, 0.231622f, 0.18331f, 0.248384f, 0.173472f, 0.238234f,
+			0.1729f, 0.235792f, 0.186769f, 0.247386f, 0.175221f, 0.238354f, 0.17469f, 0.237343f, 0.178642f, 0.247247f, 0.174382f, 0.250875f,
+			0.173506f, 0.240029f, 0.187254f, 0.249699f, 0.172566f, 0.238369f, 0.180567f, 0.246064f, 0.173235f, 0.240339f, 0.169264f, 0.244133f,
+		} },
+		{ "Bitcrusher", 48000U, 1U, {
+			0.358252f, 0.00384294f, 0.346495f, 0.0147403f, 0.355584f, 0.0370145f, 0.351678f, 0.0863232f, 0.354924f, 0.177336f, 0.351896f, 0.341478f,
+			0.334427f, 0.477983f, 0.362426f, 0.495435f, 0.362747f, 0.503584f, 0.391904f, 0.52053f, 0.375734f, 0.509514f, 0.365533f, 0.50546f,
+			0.0204439f, 0.0292475f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00830687f,
+			0.175899f, 0.229598f, 0.172615f, 0.211853f, 0.174384f, 0.206168f, 0.16679f, 0.221051f, 0.173555f, 0.228777f, 0.182336f, 0.248988f,
+			0.165261f, 0.234845f, 0.166272f, 0.230076f, 0.161582f, 0.232011f, 0.162682f, 0.236947f, 0.16047f, 0.231892f, 0.162466f, 0.234372f,
+		} },
+		{ "Bitcrusher", 48000U, 2U, {
+			0.358252f, 0.00384294f, 0.347894f, 0.0254033f, 0.346495f, 0.0147403f, 0.360474f, 0.0141774f, 0.355584f, 0.0370145f, 0.351511f, 0.0375426f,
+			0.351678f, 0.0863232f, 0.355419f, 0.0846409f, 0.354924f, 0.177336f, 0.352177f, 0.17719f, 0.351896f, 0.341478f, 0.355203f, 0.3301f,
+			0.334427f, 0.477983f, 0.371697f, 0.540214f, 0.362426f, 0.495435f, 0.344452f, 0.49135f, 0.362747f, 0.503584f, 0.344114f, 0.495555f,
+			0.391904f, 0.52053f, 0.310501f, 0.466267f, 0.375734f, 0.509514f, 0.329884f, 0.482005f, 0.365533f, 0.50546f, 0.341153f, 0.487634f,
+			0.0204439f, 0.0292475f, 0.0612267f, 0.066511f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0f,
+			0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00830687f, 0.0f, 0.0272968f,
+			0.182355f, 0.223468f, 0.176014f, 0.235557f, 0.16469f, 0.212441f, 0.172162f, 0.213116f, 0.175611f, 0.199351f, 0.164055f, 0.189084f,
+			0.167609f, 0.219545f, 0.166063f, 0.221003f, 0.175952f, 0.236852f, 0.183187f, 0.239919f, 0.174749f, 0.233669f, 0.187242f, 0.246347f,
+			0.16329f, 0.227779f, 0.182943f, 0.242048f, 0.187193f, 0.257341f, 0.169974f, 0.237031f, 0.157178f, 0.23572f, 0.183894f, 0.249649f,
+			0.185564f, 0.245371f, 0.166538f, 0.240439f, 0.183205f, 0.244888f, 0.184708f, 0.24851f, 0.165389f, 0.233315f, 0.169035f, 0.230376f,
+		} },
+		{ "Bitcrusher", 96000U, 1U, {
+			0.360221f, 0.00481036f, 0.347098f, 0.0177618f, 0.349984f, 0.0476417f, 0.356952f, 0.109138f, 0.35227f, 0.239166f, 0.375937f, 0.451768f,
+			0.336038f, 0.510754f, 0.330042f, 0.475339f, 0.378559f, 0.517845f, 0.343838f, 0.491239f, 0.325896f, 0.478579f, 0.381541f, 0.518137f,
+			0.0607077f, 0.0662543f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00587384f,
+			0.174896f, 0.236301f, 0.169665f, 0.224353f, 0.172574f, 0.228035f, 0.172443f, 0.235567f, 0.177004f, 0.240603f, 0.180821f, 0.242483f,
+			0.171112f, 0.243636f, 0.177935f, 0.243482f, 0.180676f, 0.247449f, 0.165045f, 0.237062f, 0.16889f, 0.237319f, 0.169239f, 0.23773f,
+		} },
+		{ "Bitcrusher", 96000U, 2U, {
+			0.360221f, 0.00481036f, 0.346006f, 0.0234912f, 0.347098f, 0.0177618f, 0.359893f, 0.0176347f, 0.349984f, 0.0476417f, 0.357087f, 0.0457965f,
+			0.356952f, 0.109138f, 0.350122f, 0.111098f, 0.35227f, 0.239166f, 0.354832f, 0.235352f, 0.375937f, 0.451768f, 0.329654f, 0.420784f,
+			0.336038f, 0.510754f, 0.370241f, 0.530641f, 0.330042f, 0.475339f, 0.375596f, 0.512395f, 0.378559f, 0.517845f, 0.326639f, 0.478684f,
+			0.343838f, 0.491239f, 0.363009f, 0.505598f, 0.325896f, 0.478579f, 0.379199f, 0.51685f, 0.381541f, 0.518137f, 0.323151f, 0.477549f,
+			0.0607077f, 0.0662543f, 0.01299f, 0.0224998f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0f,
+			0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00587384f, 0.0f, 0.0193018f,
+			0.158171f, 0.225916f, 0.185674f, 0.247763f, 0.173805f, 0.230964f, 0.164584f, 0.223223f, 0.172218f, 0.227328f, 0.174771f, 0.223061f,
+			0.166093f, 0.234538f, 0.167028f, 0.231725f, 0.179587f, 0.240052f, 0.16916f, 0.241086f, 0.17191f, 0.232416f, 0.176218f, 0.24375f,
+			0.173155f, 0.239352f, 0.190482f, 0.253859f, 0.176402f, 0.249633f, 0.185987f, 0.255008f, 0.166806f, 0.24138f, 0.151503f, 0.22863f,
+			0.160888f, 0.235891f, 0.187882f, 0.256477f, 0.182609f, 0.24778f, 0.186947f, 0.249867f, 0.175358f, 0.241198f, 0.152062f, 0.226773f,
+		} },
+		{ "Phaser", 44100U, 1U, {
+			0.362909f, 0.076668f, 0.347312f, 0.0978684f, 0.316684f, 0.113222f, 0.296582f, 0.123591f, 0.261687f, 0.135704f, 0.237074f, 0.143383f,
+			0.216074f, 0.150917f, 0.199206f, 0.157992f, 0.186412f, 0.168198f, 0.224907f, 0.13274f, 0.258966f, 0.0998974f, 0.269315f, 0.0937599f,
+			0.0194146f, 0.0107594f, 0.0208399f, 0.00819222f, 0.0208496f, 0.00819142f, 0.0208454f, 0.00820653f, 0.0208533f, 0.00820373f, 0.00651273f, 0.00219953f,
+			0.134127f, 0.0503337f, 0.131958f, 0.051203f, 0.134392f, 0.0522069f, 0.129787f, 0.0518933f, 0.133014f, 0.050378f, 0.132688f, 0.0531622f,
+			0.133061f, 0.0538298f, 0.13225f, 0.0510358f, 0.134106f, 0.0528815f, 0.133137f, 0.0517084f, 0.134872f, 0.0545403f, 0.135224f, 0.0519404f,
+		} },
+		{ "Phaser", 44100U, 2U, {
+			0.362909f, 0.076668f, 0.381209f, 0.0631199f, 0.347312f, 0.0978684f, 0.389675f, 0.0626118f, 0.316684f, 0.113222f, 0.383915f, 0.0725791f,
+			0.296582f, 0.123591f, 0.364648f, 0.0814991f, 0.261687f, 0.135704f, 0.360269f, 0.0883844f, 0.237074f, 0.143383f, 0.35076f, 0.0936024f,
+			0.216074f, 0.150917f, 0.362057f, 0.0877544f, 0.199206f, 0.157992f, 0.316169f, 0.118921f, 0.186412f, 0.168198f, 0.220253f, 0.160122f,
+			0.224907f, 0.13274f, 0.296672f, 0.106551f, 0.258966f, 0.0998974f, 0.263333f, 0.0965749f, 0.269315f, 0.0937599f, 0.264624f, 0.0995548f,
+			0.0194146f, 0.0107594f, 0.0209037f, 0.00829561f, 0.0208399f, 0.00819222f, 0.0208905f, 0.00814955f, 0.0208496f, 0.00819142f, 1.84492e-05f, 1.84492e-05f,
+			0.0208454f, 0.00820653f, 0.0209871f, 0.00804841f, 0.0208533f, 0.00820373f, 0.0208953f, 0.00818771f, 0.00651273f, 0.00219953f, 0.0218812f, 0.00838039f,
+			0.129163f, 0.0493009f, 0.133011f, 0.0523598f, 0.133234f, 0.0522387f, 0.131816f, 0.0514239f, 0.134695f, 0.0516523f, 0.131406f, 0.05166f,
+			0.13488f, 0.051633f, 0.131642f, 0.0525569f, 0.133994f, 0.0534922f, 0.133899f, 0.0516178f, 0.136268f, 0.0525507f, 0.134159f, 0.0525165f,
+			0.132909f, 0.0512057f, 0.132563f, 0.0517369f, 0.13155f, 0.0524754f, 0.130972f, 0.0524157f, 0.130446f, 0.0509148f, 0.13236f, 0.0519359f,
+			0.134432f, 0.0530244f, 0.132534f, 0.0525949f, 0.132667f, 0.0508139f, 0.134391f, 0.052229f, 0.128821f, 0.0504824f, 0.13322f, 0.0523572f,
+		} },
+		{ "Phaser", 48000U, 1U, {
+			0.363242f, 0.0767594f, 0.344228f, 0.0991118f, 0.318244f, 0.113608f, 0.289287f, 0.125225f, 0.260039f, 0.13754f, 0.231579f, 0.145434f,
+			0.209907f, 0.152431f, 0.194191f, 0.16023f, 0.198036f, 0.164867f, 0.243074f, 0.11883f, 0.266024f, 0.0948577f, 0.265564f, 0.0973938f,
+			0.0208095f, 0.00909404f, 0.0199538f, 0.00778696f, 0.0199558f, 0.00778394f, 0.0199593f, 0.00780182f, 0.0199587f, 0.00779557f, 0.00624437f, 0.00210457f,
+			0.132172f, 0.0505268f, 0.132321f, 0.0507036f, 0.133042f, 0.0510667f, 0.131833f, 0.0499435f, 0.133685f, 0.051795f, 0.134829f, 0.0508297f,
+			0.13249f, 0.052118f, 0.134254f, 0.0508944f, 0.134243f, 0.0516818f, 0.135736f, 0.0511598f, 0.135044f, 0.0519974f, 0.132604f, 0.0523413f,
+		} },
+		{ "Phaser", 48000U, 2U, {
+			0.363242f, 0.0767594f, 0.38054f, 0.0632362f, 0.344228f, 0.0991118f, 0.391718f, 0.0629153f, 0.318244f, 0.113608f, 0.377957f, 0.0745376f,
+			0.289287f, 0.125225f, 0.368378f, 0.081906f, 0.260039f, 0.13754f, 0.351366f, 0.0929233f, 0.231579f, 0.145434f, 0.341867f, 0.0996386f,
+			0.209907f, 0.152431f, 0.345247f, 0.0994626f, 0.194191f, 0.16023f, 0.290568f, 0.131539f, 0.198036f, 0.164867f, 0.243126f, 0.153097f,
+			0.243074f, 0.11883f, 0.281006f, 0.10809f, 0.266024f, 0.0948577f, 0.26296f, 0.097536f, 0.265564f, 0.0973938f, 0.266616f, 0.097418f,
+			0.0208095f, 0.00909404f, 0.0200811f, 0.00805338f, 0.0199538f, 0.00778696f, 0.0200206f, 0.00773213f, 0.0199558f, 0.00778394f, 1.53865e-05f, 1.53865e-05f,
+			0.0199593f, 0.00780182f, 0.020133f, 0.00761932f, 0.0199587f, 0.00779557f, 0.020012f, 0.00776672f, 0.00624437f, 0.00210457f, 0.0209758f, 0.00795674f,
+			0.130948f, 0.0484855f, 0.135156f, 0.0508003f, 0.131873f, 0.0515328f, 0.131005f, 0.0508672f, 0.136137f, 0.0518032f, 0.131103f, 0.0520688f,
+			0.132274f, 0.0525112f, 0.132811f, 0.0521268f, 0.133314f, 0.0525843f, 0.133475f, 0.0521693f, 0.13399f, 0.0531989f, 0.13331f, 0.0513172f,
+			0.129936f, 0.0510077f, 0.133317f, 0.0512918f, 0.132486f, 0.0507953f, 0.131771f, 0.0520128f, 0.133829f, 0.0523535f, 0.12961f, 0.0516553f,
+			0.130813f, 0.0515589f, 0.132836f, 0.0522821f, 0.128764f, 0.0495276f, 0.131473f, 0.0527313f, 0.132757f, 0.0498945f, 0.131977f, 0.0522797f,
+		} },
+		{ "Phaser", 96000U, 1U, {
+			0.36471f, 0.0776563f, 0.33118f, 0.105804f, 0.302438f, 0.120527f, 0.266021f, 0.136185f, 0.226366f, 0.147819f, 0.202231f, 0.154147f,
+			0.208112f, 0.15611f, 0.341748f, 0.119009f, 0.278486f, 0.124046f, 0.24935f, 0.107379f, 0.271524f, 0.0914151f, 0.262308f, 0.101797f,
+			0.0135858f, 0.00615493f, 0.0140242f, 0.00522974f, 0.0140652f, 0.00519525f, 0.0140224f, 0.00524179f, 0.0140539f, 0.00521119f, 0.00444777f, 0.00144115f,
+			0.133931f, 0.0458475f, 0.133899f, 0.0458614f, 0.135078f, 0.0472778f, 0.133987f, 0.0475828f, 0.132909f, 0.0493841f, 0.132418f, 0.0499463f,
+			0.130926f, 0.0491912f, 0.131388f, 0.0489931f, 0.131377f, 0.0494178f, 0.131633f, 0.0496222f, 0.129318f, 0.0490746f, 0.130767f, 0.0495445f,
+		} },
+		{ "Phaser", 96000U, 2U, {
+			0.36471f, 0.0776563f, 0.376896f, 0.0637991f, 0.33118f, 0.105804f, 0.391064f, 0.0684083f, 0.302438f, 0.120527f, 0.37247f, 0.0795399f,
+			0.266021f, 0.136185f, 0.344964f, 0.097526f, 0.226366f, 0.147819f, 0.319726f, 0.113405f, 0.202231f, 0.154147f, 0.283183f, 0.130693f,
+			0.208112f, 0.15611f, 0.244201f, 0.147975f, 0.341748f, 0.119009f, 0.211888f, 0.16111f, 0.278486f, 0.124046f, 0.291285f, 0.101195f,
+			0.24935f, 0.107379f, 0.271034f, 0.0907247f, 0.271524f, 0.0914151f, 0.269558f, 0.0922329f, 0.262308f, 0.101797f, 0.261715f, 0.102897f,
+			0.0135858f, 0.00615493f, 0.0141576f, 0.00513005f, 0.0140242f, 0.00522974f, 0.0142949f, 0.00498276f, 0.0140652f, 0.00519525f, 7.60433e-06f, 7.60433e-06f,
+			0.0140224f, 0.00524179f, 0.0144807f, 0.00479716f, 0.0140539f, 0.00521119f, 0.0142609f, 0.00502574f, 0.00444777f, 0.00144115f, 0.0149989f, 0.0051461f,
+			0.131116f, 0.0471244f, 0.133074f, 0.047953f, 0.136472f, 0.0472336f, 0.132585f, 0.0478233f, 0.136175f, 0.0472713f, 0.132856f, 0.0488731f,
+			0.13238f, 0.0470238f, 0.132059f, 0.0497139f, 0.132442f, 0.0480503f, 0.131456f, 0.0496419f, 0.128941f, 0.0484563f, 0.131653f, 0.0489312f,
+			0.132422f, 0.0486965f, 0.131188f, 0.0496308f, 0.1343f, 0.0502911f, 0.131272f, 0.0491336f, 0.135384f, 0.0506147f, 0.130479f, 0.0497366f,
+			0.131132f, 0.049593f, 0.13295f, 0.0497531f, 0.12983f, 0.0485876f, 0.134331f, 0.0504163f, 0.13273f, 0.0496726f, 0.131815f, 0.0486522f,
+		} },
+		{ "PitchShift", 44100U, 1U, {
+			0.177659f, 0.412486f, 0.222199f, 0.319727f, 0.298872f, 0.484441f, 0.289369f, 0.479952f, 0.293486f, 0.340766f, 0.291851f, 0.489682f,
+			0.271581f, 0.415003f, 0.301614f, 0.511317f, 0.287878f, 0.504186f, 0.292865f, 0.550063f, 0.300968f, 0.393643f, 0.250548f, 0.406052f,
+			0.0721302f, 0.0754427f, 0.0144936f, 0.0307315f, 0.0108154f, 0.029189f, 0.0120598f, 0.0296614f, 0.0298514f, 0.0403254f, 0.0380502f, 0.0390242f,
+			0.0577076f, 0.181711f, 0.143282f, 0.224426f, 0.139945f, 0.227671f, 0.142917f, 0.221712f, 0.139885f, 0.217508f, 0.140221f, 0.224264f,
+			0.143483f, 0.218733f, 0.143901f, 0.225048f, 0.137271f, 0.224525f, 0.144469f, 0.230422f, 0.140013f, 0.226413f, 0.14196f, 0.224451f,
+		} },
+		{ "PitchShift", 44100U, 2U, {
+			0.177659f, 0.412486f, 0.191255f, 0.399555f, 0.222199f, 0.319727f, 0.259634f, 0.299275f, 0.298872f, 0.484441f, 0.299026f, 0.477222f,
+			0.289369f, 0.479952f, 0.289726f, 0.486378f, 0.293486f, 0.340766f, 0.296879f, 0.340263f, 0.291851f, 0.489682f, 0.29185f, 0.492278f,
+			0.271581f, 0.415003f, 0.271392f, 0.412165f, 0.301614f, 0.511317f, 0.301102f, 0.511239f, 0.287878f, 0.504186f, 0.288541f, 0.505211f,
+			0.292865f, 0.550063f, 0.291504f, 0.548355f, 0.300968f, 0.393643f, 0.292417f, 0.394486f, 0.250548f, 0.406052f, 0.249594f, 0.407891f,
+			0.0721302f, 0.0754427f, 0.0706992f, 0.0753684f, 0.0144936f, 0.0307315f, 0.0218281f, 0.0347969f, 0.0108154f, 0.029189f, 0.021644f, 0.021644f,
+			0.0120598f, 0.0296614f, 0.0144993f, 0.0307342f, 0.0298514f, 0.0403254f, 0.00520346f, 0.0276062f, 0.0380502f, 0.0390242f, 0.00977503f, 0.0301031f,
+			0.0573615f, 0.177994f, 0.0602872f, 0.185251f, 0.141829f, 0.222427f, 0.144941f, 0.225111f, 0.139049f, 0.22728f, 0.141986f, 0.222454f,
+			0.143918f, 0.228071f, 0.137781f, 0.222932f, 0.143159f, 0.226935f, 0.144185f, 0.232466f, 0.140855f, 0.227762f, 0.139011f, 0.227118f,
+			0.142088f, 0.217468f, 0.145579f, 0.221718f, 0.141989f, 0.221498f, 0.141393f, 0.22416f, 0.135569f, 0.216802f, 0.138177f, 0.223015f,
+			0.138629f, 0.220533f, 0.140977f, 0.225865f, 0.144941f, 0.219416f, 0.142897f, 0.227545f, 0.136003f, 0.21681f, 0.143034f, 0.226875f,
+		} },
+		{ "PitchShift", 48000U, 1U, {
+			0.177479f, 0.412163f, 0.224232f, 0.323382f, 0.296657f, 0.488945f, 0.28842f, 0.514479f, 0.296944f, 0.210383f, 0.284571f, 0.363812f,
+			0.258411f, 0.525192f, 0.302281f, 0.420545f, 0.285884f, 0.586211f, 0.291103f, 0.558594f, 0.29821f, 0.515282f, 0.249203f, 0.423616f,
+			0.0737304f, 0.0803007f, 0.0109697f, 0.0282017f, 0.015647f, 0.0303287f, 0.0106794f, 0.02809f, 0.0297323f, 0.0394843f, 0.0253825f, 0.0267072f,
+			0.0574488f, 0.178647f, 0.145723f, 0.221971f, 0.140665f, 0.226389f, 0.141612f, 0.217095f, 0.141947f, 0.224258f, 0.144205f, 0.224449f,
+			0.145141f, 0.229506f, 0.143213f, 0.223113f, 0.140802f, 0.226633f, 0.141556f, 0.224507f, 0.142565f, 0.224203f, 0.136512f, 0.224636f,
+		} },
+		{ "PitchShift", 48000U, 2U, {
+			0.177479f, 0.412163f, 0.19218f, 0.398084f, 0.224232f, 0.323382f, 0.258626f, 0.306152f, 0.296657f, 0.488945f, 0.303065f, 0.477405f,
+			0.28842f, 0.514479f, 0.290493f, 0.523924f, 0.296944f, 0.210383f, 0.294742f, 0.209443f, 0.284571f, 0.363812f, 0.283004f, 0.36518f,
+			0.258411f, 0.525192f, 0.260282f, 0.525454f, 0.302281f, 0.420545f, 0.302615f, 0.420775f, 0.285884f, 0.586211f, 0.286181f, 0.586688f,
+			0.291103f, 0.558594f, 0.290566f, 0.557882f, 0.29821f, 0.515282f, 0.29534f, 0.513341f, 0.249203f, 0.423616f, 0.252971f, 0.421585f,
+			0.0737304f, 0.0803007f, 0.0727191f, 0.076892f, 0.0109697f, 0.0282017f, 0.0202326f, 0.0329296f, 0.015647f, 0.0303287f, 0.0159756f, 0.0159756f,
+			0.0106794f, 0.02809f, 0.0132856f, 0.0291806f, 0.0297323f, 0.0394843f, 0.00604315f, 0.0266743f, 0.0253825f, 0.0267072f, 0.00863177f, 0.0286291f,
+			0.0587496f, 0.178367f, 0.0615007f, 0.188221f, 0.138127f, 0.219906f, 0.146187f, 0.220669f, 0.141651f, 0.22608f, 0.137449f, 0.221438f,
+			0.143537f, 0.225471f, 0.138885f, 0.218829f, 0.145376f, 0.221815f, 0.143124f, 0.226266f, 0.140007f, 0.229532f, 0.138092f, 0.222891f,
+			0.144978f, 0.222396f, 0.147007f, 0.230531f, 0.142485f, 0.222224f, 0.145026f, 0.228793f, 0.134504f, 0.217065f, 0.14116f, 0.222074f,
+			0.144272f, 0.225797f, 0.145182f, 0.226816f, 0.135842f, 0.214938f, 0.137052f, 0.222115f, 0.139256f, 0.227719f, 0.142583f, 0.227736f,
+		} },
+		{ "PitchShift", 96000U, 1U, {
+			0.176352f, 0.404674f, 0.236089f, 0.392427f, 0.301879f, 0.502111f, 0.276122f, 0.325543f, 0.290332f, 0.357287f, 0.313227f, 0.408718f,
+			0.285583f, 0.40974f, 0.299001f, 0.462366f, 0.289479f, 0.465181f, 0.290964f, 0.450224f, 0.297479f, 0.461157f, 0.259077f, 0.43144f,
+			0.08523f, 0.0884797f, 0.00839951f, 0.0202003f, 0.0109174f, 0.0213703f, 1.16078e-06f, 0.0183712f, 0.0161087f, 0.0244334f, 0.0165914f, 0.0176004f,
+			0.0605741f, 0.181937f, 0.140745f, 0.223789f, 0.139596f, 0.223614f, 0.139816f, 0.225183f, 0.14416f, 0.231151f, 0.139129f, 0.22246f,
+			0.142646f, 0.223685f, 0.144081f, 0.223729f, 0.138485f, 0.219038f, 0.144936f, 0.225972f, 0.136904f, 0.216138f, 0.139851f, 0.222581f,
+		} },
+		{ "PitchShift", 96000U, 2U, {
+			0.176352f, 0.404674f, 0.193842f, 0.382403f, 0.236089f, 0.392427f, 0.254346f, 0.358726f, 0.301879f, 0.502111f, 0.305013f, 0.514659f,
+			0.276122f, 0.325543f, 0.274953f, 0.31692f, 0.290332f, 0.357287f, 0.29388f, 0.355688f, 0.313227f, 0.408718f, 0.312465f, 0.408186f,
+			0.285583f, 0.40974f, 0.285736f, 0.410093f, 0.299001f, 0.462366f, 0.298929f, 0.46381f, 0.289479f, 0.465181f, 0.289584f, 0.464575f,
+			0.290964f, 0.450224f, 0.290492f, 0.450365f, 0.297479f, 0.461157f, 0.298054f, 0.460711f, 0.259077f, 0.43144f, 0.259912f, 0.431139f,
+			0.08523f, 0.0884797f, 0.0835839f, 0.0857588f, 0.00839951f, 0.0202003f, 0.0147899f, 0.0235847f, 0.0109174f, 0.0213703f, 0.0138378f, 0.0138378f,
+			1.16078e-06f, 0.0183712f, 0.0083249f, 0.0201694f, 0.0161087f, 0.0244334f, 0.00614323f, 0.0193711f, 0.0165914f, 0.0176004f, 0.00682582f, 0.0204732f,
+			0.0547403f, 0.180323f, 0.0625518f, 0.183295f, 0.138942f, 0.228917f, 0.141585f, 0.225868f, 0.144402f, 0.227453f, 0.141119f, 0.22519f,
+			0.140879f, 0.219449f, 0.140576f, 0.225496f, 0.14008f, 0.225198f, 0.144575f, 0.226747f, 0.1389f, 0.218626f, 0.14004f, 0.220636f,
+			0.140009f, 0.221871f, 0.142054f, 0.223081f, 0.143698f, 0.227331f, 0.143887f, 0.221623f, 0.145111f, 0.232808f, 0.137711f, 0.220473f,
+			0.14515f, 0.223566f, 0.143047f, 0.226238f, 0.139551f, 0.220262f, 0.142411f, 0.222059f, 0.1365f, 0.222631f, 0.140743f, 0.222948f,
+		} },
+		{ "Wobble", 44100U, 1U, {
+			0.358214f, 0.00116087f, 0.350077f, 0.0169303f, 0.368008f, 0.0738253f, 0.363501f, 0.0364601f, 0.351732f, 0.00781831f, 0.354485f, 0.0176954f,
+			0.400052f, 0.366671f, 0.0441123f, 0.391038f, 0.311735f, 0.501891f, 0.408846f, 0.172821f, 0.372125f, 0.377196f, 0.0152222f, 0.362119f,
+			0.0056013f, 0.0276501f, 0.00897632f, 0.0283892f, 0.025009f, 0.0295643f, 0.0249699f, 0.029576f, 0.0092643f, 0.0284947f, 2.5799e-05f, 0.00863864f,
+			0.0788601f, 0.184777f, 0.161664f, 0.181338f, 0.16369f, 0.181568f, 0.0800811f, 0.18481f, 0.0363453f, 0.176432f, 0.0894947f, 0.189307f,
+			0.163758f, 0.174989f, 0.159603f, 0.173443f, 0.0841022f, 0.186826f, 0.0408422f, 0.177027f, 0.0891596f, 0.19039f, 0.164f, 0.171858f,
+		} },
+		{ "Wobble", 44100U, 2U, {
+			0.358214f, 0.00116087f, 0.348835f, 0.00432043f, 0.350077f, 0.0169303f, 0.359145f, 0.0160896f, 0.368008f, 0.0738253f, 0.375194f, 0.0734646f,
+			0.363501f, 0.0364601f, 0.354167f, 0.0375939f, 0.351732f, 0.00781831f, 0.355864f, 0.00757288f, 0.354485f, 0.0176954f, 0.355128f, 0.0173737f,
+			0.400052f, 0.366671f, 0.398868f, 0.366175f, 0.0441123f, 0.391038f, 0.0447186f, 0.391781f, 0.311735f, 0.501891f, 0.312259f, 0.501536f,
+			0.408846f, 0.172821f, 0.408281f, 0.173251f, 0.372125f, 0.377196f, 0.372308f, 0.377391f, 0.0152222f, 0.362119f, 0.0151549f, 0.362082f,
+			0.0056013f, 0.0276501f, 0.00610102f, 0.0277554f, 0.00897632f, 0.0283892f, 0.0164689f, 0.0302501f, 0.025009f, 0.0295643f, 1.19787e-23f, 1.19787e-23f,
+			0.0249699f, 0.029576f, 0.02787f, 0.0144564f, 0.0092643f, 0.0284947f, 0.0165554f, 0.0303255f, 2.5799e-05f, 0.00863864f, 0.00617159f, 0.0290929f,
+			0.0833346f, 0.18278f, 0.0860762f, 0.186814f, 0.162019f, 0.174126f, 0.163055f, 0.173911f, 0.159683f, 0.175537f, 0.16321f, 0.17002f,
+			0.0846825f, 0.1875f, 0.0831043f, 0.186395f, 0.044456f, 0.178712f, 0.0447076f, 0.178166f, 0.0915802f, 0.191161f, 0.0815233f, 0.186178f,
+			0.162008f, 0.177147f, 0.160017f, 0.170615f, 0.164706f, 0.179067f, 0.161224f, 0.165119f, 0.0897681f, 0.183f, 0.0810308f, 0.187603f,
+			0.0428174f, 0.179568f, 0.0301056f, 0.179167f, 0.0846532f, 0.187821f, 0.0810435f, 0.187546f, 0.161025f, 0.171469f, 0.162949f, 0.174286f,
+		} },
+		{ "Wobble", 48000U, 1U, {
+			0.358617f, 0.00119304f, 0.347785f, 0.0175107f, 0.3735f, 0.0748396f, 0.357259f, 0.0387224f, 0.35636f, 0.00810332f, 0.354789f, 0.0185741f,
+			0.395669f, 0.371088f, 0.0395932f, 0.387004f, 0.293049f, 0.502674f, 0.420705f, 0.202469f, 0.368922f, 0.389664f, 0.0128068f, 0.361029f,
+			0.00629589f, 0.0266788f, 0.00824762f, 0.0271298f, 0.0232477f, 0.0287361f, 0.0232419f, 0.0287563f, 0.00851847f, 0.0272142f, 2.0897e-05f, 0.00828598f,
+			0.0718117f, 0.182874f, 0.153117f, 0.182749f, 0.159295f, 0.184055f, 0.0796154f, 0.185962f, 0.0386577f, 0.180944f, 0.0845264f, 0.188415f,
+			0.161227f, 0.179438f, 0.154429f, 0.18166f, 0.077384f, 0.186434f, 0.0379102f, 0.178566f, 0.0818729f, 0.184252f, 0.160518f, 0.175789f,
+		} },
+		{ "Wobble", 48000U, 2U, {
+			0.358617f, 0.00119304f, 0.348417f, 0.005591f, 0.347785f, 0.0175107f, 0.361422f, 0.0159365f, 0.3735f, 0.0748396f, 0.371116f, 0.0758614f,
+			0.357259f, 0.0387224f, 0.360994f, 0.0373299f, 0.35636f, 0.00810332f, 0.351301f, 0.00834694f, 0.354789f, 0.0185741f, 0.355162f, 0.0188406f,
+			0.395669f, 0.371088f, 0.396792f, 0.370551f, 0.0395932f, 0.387004f, 0.0395587f, 0.387766f, 0.293049f, 0.502674f, 0.293407f, 0.502229f,
+			0.420705f, 0.202469f, 0.420327f, 0.203076f, 0.368922f, 0.389664f, 0.369067f, 0.389811f, 0.0128068f, 0.361029f, 0.0127694f, 0.360521f,
+			0.00629589f, 0.0266788f, 0.00588465f, 0.0266113f, 0.00824762f, 0.0271298f, 0.0151609f, 0.0288746f, 0.0232477f, 0.0287361f, 5.89315e-24f, 5.89315e-24f,
+			0.0232419f, 0.0287563f, 0.0270746f, 0.0184059f, 0.00851847f, 0.0272142f, 0.0152631f, 0.0289355f, 2.0897e-05f, 0.00828598f, 0.00567357f, 0.0278476f,
+			0.0786098f, 0.179853f, 0.0824945f, 0.186453f, 0.153311f, 0.18006f, 0.161082f, 0.179853f, 0.160302f, 0.183615f, 0.15796f, 0.175122f,
+			0.0844089f, 0.188159f, 0.0889638f, 0.191036f, 0.0359551f, 0.178928f, 0.0417831f, 0.177553f, 0.0832501f, 0.191015f, 0.0782913f, 0.184144f,
+			0.153243f, 0.176505f, 0.168106f, 0.186414f, 0.162086f, 0.17582f, 0.1599f, 0.181522f, 0.0824336f, 0.188237f, 0.0794243f, 0.186834f,
+			0.0368299f, 0.17437f, 0.0333768f, 0.179935f, 0.0678042f, 0.180562f, 0.0685641f, 0.185539f, 0.158014f, 0.181758f, 0.15932f, 0.176812f,
+		} },
+		{ "Wobble", 96000U, 1U, {
+			0.360352f, 0.0013614f, 0.348179f, 0.017901f, 0.375869f, 0.0921112f, 0.365604f, 0.0462608f, 0.353457f, 0.0122998f, 0.356066f, 0.0292374f,
+			0.36921f, 0.398951f, 0.0159747f, 0.367045f, 0.105465f, 0.429567f, 0.476171f, 0.495415f, 0.312542f, 0.469134f, 0.00349039f, 0.355456f,
+			0.00454084f, 0.0189061f, 0.00412533f, 0.0188048f, 0.012311f, 0.0207096f, 0.012329f, 0.0207233f, 0.00426807f, 0.0188367f, 3.76501e-06f, 0.00587008f,
+			0.0538735f, 0.17856f, 0.121947f, 0.194011f, 0.124259f, 0.196493f, 0.0592149f, 0.181949f, 0.0284448f, 0.17612f, 0.0598389f, 0.181979f,
+			0.124299f, 0.195693f, 0.123763f, 0.191698f, 0.0604435f, 0.180268f, 0.0255911f, 0.175229f, 0.04894f, 0.177447f, 0.12382f, 0.19266f,
+		} },
+		{ "Wobble", 96000U, 2U, {
+			0.360352f, 0.0013614f, 0.346606f, 0.00864688f, 0.348179f, 0.017901f, 0.361561f, 0.0194872f, 0.375869f, 0.0921112f, 0.382229f, 0.0907244f,
+			0.365604f, 0.0462608f, 0.35802f, 0.0483557f, 0.353457f, 0.0122998f, 0.354902f, 0.0121224f, 0.356066f, 0.0292374f, 0.357725f, 0.0292717f,
+			0.36921f, 0.398951f, 0.368751f, 0.398531f, 0.0159747f, 0.367045f, 0.0161288f, 0.367771f, 0.105465f, 0.429567f, 0.105613f, 0.4292f,
+			0.476171f, 0.495415f, 0.476017f, 0.495528f, 0.312542f, 0.469134f, 0.312726f, 0.46908f, 0.00349039f, 0.355456f, 0.00349747f, 0.355635f,
+			0.00454084f, 0.0189061f, 0.00280658f, 0.0185793f, 0.00412533f, 0.0188048f, 0.0076634f, 0.0196603f, 0.012311f, 0.0207096f, 5.04902e-25f, 5.04902e-25f,
+			0.012329f, 0.0207233f, 0.0162795f, 0.0204002f, 0.00426807f, 0.0188367f, 0.00772849f, 0.0196866f, 3.76501e-06f, 0.00587008f, 0.00283811f, 0.0195034f,
+			0.0575879f, 0.176637f, 0.0580038f, 0.181535f, 0.124006f, 0.197607f, 0.127679f, 0.194114f, 0.127708f, 0.198614f, 0.120396f, 0.192249f,
+			0.0551623f, 0.180506f, 0.0523715f, 0.182674f, 0.0274899f, 0.175288f, 0.0231793f, 0.174934f, 0.0598607f, 0.177568f, 0.0593446f, 0.179875f,
+			0.123831f, 0.192891f, 0.122244f, 0.196634f, 0.128513f, 0.201232f, 0.122208f, 0.192006f, 0.0635183f, 0.186351f, 0.0580462f, 0.180629f,
+			0.0288399f, 0.174826f, 0.0265767f, 0.176176f, 0.0537435f, 0.179769f, 0.0596495f, 0.186596f, 0.122009f, 0.194776f, 0.123285f, 0.193662f,
+		} },
+		{ "Tapestop", 44100U, 1U, {
+			0.358307f, 0.0f, 0.347826f, 0.0f, 0.351651f, 0.0f, 0.357445f, 0.0f, 0.351476f, 0.0f, 0.353221f, 0.0f,
+			0.354262f, 0.0f, 0.353345f, 0.0f, 0.348851f, 0.365013f, 0.337485f, 0.48744f, 0.320904f, 0.477795f, 0.296618f, 0.460868f,
+			0.267244f, 0.268494f, 0.238917f, 0.240532f, 0.158668f, 0.161706f, 0.0653284f, 0.0712381f, 0.0027815f, 0.0272537f, 0.0f, 0.00866444f,
+			0.0f, 0.171938f, 0.0f, 0.171263f, 0.0f, 0.175874f, 0.0f, 0.169856f, 0.0f, 0.170939f, 0.0f, 0.173694f,
+			0.0f, 0.174912f, 0.0f, 0.171218f, 0.0f, 0.175051f, 0.0f, 0.172907f, 0.0f, 0.176156f, 0.0f, 0.174005f,
+		} },
+		{ "Tapestop", 44100U, 2U, {
+			0.358307f, 0.0f, 0.348735f, 0.0f, 0.347826f, 0.0f, 0.359189f, 0.0f, 0.351651f, 0.0f, 0.355446f, 0.0f,
+			0.357445f, 0.0f, 0.349619f, 0.0f, 0.351476f, 0.0f, 0.355619f, 0.0f, 0.353221f, 0.0f, 0.353886f, 0.0f,
+			0.354262f, 0.0f, 0.352843f, 0.0f, 0.353345f, 0.0f, 0.353761f, 0.0f, 0.348851f, 0.365013f, 0.348857f, 0.365763f,
+			0.337485f, 0.48744f, 0.338001f, 0.487461f, 0.320904f, 0.477795f, 0.320995f, 0.478206f, 0.296618f, 0.460868f, 0.296261f, 0.461936f,
+			0.267244f, 0.268494f, 0.266207f, 0.266985f, 0.238917f, 0.240532f, 0.238905f, 0.241183f, 0.158668f, 0.161706f, 0.159192f, 0.159192f,
+			0.0653284f, 0.0712381f, 0.0652564f, 0.0685358f, 0.0027815f, 0.0272537f, 0.00499113f, 0.027567f, 0.0f, 0.00866444f, 0.0f, 0.0284718f,
+			0.0f, 0.167733f, 0.0f, 0.175242f, 0.0f, 0.173206f, 0.0f, 0.172509f, 0.0f, 0.174352f, 0.0f, 0.170333f,
+			0.0f, 0.174444f, 0.0f, 0.171707f, 0.0f, 0.174768f, 0.0f, 0.173179f, 0.0f, 0.175622f, 0.0f, 0.174523f,
+			0.0f, 0.172349f, 0.0f, 0.172506f, 0.0f, 0.172935f, 0.0f, 0.172375f, 0.0f, 0.169014f, 0.0f, 0.173522f,
+			0.0f, 0.175483f, 0.0f, 0.174493f, 0.0f, 0.169357f, 0.0f, 0.174065f, 0.0f, 0.168692f, 0.0f, 0.17411f,
+		} },
+		{ "Tapestop", 48000U, 1U, {
+			0.358708f, 0.0f, 0.345625f, 0.0f, 0.356752f, 0.0f, 0.350595f, 0.0f, 0.356091f, 0.0f, 0.353297f, 0.0f,
+			0.353207f, 0.0f, 0.353221f, 0.0f, 0.348137f, 0.443349f, 0.339423f, 0.489373f, 0.325288f, 0.480233f, 0.306281f, 0.468265f,
+			0.285992f, 0.288039f, 0.211084f, 0.213678f, 0.0830542f, 0.0876319f, 0.00197738f, 0.0260559f, 0.0f, 0.0259808f, 0.0f, 0.00830687f,
+			0.0f, 0.171787f, 0.0f, 0.172193f, 0.0f, 0.17374f, 0.0f, 0.169348f, 0.0f, 0.174832f, 0.0f, 0.172799f,
+			0.0f, 0.173497f, 0.0f, 0.173369f, 0.0f, 0.174577f, 0.0f, 0.173952f, 0.0f, 0.174138f, 0.0f, 0.173845f,
+		} },
+		{ "Tapestop", 48000U, 2U, {
+			0.358708f, 0.0f, 0.348322f, 0.0f, 0.345625f, 0.0f, 0.361308f, 0.0f, 0.356752f, 0.0f, 0.350325f, 0.0f,
+			0.350595f, 0.0f, 0.356488f, 0.0f, 0.356091f, 0.0f, 0.350998f, 0.0f, 0.353297f, 0.0f, 0.353809f, 0.0f,
+			0.353207f, 0.0f, 0.353899f, 0.0f, 0.353221f, 0.0f, 0.353886f, 0.0f, 0.348137f, 0.443349f, 0.347839f, 0.443532f,
+			0.339423f, 0.489373f, 0.339272f, 0.488536f, 0.325288f, 0.480233f, 0.32553f, 0.480615f, 0.306281f, 0.468265f, 0.306578f, 0.467119f,
+			0.285992f, 0.288039f, 0.286731f, 0.287181f, 0.211084f, 0.213678f, 0.210975f, 0.212063f, 0.0830542f, 0.0876319f, 0.0828539f, 0.0828539f,
+			0.00197738f, 0.0260559f, 0.00390129f, 0.0259579f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00830687f, 0.0f, 0.0272968f,
+			0.0f, 0.168336f, 0.0f, 0.175373f, 0.0f, 0.171797f, 0.0f, 0.171314f, 0.0f, 0.176728f, 0.0f, 0.170859f,
+			0.0f, 0.173858f, 0.0f, 0.173012f, 0.0f, 0.17437f, 0.0f, 0.174155f, 0.0f, 0.175374f, 0.0f, 0.172742f,
+			0.0f, 0.170362f, 0.0f, 0.174667f, 0.0f, 0.171727f, 0.0f, 0.172946f, 0.0f, 0.17431f, 0.0f, 0.171324f,
+			0.0f, 0.171031f, 0.0f, 0.175204f, 0.0f, 0.167564f, 0.0f, 0.173216f, 0.0f, 0.171972f, 0.0f, 0.172416f,
+		} },
+		{ "Tapestop", 96000U, 1U, {
+			0.360397f, 0.0f, 0.347694f, 0.0f, 0.349298f, 0.0f, 0.357252f, 0.0f, 0.352906f, 0.0f, 0.352855f, 0.0f,
+			0.353813f, 0.0f, 0.353239f, 0.0f, 0.349957f, 0.455631f, 0.345091f, 0.493873f, 0.267398f, 0.44295f, 0.0175542f, 0.353896f,
+			0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00587384f,
+			0.0f, 0.17199f, 0.0f, 0.171558f, 0.0f, 0.173819f, 0.0f, 0.173433f, 0.0f, 0.174265f, 0.0f, 0.173991f,
+			0.0f, 0.172553f, 0.0f, 0.172382f, 0.0f, 0.172825f, 0.0f, 0.173105f, 0.0f, 0.170352f, 0.0f, 0.172233f,
+		} },
+		{ "Tapestop", 96000U, 2U, {
+			0.360397f, 0.0f, 0.346575f, 0.0f, 0.347694f, 0.0f, 0.359318f, 0.0f, 0.349298f, 0.0f, 0.357758f, 0.0f,
+			0.357252f, 0.0f, 0.349816f, 0.0f, 0.352906f, 0.0f, 0.354199f, 0.0f, 0.352855f, 0.0f, 0.354251f, 0.0f,
+			0.353813f, 0.0f, 0.353294f, 0.0f, 0.353239f, 0.0f, 0.353867f, 0.0f, 0.349957f, 0.455631f, 0.349827f, 0.455652f,
+			0.345091f, 0.493873f, 0.344998f, 0.493637f, 0.267398f, 0.44295f, 0.267408f, 0.443284f, 0.0175542f, 0.353896f, 0.0174041f, 0.354044f,
+			0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0f,
+			0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00587384f, 0.0f, 0.0193018f,
+			0.0f, 0.170075f, 0.0f, 0.173355f, 0.0f, 0.175299f, 0.0f, 0.171939f, 0.0f, 0.174873f, 0.0f, 0.17345f,
+			0.0f, 0.171046f, 0.0f, 0.173809f, 0.0f, 0.172678f, 0.0f, 0.173275f, 0.0f, 0.169782f, 0.0f, 0.172817f,
+			0.0f, 0.17281f, 0.0f, 0.173051f, 0.0f, 0.176669f, 0.0f, 0.172487f, 0.0f, 0.177911f, 0.0f, 0.171578f,
+			0.0f, 0.172437f, 0.0f, 0.174261f, 0.0f, 0.170448f, 0.0f, 0.175927f, 0.0f, 0.173794f, 0.0f, 0.172521f,
+		} },
+		{ "Echo", 44100U, 1U, {
+			0.301373f, 0.0669318f, 0.186018f, 0.167139f, 0.0582604f, 0.326595f, 0.166316f, 0.395715f, 0.126895f, 0.374806f, 0.0509592f, 0.355566f,
+			0.0866103f, 0.364818f, 0.0867751f, 0.363772f, 0.0407603f, 0.355936f, 0.0470338f, 0.356863f, 0.0530854f, 0.357301f, 0.031284f, 0.35494f,
+			0.0174444f, 0.0322387f, 0.0366119f, 0.0452008f, 0.0225003f, 0.0351834f, 0.00346824f, 0.0273201f, 0.0234348f, 0.0358738f, 0.0144648f, 0.0168558f,
+			0.00453033f, 0.17215f, 0.0129327f, 0.171795f, 0.00986733f, 0.175903f, 0.00396259f, 0.169841f, 0.00673482f, 0.171073f, 0.00674763f, 0.173993f,
+			0.00316952f, 0.17477f, 0.00365735f, 0.171404f, 0.00412792f, 0.174935f, 0.00243265f, 0.172949f, 0.00135648f, 0.176148f, 0.00284694f, 0.17395f,
+		} },
+		{ "Echo", 44100U, 2U, {
+			0.301373f, 0.0669318f, 0.295685f, 0.0671846f, 0.186018f, 0.167139f, 0.195056f, 0.170243f, 0.0582604f, 0.326595f, 0.0595234f, 0.330159f,
+			0.166316f, 0.395715f, 0.164827f, 0.393616f, 0.126895f, 0.374806f, 0.127987f, 0.384603f, 0.0509592f, 0.355566f, 0.0536976f, 0.355475f,
+			0.0866103f, 0.364818f, 0.0910212f, 0.365674f, 0.0867751f, 0.363772f, 0.0818325f, 0.363149f, 0.0407603f, 0.355936f, 0.0416883f, 0.355637f,
+			0.0470338f, 0.356863f, 0.0425191f, 0.355873f, 0.0530854f, 0.357301f, 0.0574977f, 0.358476f, 0.031284f, 0.35494f, 0.0300802f, 0.3548f,
+			0.0174444f, 0.0322387f, 0.0212609f, 0.0344536f, 0.0366119f, 0.0452008f, 0.0354691f, 0.0449371f, 0.0225003f, 0.0351834f, 0.0212451f, 0.0212451f,
+			0.00346824f, 0.0273201f, 0.00224207f, 0.0266973f, 0.0234348f, 0.0358738f, 0.0229925f, 0.0353457f, 0.0144648f, 0.0168558f, 0.0151675f, 0.0316153f,
+			0.00453033f, 0.167856f, 0.00462854f, 0.175626f, 0.0129327f, 0.173425f, 0.012817f, 0.173688f, 0.00986733f, 0.174592f, 0.0099523f, 0.170893f,
+			0.00396259f, 0.174537f, 0.00417552f, 0.171642f, 0.00673482f, 0.174733f, 0.00707781f, 0.173332f, 0.00674763f, 0.175855f, 0.00636329f, 0.175026f,
+			0.00316952f, 0.1724f, 0.00324168f, 0.172616f, 0.00365735f, 0.173006f, 0.00330629f, 0.172456f, 0.00412792f, 0.169007f, 0.00447102f, 0.173339f,
+			0.00243265f, 0.175467f, 0.00233904f, 0.174395f, 0.00135648f, 0.16934f, 0.00165324f, 0.17411f, 0.00284694f, 0.168707f, 0.00275808f, 0.174189f,
+		} },
+		{ "Echo", 48000U, 1U, {
+			0.301582f, 0.0671505f, 0.185124f, 0.165652f, 0.0609253f, 0.329767f, 0.166197f, 0.391051f, 0.126784f, 0.376745f, 0.0521632f, 0.357741f,
+			0.0867074f, 0.362887f, 0.0865116f, 0.364411f, 0.0413222f, 0.355995f, 0.0470191f, 0.356835f, 0.053026f, 0.357334f, 0.0315125f, 0.35521f,
+			0.0174947f, 0.0313219f, 0.0366179f, 0.0445766f, 0.0224492f, 0.0343617f, 0.00383564f, 0.0262624f, 0.023451f, 0.0350232f, 0.0143953f, 0.0165766f,
+			0.00473755f, 0.172041f, 0.0129235f, 0.172985f, 0.00985872f, 0.174519f, 0.00405621f, 0.169331f, 0.00674237f, 0.174912f, 0.00672714f, 0.172963f,
+			0.00321321f, 0.173639f, 0.00365621f, 0.173416f, 0.0041233f, 0.174609f, 0.00245041f, 0.17391f, 0.00136038f, 0.174188f, 0.00284741f, 0.173929f,
+		} },
+		{ "Echo", 48000U, 2U, {
+			0.301582f, 0.0671505f, 0.29567f, 0.0664923f, 0.185124f, 0.165652f, 0.195844f, 0.171741f, 0.0609253f, 0.329767f, 0.0568126f, 0.327001f,
+			0.166197f, 0.391051f, 0.165181f, 0.407025f, 0.126784f, 0.376745f, 0.128065f, 0.367547f, 0.0521632f, 0.357741f, 0.0524949f, 0.359905f,
+			0.0867074f, 0.362887f, 0.091047f, 0.364565f, 0.0865116f, 0.364411f, 0.0820882f, 0.363302f, 0.0413222f, 0.355995f, 0.0411196f, 0.355975f,
+			0.0470191f, 0.356835f, 0.0426375f, 0.35593f, 0.053026f, 0.357334f, 0.0575412f, 0.358409f, 0.0315125f, 0.35521f, 0.02983f, 0.354529f,
+			0.0174947f, 0.0313219f, 0.0213094f, 0.033602f, 0.0366179f, 0.0445766f, 0.0354549f, 0.0442544f, 0.0224492f, 0.0343617f, 0.0212922f, 0.0212922f,
+			0.00383564f, 0.0262624f, 0.00150403f, 0.0256416f, 0.023451f, 0.0350232f, 0.0229913f, 0.0345006f, 0.0143953f, 0.0165766f, 0.0152288f, 0.0306618f,
+			0.00473755f, 0.168418f, 0.00441775f, 0.175727f, 0.0129235f, 0.17233f, 0.0128445f, 0.172374f, 0.00985872f, 0.177585f, 0.00995835f, 0.170906f,
+			0.00405621f, 0.173718f, 0.004082f, 0.173099f, 0.00674237f, 0.174363f, 0.00707981f, 0.174022f, 0.00672714f, 0.175926f, 0.00638318f, 0.172886f,
+			0.00321321f, 0.170252f, 0.00319746f, 0.174728f, 0.00365621f, 0.171801f, 0.0033155f, 0.172929f, 0.0041233f, 0.174469f, 0.00447441f, 0.171324f,
+			0.00245041f, 0.171152f, 0.00231958f, 0.175184f, 0.00136038f, 0.167605f, 0.00165702f, 0.173207f, 0.00284741f, 0.171946f, 0.00275697f, 0.172514f,
+		} },
+		{ "Echo", 96000U, 1U, {
+			0.302591f, 0.0678699f, 0.184286f, 0.168694f, 0.055254f, 0.327289f, 0.164936f, 0.395596f, 0.127453f, 0.375051f, 0.0532854f, 0.355671f,
+			0.0872468f, 0.364623f, 0.0852086f, 0.363036f, 0.0423193f, 0.356385f, 0.0468068f, 0.356557f, 0.0530963f, 0.357583f, 0.0314443f, 0.354845f,
+			0.0175601f, 0.0254137f, 0.0368895f, 0.0410524f, 0.0221003f, 0.0290661f, 0.001403f, 0.0184247f, 0.0235295f, 0.0298086f, 0.0143301f, 0.0153764f,
+			0.00429655f, 0.172138f, 0.0128254f, 0.172161f, 0.00991072f, 0.174067f, 0.00414347f, 0.173428f, 0.00678431f, 0.174322f, 0.00662583f, 0.174352f,
+			0.00329075f, 0.172617f, 0.0036397f, 0.172406f, 0.00412877f, 0.172954f, 0.00244511f, 0.173102f, 0.00136547f, 0.170385f, 0.00286853f, 0.172319f,
+		} },
+		{ "Echo", 96000U, 2U, {
+			0.302591f, 0.0678699f, 0.296025f, 0.0626703f, 0.184286f, 0.168694f, 0.196589f, 0.168799f, 0.055254f, 0.327289f, 0.0620331f, 0.330001f,
+			0.164936f, 0.395596f, 0.167329f, 0.397916f, 0.127453f, 0.375051f, 0.127372f, 0.374342f, 0.0532854f, 0.355671f, 0.0512111f, 0.357461f,
+			0.0872468f, 0.364623f, 0.0911216f, 0.364296f, 0.0852086f, 0.363036f, 0.0834233f, 0.363534f, 0.0423193f, 0.356385f, 0.0400212f, 0.355543f,
+			0.0468068f, 0.356557f, 0.0433221f, 0.356281f, 0.0530963f, 0.357583f, 0.0574668f, 0.358169f, 0.0314443f, 0.354845f, 0.0298647f, 0.354892f,
+			0.0175601f, 0.0254137f, 0.021585f, 0.0283446f, 0.0368895f, 0.0410524f, 0.0351661f, 0.0399365f, 0.0221003f, 0.0290661f, 0.0216483f, 0.0216483f,
+			0.001403f, 0.0184247f, 0.00379443f, 0.0191496f, 0.0235295f, 0.0298086f, 0.0230189f, 0.0293415f, 0.0143301f, 0.0153764f, 0.0152867f, 0.0244631f,
+			0.00429655f, 0.170143f, 0.00482369f, 0.173431f, 0.0128254f, 0.175884f, 0.0130115f, 0.1726f, 0.00991072f, 0.175185f, 0.00990448f, 0.173673f,
+			0.00414347f, 0.171093f, 0.00398218f, 0.173863f, 0.00678431f, 0.172665f, 0.00708562f, 0.173516f, 0.00662583f, 0.169981f, 0.006487f, 0.172912f,
+			0.00329075f, 0.172832f, 0.00311205f, 0.173049f, 0.0036397f, 0.176789f, 0.00336873f, 0.172518f, 0.00412877f, 0.177923f, 0.00446862f, 0.171594f,
+			0.00244511f, 0.172484f, 0.00232228f, 0.174225f, 0.00136547f, 0.17045f, 0.00167845f, 0.175905f, 0.00286853f, 0.173827f, 0.00273452f, 0.172627f,
+		} },
+		{ "Sidechain", 44100U, 1U, {
+			0.358307f, 0.0f, 0.347826f, 0.0f, 0.351651f, 0.0f, 0.357445f, 0.0f, 0.351476f, 0.0f, 0.353221f, 0.0f,
+			0.354262f, 0.0f, 0.353345f, 0.0f, 0.353614f, 0.0f, 0.353715f, 0.0f, 0.353381f, 0.0f, 0.353548f, 0.0f,
+			0.0271114f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.00866444f, 0.0f,
+			0.171938f, 0.0f, 0.171263f, 0.0f, 0.175874f, 0.0f, 0.169856f, 0.0f, 0.170939f, 0.0f, 0.173694f, 0.0f,
+			0.174912f, 0.0f, 0.171218f, 0.0f, 0.175051f, 0.0f, 0.172907f, 0.0f, 0.176156f, 0.0f, 0.174005f, 0.0f,
+		} },
+		{ "Sidechain", 44100U, 2U, {
+			0.358307f, 0.0f, 0.348735f, 0.0f, 0.347826f, 0.0f, 0.359189f, 0.0f, 0.351651f, 0.0f, 0.355446f, 0.0f,
+			0.357445f, 0.0f, 0.349619f, 0.0f, 0.351476f, 0.0f, 0.355619f, 0.0f, 0.353221f, 0.0f, 0.353886f, 0.0f,
+			0.354262f, 0.0f, 0.352843f, 0.0f, 0.353345f, 0.0f, 0.353761f, 0.0f, 0.353614f, 0.0f, 0.353492f, 0.0f,
+			0.353715f, 0.0f, 0.353392f, 0.0f, 0.353381f, 0.0f, 0.353726f, 0.0f, 0.353548f, 0.0f, 0.353558f, 0.0f,
+			0.0271114f, 0.0f, 0.0271114f, 0.0f, 0.0270991f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.0f, 0.0f,
+			0.0270991f, 0.0f, 0.0270991f, 0.0f, 0.0271114f, 0.0f, 0.0271114f, 0.0f, 0.00866444f, 0.0f, 0.0284718f, 0.0f,
+			0.167733f, 0.0f, 0.175242f, 0.0f, 0.173206f, 0.0f, 0.172509f, 0.0f, 0.174352f, 0.0f, 0.170333f, 0.0f,
+			0.174444f, 0.0f, 0.171707f, 0.0f, 0.174768f, 0.0f, 0.173179f, 0.0f, 0.175622f, 0.0f, 0.174523f, 0.0f,
+			0.172349f, 0.0f, 0.172506f, 0.0f, 0.172935f, 0.0f, 0.172375f, 0.0f, 0.169014f, 0.0f, 0.173522f, 0.0f,
+			0.175483f, 0.0f, 0.174493f, 0.0f, 0.169357f, 0.0f, 0.174065f, 0.0f, 0.168692f, 0.0f, 0.17411f, 0.0f,
+		} },
+		{ "Sidechain", 48000U, 1U, {
+			0.358708f, 0.0f, 0.345625f, 0.0f, 0.356752f, 0.0f, 0.350595f, 0.0f, 0.356091f, 0.0f, 0.353297f, 0.0f,
+			0.353207f, 0.0f, 0.353221f, 0.0f, 0.353593f, 0.0f, 0.353688f, 0.0f, 0.353425f, 0.0f, 0.353798f, 0.0f,
+			0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00830687f, 0.0f,
+			0.171787f, 0.0f, 0.172193f, 0.0f, 0.17374f, 0.0f, 0.169348f, 0.0f, 0.174832f, 0.0f, 0.172799f, 0.0f,
+			0.173497f, 0.0f, 0.173369f, 0.0f, 0.174577f, 0.0f, 0.173952f, 0.0f, 0.174138f, 0.0f, 0.173845f, 0.0f,
+		} },
+		{ "Sidechain", 48000U, 2U, {
+			0.358708f, 0.0f, 0.348322f, 0.0f, 0.345625f, 0.0f, 0.361308f, 0.0f, 0.356752f, 0.0f, 0.350325f, 0.0f,
+			0.350595f, 0.0f, 0.356488f, 0.0f, 0.356091f, 0.0f, 0.350998f, 0.0f, 0.353297f, 0.0f, 0.353809f, 0.0f,
+			0.353207f, 0.0f, 0.353899f, 0.0f, 0.353221f, 0.0f, 0.353886f, 0.0f, 0.353593f, 0.0f, 0.353514f, 0.0f,
+			0.353688f, 0.0f, 0.353418f, 0.0f, 0.353425f, 0.0f, 0.353682f, 0.0f, 0.353798f, 0.0f, 0.353309f, 0.0f,
+			0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0f, 0.0f,
+			0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.0259808f, 0.0f, 0.00830687f, 0.0f, 0.0272968f, 0.0f,
+			0.168336f, 0.0f, 0.175373f, 0.0f, 0.171797f, 0.0f, 0.171314f, 0.0f, 0.176728f, 0.0f, 0.170859f, 0.0f,
+			0.173858f, 0.0f, 0.173012f, 0.0f, 0.17437f, 0.0f, 0.174155f, 0.0f, 0.175374f, 0.0f, 0.172742f, 0.0f,
+			0.170362f, 0.0f, 0.174667f, 0.0f, 0.171727f, 0.0f, 0.172946f, 0.0f, 0.17431f, 0.0f, 0.171324f, 0.0f,
+			0.171031f, 0.0f, 0.175204f, 0.0f, 0.167564f, 0.0f, 0.173216f, 0.0f, 0.171972f, 0.0f, 0.172416f, 0.0f,
+		} },
+		{ "Sidechain", 96000U, 1U, {
+			0.360397f, 0.0f, 0.347694f, 0.0f, 0.349298f, 0.0f, 0.357252f, 0.0f, 0.352906f, 0.0f, 0.352855f, 0.0f,
+			0.353813f, 0.0f, 0.353239f, 0.0f, 0.353756f, 0.0f, 0.353491f, 0.0f, 0.353581f, 0.0f, 0.353465f, 0.0f,
+			0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00587384f, 0.0f,
+			0.17199f, 0.0f, 0.171558f, 0.0f, 0.173819f, 0.0f, 0.173433f, 0.0f, 0.174265f, 0.0f, 0.173991f, 0.0f,
+			0.172553f, 0.0f, 0.172382f, 0.0f, 0.172825f, 0.0f, 0.173105f, 0.0f, 0.170352f, 0.0f, 0.172233f, 0.0f,
+		} },
+		{ "Sidechain", 96000U, 2U, {
+			0.360397f, 0.0f, 0.346575f, 0.0f, 0.347694f, 0.0f, 0.359318f, 0.0f, 0.349298f, 0.0f, 0.357758f, 0.0f,
+			0.357252f, 0.0f, 0.349816f, 0.0f, 0.352906f, 0.0f, 0.354199f, 0.0f, 0.352855f, 0.0f, 0.354251f, 0.0f,
+			0.353813f, 0.0f, 0.353294f, 0.0f, 0.353239f, 0.0f, 0.353867f, 0.0f, 0.353756f, 0.0f, 0.353351f, 0.0f,
+			0.353491f, 0.0f, 0.353616f, 0.0f, 0.353581f, 0.0f, 0.353525f, 0.0f, 0.353465f, 0.0f, 0.353641f, 0.0f,
+			0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0f, 0.0f,
+			0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.0183712f, 0.0f, 0.00587384f, 0.0f, 0.0193018f, 0.0f,
+			0.170075f, 0.0f, 0.173355f, 0.0f, 0.175299f, 0.0f, 0.171939f, 0.0f, 0.174873f, 0.0f, 0.17345f, 0.0f,
+			0.171046f, 0.0f, 0.173809f, 0.0f, 0.172678f, 0.0f, 0.173275f, 0.0f, 0.169782f, 0.0f, 0.172817f, 0.0f,
+			0.17281f, 0.0f, 0.173051f, 0.0f, 0.176669f, 0.0f, 0.172487f, 0.0f, 0.177911f, 0.0f, 0.171578f, 0.0f,
+			0.172437f, 0.0f, 0.174261f, 0.0f, 0.170448f, 0.0f, 0.175927f, 0.0f, 0.173794f, 0.0f, 0.172521f, 0.0f,
+		} },
+		{ "PeakingFilter", 44100U, 1U, {
+			0.384813f, 0.0643146f, 0.443749f, 0.245021f, 0.403118f, 0.160269f, 0.388047f, 0.132344f, 0.383027f, 0.127459f, 0.38984f, 0.137167f,
+			0.403757f, 0.154452f, 0.394191f, 0.127701f, 0.463243f, 0.212923f, 1.03963f, 0.757555f, 0.461523f, 0.240709f, 0.362701f, 0.0671217f,
+			0.0371411f, 0.0218483f, 0.0398273f, 0.0252281f, 0.0325935f, 0.0160337f, 0.0274227f, 0.00281761f, 0.0274806f, 0.00300765f, 0.00915094f, 0.0012727f,
+			0.212041f, 0.105367f, 0.230737f, 0.133096f, 0.253662f, 0.152276f, 0.195306f, 0.0630904f, 0.172626f, 0.00947509f, 0.173694f, 0.0f,
+			0.27523f, 0.147864f, 0.296254f, 0.187126f, 0.294433f, 0.192297f, 0.280112f, 0.184294f, 0.29257f, 0.199805f, 0.258967f, 0.166206f,
+		} },
+		{ "PeakingFilter", 44100U, 2U, {
+			0.384813f, 0.0643146f, 0.355294f, 0.0581534f, 0.443749f, 0.245021f, 0.486825f, 0.242383f, 0.403118f, 0.160269f, 0.395982f, 0.158279f,
+			0.388047f, 0.132344f, 0.385178f, 0.136586f, 0.383027f, 0.127459f, 0.385761f, 0.126732f, 0.38984f, 0.137167f, 0.391581f, 0.136578f,
+			0.403757f, 0.154452f, 0.402532f, 0.155146f, 0.394191f, 0.127701f, 0.394691f, 0.127687f, 0.463243f, 0.212923f, 0.46267f, 0.212279f,
+			1.03963f, 0.757555f, 1.03976f, 0.757801f, 0.461523f, 0.240709f, 0.461868f, 0.240495f, 0.362701f, 0.0671217f, 0.362669f, 0.06722f,
+			0.0371411f, 0.0218483f, 0.041787f, 0.0272591f, 0.0398273f, 0.0252281f, 0.0368446f, 0.0215616f, 0.0325935f, 0.0160337f, 0.000775213f, 0.000775213f,
+			0.0274227f, 0.00281761f, 0.0291164f, 0.00889024f, 0.0274806f, 0.00300765f, 0.0273418f, 0.0021548f, 0.00915094f, 0.0012727f, 0.0306909f, 0.00927101f,
+			0.204104f, 0.0994199f, 0.232554f, 0.130181f, 0.260178f, 0.166675f, 0.245501f, 0.150016f, 0.259435f, 0.16026f, 0.288142f, 0.193375f,
+			0.199128f, 0.0636001f, 0.198988f, 0.0671125f, 0.176427f, 0.00879519f, 0.174981f, 0.00956815f, 0.175622f, 0.0f, 0.174523f, 0.0f,
+			0.264737f, 0.13925f, 0.267048f, 0.142663f, 0.292368f, 0.183155f, 0.307845f, 0.197062f, 0.301045f, 0.202883f, 0.300978f, 0.200323f,
+			0.290836f, 0.193596f, 0.306485f, 0.210239f, 0.263906f, 0.172997f, 0.265614f, 0.171993f, 0.259586f, 0.17147f, 0.234381f, 0.135139f,
+		} },
+		{ "PeakingFilter", 48000U, 1U, {
+			0.402558f, 0.0873736f, 0.453798f, 0.242278f, 0.408321f, 0.159061f, 0.381297f, 0.13418f, 0.387816f, 0.128391f, 0.392175f, 0.141484f,
+			0.40614f, 0.160266f, 0.398009f, 0.134172f, 0.473987f, 0.223551f, 0.944926f, 0.676613f, 0.440978f, 0.214085f, 0.361363f, 0.061105f,
+			0.0381166f, 0.0236787f, 0.0393902f, 0.0259816f, 0.0314528f, 0.0153811f, 0.0261872f, 0.00203201f, 0.0260282f, 0.000610444f, 0.00878645f, 0.000504516f,
+			0.220201f, 0.11805f, 0.226583f, 0.126337f, 0.222957f, 0.113351f, 0.18191f, 0.0387918f, 0.174851f, 0.000256111f, 0.172799f, 0.0f,
+			0.247931f, 0.125152f, 0.287985f, 0.178738f, 0.27967f, 0.177777f, 0.300897f, 0.204869f, 0.273793f, 0.180973f, 0.237933f, 0.140925f,
+		} },
+		{ "PeakingFilter", 48000U, 2U, {
+			0.402558f, 0.0873736f, 0.366299f, 0.0981349f, 0.453798f, 0.242278f, 0.481543f, 0.247689f, 0.408321f, 0.159061f, 0.394083f, 0.166066f,
+			0.381297f, 0.13418f, 0.39093f, 0.132698f, 0.387816f, 0.128391f, 0.383349f, 0.130668f, 0.392175f, 0.141484f, 0.394023f, 0.141293f,
+			0.40614f, 0.160266f, 0.40694f, 0.160221f, 0.398009f, 0.134172f, 0.398497f, 0.133766f, 0.473987f, 0.223551f, 0.473166f, 0.222723f,
+			0.944926f, 0.676613f, 0.945507f, 0.677408f, 0.440978f, 0.214085f, 0.441433f, 0.214025f, 0.361363f, 0.061105f, 0.360877f, 0.0611704f,
+			0.0381166f, 0.0236787f, 0.0402829f, 0.0265485f, 0.0393902f, 0.0259816f, 0.0334216f, 0.0180844f, 0.0314528f, 0.0153811f, 0.000518985f, 0.000518985f,
+			0.0261872f, 0.00203201f, 0.027333f, 0.00691135f, 0.0260282f, 0.000610444f, 0.0260945f, 0.00125078f, 0.00878645f, 0.000504516f, 0.0285839f, 0.00628756f,
+			0.206868f, 0.101469f, 0.229619f, 0.12703f, 0.265878f, 0.17522f, 0.23853f, 0.142587f, 0.235666f, 0.126128f, 0.23067f, 0.125325f,
+			0.18528f, 0.0367433f, 0.185581f, 0.0384399f, 0.174387f, 0.000292762f, 0.17416f, 0.000194892f, 0.175374f, 0.0f, 0.172742f, 0.0f,
+			0.241506f, 0.120687f, 0.258894f, 0.134468f, 0.288072f, 0.179503f, 0.302524f, 0.192921f, 0.312736f, 0.212031f, 0.284554f, 0.185413f,
+			0.309803f, 0.215104f, 0.290893f, 0.19362f, 0.250214f, 0.158483f, 0.264354f, 0.170515f, 0.245083f, 0.15159f, 0.212596f, 0.109742f,
+		} },
+		{ "PeakingFilter", 96000U, 1U, {
+			0.403872f, 0.098746f, 0.443862f, 0.233689f, 0.39841f, 0.171622f, 0.399191f, 0.152453f, 0.402485f, 0.161361f, 0.422712f, 0.191009f,
+			0.457828f, 0.230765f, 0.446102f, 0.195796f, 0.798801f, 0.514765f, 0.588285f, 0.360188f, 0.374552f, 0.100704f, 0.355417f, 0.0310073f,
+			0.0273587f, 0.0172816f, 0.0231332f, 0.012321f, 0.0198794f, 0.00648592f, 0.0184469f, 0.00103584f, 0.0183884f, 0.000303525f, 0.00604421f, 0.00018434f,
+			0.196268f, 0.0806788f, 0.208395f, 0.101496f, 0.213446f, 0.100121f, 0.17822f, 0.0229692f, 0.174272f, 0.000174794f, 0.173991f, 0.0f,
+			0.228613f, 0.105271f, 0.247739f, 0.139365f, 0.240373f, 0.136448f, 0.241095f, 0.14032f, 0.219306f, 0.118416f, 0.194178f, 0.0788238f,
+		} },
+		{ "PeakingFilter", 96000U, 2U, {
+			0.403872f, 0.098746f, 0.371017f, 0.115914f, 0.443862f, 0.233689f, 0.469838f, 0.243997f, 0.39841f, 0.171622f, 0.412516f, 0.169008f,
+			0.399191f, 0.152453f, 0.394851f, 0.157165f, 0.402485f, 0.161361f, 0.401914f, 0.16055f, 0.422712f, 0.191009f, 0.423606f, 0.190191f,
+			0.457828f, 0.230765f, 0.45803f, 0.231009f, 0.446102f, 0.195796f, 0.446907f, 0.195667f, 0.798801f, 0.514765f, 0.797615f, 0.514033f,
+			0.588285f, 0.360188f, 0.5889f, 0.360507f, 0.374552f, 0.100704f, 0.374578f, 0.100728f, 0.355417f, 0.0310073f, 0.355591f, 0.0309886f,
+			0.0273587f, 0.0172816f, 0.0234821f, 0.0125522f, 0.0231332f, 0.012321f, 0.0212752f, 0.00928342f, 0.0198794f, 0.00648592f, 0.000412864f, 0.000412864f,
+			0.0184469f, 0.00103584f, 0.0189047f, 0.00371355f, 0.0183884f, 0.000303525f, 0.0184113f, 0.000623219f, 0.00604421f, 0.00018434f, 0.0201246f, 0.00458858f,
+			0.199893f, 0.0905572f, 0.195589f, 0.0773467f, 0.217674f, 0.110466f, 0.220225f, 0.117801f, 0.210847f, 0.0945391f, 0.201616f, 0.0816883f,
+			0.17618f, 0.0237626f, 0.178982f, 0.024017f, 0.17269f, 0.00023726f, 0.173279f, 0.000180146f, 0.169782f, 0.0f, 0.172817f, 0.0f,
+			0.232318f, 0.109558f, 0.226181f, 0.102355f, 0.251891f, 0.141134f, 0.249721f, 0.140961f, 0.244015f, 0.13635f, 0.248028f, 0.14659f,
+			0.236843f, 0.135886f, 0.243757f, 0.142274f, 0.217002f, 0.1148f, 0.2184f, 0.110738f, 0.198847f, 0.0844112f, 0.192437f, 0.0740887f,
+		} },
+		{ "HighPassFilter", 44100U, 1U, {
+			0.358307f, 0.0f, 0.347826f, 0.0f, 0.312848f, 0.517536f, 0.38499f, 0.721281f, 0.65195f, 0.958257f, 1.44586f, 1.54946f,
+			1.11493f, 0.870764f, 0.606667f, 0.282979f, 0.455608f, 0.115728f, 0.397913f, 0.0536023f, 0.367903f, 0.0219298f, 0.35537f, 0.00566426f,
+			0.0306506f, 0.0150597f, 0.0318447f, 0.0176986f, 0.030467f, 0.0146316f, 0.0296451f, 0.012612f, 0.0284367f, 0.00903078f, 0.00928596f, 0.00340973f,
+			0.171974f, 0.011535f, 0.171263f, 0.0f, 0.175874f, 0.0f, 0.169856f, 0.0f, 0.173649f, 0.0288776f, 0.18345f, 0.0577679f,
+			0.191969f, 0.0920327f, 0.18404f, 0.082177f, 0.197696f, 0.106433f, 0.203494f, 0.114422f, 0.217611f, 0.133265f, 0.214107f, 0.143968f,
+		} },
+		{ "HighPassFilter", 44100U, 2U, {
+			0.358307f, 0.0f, 0.348735f, 0.0f, 0.347826f, 0.0f, 0.359189f, 0.0f, 0.312848f, 0.517536f, 0.324795f, 0.53912f,
+			0.38499f, 0.721281f, 0.371718f, 0.700167f, 0.65195f, 0.958257f, 0.642815f, 0.954215f, 1.44586f, 1.54946f, 1.4409f, 1.54565f,
+			1.11493f, 0.870764f, 1.11175f, 0.866952f, 0.606667f, 0.282979f, 0.609207f, 0.285275f, 0.455608f, 0.115728f, 0.455428f, 0.115686f,
+			0.397913f, 0.0536023f, 0.397615f, 0.053623f, 0.367903f, 0.0219298f, 0.368259f, 0.0219269f, 0.35537f, 0.00566426f, 0.35538f, 0.00566947f,
+			0.0306506f, 0.0150597f, 0.0323705f, 0.0187504f, 0.0318447f, 0.0176986f, 0.0313719f, 0.0166931f, 0.030467f, 0.0146316f, 0.000847917f, 0.000847917f,
+			0.0296451f, 0.012612f, 0.030032f, 0.0136044f, 0.0284367f, 0.00903078f, 0.0295415f, 0.0122361f, 0.00928596f, 0.00340973f, 0.0296469f, 0.00876562f,
+			0.167929f, 0.00991971f, 0.175501f, 0.00806879f, 0.173206f, 0.0f, 0.172509f, 0.0f, 0.174352f, 0.0f, 0.170333f, 0.0f,
+			0.174444f, 0.0f, 0.171707f, 0.0f, 0.178174f, 0.0501976f, 0.175711f, 0.0355782f, 0.183904f, 0.0653945f, 0.185203f, 0.072117f,
+			0.177313f, 0.0455405f, 0.182411f, 0.064333f, 0.190833f, 0.0820994f, 0.192925f, 0.0838737f, 0.202793f, 0.118537f, 0.194536f, 0.0840991f,
+			0.205398f, 0.112016f, 0.21547f, 0.125696f, 0.206927f, 0.119509f, 0.217009f, 0.128291f, 0.197385f, 0.109942f, 0.201249f, 0.110814f,
+		} },
+		{ "HighPassFilter", 48000U, 1U, {
+			0.358708f, 0.0f, 0.345625f, 0.0f, 0.31919f, 0.599533f, 0.414277f, 0.74413f, 0.723004f, 1.02549f, 1.53108f, 1.56936f,
+			0.982072f, 0.715815f, 0.559879f, 0.228992f, 0.441623f, 0.100962f, 0.392517f, 0.0479012f, 0.365998f, 0.0196585f, 0.355342f, 0.00513911f,
+			0.030153f, 0.0162573f, 0.0306816f, 0.0172003f, 0.0292603f, 0.0141614f, 0.0282107f, 0.0115253f, 0.0272142f, 0.00851398f, 0.00890271f, 0.00320221f,
+			0.171787f, 0.0f, 0.172193f, 0.0f, 0.17374f, 0.0f, 0.169348f, 0.0f, 0.176952f, 0.0287279f, 0.180509f, 0.0535821f,
+			0.202482f, 0.109477f, 0.189065f, 0.0865516f, 0.192613f, 0.0888188f, 0.204675f, 0.113474f, 0.212583f, 0.139735f, 0.218252f, 0.137627f,
+		} },
+		{ "HighPassFilter", 48000U, 2U, {
+			0.358708f, 0.0f, 0.348322f, 0.0f, 0.345625f, 0.0f, 0.361308f, 0.0f, 0.31919f, 0.599533f, 0.305255f, 0.600438f,
+			0.414277f, 0.74413f, 0.404508f, 0.74139f, 0.723004f, 1.02549f, 0.709205f, 1.00644f, 1.53108f, 1.56936f, 1.49789f, 1.53867f,
+			0.982072f, 0.715815f, 0.988166f, 0.722236f, 0.559879f, 0.228992f, 0.56024f, 0.228526f, 0.441623f, 0.100962f, 0.441334f, 0.100656f,
+			0.392517f, 0.0479012f, 0.392257f, 0.0479363f, 0.365998f, 0.0196585f, 0.366247f, 0.0196419f, 0.355342f, 0.00513911f, 0.354853f, 0.0051452f,
+			0.030153f, 0.0162573f, 0.0311679f, 0.0181653f, 0.0306816f, 0.0172003f, 0.0295925f, 0.0149378f, 0.0292603f, 0.0141614f, 0.000666629f, 0.000666629f,
+			0.0282107f, 0.0115253f, 0.0285214f, 0.0123552f, 0.0272142f, 0.00851398f, 0.0282756f, 0.0116005f, 0.00890271f, 0.00320221f, 0.0285034f, 0.00853507f,
+			0.168336f, 0.0f, 0.175373f, 0.0f, 0.171797f, 0.0f, 0.171314f, 0.0f, 0.176728f, 0.0f, 0.170859f, 0.0f,
+			0.173858f, 0.0f, 0.173012f, 0.0f, 0.185426f, 0.0685406f, 0.176843f, 0.0399981f, 0.189414f, 0.0696058f, 0.186188f, 0.0714863f,
+			0.178488f, 0.0557059f, 0.182348f, 0.0501431f, 0.193796f, 0.0905892f, 0.190996f, 0.0815624f, 0.202241f, 0.107897f, 0.19741f, 0.097476f,
+			0.201883f, 0.108449f, 0.200389f, 0.101007f, 0.194706f, 0.108612f, 0.1998f, 0.1051f, 0.224691f, 0.156616f, 0.213791f, 0.14193f,
+		} },
+		{ "HighPassFilter", 96000U, 1U, {
+			0.360397f, 0.0f, 0.347694f, 0.0f, 0.434503f, 0.725815f, 0.824275f, 1.11731f, 1.55121f, 1.52454f, 0.827257f, 0.526661f,
+			0.520095f, 0.185736f, 0.422566f, 0.0807028f, 0.38404f, 0.0385597f, 0.366269f, 0.0193254f, 0.357426f, 0.0087031f, 0.353895f, 0.00256027f,
+			0.0215143f, 0.0117411f, 0.0199792f, 0.00822689f, 0.0195041f, 0.00685253f, 0.0191276f, 0.00556041f, 0.0188673f, 0.0044857f, 0.00619009f, 0.00195326f,
+			0.17199f, 0.0f, 0.171558f, 0.0f, 0.173819f, 0.0f, 0.173433f, 0.0f, 0.178308f, 0.0472771f, 0.185921f, 0.0690127f,
+			0.176969f, 0.0420215f, 0.181272f, 0.0574919f, 0.192895f, 0.090266f, 0.187741f, 0.0775644f, 0.185214f, 0.0775637f, 0.198029f, 0.10483f,
+		} },
+		{ "HighPassFilter", 96000U, 2U, {
+			0.360397f, 0.0f, 0.346575f, 0.0f, 0.347694f, 0.0f, 0.359318f, 0.0f, 0.434503f, 0.725815f, 0.421566f, 0.712168f,
+			0.824275f, 1.11731f, 0.804479f, 1.08392f, 1.55121f, 1.52454f, 1.5193f, 1.4988f, 0.827257f, 0.526661f, 0.830931f, 0.528398f,
+			0.520095f, 0.185736f, 0.520134f, 0.186381f, 0.422566f, 0.0807028f, 0.42347f, 0.081013f, 0.38404f, 0.0385597f, 0.383583f, 0.038548f,
+			0.366269f, 0.0193254f, 0.366407f, 0.0193496f, 0.357426f, 0.0087031f, 0.357365f, 0.00868713f, 0.353895f, 0.00256027f, 0.354071f, 0.00256035f,
+			0.0215143f, 0.0117411f, 0.0201132f, 0.00859191f, 0.0199792f, 0.00822689f, 0.0197285f, 0.00752873f, 0.0195041f, 0.00685253f, 0.000426916f, 0.000426916f,
+			0.0191276f, 0.00556041f, 0.0193088f, 0.00621065f, 0.0188673f, 0.0044857f, 0.019093f, 0.00540329f, 0.00619009f, 0.00195326f, 0.0196923f, 0.00405975f,
+			0.170075f, 0.0f, 0.173355f, 0.0f, 0.175299f, 0.0f, 0.171939f, 0.0f, 0.174873f, 0.0f, 0.17345f, 0.0f,
+			0.171046f, 0.0f, 0.173809f, 0.0f, 0.174569f, 0.0263257f, 0.174932f, 0.0269411f, 0.173761f, 0.037059f, 0.175393f, 0.0292628f,
+			0.178692f, 0.0438319f, 0.179059f, 0.0502369f, 0.1833f, 0.0473313f, 0.189193f, 0.0769493f, 0.194576f, 0.0822631f, 0.181f, 0.0561185f,
+			0.195677f, 0.0982903f, 0.184555f, 0.0609999f, 0.186751f, 0.0766473f, 0.19256f, 0.0739324f, 0.201162f, 0.104395f, 0.193293f, 0.0929447f,
+		} },
+		{ "LowPassFilter", 44100U, 1U, {
+			0.358283f, 0.000192728f, 0.347876f, 0.000611882f, 0.351676f, 0.00150589f, 0.357925f, 0.00360133f, 0.354094f, 0.00937049f, 0.370592f, 0.0306015f,
+			0.516722f, 0.220742f, 0.813299f, 0.922991f, 0.0575554f, 0.404801f, 0.0102666f, 0.363061f, 0.00241014f, 0.355644f, 0.000579926f, 0.354043f,
+			0.0101078f, 0.0288744f, 0.0176385f, 0.0320237f, 0.0229938f, 0.0347273f, 0.02709f, 0.0368111f, 0.0331314f, 0.0395066f, 0.00258543f, 0.00607901f,
+			0.242776f, 0.263883f, 0.238597f, 0.236731f, 0.231633f, 0.197088f, 0.241051f, 0.238453f, 0.226871f, 0.25687f, 0.221783f, 0.261327f,
+			0.192497f, 0.246852f, 0.15213f, 0.22332f, 0.129531f, 0.215527f, 0.103137f, 0.201111f, 0.0925568f, 0.198587f, 0.0885101f, 0.189634f,
+		} },
+		{ "LowPassFilter", 44100U, 2U, {
+			0.358283f, 0.000192728f, 0.348762f, 0.000228575f, 0.347876f, 0.000611882f, 0.359167f, 0.000612443f, 0.351676f, 0.00150589f, 0.355576f, 0.00147596f,
+			0.357925f, 0.00360133f, 0.350045f, 0.00367111f, 0.354094f, 0.00937049f, 0.358409f, 0.00938346f, 0.370592f, 0.0306015f, 0.371191f, 0.0305466f,
+			0.516722f, 0.220742f, 0.518808f, 0.225153f, 0.813299f, 0.922991f, 0.808156f, 0.919024f, 0.0575554f, 0.404801f, 0.057124f, 0.404512f,
+			0.0102666f, 0.363061f, 0.0101948f, 0.362728f, 0.00241014f, 0.355644f, 0.0024139f, 0.355992f, 0.000579926f, 0.354043f, 0.0005813f, 0.354052f,
+			0.0101078f, 0.0288744f, 0.0162377f, 0.0313752f, 0.0176385f, 0.0320237f, 0.0192598f, 0.0328168f, 0.0229938f, 0.0347273f, 1.68442e-06f, 1.68442e-06f,
+			0.02709f, 0.0368111f, 0.0250108f, 0.0357563f, 0.0331314f, 0.0395066f, 0.0291837f, 0.0378413f, 0.00258543f, 0.00607901f, 0.0349632f, 0.0404809f,
+			0.239693f, 0.259099f, 0.246894f, 0.262156f, 0.258807f, 0.252998f, 0.249694f, 0.238976f, 0.225975f, 0.189419f, 0.208213f, 0.171061f,
+			0.247573f, 0.248758f, 0.238806f, 0.234802f, 0.230148f, 0.262956f, 0.217706f, 0.246745f, 0.225252f, 0.254191f, 0.206529f, 0.249433f,
+			0.1946f, 0.250839f, 0.182594f, 0.242739f, 0.154614f, 0.227876f, 0.14794f, 0.219415f, 0.139682f, 0.212814f, 0.130101f, 0.211153f,
+			0.0950023f, 0.199103f, 0.11353f, 0.208307f, 0.0810259f, 0.187949f, 0.0916564f, 0.197742f, 0.0778635f, 0.188576f, 0.0714746f, 0.186566f,
+		} },
+		{ "LowPassFilter", 48000U, 1U, {
+			0.35868f, 0.000223588f, 0.345682f, 0.000665193f, 0.356779f, 0.00152503f, 0.351116f, 0.00387003f, 0.359009f, 0.00982403f, 0.37289f, 0.0335674f,
+			0.583214f, 0.322818f, 0.699541f, 0.8279f, 0.0512851f, 0.398447f, 0.00869262f, 0.361697f, 0.00208701f, 0.355387f, 0.000506758f, 0.354227f,
+			0.011965f, 0.0284912f, 0.0151359f, 0.0298449f, 0.0199309f, 0.0322001f, 0.0251368f, 0.0348716f, 0.0304156f, 0.0373493f, 0.00243489f, 0.00587198f,
+			0.234068f, 0.263301f, 0.239737f, 0.248281f, 0.22479f, 0.187349f, 0.227456f, 0.238568f, 0.235761f, 0.267477f, 0.202741f, 0.24682f,
+			0.175554f, 0.232976f, 0.157017f, 0.226961f, 0.13123f, 0.214345f, 0.098849f, 0.199764f, 0.103673f, 0.196978f, 0.070705f, 0.189715f,
+		} },
+		{ "LowPassFilter", 48000U, 2U, {
+			0.35868f, 0.000223588f, 0.348355f, 0.000250622f, 0.345682f, 0.000665193f, 0.361282f, 0.000633032f, 0.356779f, 0.00152503f, 0.350466f, 0.00155741f,
+			0.351116f, 0.00387003f, 0.356963f, 0.00376401f, 0.359009f, 0.00982403f, 0.354035f, 0.00998316f, 0.37289f, 0.0335674f, 0.372943f, 0.0332825f,
+			0.583214f, 0.322818f, 0.582444f, 0.323293f, 0.699541f, 0.8279f, 0.703101f, 0.830554f, 0.0512851f, 0.398447f, 0.0510858f, 0.398158f,
+			0.00869262f, 0.361697f, 0.00876185f, 0.361431f, 0.00208701f, 0.355387f, 0.00208924f, 0.355645f, 0.000506758f, 0.354227f, 0.000505548f, 0.353738f,
+			0.011965f, 0.0284912f, 0.0149028f, 0.0297855f, 0.0151359f, 0.0298449f, 0.0183614f, 0.0314111f, 0.0199309f, 0.0322001f, 1.93817e-06f, 1.93817e-06f,
+			0.0251368f, 0.0348716f, 0.023348f, 0.0339564f, 0.0304156f, 0.0373493f, 0.0266982f, 0.0355898f, 0.00243489f, 0.00587198f, 0.0321158f, 0.0384117f,
+			0.223895f, 0.250268f, 0.245973f, 0.265457f, 0.256864f, 0.260308f, 0.249045f, 0.246276f, 0.217338f, 0.187059f, 0.20613f, 0.169297f,
+			0.240024f, 0.25068f, 0.240489f, 0.247307f, 0.241061f, 0.267698f, 0.217564f, 0.247554f, 0.220032f, 0.262148f, 0.198715f, 0.249472f,
+			0.176333f, 0.23814f, 0.170568f, 0.237534f, 0.158043f, 0.22527f, 0.139477f, 0.21856f, 0.110984f, 0.203585f, 0.128155f, 0.209374f,
+			0.0963224f, 0.199161f, 0.10475f, 0.202892f, 0.0857924f, 0.190169f, 0.0797118f, 0.191394f, 0.0742648f, 0.18927f, 0.0637411f, 0.182378f,
+		} },
+		{ "LowPassFilter", 96000U, 1U, {
+			0.360415f, 0.000332655f, 0.347692f, 0.000856031f, 0.349461f, 0.00207357f, 0.358162f, 0.00509197f, 0.358699f, 0.0146738f, 0.398592f, 0.0678155f,
+			0.817109f, 0.784098f, 0.157451f, 0.485311f, 0.0163502f, 0.368215f, 0.00292001f, 0.356133f, 0.000669009f, 0.354201f, 0.000158505f, 0.353596f,
+			0.00863146f, 0.0202609f, 0.00803508f, 0.0200018f, 0.0104564f, 0.021011f, 0.013269f, 0.0223532f, 0.0157928f, 0.0236411f, 0.00049589f, 0.00537795f,
+			0.18366f, 0.239541f, 0.211665f, 0.253071f, 0.202559f, 0.224567f, 0.190385f, 0.243933f, 0.172014f, 0.235297f, 0.155342f, 0.226775f,
+			0.115963f, 0.207653f, 0.098613f, 0.197176f, 0.0812375f, 0.187878f, 0.0708401f, 0.187251f, 0.0618644f, 0.183124f, 0.0468858f, 0.178613f,
+		} },
+		{ "LowPassFilter", 96000U, 2U, {
+			0.360415f, 0.000332655f, 0.346565f, 0.000372621f, 0.347692f, 0.000856031f, 0.35937f, 0.000859234f, 0.349461f, 0.00207357f, 0.357885f, 0.00200182f,
+			0.358162f, 0.00509197f, 0.350665f, 0.0051513f, 0.358699f, 0.0146738f, 0.360036f, 0.014804f, 0.398592f, 0.0678155f, 0.400529f, 0.0686629f,
+			0.817109f, 0.784098f, 0.820622f, 0.787886f, 0.157451f, 0.485311f, 0.159749f, 0.487413f, 0.0163502f, 0.368215f, 0.0163327f, 0.367782f,
+			0.00292001f, 0.356133f, 0.00293789f, 0.356261f, 0.000669009f, 0.354201f, 0.000669367f, 0.354145f, 0.000158505f, 0.353596f, 0.000162818f, 0.353772f,
+			0.00863146f, 0.0202609f, 0.0075462f, 0.0198239f, 0.00803508f, 0.0200018f, 0.00922115f, 0.020476f, 0.0104564f, 0.021011f, 4.31754e-07f, 4.31754e-07f,
+			0.013269f, 0.0223532f, 0.0118166f, 0.0216422f, 0.0157928f, 0.0236411f, 0.0142293f, 0.0228334f, 0.00049589f, 0.00537795f, 0.017313f, 0.025014f,
+			0.176363f, 0.233034f, 0.189365f, 0.249646f, 0.208599f, 0.255515f, 0.203715f, 0.246903f, 0.214528f, 0.232297f, 0.198403f, 0.223024f,
+			0.184479f, 0.237122f, 0.19806f, 0.255662f, 0.181731f, 0.2422f, 0.161555f, 0.229452f, 0.136567f, 0.2119f, 0.146706f, 0.225342f,
+			0.12354f, 0.212699f, 0.122798f, 0.208447f, 0.110832f, 0.208953f, 0.101426f, 0.201051f, 0.0918706f, 0.197758f, 0.0939477f, 0.195456f,
+			0.0780713f, 0.188212f, 0.0670752f, 0.187835f, 0.0538008f, 0.179692f, 0.047579f, 0.182544f, 0.0436569f, 0.180461f, 0.0452169f, 0.178181f,
+		} },
+	};
+}
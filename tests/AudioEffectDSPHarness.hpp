@@ -0,0 +1,289 @@
+﻿#pragma once
+#include "ksmaudio/AudioEffect/All.hpp"
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// 音声エフェクトのDSPを単体で動かすためのテスト用ハーネス
+// ゴールデン出力との比較(TestAudioEffectDSPGolden.cpp)と処理速度の計測(TestAudioEffectDSPBenchmark.cpp)で共通して使用する
+namespace AudioEffectDSPHarness
+{
+	using namespace ksmaudio::AudioEffect;
+
+	struct Config
+	{
+		std::size_t sampleRate;
+		std::size_t numChannels;
+	};
+
+	inline const std::vector<Config> kConfigs = {
+		{ 44100U, 1U },
+		{ 44100U, 2U },
+		{ 48000U, 1U },
+		{ 48000U, 2U },
+		{ 96000U, 1U },
+		{ 96000U, 2U },
+	};
+
+	// ゲーム内のBASSのDSPコールバックと同程度のブロックサイズ
+	constexpr std::size_t kBlockFrames = 512U;
+
+	// 入力信号の各区間の長さ(秒)
+	constexpr double kSweepSec = 0.3;
+	constexpr double kImpulseSec = 0.15;
+	constexpr double kNoiseSec = 0.3;
+	constexpr double kSignalSec = kSweepSec + kImpulseSec + kNoiseSec;
+
+	// ゴールデン出力として保持するエンベロープの窓の数
+	constexpr std::size_t kNumEnvelopeWindows = 30U;
+
+	inline std::size_t NumSignalFrames(const Config& config)
+	{
+		return static_cast<std::size_t>(kSignalSec * static_cast<double>(config.sampleRate) + 0.5);
+	}
+
+	// サインスイープ・インパルス列・ホワイトノイズを順に並べた入力信号を生成する
+	// Note: 乱数には実装依存のない線形合同法を使用しているため、環境によらず同じ信号になる
+	inline std::vector<float> CreateCanonicalSignal(const Config& config)
+	{
+		const std::size_t numFrames = NumSignalFrames(config);
+		const double sampleRate = static_cast<double>(config.sampleRate);
+		const std::size_t sweepEndFrame = static_cast<std::size_t>(kSweepSec * sampleRate);
+		const std::size_t impulseEndFrame = static_cast<std::size_t>((kSweepSec + kImpulseSec) * sampleRate);
+		const std::size_t impulseIntervalFrames = static_cast<std::size_t>(0.03 * sampleRate);
+
+		// 40Hzからナイキスト周波数の9割までの対数スイープ
+		const double freqBegin = 40.0;
+		const double freqEnd = sampleRate * 0.45;
+		const double sweepRate = std::log(freqEnd / freqBegin) / kSweepSec;
+
+		std::vector<float> signal(numFrames * config.numChannels);
+		std::uint32_t noiseState = 12345U;
+		for (std::size_t i = 0U; i < numFrames; ++i)
+		{
+			for (std::size_t channel = 0U; channel < config.numChannels; ++channel)
+			{
+				float value;
+				if (i < sweepEndFrame)
+				{
+					const double t = static_cast<double>(i) / sampleRate;
+					const double phase = 2.0 * 3.14159265358979 * freqBegin * (std::exp(sweepRate * t) - 1.0) / sweepRate;
+					value = static_cast<float>(0.5 * (channel == 0U ? std::sin(phase) : std::cos(phase)));
+				}
+				else if (i < impulseEndFrame)
+				{
+					// 右チャンネルは半周期ずらす
+					const std::size_t offset = channel == 0U ? 0U : impulseIntervalFrames / 2U;
+					value = ((i - sweepEndFrame + offset) % impulseIntervalFrames == 0U) ? 0.9f : 0.0f;
+				}
+				else
+				{
+					noiseState = noiseState * 1664525U + 1013904223U;
+					value = 0.3f * (static_cast<float>(noiseState >> 8) / static_cast<float>(1U << 24) * 2.0f - 1.0f);
+				}
+				signal[i * config.numChannels + channel] = value;
+			}
+		}
+		return signal;
+	}
+
+	// 次のトリガまでの秒数(periodSecごとにトリガされる)
+	inline float SecUntilNextTrigger(float sec, float periodSec)
+	{
+		const float next = std::ceil(sec / periodSec) * periodSec;
+		return next - sec;
+	}
+
+	// 0→1→0と変化する三角波
+	inline float Triangle(float sec, float periodSec)
+	{
+		const float phase = std::fmod(sec / periodSec, 1.0f);
+		return phase < 0.5f ? phase * 2.0f : 2.0f - phase * 2.0f;
+	}
+
+	// pDataのnumFramesフレーム分をインプレースで処理する関数
+	// 呼び出すたびに前回の続きの時刻から処理する
+	using Processor = std::function<void(float* pData, std::size_t numFrames)>;
+
+	struct EffectCase
+	{
+		std::string name;
+
+		// DSPを新規に作成し、それを処理するProcessorを返す
+		std::function<Processor(const Config& config)> createProcessor;
+	};
+
+	// paramsFuncはブロックの先頭の時刻(秒)からDSPParamsを返す関数
+	// ゲーム内と同様に、kBlockFramesごとにupdateParamsを呼んでからprocessを呼ぶ
+	template <typename DSP, typename ParamsFunc>
+	EffectCase MakeEffectCase(const std::string& name, ParamsFunc paramsFunc)
+	{
+		return {
+			name,
+			[paramsFunc](const Config& config) -> Processor
+			{
+				auto pDSP = std::make_shared<DSP>(DSPCommonInfo{ config.sampleRate, config.numChannels });
+				auto pProcessedFrames = std::make_shared<std::size_t>(0U);
+				return [paramsFunc, config, pDSP, pProcessedFrames](float* pData, std::size_t numFrames)
+				{
+					for (std::size_t frameIdx = 0U; frameIdx < numFrames; frameIdx += kBlockFrames)
+					{
+						const std::size_t blockFrames = std::min(kBlockFrames, numFrames - frameIdx);
+						const float sec = static_cast<float>(*pProcessedFrames) / static_cast<float>(config.sampleRate);
+						const auto params = paramsFunc(sec);
+						pDSP->updateParams(params);
+						pDSP->process(pData + frameIdx * config.numChannels, blockFrames * config.numChannels, false, params);
+						*pProcessedFrames += blockFrames;
+					}
+				};
+			},
+		};
+	}
+
+	// 全13種類の音声エフェクト
+	// Note: RetriggerとEchoは同じDSPをパラメータ違いで使用している
+	inline const std::vector<EffectCase>& EffectCases()
+	{
+		static const std::vector<EffectCase> cases = {
+			MakeEffectCase<RetriggerEchoDSP>("Retrigger", [](float sec)
+			{
+				return RetriggerEchoDSPParams{
+					.secUntilTrigger = SecUntilNextTrigger(sec, 0.25f),
+					.waveLength = 0.05f,
+					.rate = 0.7f,
+				};
+			}),
+			MakeEffectCase<GateDSP>("Gate", [](float sec)
+			{
+				return GateDSPParams{
+					.secUntilTrigger = SecUntilNextTrigger(sec, 0.25f),
+					.waveLength = 0.0625f,
+					.rate = 0.6f,
+				};
+			}),
+			MakeEffectCase<FlangerDSP>("Flanger", [](float)
+			{
+				return FlangerDSPParams{
+					.period = 0.5f,
+					.stereoWidth = 0.3f,
+				};
+			}),
+			MakeEffectCase<BitcrusherDSP>("Bitcrusher", [](float sec)
+			{
+				return BitcrusherDSPParams{
+					.reduction = 2.0f + 30.0f * Triangle(sec, 0.5f),
+				};
+			}),
+			MakeEffectCase<PhaserDSP>("Phaser", [](float sec)
+			{
+				return PhaserDSPParams{
+					.period = 0.5f,
+					.stage = sec < kSignalSec / 2 ? 6U : 12U,
+					.stereoWidth = 0.3f,
+				};
+			}),
+			MakeEffectCase<PitchShiftDSP>("PitchShift", [](float sec)
+			{
+				return PitchShiftDSPParams{
+					.pitch = sec < kSignalSec / 2 ? 5.0f : -7.0f,
+				};
+			}),
+			MakeEffectCase<WobbleDSP>("Wobble", [](float sec)
+			{
+				return WobbleDSPParams{
+					.secUntilTrigger = SecUntilNextTrigger(sec, 0.25f),
+					.waveLength = 0.125f,
+					.mix = 0.8f,
+				};
+			}),
+			MakeEffectCase<TapestopDSP>("Tapestop", [](float sec)
+			{
+				// 0.2秒後にテープストップを開始する
+				return TapestopDSPParams{
+					.trigger = sec >= 0.2f,
+				};
+			}),
+			MakeEffectCase<RetriggerEchoDSP>("Echo", [](float sec)
+			{
+				return RetriggerEchoDSPParams{
+					.updateTrigger = sec == 0.0f,
+					.waveLength = 0.08f,
+					.fadesOut = true,
+					.feedbackLevel = 0.6f,
+				};
+			}),
+			MakeEffectCase<SidechainDSP>("Sidechain", [](float sec)
+			{
+				return SidechainDSPParams{
+					.secUntilTrigger = SecUntilNextTrigger(sec, 0.25f),
+				};
+			}),
+			MakeEffectCase<PeakingFilterDSP>("PeakingFilter", [](float sec)
+			{
+				// 途中でmixを0にしてリリース処理も通す
+				return PeakingFilterDSPParams{
+					.v = Triangle(sec, 0.4f),
+					.mix = (0.5f <= sec && sec < 0.6f) ? 0.0f : 1.0f,
+					.releaseEnabled = true,
+				};
+			}),
+			MakeEffectCase<HighPassFilterDSP>("HighPassFilter", [](float sec)
+			{
+				return HighPassFilterDSPParams{
+					.v = Triangle(sec, 0.5f),
+				};
+			}),
+			MakeEffectCase<LowPassFilterDSP>("LowPassFilter", [](float sec)
+			{
+				return LowPassFilterDSPParams{
+					.v = Triangle(sec, 0.5f),
+				};
+			}),
+		};
+		return cases;
+	}
+
+	struct GoldenEntry
+	{
+		const char* name;
+		std::size_t sampleRate;
+		std::size_t numChannels;
+		std::vector<float> envelope;
+	};
+
+	// 出力を窓ごとのエンベロープに要約する
+	// 各窓・各チャンネルについて、出力のRMSと(出力 - 入力)のRMSを並べたものを返す
+	// Note: 1サンプル単位の比較ではなくエンベロープで比較することで、浮動小数点演算の誤差やトリガ位置の1サンプルのずれは許容しつつ、
+	//       音量・周波数特性・位相・タイミングの変化は検出できるようにしている
+	inline std::vector<float> CalcEnvelope(const Config& config, const std::vector<float>& dry, const std::vector<float>& wet)
+	{
+		const std::size_t numFrames = dry.size() / config.numChannels;
+		std::vector<float> envelope;
+		envelope.reserve(kNumEnvelopeWindows * config.numChannels * 2U);
+		for (std::size_t window = 0U; window < kNumEnvelopeWindows; ++window)
+		{
+			const std::size_t beginFrame = window * numFrames / kNumEnvelopeWindows;
+			const std::size_t endFrame = (window + 1U) * numFrames / kNumEnvelopeWindows;
+			for (std::size_t channel = 0U; channel < config.numChannels; ++channel)
+			{
+				double wetSum = 0.0;
+				double diffSum = 0.0;
+				for (std::size_t i = beginFrame; i < endFrame; ++i)
+				{
+					const double w = wet[i * config.numChannels + channel];
+					const double d = w - dry[i * config.numChannels + channel];
+					wetSum += w * w;
+					diffSum += d * d;
+				}
+				const double count = static_cast<double>(endFrame - beginFrame);
+				envelope.push_back(static_cast<float>(std::sqrt(wetSum / count)));
+				envelope.push_back(static_cast<float>(std::sqrt(diffSum / count)));
+			}
+		}
+		return envelope;
+	}
+}
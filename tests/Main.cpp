@@ -7,6 +7,7 @@
 #endif
 
 #include <catch2/catch.hpp>
+#include "SimulationRunner.hpp"
 
 // Linux環境でのみヘッドレスモードを使用
 #ifdef __linux__
@@ -20,6 +21,13 @@ void Main()
 	// コマンドライン引数を取得
 	const Array<String> args = System::GetCommandLineArgs();
 
+	// "--simulate"が指定された場合はテストの代わりに判定シミュレータのバッチランナーを実行
+	if (SimulationRunner::IsRequested(args))
+	{
+		SimulationRunner::Run(args);
+		return;
+	}
+
 	// argc, argvに変換
 	std::vector<char*> argv;
 	std::vector<std::string> argStrings;
@@ -0,0 +1,258 @@
+﻿#include "SimulationRunner.hpp"
+#include <iomanip>
+#include <iostream>
+#include "HighScore/KscKey.hpp"
+#include "MusicGame/ChartDataLoader.hpp"
+#include "MusicGame/Simulation/JudgmentSimulator.hpp"
+#include "MusicGame/Simulation/InputScript.hpp"
+
+using namespace MusicGame;
+using namespace MusicGame::Simulation;
+
+namespace
+{
+	constexpr StringView kSimulateArg = U"--simulate";
+
+	enum class InputMode
+	{
+		kAuto,
+		kScript,
+	};
+
+	struct RunnerOption
+	{
+		FilePath chartPath;
+
+		Array<double> tickRatesHz = { 60.0 };
+
+		InputMode inputMode = InputMode::kAuto;
+
+		double offsetSec = 0.0;
+
+		GaugeType gaugeType = GaugeType::kNormalGauge;
+	};
+
+	void PrintUsage()
+	{
+		std::cerr << "Usage: ksm-v2-test --simulate <chart.ksh|directory> [--tick-rate <Hz,...>] [--input auto|script] [--offset <ms>] [--gauge easy|normal|hard]" << std::endl;
+	}
+
+	Optional<Array<double>> ParseTickRates(StringView str)
+	{
+		Array<double> tickRatesHz;
+		for (const String& part : String{ str }.split(U','))
+		{
+			const Optional<double> tickRateHz = ParseOpt<double>(part);
+			if (!tickRateHz.has_value() || *tickRateHz <= 0.0)
+			{
+				return none;
+			}
+			tickRatesHz.push_back(*tickRateHz);
+		}
+		if (tickRatesHz.empty())
+		{
+			return none;
+		}
+		return tickRatesHz;
+	}
+
+	Optional<RunnerOption> ParseArgs(const Array<String>& args)
+	{
+		RunnerOption option;
+		bool hasChartPath = false;
+		for (std::size_t i = 1U; i < args.size(); ++i)
+		{
+			const String& arg = args[i];
+			if (i + 1U >= args.size())
+			{
+				std::cerr << "Missing value for " << arg.narrow() << std::endl;
+				return none;
+			}
+			const String& value = args[++i];
+
+			if (arg == kSimulateArg)
+			{
+				option.chartPath = FileSystem::FullPath(value);
+				hasChartPath = true;
+			}
+			else if (arg == U"--tick-rate")
+			{
+				const Optional<Array<double>> tickRatesHz = ParseTickRates(value);
+				if (!tickRatesHz.has_value())
+				{
+					std::cerr << "Invalid tick rate: " << value.narrow() << std::endl;
+					return none;
+				}
+				option.tickRatesHz = *tickRatesHz;
+			}
+			else if (arg == U"--input")
+			{
+				if (value == U"auto")
+				{
+					option.inputMode = InputMode::kAuto;
+				}
+				else if (value == U"script")
+				{
+					option.inputMode = InputMode::kScript;
+				}
+				else
+				{
+					std::cerr << "Invalid input mode: " << value.narrow() << std::endl;
+					return none;
+				}
+			}
+			else if (arg == U"--offset")
+			{
+				const Optional<double> offsetMs = ParseOpt<double>(value);
+				if (!offsetMs.has_value())
+				{
+					std::cerr << "Invalid offset: " << value.narrow() << std::endl;
+					return none;
+				}
+				option.offsetSec = *offsetMs / 1000;
+			}
+			else if (arg == U"--gauge")
+			{
+				const Optional<GaugeType> gaugeType = KscKey::ParseGaugeType(value);
+				if (!gaugeType.has_value())
+				{
+					std::cerr << "Invalid gauge type: " << value.narrow() << std::endl;
+					return none;
+				}
+				option.gaugeType = *gaugeType;
+			}
+			else
+			{
+				std::cerr << "Unknown argument: " << arg.narrow() << std::endl;
+				return none;
+			}
+		}
+
+		if (!hasChartPath)
+		{
+			return none;
+		}
+		return option;
+	}
+
+	Array<FilePath> ChartFilePaths(FilePathView chartPath)
+	{
+		if (!FileSystem::IsDirectory(chartPath))
+		{
+			return { FilePath{ chartPath } };
+		}
+
+		// Note: 譜面データは1譜面ずつ読み込んで破棄するため、ここではパスのみを列挙する
+		Array<FilePath> chartFilePaths = FileSystem::DirectoryContents(chartPath, Recursive::Yes).filter([](const FilePath& path) { return FileSystem::Extension(path) == U"ksh"; });
+		chartFilePaths.sort();
+		return chartFilePaths;
+	}
+
+	StringView InputModeStr(InputMode inputMode)
+	{
+		return inputMode == InputMode::kScript ? U"script" : U"auto";
+	}
+
+	StringView AchievementStr(Achievement achievement)
+	{
+		switch (achievement)
+		{
+		case Achievement::kCleared:
+			return U"cleared";
+		case Achievement::kFullCombo:
+			return U"fullcombo";
+		case Achievement::kPerfect:
+			return U"perfect";
+		default:
+			return U"failed";
+		}
+	}
+
+	StringView GradeStr(Grade grade)
+	{
+		constexpr std::array<StringView, static_cast<std::size_t>(Grade::kNumGrades)> kGradeStrs = { U"-", U"D", U"C", U"B", U"A", U"AA", U"AAA" };
+		const std::size_t gradeIdx = static_cast<std::size_t>(grade);
+		return gradeIdx < kGradeStrs.size() ? kGradeStrs[gradeIdx] : U"?";
+	}
+
+	void PrintHeader()
+	{
+		std::cout << "chart\ttick_rate_hz\tinput\toffset_ms\tgauge\tscore\tachievement\tgrade\tgauge_percentage\tmax_combo\ttotal_combo\tcritical\tnear_fast\tnear_slow\terror\tnum_ticks\tns_per_tick" << std::endl;
+	}
+
+	void PrintResult(FilePathView chartFilePath, double tickRateHz, const RunnerOption& option, const SimulationResult& result)
+	{
+		const PlayResult& playResult = result.playResult;
+		const Judgment::ComboStats& comboStats = playResult.comboStats;
+		std::cout
+			<< chartFilePath.narrow() << '\t'
+			<< std::fixed << std::setprecision(1) << tickRateHz << '\t'
+			<< InputModeStr(option.inputMode).narrow() << '\t'
+			<< std::setprecision(1) << option.offsetSec * 1000 << '\t'
+			<< KscKey::GaugeTypeStr(option.gaugeType).narrow() << '\t'
+			<< playResult.score << '\t'
+			<< AchievementStr(playResult.achievement()).narrow() << '\t'
+			<< GradeStr(playResult.grade()).narrow() << '\t'
+			<< std::setprecision(2) << playResult.gaugePercentage << '\t'
+			<< playResult.maxCombo << '\t'
+			<< playResult.totalCombo << '\t'
+			<< comboStats.critical << '\t'
+			<< comboStats.nearFast << '\t'
+			<< comboStats.nearSlow << '\t'
+			<< comboStats.error << '\t'
+			<< result.numTicks << '\t'
+			<< std::setprecision(1) << result.nsPerTick() << std::endl;
+	}
+}
+
+namespace SimulationRunner
+{
+	bool IsRequested(const Array<String>& args)
+	{
+		return args.contains(String{ kSimulateArg });
+	}
+
+	int32 Run(const Array<String>& args)
+	{
+		const Optional<RunnerOption> option = ParseArgs(args);
+		if (!option.has_value())
+		{
+			PrintUsage();
+			return 1;
+		}
+
+		PlayOption playOption;
+		playOption.isAutoPlay = option->inputMode == InputMode::kAuto ? IsAutoPlayYN::Yes : IsAutoPlayYN::No;
+		playOption.gaugeType = option->gaugeType;
+
+		PrintHeader();
+
+		int32 exitCode = 0;
+		for (const FilePath& chartFilePath : ChartFilePaths(option->chartPath))
+		{
+			// 譜面ライブラリ全体を対象にしてもメモリ使用量が増えないよう、1譜面ずつ読み込んで実行する
+			const kson::ChartData chartData = LoadChartDataForPlay(chartFilePath, playOption);
+			if (chartData.error != kson::ErrorType::None)
+			{
+				std::cerr << "Could not load chart: " << chartFilePath.narrow() << std::endl;
+				exitCode = 1;
+				continue;
+			}
+
+			for (const double tickRateHz : option->tickRatesHz)
+			{
+				const SimulationOption simulationOption{ .tickRateHz = tickRateHz };
+				if (option->inputMode == InputMode::kScript)
+				{
+					NoteTimingInputScript inputScript(chartData, option->offsetSec);
+					PrintResult(chartFilePath, tickRateHz, *option, RunSimulation(chartData, playOption, simulationOption, &inputScript));
+				}
+				else
+				{
+					PrintResult(chartFilePath, tickRateHz, *option, RunSimulation(chartData, playOption, simulationOption, nullptr));
+				}
+			}
+		}
+		return exitCode;
+	}
+}
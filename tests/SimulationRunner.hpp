@@ -0,0 +1,26 @@
+﻿#pragma once
+
+// 判定シミュレータで譜面を一括でスコア計算するバッチランナー
+// テストバイナリに"--simulate"を指定して起動した場合、Catch2のテストの代わりに実行する
+// (JudgmentSimulatorはkshootmania本体のソースに依存するため、本体のソースをリンク済みのテストバイナリ上で実行する)
+//
+// 使用例: ksm-v2-test --simulate songs --tick-rate 120,1000 --input script --offset 10
+//   --simulate <path>       譜面ファイル(.ksh)、またはディレクトリ(サブディレクトリ内の.kshも含めて全て実行)
+//   --tick-rate <Hz,...>    1秒あたりのティック数(カンマ区切りで複数指定すると、それぞれで実行。省略時は60)
+//   --input <auto|script>   auto: オートプレイ / script: ノーツのタイミングにずれを加えた入力(省略時はauto)
+//   --offset <ms>           scriptの入力のずれ(正の値で遅く入力する。省略時は0)
+//   --gauge <easy|normal|hard> ゲージの種類(省略時はnormal)
+//
+// 実行ごとにスコアとPlayResultをタブ区切りで1行ずつ標準出力へ書き出す
+namespace SimulationRunner
+{
+	/// @brief コマンドライン引数でバッチランナーの実行が指定されているかどうか
+	/// @param args コマンドライン引数
+	[[nodiscard]]
+	bool IsRequested(const Array<String>& args);
+
+	/// @brief バッチランナーを実行
+	/// @param args コマンドライン引数
+	/// @return 全ての譜面を実行できた場合は0、引数が不正な場合や読み込めない譜面があった場合は1
+	int32 Run(const Array<String>& args);
+}
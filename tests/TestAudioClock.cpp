@@ -0,0 +1,154 @@
+﻿#include <catch2/catch.hpp>
+#include "MusicGame/Audio/AudioClock.hpp"
+
+using MusicGame::Audio::AudioClock;
+
+namespace
+{
+	// ミキサーの更新単位(この単位でしか再生位置が進まない)
+	constexpr double kMixerUpdateSec = 0.01;
+
+	// 量子化された再生位置は真の位置より平均して更新単位の半分だけ遅れる
+	constexpr double kQuantizationBiasSec = kMixerUpdateSec / 2;
+
+	/// @brief 経過時間に対して指定の速さで進み、ミキサーの更新単位で量子化された再生位置を返す仮想の音声
+	struct SimulatedAudio
+	{
+		double rate;
+
+		double startPosSec = 0.0;
+
+		double truePosSec(double steadySec) const
+		{
+			return startPosSec + steadySec * rate;
+		}
+
+		double reportedPosSec(double steadySec) const
+		{
+			return std::floor(truePosSec(steadySec) / kMixerUpdateSec) * kMixerUpdateSec;
+		}
+	};
+
+	/// @brief 60fpsを中心に±4msばらつくフレームの経過時間を生成
+	Array<double> CreateJitteryFrameTimes(double durationSec, uint64 seed)
+	{
+		std::mt19937_64 rng(seed);
+		std::uniform_real_distribution<double> jitter(-0.004, 0.004);
+
+		Array<double> frameTimes;
+		for (double t = 0.0; t < durationSec; t += 1.0 / 60 + jitter(rng))
+		{
+			frameTimes.push_back(t);
+		}
+		return frameTimes;
+	}
+}
+
+TEST_CASE("AudioClock output is smooth and tracks the audio position", "[audio_clock]")
+{
+	const SimulatedAudio audio{ .rate = 1.0003 };
+	const Array<double> frameTimes = CreateJitteryFrameTimes(60.0, 1);
+
+	AudioClock clock;
+	clock.reset(audio.reportedPosSec(0.0), 0.0);
+
+	double prevNowSec = clock.now(0.0);
+	double prevSteadySec = 0.0;
+	double maxRawDeltaErrorSec = 0.0;
+	double maxDeltaErrorSec = 0.0;
+	double maxTrackingErrorSec = 0.0;
+	for (const double steadySec : frameTimes)
+	{
+		const double rawPosSec = audio.reportedPosSec(steadySec);
+		clock.update(rawPosSec, steadySec);
+		const double nowSec = clock.now(steadySec);
+
+		// 単調増加
+		REQUIRE(nowSec >= prevNowSec);
+
+		// 収束後(開始から5秒以降)の誤差を計測
+		if (steadySec >= 5.0)
+		{
+			const double expectedDeltaSec = (steadySec - prevSteadySec) * audio.rate;
+			maxDeltaErrorSec = Max(maxDeltaErrorSec, Abs((nowSec - prevNowSec) - expectedDeltaSec));
+			maxRawDeltaErrorSec = Max(maxRawDeltaErrorSec, Abs((rawPosSec - audio.reportedPosSec(prevSteadySec)) - expectedDeltaSec));
+			maxTrackingErrorSec = Max(maxTrackingErrorSec, Abs(nowSec - (audio.truePosSec(steadySec) - kQuantizationBiasSec)));
+		}
+
+		prevNowSec = nowSec;
+		prevSteadySec = steadySec;
+	}
+
+	// フレーム間の進み幅のばらつきが、量子化された再生位置をそのまま使う場合より十分小さい
+	REQUIRE(maxRawDeltaErrorSec > 0.005);
+	REQUIRE(maxDeltaErrorSec < maxRawDeltaErrorSec / 5);
+
+	// 再生位置への追従誤差
+	REQUIRE(maxTrackingErrorSec < 0.0025);
+
+	// 速さのずれを推定できている
+	const auto& stats = clock.stats();
+	REQUIRE(stats.driftPPM() == Approx(300.0).margin(150.0));
+	REQUIRE(stats.numSamples > 0);
+	REQUIRE(stats.numResyncs == 0);
+	REQUIRE(stats.rmsErrorSec() < kMixerUpdateSec);
+}
+
+TEST_CASE("AudioClock resyncs on discontinuities", "[audio_clock]")
+{
+	SimulatedAudio audio{ .rate = 1.0 };
+	AudioClock clock;
+	clock.reset(0.0, 0.0);
+
+	double steadySec = 0.0;
+	for (int i = 0; i < 600; ++i)
+	{
+		steadySec += 1.0 / 60;
+		clock.update(audio.reportedPosSec(steadySec), steadySec);
+		clock.now(steadySec);
+	}
+	REQUIRE(clock.stats().numResyncs == 0);
+
+	SECTION("Forward jump (seek)")
+	{
+		audio.startPosSec = 2.0;
+		steadySec += 1.0 / 60;
+		clock.update(audio.reportedPosSec(steadySec), steadySec);
+		REQUIRE(clock.stats().numResyncs == 1);
+		REQUIRE(clock.now(steadySec) == Approx(audio.reportedPosSec(steadySec)));
+
+		for (int i = 0; i < 60; ++i)
+		{
+			steadySec += 1.0 / 60;
+			clock.update(audio.reportedPosSec(steadySec), steadySec);
+			REQUIRE(clock.now(steadySec) == Approx(audio.truePosSec(steadySec) - kQuantizationBiasSec).margin(kMixerUpdateSec));
+		}
+		REQUIRE(clock.stats().numResyncs == 1);
+	}
+
+	SECTION("Stall of the audio position")
+	{
+		// 100msの間、再生位置が更新されない場合も推定した速さで進み続ける
+		const double stalledPosSec = audio.reportedPosSec(steadySec);
+		double prevNowSec = clock.now(steadySec);
+		for (int i = 0; i < 6; ++i)
+		{
+			steadySec += 1.0 / 60;
+			clock.update(stalledPosSec, steadySec);
+			const double nowSec = clock.now(steadySec);
+			REQUIRE(nowSec > prevNowSec);
+			prevNowSec = nowSec;
+		}
+
+		// 再生位置の更新が再開した後も単調増加を保つ
+		for (int i = 0; i < 60; ++i)
+		{
+			steadySec += 1.0 / 60;
+			clock.update(audio.reportedPosSec(steadySec), steadySec);
+			const double nowSec = clock.now(steadySec);
+			REQUIRE(nowSec >= prevNowSec);
+			prevNowSec = nowSec;
+		}
+		REQUIRE(clock.stats().numResyncs == 0);
+	}
+}
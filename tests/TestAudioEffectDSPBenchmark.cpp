@@ -0,0 +1,53 @@
+﻿#include <catch2/catch.hpp>
+#include "AudioEffectDSPHarness.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace AudioEffectDSPHarness;
+
+namespace
+{
+	// 1つの設定あたりに処理する入力信号の繰り返し回数
+	constexpr int kNumRepeats = 8;
+}
+
+// 実行時間がかかるため通常のテスト実行からは除外している
+// 実行する場合は"[benchmark]"タグを指定する
+TEST_CASE("Audio effect DSP benchmark", "[.][AudioEffect][benchmark]")
+{
+	std::cout << std::left << std::setw(16) << "Effect";
+	for (const auto& config : kConfigs)
+	{
+		std::cout << std::right << std::setw(12) << (std::to_string(config.sampleRate / 1000U) + "k/" + std::to_string(config.numChannels) + "ch");
+	}
+	std::cout << "  (ns/sample)" << std::endl;
+
+	for (const auto& effectCase : EffectCases())
+	{
+		std::cout << std::left << std::setw(16) << effectCase.name;
+		for (const auto& config : kConfigs)
+		{
+			const std::vector<float> source = CreateCanonicalSignal(config);
+			const std::size_t numFrames = NumSignalFrames(config);
+			std::vector<float> buffer(source.size());
+
+			// DSPの作成(バッファ確保)にかかる時間は含めない
+			const Processor processor = effectCase.createProcessor(config);
+			double totalNanoseconds = 0.0;
+			for (int i = 0; i < kNumRepeats; ++i)
+			{
+				std::copy(source.begin(), source.end(), buffer.begin());
+				const auto start = std::chrono::steady_clock::now();
+				processor(buffer.data(), numFrames);
+				totalNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+			}
+
+			const double nsPerSample = totalNanoseconds / (static_cast<double>(source.size()) * kNumRepeats);
+			std::cout << std::right << std::setw(12) << std::fixed << std::setprecision(2) << nsPerSample;
+		}
+		std::cout << std::endl;
+	}
+
+	SUCCEED();
+}
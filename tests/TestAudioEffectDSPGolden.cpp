@@ -0,0 +1,118 @@
+﻿#include <catch2/catch.hpp>
+#include "AudioEffectDSPHarness.hpp"
+#include "AudioEffectDSPGolden.hpp"
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace AudioEffectDSPHarness;
+
+namespace
+{
+	// エンベロープの許容誤差
+	constexpr float kAbsTolerance = 5e-4f;
+	constexpr float kRelTolerance = 0.005f;
+
+	constexpr const char* kGoldenFileName = "AudioEffectDSPGolden.hpp";
+
+	std::vector<float> RenderEnvelope(const EffectCase& effectCase, const Config& config)
+	{
+		const std::vector<float> dry = CreateCanonicalSignal(config);
+		std::vector<float> wet = dry;
+		effectCase.createProcessor(config)(wet.data(), NumSignalFrames(config));
+		return CalcEnvelope(config, dry, wet);
+	}
+
+	// C++の浮動小数点リテラルとして出力する
+	std::string ToFloatLiteral(float value)
+	{
+		std::ostringstream oss;
+		oss << std::setprecision(6) << value;
+		std::string str = oss.str();
+		if (str.find_first_of(".e") == std::string::npos)
+		{
+			str += ".0";
+		}
+		return str + "f";
+	}
+
+	const GoldenEntry* FindGoldenEntry(const std::string& name, const Config& config)
+	{
+		for (const auto& entry : AudioEffectDSPGolden::kEntries)
+		{
+			if (entry.name == name && entry.sampleRate == config.sampleRate && entry.numChannels == config.numChannels)
+			{
+				return &entry;
+			}
+		}
+		return nullptr;
+	}
+}
+
+TEST_CASE("Audio effect DSP outputs match golden envelopes", "[AudioEffect][golden]")
+{
+	for (const auto& effectCase : EffectCases())
+	{
+		for (const auto& config : kConfigs)
+		{
+			INFO(effectCase.name << " (" << config.sampleRate << " Hz, " << config.numChannels << " ch)");
+
+			const GoldenEntry* pGolden = FindGoldenEntry(effectCase.name, config);
+			REQUIRE(pGolden != nullptr);
+
+			const std::vector<float> envelope = RenderEnvelope(effectCase, config);
+			REQUIRE(envelope.size() == pGolden->envelope.size());
+
+			// 最初にずれた位置を報告する
+			std::size_t numMismatches = 0U;
+			std::ostringstream firstMismatch;
+			for (std::size_t i = 0U; i < envelope.size(); ++i)
+			{
+				const float expected = pGolden->envelope[i];
+				if (std::abs(envelope[i] - expected) > kAbsTolerance + kRelTolerance * std::abs(expected))
+				{
+					if (numMismatches == 0U)
+					{
+						const std::size_t valuesPerWindow = config.numChannels * 2U;
+						firstMismatch << "window " << i / valuesPerWindow << ", ch " << i % valuesPerWindow / 2U
+							<< (i % 2U == 0U ? " (wet rms)" : " (diff rms)") << ": " << envelope[i] << " != " << expected;
+					}
+					++numMismatches;
+				}
+			}
+			INFO(firstMismatch.str());
+			CHECK(numMismatches == 0U);
+		}
+	}
+}
+
+// DSPの出力を意図的に変更した場合に実行し、生成されたファイルでtests/AudioEffectDSPGolden.hppを置き換える
+TEST_CASE("Update audio effect DSP golden envelopes", "[.][AudioEffect][golden-update]")
+{
+	std::ofstream ofs(kGoldenFileName);
+	REQUIRE(ofs);
+
+	ofs << "#pragma once\n";
+	ofs << "#include \"AudioEffectDSPHarness.hpp\"\n\n";
+	ofs << "// Note: This file is generated by the \"[golden-update]\" test case in TestAudioEffectDSPGolden.cpp. Do not edit manually.\n";
+	ofs << "namespace AudioEffectDSPGolden\n{\n";
+	ofs << "\tinline const std::vector<AudioEffectDSPHarness::GoldenEntry> kEntries = {\n";
+	for (const auto& effectCase : EffectCases())
+	{
+		for (const auto& config : kConfigs)
+		{
+			const std::vector<float> envelope = RenderEnvelope(effectCase, config);
+			ofs << "\t\t{ \"" << effectCase.name << "\", " << config.sampleRate << "U, " << config.numChannels << "U, {";
+			for (std::size_t i = 0U; i < envelope.size(); ++i)
+			{
+				ofs << (i % 12U == 0U ? "\n\t\t\t" : " ") << ToFloatLiteral(envelope[i]) << ",";
+			}
+			ofs << "\n\t\t} },\n";
+		}
+	}
+	ofs << "\t};\n}\n";
+
+	std::cout << "Golden envelopes were written to " << kGoldenFileName << std::endl;
+}
@@ -0,0 +1,114 @@
+﻿#include <catch2/catch.hpp>
+#include "ksmaudio/ksmaudio.hpp"
+#include <cmath>
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t kSampleRate = 44100U;
+	constexpr std::size_t kNumChannels = 2U;
+	constexpr std::size_t kNumFrames = kSampleRate * 3U;
+
+	std::string TempFilePath(const std::string& fileName)
+	{
+		return (std::filesystem::temp_directory_path() / fileName).string();
+	}
+
+	void WriteSourceWavFile(const std::string& filePath)
+	{
+		std::vector<float> data(kNumFrames * kNumChannels);
+		for (std::size_t i = 0U; i < kNumFrames; ++i)
+		{
+			const float t = static_cast<float>(i) / kSampleRate;
+			data[i * 2U] = 0.3f * std::sin(t * 440.0f * 6.2831853f);
+			data[i * 2U + 1U] = 0.3f * std::sin(t * 660.0f * 6.2831853f);
+		}
+
+		ksmaudio::WavFileWriter writer(filePath, kSampleRate, kNumChannels, ksmaudio::WavSampleFormat::kFloat32);
+		writer.write(data.data(), kNumFrames);
+		writer.close();
+	}
+
+	std::vector<float> RenderFrom(const ksmaudio::Stream& stream, double startSec)
+	{
+		std::vector<float> data(kNumFrames * kNumChannels);
+		stream.seekPosSec(ksmaudio::SecondsF{ startSec });
+		const std::size_t numFrames = stream.render(data.data(), kNumFrames);
+		data.resize(numFrames * kNumChannels);
+		return data;
+	}
+}
+
+TEST_CASE("AudioSourceCache shares mapped files between streams", "[ksmaudio][AudioSourceCache]")
+{
+	const std::string sourceFilePath = TempFilePath("ksm_test_audio_source_cache.wav");
+	WriteSourceWavFile(sourceFilePath);
+
+	SECTION("Same file is mapped once and released with the last reference")
+	{
+		REQUIRE(ksmaudio::AudioSourceCache::NumOpenFiles() == 0U);
+		{
+			const auto file1 = ksmaudio::AudioSourceCache::Open(sourceFilePath);
+			const auto file2 = ksmaudio::AudioSourceCache::Open((std::filesystem::path(sourceFilePath).parent_path() / "." / "ksm_test_audio_source_cache.wav").string());
+			REQUIRE(file1 != nullptr);
+			REQUIRE(file1 == file2);
+			REQUIRE(file1->size() == std::filesystem::file_size(sourceFilePath));
+			REQUIRE(ksmaudio::AudioSourceCache::NumOpenFiles() == 1U);
+		}
+		REQUIRE(ksmaudio::AudioSourceCache::NumOpenFiles() == 0U);
+	}
+
+	SECTION("Missing file")
+	{
+		REQUIRE(ksmaudio::AudioSourceCache::Open(TempFilePath("ksm_test_audio_source_cache_missing.wav")) == nullptr);
+		REQUIRE(ksmaudio::AudioSourceCache::NumOpenFiles() == 0U);
+	}
+
+	SECTION("Reader reads and seeks within the file")
+	{
+		ksmaudio::AudioSourceReader reader(ksmaudio::AudioSourceCache::Open(sourceFilePath));
+		const std::uint64_t fileSize = reader.length();
+
+		// WAVファイルのヘッダ
+		char header[4];
+		REQUIRE(reader.read(header, sizeof(header)) == sizeof(header));
+		REQUIRE(std::string(header, sizeof(header)) == "RIFF");
+		REQUIRE(reader.position() == sizeof(header));
+
+		// 終端をまたぐ読み込みは終端までになる
+		std::vector<char> buffer(64);
+		REQUIRE(reader.seek(fileSize - 10U));
+		REQUIRE(reader.read(buffer.data(), buffer.size()) == 10U);
+		REQUIRE(reader.read(buffer.data(), buffer.size()) == 0U);
+
+		REQUIRE(reader.seek(fileSize));
+		REQUIRE_FALSE(reader.seek(fileSize + 1U));
+	}
+
+	SECTION("Streams opened through the cache decode the same as streams opened from the file")
+	{
+		ksmaudio::InitNoSound();
+		{
+			const ksmaudio::Stream fileStream(sourceFilePath, 1.0, false, false, false, 1.0, true);
+			const ksmaudio::Stream mappedStream1(sourceFilePath, 1.0, false, true, false, 1.0, true);
+			const ksmaudio::Stream mappedStream2(sourceFilePath, 1.0, false, true, false, 1.0, true);
+			REQUIRE(ksmaudio::AudioSourceCache::NumOpenFiles() == 1U);
+
+			REQUIRE(mappedStream1.numChannels() == kNumChannels);
+			REQUIRE(mappedStream1.duration().count() == Approx(fileStream.duration().count()));
+
+			const std::vector<float> expected = RenderFrom(fileStream, 1.0);
+			REQUIRE(expected.size() == (kNumFrames - kSampleRate) * kNumChannels);
+			REQUIRE(RenderFrom(mappedStream1, 1.0) == expected);
+
+			// 同じファイルを共有していても読み込み位置はストリームごとに独立
+			REQUIRE(RenderFrom(mappedStream2, 0.0).size() == kNumFrames * kNumChannels);
+			REQUIRE(RenderFrom(mappedStream1, 1.0) == expected);
+		}
+		REQUIRE(ksmaudio::AudioSourceCache::NumOpenFiles() == 0U);
+		ksmaudio::Terminate();
+	}
+
+	std::filesystem::remove(sourceFilePath);
+}
@@ -0,0 +1,97 @@
+﻿#include <catch2/catch.hpp>
+#include "ksmaudio/AudioEffect/detail/StereoBiquadFilter.hpp"
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace ksmaudio::AudioEffect::detail;
+
+namespace
+{
+	float TestSignal(std::size_t frameIdx, std::size_t channel)
+	{
+		return 0.5f * std::sin(static_cast<float>(frameIdx) * (channel == 0U ? 0.031f : 0.047f)) + 0.1f * static_cast<float>(channel);
+	}
+
+	BiquadCoefficients<float> SweepLowPassCoefficients(std::size_t frameIdx, std::size_t channel)
+	{
+		const float freq = 2000.0f + 1500.0f * std::sin(static_cast<float>(frameIdx) * 0.002f + static_cast<float>(channel));
+		return BiquadCoefficients<float>::LowPassFilter(freq, 1.414f, 44100.0f);
+	}
+}
+
+TEST_CASE("Biquad coefficients are normalized by a0", "[AudioEffect][BiquadFilter]")
+{
+	const auto coef = BiquadCoefficients<float>::Normalized(2.0f, 1.0f, 0.5f, 4.0f, 3.0f, 2.0f);
+	REQUIRE(coef.b0 == 2.0f);
+	REQUIRE(coef.b1 == 1.5f);
+	REQUIRE(coef.b2 == 1.0f);
+	REQUIRE(coef.a1 == 0.5f);
+	REQUIRE(coef.a2 == 0.25f);
+
+	// 係数が恒等の場合は入力をそのまま出力する
+	BiquadFilter<float> filter;
+	REQUIRE(filter.process(0.25f) == 0.25f);
+	REQUIRE(filter.process(-1.0f) == -1.0f);
+}
+
+TEST_CASE("StereoBiquadFilter matches BiquadFilter per channel", "[AudioEffect][BiquadFilter]")
+{
+	constexpr std::size_t kNumFrames = 4096U;
+
+	SECTION("Per-frame processing with per-channel coefficients")
+	{
+		StereoBiquadFilter stereoFilter;
+		std::array<BiquadFilter<float>, 2> filters;
+		bool allEqual = true;
+		for (std::size_t i = 0U; i < kNumFrames; ++i)
+		{
+			const auto coefL = SweepLowPassCoefficients(i, 0U);
+			const auto coefR = SweepLowPassCoefficients(i, 1U);
+			stereoFilter.setCoefficients(coefL, coefR);
+			filters[0].setCoefficients(coefL);
+			filters[1].setCoefficients(coefR);
+
+			const std::array<float, 2> input = { TestSignal(i, 0U), TestSignal(i, 1U) };
+			std::array<float, 2> output;
+			stereoFilter.processFrame(input.data(), output.data());
+			allEqual = allEqual && output[0] == filters[0].process(input[0]) && output[1] == filters[1].process(input[1]);
+		}
+		REQUIRE(allEqual);
+	}
+
+	SECTION("Block processing of stereo and mono data")
+	{
+		const auto coef = BiquadCoefficients<float>::PeakingFilter(1200.0f, 1.2f, 12.0f, 44100.0f);
+		constexpr float kMix = 0.75f;
+
+		for (std::size_t numChannels = 1U; numChannels <= 2U; ++numChannels)
+		{
+			std::vector<float> data(kNumFrames * numChannels);
+			for (std::size_t i = 0U; i < data.size(); ++i)
+			{
+				data[i] = TestSignal(i / numChannels, i % numChannels);
+			}
+			std::vector<float> expected = data;
+
+			std::array<BiquadFilter<float>, 2> filters;
+			for (auto& filter : filters)
+			{
+				filter.setCoefficients(coef);
+			}
+			for (std::size_t i = 0U; i < expected.size(); ++i)
+			{
+				const float wet = filters[i % numChannels].process(expected[i]);
+				expected[i] = expected[i] + (wet - expected[i]) * kMix;
+			}
+
+			// ブロックの境界をまたいでも状態が引き継がれること
+			StereoBiquadFilter stereoFilter;
+			stereoFilter.setCoefficients(coef);
+			stereoFilter.processBlock(data.data(), 1000U, numChannels, kMix);
+			stereoFilter.processBlock(data.data() + 1000U * numChannels, kNumFrames - 1000U, numChannels, kMix);
+
+			REQUIRE(data == expected);
+		}
+	}
+}
@@ -0,0 +1,352 @@
+﻿#include <catch2/catch.hpp>
+#include "Common/SPSCQueue.hpp"
+#include "Input/ButtonEvent/ButtonEventThread.hpp"
+#include "MusicGame/Judgment/JudgmentInputTimestamper.hpp"
+#include "MusicGame/Simulation/JudgmentSimulator.hpp"
+
+using namespace MusicGame;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+	struct ScriptedPress
+	{
+		Button button;
+
+		double beginSec;
+
+		double endSec;
+	};
+
+	/// @brief 予め決めた時刻に押下・解放する合成入力元
+	/// @remark 時刻は基準時刻からの経過秒数で指定する
+	class SyntheticButtonStateSource : public IButtonStateSource
+	{
+	private:
+		const Array<ScriptedPress> m_presses;
+
+		const Clock::time_point m_originTime;
+
+	public:
+		SyntheticButtonStateSource(const Array<ScriptedPress>& presses, Clock::time_point originTime)
+			: m_presses(presses)
+			, m_originTime(originTime)
+		{
+		}
+
+		uint32 pressedButtonBitsAt(Clock::time_point time) const
+		{
+			const double sec = std::chrono::duration<double>(time - m_originTime).count();
+			uint32 bits = 0U;
+			for (const auto& press : m_presses)
+			{
+				if (press.beginSec <= sec && sec < press.endSec)
+				{
+					bits |= 1U << press.button;
+				}
+			}
+			return bits;
+		}
+
+		uint32 pressedButtonBits() override
+		{
+			return pressedButtonBitsAt(Clock::now());
+		}
+	};
+
+	Clock::time_point ToTimePoint(Clock::time_point originTime, double sec)
+	{
+		return originTime + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(sec));
+	}
+
+	// 0.5秒間隔のBTチップのみの譜面(120BPM)
+	kson::ChartData CreateChipChartData()
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 120.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+		for (kson::Pulse y = 1920; y < 1920 * 5; y += 240)
+		{
+			chartData.note.bt[(y / 240) % 4].emplace(y, kson::Interval{ 0 });
+		}
+		return chartData;
+	}
+
+	// ノーツの直後(0〜4ms後)に押す入力
+	Array<ScriptedPress> CreatePressesForChart(const kson::ChartData& chartData)
+	{
+		const auto timingCache = kson::CreateTimingCache(chartData.beat);
+		Array<ScriptedPress> presses;
+		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumBTLanesSZ; ++laneIdx)
+		{
+			for (const auto& [y, note] : chartData.note.bt[laneIdx])
+			{
+				const double sec = kson::PulseToSec(y, chartData.beat, timingCache) + 0.001 + (y / 240 % 4) * 0.001;
+				presses.push_back(ScriptedPress{ .button = static_cast<Button>(laneIdx), .beginSec = sec, .endSec = sec + 0.03 });
+			}
+		}
+		return presses;
+	}
+
+	/// @brief 入力スレッドのポーリングと描画フレームを仮想時刻で再現し、フレームごとの判定用入力を生成する
+	/// @param presses 押下の予定
+	/// @param pollIntervalSec 入力スレッドのポーリング間隔
+	/// @param frameRate 描画フレームレート
+	/// @param startSec 最初のフレームの時刻
+	/// @param endSec 最後のフレームの時刻
+	/// @param useTimestamper 押下時刻を付与するかどうか
+	/// @param fnOnFrame フレームごとに(フレームの時刻, 判定用入力)を受け取る関数
+	template <typename F>
+	void SimulateInputFrames(const Array<ScriptedPress>& presses, double pollIntervalSec, double frameRate, double startSec, double endSec, bool useTimestamper, F fnOnFrame)
+	{
+		// 負の時刻を避けるため基準時刻をずらす
+		const Clock::time_point originTime = Clock::time_point{} + std::chrono::seconds{ 100 };
+		const SyntheticButtonStateSource source(presses, originTime);
+		ButtonEventDetector detector;
+		Judgment::JudgmentInputTimestamper timestamper;
+		Array<ButtonEvent> queuedEvents;
+
+		int64 pollIdx = 0;
+		double prevFrameSec = std::numeric_limits<double>::lowest();
+		for (int64 frameIdx = 0; ; ++frameIdx)
+		{
+			const double frameSec = startSec + static_cast<double>(frameIdx) / frameRate;
+			if (frameSec > endSec)
+			{
+				break;
+			}
+			const Clock::time_point frameTime = ToTimePoint(originTime, frameSec);
+
+			// 前回のフレームから今回のフレームまでの間の入力スレッドのポーリング
+			while (true)
+			{
+				const double pollSec = startSec + static_cast<double>(pollIdx) * pollIntervalSec;
+				if (pollSec > frameSec)
+				{
+					break;
+				}
+				const Clock::time_point pollTime = ToTimePoint(originTime, pollSec);
+				detector.update(source.pressedButtonBitsAt(pollTime), pollTime, [&queuedEvents](const ButtonEvent& event) { queuedEvents.push_back(event); });
+				++pollIdx;
+			}
+
+			// フレーム単位の入力
+			// (Siv3Dの入力状態と同様に、フレーム間に押して離した場合も押下・解放ありとする)
+			const uint32 pressedBits = source.pressedButtonBitsAt(frameTime);
+			Judgment::JudgmentInput input;
+			for (std::size_t i = 0U; i < Judgment::kNumJudgmentButtons; ++i)
+			{
+				input.buttons[i].pressed = (pressedBits & (1U << i)) != 0U;
+			}
+			for (const auto& press : presses)
+			{
+				Judgment::ButtonInput& button = input.buttons[static_cast<std::size_t>(press.button)];
+				button.down = button.down || (prevFrameSec < press.beginSec && press.beginSec <= frameSec);
+				button.up = button.up || (prevFrameSec < press.endSec && press.endSec <= frameSec);
+			}
+			prevFrameSec = frameSec;
+
+			if (useTimestamper)
+			{
+				for (const auto& event : queuedEvents)
+				{
+					timestamper.addEvent(event);
+				}
+				timestamper.apply(input, frameTime);
+			}
+			queuedEvents.clear();
+
+			fnOnFrame(frameSec, input);
+		}
+	}
+}
+
+TEST_CASE("SPSCQueue basic operations", "[SPSCQueue]")
+{
+	SPSCQueue<int32, 4> queue;
+	int32 value = 0;
+	REQUIRE_FALSE(queue.tryPop(&value));
+
+	// 容量を超える追加は失敗する
+	for (int32 i = 0; i < 4; ++i)
+	{
+		REQUIRE(queue.tryPush(i));
+	}
+	REQUIRE_FALSE(queue.tryPush(4));
+
+	// 取り出しと追加を交互に行い、インデックスが一周しても順序が保たれることを確認
+	for (int32 i = 0; i < 20; ++i)
+	{
+		REQUIRE(queue.tryPop(&value));
+		REQUIRE(value == i);
+		REQUIRE(queue.tryPush(i + 4));
+	}
+	for (int32 i = 20; i < 24; ++i)
+	{
+		REQUIRE(queue.tryPop(&value));
+		REQUIRE(value == i);
+	}
+	REQUIRE_FALSE(queue.tryPop(&value));
+}
+
+TEST_CASE("SPSCQueue transfers values between threads in order", "[SPSCQueue]")
+{
+	constexpr int32 kNumValues = 200000;
+	SPSCQueue<int32, 64> queue;
+
+	std::thread producer([&queue]
+	{
+		for (int32 i = 0; i < kNumValues; ++i)
+		{
+			while (!queue.tryPush(i))
+			{
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	int32 expected = 0;
+	bool isInOrder = true;
+	while (expected < kNumValues)
+	{
+		int32 value;
+		if (queue.tryPop(&value))
+		{
+			isInOrder = isInOrder && value == expected;
+			++expected;
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+
+	REQUIRE(isInOrder);
+}
+
+TEST_CASE("Button down timestamps are independent of frame rate", "[Judgment][ButtonEvent]")
+{
+	constexpr double kPollIntervalSec = 0.00025;
+
+	// 不規則な間隔で押下する
+	Array<ScriptedPress> presses;
+	for (int32 i = 0; i < 200; ++i)
+	{
+		const double beginSec = 0.1 + i * 0.0537 + (i % 7) * 0.0031;
+		presses.push_back(ScriptedPress{ .button = static_cast<Button>(i % 6), .beginSec = beginSec, .endSec = beginSec + 0.02 + (i % 3) * 0.01 });
+	}
+
+	for (const double frameRate : { 20.0, 30.0, 60.0, 144.0, 240.0 })
+	{
+		Array<double> judgedDownSecs;
+		Array<double> frameDownSecs;
+		SimulateInputFrames(presses, kPollIntervalSec, frameRate, 0.0, 11.5, true, [&](double frameSec, const Judgment::JudgmentInput& input)
+		{
+			for (const auto& button : input.buttons)
+			{
+				if (button.down)
+				{
+					judgedDownSecs.push_back(frameSec + button.downTimeOffsetSec);
+					frameDownSecs.push_back(frameSec);
+				}
+			}
+		});
+
+		REQUIRE(judgedDownSecs.size() == presses.size());
+		double maxErrorSec = 0.0;
+		double maxFrameErrorSec = 0.0;
+		for (std::size_t i = 0U; i < presses.size(); ++i)
+		{
+			// 押下時刻はフレーム内で同時刻に押下したボタンの順になるため、予定との誤差は最も近いものを使用する
+			const double pressSec = presses[i].beginSec;
+			const auto nearest = std::min_element(judgedDownSecs.begin(), judgedDownSecs.end(), [pressSec](double a, double b) { return Abs(a - pressSec) < Abs(b - pressSec); });
+			maxErrorSec = Max(maxErrorSec, Abs(*nearest - pressSec));
+			maxFrameErrorSec = Max(maxFrameErrorSec, Abs(frameDownSecs[static_cast<std::size_t>(nearest - judgedDownSecs.begin())] - pressSec));
+
+			// ポーリングで検出するため、押下時刻より前にはならない
+			REQUIRE(*nearest >= pressSec - 1e-9);
+		}
+
+		// フレームレートに関係なく、誤差はポーリング間隔以内(1ms未満)
+		REQUIRE(maxErrorSec <= kPollIntervalSec + 1e-9);
+		REQUIRE(maxErrorSec < 0.001);
+
+		// フレームの時刻のみでは、誤差はフレーム時間程度になる
+		REQUIRE(maxFrameErrorSec > 0.5 / frameRate);
+	}
+}
+
+TEST_CASE("Button down timestamps are used for chip judgment", "[Judgment][ButtonEvent]")
+{
+	const kson::ChartData chartData = CreateChipChartData();
+	const Array<ScriptedPress> presses = CreatePressesForChart(chartData);
+	const int32 numNotes = static_cast<int32>(presses.size());
+
+	const auto fnRun = [&](double frameRate, bool useTimestamper)
+	{
+		Simulation::JudgmentSimulator simulator(chartData, PlayOption{});
+		SimulateInputFrames(presses, 0.001, frameRate, -1.0, 7.0, useTimestamper, [&simulator](double frameSec, const Judgment::JudgmentInput& input)
+		{
+			simulator.tick(frameSec, input);
+		});
+		return simulator.playResult();
+	};
+
+	SECTION("Timestamped input is judged at the press time regardless of frame rate") {
+		for (const double frameRate : { 20.0, 30.0, 60.0, 240.0 })
+		{
+			const PlayResult playResult = fnRun(frameRate, true);
+			REQUIRE(playResult.comboStats.critical == numNotes);
+			REQUIRE(playResult.comboStats.deviationCount == numNotes);
+			REQUIRE(playResult.comboStats.totalDeviationSec / numNotes == Approx(0.003).margin(0.0015));
+		}
+	}
+
+	SECTION("Frame-quantised input is judged late at low frame rates") {
+		// ノーツがフレームの時刻の直後にあるため、フレーム時間(50ms)だけ遅れてNEAR判定になる
+		const PlayResult playResult = fnRun(20.0, false);
+		REQUIRE(playResult.comboStats.nearSlow == numNotes);
+	}
+}
+
+TEST_CASE("ButtonEventThread detects presses from a synthetic source", "[ButtonEvent]")
+{
+	Array<ScriptedPress> presses;
+	for (int32 i = 0; i < 6; ++i)
+	{
+		const double beginSec = 0.05 + i * 0.06;
+		presses.push_back(ScriptedPress{ .button = static_cast<Button>(i % 2), .beginSec = beginSec, .endSec = beginSec + 0.03 });
+	}
+
+	const Clock::time_point originTime = Clock::now();
+	Array<ButtonEvent> events;
+	{
+		ButtonEventThread thread(std::make_unique<SyntheticButtonStateSource>(presses, originTime), std::chrono::microseconds{ 500 });
+		std::this_thread::sleep_until(ToTimePoint(originTime, 0.5));
+
+		ButtonEvent event;
+		while (thread.tryPop(&event))
+		{
+			events.push_back(event);
+		}
+		REQUIRE(thread.numDroppedEvents() == 0U);
+	}
+
+	// 押下・解放が時刻順に全て検出される
+	REQUIRE(events.size() == presses.size() * 2U);
+	for (std::size_t i = 0U; i < presses.size(); ++i)
+	{
+		const ButtonEvent& downEvent = events[i * 2U];
+		const ButtonEvent& upEvent = events[i * 2U + 1U];
+		REQUIRE(downEvent.button == presses[i].button);
+		REQUIRE(downEvent.isDown);
+		REQUIRE(upEvent.button == presses[i].button);
+		REQUIRE_FALSE(upEvent.isDown);
+
+		// 実スレッドではOSのスケジューリングによる遅延があるため、誤差の許容範囲は広めに取る
+		const double downSec = std::chrono::duration<double>(downEvent.time - originTime).count();
+		REQUIRE(downSec >= presses[i].beginSec - 0.001);
+		REQUIRE(downSec < presses[i].beginSec + 0.015);
+	}
+}
@@ -0,0 +1,159 @@
+﻿#include <catch2/catch.hpp>
+#include "ksmaudio/ksmaudio.hpp"
+#include "MusicGame/ChartPreparation.hpp"
+
+using namespace MusicGame;
+
+namespace
+{
+	constexpr std::size_t kSampleRate = 44100U;
+	constexpr std::size_t kNumChannels = 2U;
+
+	void WriteSilentWavFile(FilePathView filePath, double durationSec)
+	{
+		const std::size_t numFrames = static_cast<std::size_t>(kSampleRate * durationSec);
+		const std::vector<float> data(numFrames * kNumChannels, 0.0f);
+		ksmaudio::WavFileWriter writer(filePath.narrow(), kSampleRate, kNumChannels, ksmaudio::WavSampleFormat::kFloat32);
+		writer.write(data.data(), numFrames);
+		writer.close();
+	}
+
+	void WriteChartFile(FilePathView filePath, StringView bgmFilename)
+	{
+		TextWriter writer(filePath, TextEncoding::UTF8_WITH_BOM);
+		writer.writeln(U"title=ChartPreparation test");
+		writer.writeln(U"artist=test");
+		writer.writeln(U"difficulty=extended");
+		writer.writeln(U"level=1");
+		writer.writeln(U"t=120-180");
+		writer.writeln(U"m={}"_fmt(bgmFilename));
+		writer.writeln(U"o=0");
+		writer.writeln(U"ver=167");
+		writer.writeln(U"--");
+		for (int32 measureIdx = 0; measureIdx < 4; ++measureIdx)
+		{
+			if (measureIdx == 2)
+			{
+				writer.writeln(U"t=180");
+			}
+			writer.writeln(U"1000|00|0-");
+			writer.writeln(U"0100|10|--");
+			writer.writeln(U"0010|00|:-");
+			writer.writeln(U"0001|01|o-");
+			writer.writeln(U"--");
+		}
+	}
+
+	PlayOption MakePlayOption(IsAutoPlayYN isAutoPlay)
+	{
+		return PlayOption
+		{
+			.isAutoPlay = isAutoPlay,
+			.turnMode = TurnMode::kMirror,
+		};
+	}
+
+	template <typename Lane>
+	void RequireSameButtonLane(const Lane& a, const Lane& b)
+	{
+		REQUIRE(a.size() == b.size());
+		for (auto itA = a.begin(), itB = b.begin(); itA != a.end(); ++itA, ++itB)
+		{
+			REQUIRE(itA->first == itB->first);
+			REQUIRE(itA->second.length == itB->second.length);
+		}
+	}
+
+	void RequireSamePreparedChart(const PreparedChart& a, const PreparedChart& b)
+	{
+		REQUIRE(a.chartData.beat.bpm == b.chartData.beat.bpm);
+		REQUIRE(a.chartData.beat.scrollSpeed.size() == b.chartData.beat.scrollSpeed.size());
+		for (std::size_t i = 0U; i < kson::kNumBTLanesSZ; ++i)
+		{
+			RequireSameButtonLane(a.chartData.note.bt[i], b.chartData.note.bt[i]);
+			REQUIRE(a.noteAttributeTable.btLane(i).size() == b.noteAttributeTable.btLane(i).size());
+		}
+		for (std::size_t i = 0U; i < kson::kNumFXLanesSZ; ++i)
+		{
+			RequireSameButtonLane(a.chartData.note.fx[i], b.chartData.note.fx[i]);
+			REQUIRE(a.noteAttributeTable.fxLane(i).size() == b.noteAttributeTable.fxLane(i).size());
+		}
+		for (std::size_t i = 0U; i < kson::kNumLaserLanesSZ; ++i)
+		{
+			REQUIRE(a.chartData.note.laser[i].size() == b.chartData.note.laser[i].size());
+		}
+		REQUIRE(a.timingCache.bpmChangePulses == b.timingCache.bpmChangePulses);
+		REQUIRE(a.timingCache.bpmChangeSecs == b.timingCache.bpmChangeSecs);
+		REQUIRE(a.chartFileHash == b.chartFileHash);
+
+		REQUIRE(a.bgm != nullptr);
+		REQUIRE(b.bgm != nullptr);
+		REQUIRE(a.bgm->duration().count() == Approx(b.bgm->duration().count()));
+	}
+}
+
+TEST_CASE("ChartPreparation", "[chart_preparation]")
+{
+	ksmaudio::InitNoSound();
+
+	const FilePath directoryPath = FileSystem::PathAppend(FileSystem::TemporaryDirectoryPath(), U"ksm_test_chart_preparation");
+	FileSystem::CreateDirectories(directoryPath);
+	const FilePath chartFilePath = FileSystem::PathAppend(directoryPath, U"chart.ksh");
+	WriteSilentWavFile(FileSystem::PathAppend(directoryPath, U"bgm.wav"), 3.0);
+	WriteChartFile(chartFilePath, U"bgm.wav");
+
+	SECTION("Asynchronous preparation produces the same data as synchronous preparation")
+	{
+		const PlayOption playOption = MakePlayOption(IsAutoPlayYN::No);
+		const PreparedChart expected = PrepareChart(chartFilePath, playOption);
+		REQUIRE(expected.chartData.note.bt[0].size() == 4U);
+		REQUIRE(expected.chartFileHash.has_value());
+		REQUIRE(expected.bgm->duration().count() == Approx(3.0));
+
+		ChartPreparation chartPreparation(chartFilePath, playOption);
+		const PreparedChart actual = chartPreparation.take();
+		REQUIRE(chartPreparation.isReady());
+		RequireSamePreparedChart(actual, expected);
+	}
+
+	SECTION("Chart file hash is not computed for autoplay")
+	{
+		ChartPreparation chartPreparation(chartFilePath, MakePlayOption(IsAutoPlayYN::Yes));
+		REQUIRE_FALSE(chartPreparation.take().chartFileHash.has_value());
+	}
+
+	SECTION("Options that do not affect the prepared data are ignored by matches()")
+	{
+		const PlayOption playOption = MakePlayOption(IsAutoPlayYN::No);
+		const ChartPreparation chartPreparation(chartFilePath, playOption);
+
+		PlayOption otherHispeed = playOption;
+		otherHispeed.hispeedSetting = HispeedSetting{ .type = HispeedType::XMod, .value = 25 };
+		REQUIRE(chartPreparation.matches(chartFilePath, otherHispeed));
+
+		PlayOption otherTurn = playOption;
+		otherTurn.turnMode = TurnMode::kNormal;
+		REQUIRE_FALSE(chartPreparation.matches(chartFilePath, otherTurn));
+
+		PlayOption otherOffset = playOption;
+		otherOffset.globalOffsetMs += 10;
+		REQUIRE_FALSE(chartPreparation.matches(chartFilePath, otherOffset));
+
+		REQUIRE_FALSE(chartPreparation.matches(FileSystem::PathAppend(directoryPath, U"other.ksh"), playOption));
+	}
+
+	SECTION("Destroying an unfinished preparation does not wait for or leak the tasks")
+	{
+		for (int32 i = 0; i < 8; ++i)
+		{
+			ChartPreparation chartPreparation(chartFilePath, MakePlayOption(IsAutoPlayYN::No));
+		}
+
+		// 後から開始した準備は中断の影響を受けない
+		ChartPreparation chartPreparation(chartFilePath, MakePlayOption(IsAutoPlayYN::No));
+		REQUIRE(chartPreparation.take().bgm != nullptr);
+	}
+
+	FileSystem::Remove(directoryPath);
+	ksmaudio::Terminate();
+}
@@ -0,0 +1,161 @@
+﻿#include <catch2/catch.hpp>
+#include "ksmaudio/AudioEffect/All.hpp"
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <cmath>
+
+using namespace ksmaudio::AudioEffect;
+
+namespace
+{
+	struct TestDSPParams
+	{
+		std::uint64_t seq = 0U;
+		bool updateTrigger = false;
+	};
+}
+
+TEST_CASE("DSPParamsHandoff delivers every update in order", "[AudioEffect][DSPParamsHandoff]")
+{
+	detail::DSPParamsHandoff<TestDSPParams> handoff;
+	std::vector<std::uint64_t> received;
+	const auto consume = [&handoff, &received]
+	{
+		return handoff.consume([&received](const TestDSPParams& params) { received.push_back(params.seq); });
+	};
+
+	REQUIRE_FALSE(consume());
+
+	// 読み込み側が取得するまでの間に複数回更新されても、一度きりのイベントが抜けないこと
+	handoff.push({ 1U, false });
+	handoff.push({ 2U, true });
+	handoff.push({ 3U, false });
+	REQUIRE(consume());
+	REQUIRE(received == std::vector<std::uint64_t>{ 1U, 2U, 3U });
+
+	// 適用済みの更新は再度渡されないこと
+	REQUIRE_FALSE(consume());
+	handoff.push({ 4U, false });
+	REQUIRE(consume());
+	REQUIRE(received == std::vector<std::uint64_t>{ 1U, 2U, 3U, 4U });
+}
+
+TEST_CASE("DSPParamsHandoff drops the oldest updates when the reader stalls", "[AudioEffect][DSPParamsHandoff]")
+{
+	using Handoff = detail::DSPParamsHandoff<TestDSPParams>;
+	Handoff handoff;
+	const std::uint64_t numUpdates = Handoff::kMaxPendingUpdates + 5U;
+	for (std::uint64_t i = 1U; i <= numUpdates; ++i)
+	{
+		handoff.push({ i, false });
+	}
+
+	std::vector<std::uint64_t> received;
+	REQUIRE(handoff.consume([&received](const TestDSPParams& params) { received.push_back(params.seq); }));
+	REQUIRE(received.size() == Handoff::kMaxPendingUpdates);
+	REQUIRE(received.front() == numUpdates - Handoff::kMaxPendingUpdates + 1U);
+	REQUIRE(received.back() == numUpdates);
+}
+
+TEST_CASE("DSPParamsHandoff under concurrent access", "[AudioEffect][DSPParamsHandoff]")
+{
+	constexpr std::uint64_t kNumUpdates = 200000U;
+
+	detail::DSPParamsHandoff<TestDSPParams> handoff;
+	std::atomic<bool> finished = false;
+
+	std::thread writer([&handoff, &finished]
+	{
+		for (std::uint64_t i = 1U; i <= kNumUpdates; ++i)
+		{
+			handoff.push({ i, (i % 7U) == 0U });
+		}
+		finished.store(true, std::memory_order_release);
+	});
+
+	std::uint64_t lastSeq = 0U;
+	bool isOrdered = true;
+	const auto consume = [&]
+	{
+		handoff.consume([&](const TestDSPParams& params)
+		{
+			if (params.seq <= lastSeq || params.updateTrigger != ((params.seq % 7U) == 0U))
+			{
+				isOrdered = false;
+			}
+			lastSeq = params.seq;
+		});
+	};
+	while (!finished.load(std::memory_order_acquire))
+	{
+		consume();
+	}
+	writer.join();
+	consume();
+
+	REQUIRE(isOrdered);
+	REQUIRE(lastSeq == kNumUpdates);
+}
+
+TEST_CASE("Audio effects can be updated while processing on another thread", "[AudioEffect][DSPParamsHandoff]")
+{
+	constexpr std::size_t kSampleRate = 44100U;
+	constexpr std::size_t kNumChannels = 2U;
+	constexpr int kNumUpdates = 20000;
+
+	ksmaudio::Retrigger retrigger(kSampleRate, kNumChannels, false, { 0.0f, 0.5f, 1.0f, 1.5f });
+	ksmaudio::PeakingFilter peakingFilter(kSampleRate, kNumChannels, true);
+	ksmaudio::Tapestop tapestop(kSampleRate, kNumChannels, false);
+
+	std::atomic<bool> finished = false;
+
+	std::thread gameThread([&]
+	{
+		Status status;
+		status.sec = 0.0f;
+		for (int i = 0; i < kNumUpdates; ++i)
+		{
+			status.sec += 1.0f / 240;
+			status.v = static_cast<float>(i % 100) / 100;
+			const bool isOn = (i / 50) % 2 == 0;
+
+			retrigger.updateStatusByFX(status, isOn ? std::make_optional<std::size_t>(0U) : std::nullopt);
+			peakingFilter.updateStatusByLaser(status, isOn);
+			tapestop.updateStatusByFX(status, isOn ? std::make_optional<std::size_t>(1U) : std::nullopt);
+			if (i % 1000 == 0)
+			{
+				tapestop.setBypass(i % 2000 == 0);
+			}
+		}
+		finished.store(true, std::memory_order_release);
+	});
+
+	// オーディオスレッド相当
+	std::vector<float> buffer(256U * kNumChannels);
+	bool isFinite = true;
+	std::size_t frameCount = 0U;
+	while (!finished.load(std::memory_order_acquire))
+	{
+		for (std::size_t i = 0U; i < buffer.size(); ++i)
+		{
+			buffer[i] = std::sin(static_cast<float>(frameCount + i / kNumChannels) * 0.05f) * 0.5f;
+		}
+		frameCount += buffer.size() / kNumChannels;
+
+		retrigger.process(buffer.data(), buffer.size());
+		peakingFilter.process(buffer.data(), buffer.size());
+		tapestop.process(buffer.data(), buffer.size());
+
+		for (float value : buffer)
+		{
+			if (!std::isfinite(value))
+			{
+				isFinite = false;
+			}
+		}
+	}
+	gameThread.join();
+
+	REQUIRE(isFinite);
+}
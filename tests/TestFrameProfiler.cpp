@@ -0,0 +1,104 @@
+﻿#include <catch2/catch.hpp>
+#include "Common/FrameProfiler.hpp"
+
+namespace
+{
+	Array<FrameProfiler::Event> EventsSince(int64 beginNs)
+	{
+		return FrameProfiler::Snapshot().filter([beginNs](const FrameProfiler::Event& event) { return event.beginNs >= beginNs; });
+	}
+}
+
+TEST_CASE("FrameProfiler records nested sections with their parent", "[FrameProfiler]")
+{
+	const int64 testBeginNs = FrameProfiler::NowNs();
+	{
+		const FrameProfiler::ScopedTimer outer{ FrameProfiler::Section::kGameUpdateStatus };
+		{
+			const FrameProfiler::ScopedTimer inner{ FrameProfiler::Section::kGameJudgment };
+		}
+	}
+
+	const Array<FrameProfiler::Event> events = EventsSince(testBeginNs);
+	REQUIRE(events.size() == 2U);
+
+	// 内側の区間が先に終了して記録される
+	REQUIRE(events[0].section == FrameProfiler::Section::kGameJudgment);
+	REQUIRE(events[0].parent == FrameProfiler::Section::kGameUpdateStatus);
+	REQUIRE(events[1].section == FrameProfiler::Section::kGameUpdateStatus);
+	REQUIRE(events[1].parent == FrameProfiler::Section::kNone);
+	REQUIRE(events[1].beginNs <= events[0].beginNs);
+	REQUIRE(events[0].endNs <= events[1].endNs);
+}
+
+TEST_CASE("FrameProfiler does not record while disabled", "[FrameProfiler]")
+{
+	const int64 testBeginNs = FrameProfiler::NowNs();
+	FrameProfiler::SetEnabled(false);
+	{
+		const FrameProfiler::ScopedTimer timer{ FrameProfiler::Section::kGameSE };
+	}
+	FrameProfiler::SetEnabled(true);
+
+	REQUIRE(EventsSince(testBeginNs).empty());
+}
+
+TEST_CASE("FrameProfiler keeps only the latest events when the ring buffer wraps", "[FrameProfiler]")
+{
+	const int64 testBeginNs = FrameProfiler::NowNs();
+	constexpr std::size_t kNumThreads = 4U;
+	constexpr std::size_t kNumEventsPerThread = FrameProfiler::kCapacity;
+
+	Array<std::thread> threads;
+	for (std::size_t i = 0U; i < kNumThreads; ++i)
+	{
+		threads.emplace_back([]
+		{
+			for (std::size_t j = 0U; j < kNumEventsPerThread; ++j)
+			{
+				const FrameProfiler::ScopedTimer timer{ FrameProfiler::Section::kSelectItemConstruction };
+			}
+		});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	const Array<FrameProfiler::Event> events = EventsSince(testBeginNs);
+	REQUIRE(events.size() == FrameProfiler::kCapacity);
+	for (const auto& event : events)
+	{
+		REQUIRE(event.section == FrameProfiler::Section::kSelectItemConstruction);
+		REQUIRE(event.beginNs <= event.endNs);
+	}
+}
+
+TEST_CASE("FrameProfiler exports Chrome trace JSON", "[FrameProfiler]")
+{
+	{
+		const FrameProfiler::ScopedTimer timer{ FrameProfiler::Section::kGameGraphicsDraw };
+	}
+
+	const FilePath filePath = FileSystem::PathAppend(FileSystem::TemporaryDirectoryPath(), U"ksm_test_trace.json");
+	REQUIRE(FrameProfiler::ExportChromeTrace(filePath));
+
+	const JSON json = JSON::Load(filePath);
+	REQUIRE(json);
+	REQUIRE(json[U"traceEvents"].isArray());
+	REQUIRE(json[U"traceEvents"].size() > 0U);
+
+	bool found = false;
+	for (const auto& element : json[U"traceEvents"].arrayView())
+	{
+		if (element[U"name"].getString() == U"GraphicsMain::draw")
+		{
+			REQUIRE(element[U"ph"].getString() == U"X");
+			REQUIRE(element[U"dur"].get<double>() >= 0.0);
+			found = true;
+		}
+	}
+	REQUIRE(found);
+
+	FileSystem::Remove(filePath);
+}
@@ -1,6 +1,8 @@
-#include <catch2/catch.hpp>
+﻿#include <catch2/catch.hpp>
 #include "MusicGame/Scroll/HighwayScroll.hpp"
+#include "MusicGame/Scroll/ScrollSpeedIntegralTable.hpp"
 #include "MusicGame/GameStatus.hpp"
+#include "MusicGame/Graphics/Highway/Note/LaneNoteCuller.hpp"
 
 using namespace MusicGame::Scroll;
 using namespace MusicGame;
@@ -68,3 +70,214 @@ TEST_CASE("HighwayScroll at currentPulse=0 with scroll_speed", "[HighwayScroll]"
 	REQUIRE(posY_0 > posY_960);
 	REQUIRE(posY_m960 - posY_0 == posY_0 - posY_960);
 }
+
+TEST_CASE("ScrollSpeedIntegralTable matches reference implementation for future notes on step graph", "[HighwayScroll][ScrollSpeedIntegralTable]")
+{
+	// stopを焼き込んだ後のような、変更点間で速度が一定のグラフ
+	kson::Graph scrollSpeed;
+	scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+	scrollSpeed[960] = kson::GraphPoint{ kson::GraphValue{ 1.0, 0.0 } };
+	scrollSpeed[1200] = kson::GraphPoint{ kson::GraphValue{ 0.0, 2.0 } };
+	scrollSpeed[1920] = kson::GraphPoint{ kson::GraphValue{ 2.0, -0.5 } };
+	scrollSpeed[2400] = kson::GraphPoint{ kson::GraphValue{ -0.5, 1.0 } };
+
+	const ScrollSpeedIntegralTable table(scrollSpeed);
+
+	for (kson::Pulse currentPulse = -480; currentPulse <= 3360; currentPulse += 120)
+	{
+		for (kson::Pulse notePulse = currentPulse; notePulse <= 3840; notePulse += 60)
+		{
+			const double currentPulseDouble = static_cast<double>(currentPulse) + 0.25;
+			const double expected = CalcScrollSpeedAdjustedRelPulseReference(notePulse, currentPulseDouble, scrollSpeed);
+			REQUIRE(table.scrollSpeedAdjustedRelPulse(notePulse, currentPulseDouble) == Approx(expected));
+		}
+	}
+}
+
+TEST_CASE("ScrollSpeedIntegralTable matches reference implementation at change points of linear graph", "[HighwayScroll][ScrollSpeedIntegralTable]")
+{
+	kson::Graph scrollSpeed;
+	scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+	scrollSpeed[480] = kson::GraphPoint{ 3.0 };
+	scrollSpeed[1440] = kson::GraphPoint{ kson::GraphValue{ -1.0, 2.0 } };
+	scrollSpeed[1920] = kson::GraphPoint{ 0.5 };
+
+	const ScrollSpeedIntegralTable table(scrollSpeed);
+
+	for (const auto& [currentPulse, currentPoint] : scrollSpeed)
+	{
+		for (const auto& [notePulse, notePoint] : scrollSpeed)
+		{
+			if (notePulse < currentPulse)
+			{
+				continue;
+			}
+			const double expected = CalcScrollSpeedAdjustedRelPulseReference(notePulse, static_cast<double>(currentPulse), scrollSpeed);
+			REQUIRE(table.scrollSpeedAdjustedRelPulse(notePulse, static_cast<double>(currentPulse)) == Approx(expected));
+		}
+	}
+}
+
+TEST_CASE("ScrollSpeedIntegralTable integrates past notes exactly", "[HighwayScroll][ScrollSpeedIntegralTable]")
+{
+	kson::Graph scrollSpeed;
+	scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+	scrollSpeed[100] = kson::GraphPoint{ 2.0 };
+	scrollSpeed[300] = kson::GraphPoint{ kson::GraphValue{ 3.0, 0.0 } };
+
+	const ScrollSpeedIntegralTable table(scrollSpeed);
+
+	// 0～100は1.0→2.0、100～300は2.0→3.0の線形補間、300以降は0.0
+	REQUIRE(table.scrollSpeedAdjustedRelPulse(0, 300.0) == Approx(-(150.0 + 500.0)));
+	REQUIRE(table.scrollSpeedAdjustedRelPulse(50, 100.0) == Approx(-(50.0 * (1.5 + 2.0) / 2)));
+	REQUIRE(table.scrollSpeedAdjustedRelPulse(300, 1000.0) == Approx(0.0));
+	REQUIRE(table.scrollSpeedAdjustedRelPulse(-100, 0.0) == Approx(-100.0));
+
+	// 過去方向は未来方向の符号反転になる
+	for (kson::Pulse pulseA = -120; pulseA <= 480; pulseA += 40)
+	{
+		for (kson::Pulse pulseB = -120; pulseB <= 480; pulseB += 40)
+		{
+			REQUIRE(table.scrollSpeedAdjustedRelPulse(pulseA, static_cast<double>(pulseB)) == Approx(-table.scrollSpeedAdjustedRelPulse(pulseB, static_cast<double>(pulseA))).margin(1e-9));
+		}
+	}
+}
+
+TEST_CASE("ScrollSpeedIntegralTable with empty graph returns plain difference", "[HighwayScroll][ScrollSpeedIntegralTable]")
+{
+	const ScrollSpeedIntegralTable table(kson::Graph{});
+
+	REQUIRE(table.scrollSpeedAdjustedRelPulse(960, 480.5) == Approx(479.5));
+	REQUIRE(table.scrollSpeedAdjustedRelPulse(0, 480.0) == Approx(-480.0));
+}
+
+TEST_CASE("ScrollSpeedIntegralTable integralRange matches brute force", "[HighwayScroll][ScrollSpeedIntegralTable]")
+{
+	kson::Graph scrollSpeed;
+	scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+	scrollSpeed[240] = kson::GraphPoint{ -1.0 };
+	scrollSpeed[480] = kson::GraphPoint{ kson::GraphValue{ -1.0, 2.0 } };
+	scrollSpeed[720] = kson::GraphPoint{ -0.5 };
+	scrollSpeed[960] = kson::GraphPoint{ 0.0 };
+
+	const ScrollSpeedIntegralTable table(scrollSpeed);
+
+	for (kson::Pulse beginPulse = -120; beginPulse <= 1080; beginPulse += 30)
+	{
+		for (kson::Pulse endPulse = beginPulse; endPulse <= 1080; endPulse += 45)
+		{
+			double expectedMin = table.integralAt(beginPulse);
+			double expectedMax = expectedMin;
+			for (kson::Pulse pulse = beginPulse; pulse <= endPulse; ++pulse)
+			{
+				expectedMin = Min(expectedMin, table.integralAt(pulse));
+				expectedMax = Max(expectedMax, table.integralAt(pulse));
+			}
+
+			// 速度が0になる点は整数Pulse上にあるとは限らないため、求めた範囲は整数Pulse上の値をすべて含んでいればよい
+			const auto [minIntegral, maxIntegral] = table.integralRange(beginPulse, endPulse);
+			REQUIRE(minIntegral <= expectedMin + 1e-9);
+			REQUIRE(maxIntegral >= expectedMax - 1e-9);
+			REQUIRE(minIntegral >= expectedMin - 1.0);
+			REQUIRE(maxIntegral <= expectedMax + 1.0);
+		}
+	}
+}
+
+namespace
+{
+	/// @brief LaneNoteCullerが描画範囲内のノーツを漏れなく列挙するかを、ノーツ内の全Pulseの座標を調べて検証する
+	void CheckLaneNoteCullerEnumeratesVisibleNotes(const kson::ChartData& chartData, HispeedType hispeedType)
+	{
+		const auto timingCache = kson::CreateTimingCache(chartData.beat);
+
+		HighwayScroll highwayScroll(chartData);
+		HispeedSetting hispeedSetting;
+		hispeedSetting.type = hispeedType;
+		hispeedSetting.value = hispeedType == HispeedType::XMod ? 10 : 600;
+		highwayScroll.update(hispeedSetting, 120.0);
+
+		const auto& lane = chartData.note.bt[0];
+		const MusicGame::Graphics::LaneNoteCuller<kson::Interval> culler(lane, chartData.beat.scrollSpeed, 0);
+
+		GameStatus gameStatus;
+		const HighwayScrollContext highwayScrollContext(&highwayScroll, &chartData.beat, &timingCache, &gameStatus);
+
+		// 順方向の再生に加えて、途中で後方へのシークも行う
+		std::vector<double> currentPulses;
+		for (double pulse = -960.0; pulse < 9600.0; pulse += 97.5)
+		{
+			currentPulses.push_back(pulse);
+		}
+		currentPulses.push_back(480.0);
+		currentPulses.push_back(7200.0);
+		currentPulses.push_back(-240.0);
+
+		for (const double currentPulseDouble : currentPulses)
+		{
+			gameStatus.currentPulseDouble = currentPulseDouble;
+			gameStatus.currentPulse = static_cast<kson::Pulse>(currentPulseDouble);
+			gameStatus.currentTimeSec = kson::PulseDoubleToSec(currentPulseDouble, chartData.beat, timingCache);
+
+			std::set<kson::Pulse> enumeratedPulses;
+			culler.forEachVisible(highwayScrollContext, [&](const auto& itr, std::size_t) { enumeratedPulses.insert(itr->first); });
+
+			for (const auto& [y, note] : lane)
+			{
+				bool isVisible = false;
+				for (kson::Pulse pulse = y; pulse <= y + note.length && !isVisible; ++pulse)
+				{
+					const int32 positionY = highwayScrollContext.getPositionY(pulse);
+					isVisible = 0 <= positionY && positionY < MusicGame::Graphics::kHighwayTextureSize.y;
+				}
+
+				if (isVisible)
+				{
+					REQUIRE(enumeratedPulses.contains(y));
+				}
+			}
+		}
+	}
+
+	kson::ChartData CreateChartDataForLaneNoteCuller()
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 120.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+		for (kson::Pulse y = 0; y < 9600; y += 120)
+		{
+			chartData.note.bt[0].emplace(y, kson::Interval{ (y % 600 == 0) ? 360 : 0 });
+		}
+		return chartData;
+	}
+}
+
+TEST_CASE("LaneNoteCuller enumerates all visible notes", "[HighwayScroll][LaneNoteCuller]")
+{
+	SECTION("Without scroll_speed") {
+		const kson::ChartData chartData = CreateChartDataForLaneNoteCuller();
+		CheckLaneNoteCullerEnumeratesVisibleNotes(chartData, HispeedType::XMod);
+		CheckLaneNoteCullerEnumeratesVisibleNotes(chartData, HispeedType::CMod);
+	}
+
+	SECTION("With positive scroll_speed") {
+		kson::ChartData chartData = CreateChartDataForLaneNoteCuller();
+		chartData.beat.scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+		chartData.beat.scrollSpeed[1920] = kson::GraphPoint{ kson::GraphValue{ 3.0, 0.5 } };
+		chartData.beat.scrollSpeed[4800] = kson::GraphPoint{ 0.0 };
+		chartData.beat.scrollSpeed[5760] = kson::GraphPoint{ 1.0 };
+		CheckLaneNoteCullerEnumeratesVisibleNotes(chartData, HispeedType::XMod);
+	}
+
+	SECTION("With negative scroll_speed") {
+		kson::ChartData chartData = CreateChartDataForLaneNoteCuller();
+		chartData.beat.scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+		chartData.beat.scrollSpeed[1920] = kson::GraphPoint{ kson::GraphValue{ 1.0, -2.0 } };
+		chartData.beat.scrollSpeed[2880] = kson::GraphPoint{ 1.5 };
+		chartData.beat.scrollSpeed[4800] = kson::GraphPoint{ -1.0 };
+		chartData.beat.scrollSpeed[6720] = kson::GraphPoint{ kson::GraphValue{ -1.0, 1.0 } };
+		CheckLaneNoteCullerEnumeratesVisibleNotes(chartData, HispeedType::XMod);
+		CheckLaneNoteCullerEnumeratesVisibleNotes(chartData, HispeedType::OMod);
+		CheckLaneNoteCullerEnumeratesVisibleNotes(chartData, HispeedType::CMod);
+	}
+}
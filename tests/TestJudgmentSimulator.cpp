@@ -0,0 +1,195 @@
+﻿#include <catch2/catch.hpp>
+#include <iomanip>
+#include <iostream>
+#include "MusicGame/Simulation/JudgmentSimulator.hpp"
+#include "MusicGame/Simulation/InputScript.hpp"
+
+using namespace MusicGame;
+using namespace MusicGame::Simulation;
+
+namespace
+{
+	// 0.5秒間隔のBTチップのみの譜面(120BPM、8分音符間隔)
+	kson::ChartData CreateChipOnlyChartData()
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 120.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+		for (kson::Pulse y = 1920; y < 1920 * 5; y += 240)
+		{
+			chartData.note.bt[(y / 240) % 4].emplace(y, kson::Interval{ 0 });
+		}
+		return chartData;
+	}
+
+	// BT・FX・LASERを含む譜面
+	kson::ChartData CreateMixedChartData()
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 150.0;
+		chartData.beat.bpm[7680] = 180.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+		for (kson::Pulse y = 1920; y < 15360; y += 240)
+		{
+			chartData.note.bt[(y / 240) % 4].emplace(y, kson::Interval{ 0 });
+		}
+		chartData.note.fx[0].emplace(3840, kson::Interval{ 1920 });
+		chartData.note.fx[1].emplace(9600, kson::Interval{ 0 });
+
+		kson::LaserSection laserSection;
+		laserSection.v.emplace(0, kson::GraphPoint{ 0.0 });
+		laserSection.v.emplace(960, kson::GraphPoint{ 1.0 });
+		laserSection.v.emplace(1440, kson::GraphPoint{ kson::GraphValue{ 1.0, 0.25 } });
+		laserSection.v.emplace(1920, kson::GraphPoint{ 0.5 });
+		chartData.note.laser[0].emplace(5760, laserSection);
+		chartData.note.laser[1].emplace(11520, laserSection);
+		return chartData;
+	}
+
+	// ノーツが密な譜面(ベンチマーク用)
+	kson::ChartData CreateDenseChartData(int32 numMeasures)
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 240.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+
+		const kson::Pulse endY = 1920 * (numMeasures + 1);
+		for (kson::Pulse y = 1920; y < endY; y += 60)
+		{
+			// 32分音符の階段
+			chartData.note.bt[(y / 60) % 4].emplace(y, kson::Interval{ 0 });
+		}
+		for (kson::Pulse y = 1920; y < endY; y += 960)
+		{
+			chartData.note.fx[(y / 960) % 2].emplace(y, kson::Interval{ 480 });
+		}
+		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumLaserLanesSZ; ++laneIdx)
+		{
+			for (kson::Pulse y = 1920; y < endY; y += 1920)
+			{
+				kson::LaserSection laserSection;
+				for (kson::RelPulse ry = 0; ry < 1920 - 120; ry += 240)
+				{
+					const double v = ((ry / 240) % 2 == 0) == (laneIdx == 0U) ? 0.0 : 1.0;
+					laserSection.v.emplace(ry, kson::GraphPoint{ v });
+				}
+				chartData.note.laser[laneIdx].emplace(y, laserSection);
+			}
+		}
+		return chartData;
+	}
+
+	PlayOption CreateAutoPlayOption()
+	{
+		PlayOption playOption;
+		playOption.isAutoPlay = IsAutoPlayYN::Yes;
+		return playOption;
+	}
+
+	SimulationResult RunNoteTimingSimulation(const kson::ChartData& chartData, double tickRateHz, double offsetSec)
+	{
+		NoteTimingInputScript inputScript(chartData, offsetSec);
+		return RunSimulation(chartData, PlayOption{}, SimulationOption{ .tickRateHz = tickRateHz }, &inputScript);
+	}
+}
+
+TEST_CASE("Judgment simulator auto play", "[Judgment][Simulation]")
+{
+	const kson::ChartData chartData = CreateMixedChartData();
+
+	for (const double tickRateHz : { 60.0, 1000.0, 8000.0 })
+	{
+		const SimulationResult result = RunSimulation(chartData, CreateAutoPlayOption(), SimulationOption{ .tickRateHz = tickRateHz }, nullptr);
+		const auto& comboStats = result.playResult.comboStats;
+		REQUIRE(result.numTicks > 0);
+		REQUIRE(result.playResult.totalCombo > 0);
+		REQUIRE(comboStats.critical == result.playResult.totalCombo);
+		REQUIRE(comboStats.totalNear() == 0);
+		REQUIRE(comboStats.error == 0);
+		REQUIRE(result.playResult.maxCombo == result.playResult.totalCombo);
+	}
+}
+
+TEST_CASE("Judgment simulator note timing input", "[Judgment][Simulation]")
+{
+	const kson::ChartData chartData = CreateChipOnlyChartData();
+	const int32 numNotes = 32;
+
+	SECTION("Just timing") {
+		for (const double tickRateHz : { 60.0, 240.0, 1000.0, 8000.0 })
+		{
+			const SimulationResult result = RunNoteTimingSimulation(chartData, tickRateHz, 0.0);
+			REQUIRE(result.playResult.totalCombo == numNotes);
+			REQUIRE(result.playResult.comboStats.critical == numNotes);
+		}
+	}
+
+	SECTION("Slow") {
+		const SimulationResult result = RunNoteTimingSimulation(chartData, 8000.0, 0.08);
+		REQUIRE(result.playResult.comboStats.nearSlow == numNotes);
+		REQUIRE(result.playResult.comboStats.deviationCount == numNotes);
+		REQUIRE(result.playResult.comboStats.totalDeviationSec / numNotes == Approx(0.08).margin(1.0 / 8000.0));
+	}
+
+	SECTION("Fast") {
+		const SimulationResult result = RunNoteTimingSimulation(chartData, 8000.0, -0.08);
+		REQUIRE(result.playResult.comboStats.nearFast == numNotes);
+		REQUIRE(result.playResult.comboStats.totalDeviationSec / numNotes == Approx(-0.08).margin(1.0 / 8000.0));
+	}
+
+	SECTION("Out of window") {
+		const SimulationResult result = RunNoteTimingSimulation(chartData, 8000.0, 0.2);
+		REQUIRE(result.playResult.comboStats.error == numNotes);
+	}
+}
+
+TEST_CASE("Judgment simulator note timing input with long notes and lasers", "[Judgment][Simulation]")
+{
+	const kson::ChartData chartData = CreateMixedChartData();
+
+	for (const double tickRateHz : { 120.0, 1000.0, 8000.0 })
+	{
+		const SimulationResult result = RunNoteTimingSimulation(chartData, tickRateHz, 0.0);
+		REQUIRE(result.playResult.comboStats.error == 0);
+		REQUIRE(result.playResult.maxCombo == result.playResult.totalCombo);
+	}
+}
+
+TEST_CASE("Judgment simulator is deterministic", "[Judgment][Simulation]")
+{
+	const kson::ChartData chartData = CreateMixedChartData();
+
+	const SimulationResult result1 = RunNoteTimingSimulation(chartData, 1000.0, 0.05);
+	const SimulationResult result2 = RunNoteTimingSimulation(chartData, 1000.0, 0.05);
+	REQUIRE(result1.numTicks == result2.numTicks);
+	REQUIRE(result1.playResult.score == result2.playResult.score);
+	REQUIRE(result1.playResult.comboStats.critical == result2.playResult.comboStats.critical);
+	REQUIRE(result1.playResult.comboStats.nearFast == result2.playResult.comboStats.nearFast);
+	REQUIRE(result1.playResult.comboStats.nearSlow == result2.playResult.comboStats.nearSlow);
+	REQUIRE(result1.playResult.comboStats.error == result2.playResult.comboStats.error);
+	REQUIRE(result1.playResult.comboStats.totalDeviationSec == result2.playResult.comboStats.totalDeviationSec);
+	REQUIRE(result1.playResult.gaugePercentage == result2.playResult.gaugePercentage);
+}
+
+// 実行時間がかかるため通常のテスト実行からは除外している
+// 実行する場合は"[benchmark]"タグを指定する
+// (実際の譜面のスコア計算・計測はSimulationRunner.hppのバッチランナーで行う)
+TEST_CASE("Judgment simulator benchmark", "[.][Judgment][benchmark]")
+{
+	constexpr std::array<double, 5> kTickRatesHz = { 60.0, 240.0, 1000.0, 4000.0, 8000.0 };
+
+	const kson::ChartData chartData = CreateDenseChartData(128);
+
+	std::cout << "Dense chart (128 measures)" << std::endl;
+	std::cout << std::right << std::setw(10) << "Tick rate" << std::setw(12) << "ns/tick" << std::setw(10) << "Score" << std::endl;
+	for (const double tickRateHz : kTickRatesHz)
+	{
+		const SimulationResult result = RunNoteTimingSimulation(chartData, tickRateHz, 0.01);
+		std::cout
+			<< std::right << std::setw(10) << (std::to_string(static_cast<int32>(tickRateHz)) + "Hz")
+			<< std::setw(12) << std::fixed << std::setprecision(1) << result.nsPerTick()
+			<< std::setw(10) << result.playResult.score << std::endl;
+	}
+
+	SUCCEED();
+}
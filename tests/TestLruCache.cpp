@@ -0,0 +1,52 @@
+﻿#include <catch2/catch.hpp>
+#include "Common/LruCache.hpp"
+
+TEST_CASE("LruCache evicts least recently used entries over the cost limit", "[LruCache]")
+{
+	LruCache<String, int32> cache{ 30U, 100U };
+	cache.insert(U"a", 1, 10U);
+	cache.insert(U"b", 2, 10U);
+	cache.insert(U"c", 3, 10U);
+	REQUIRE(cache.totalCost() == 30U);
+
+	// "a"を使用すると"b"が最も古くなる
+	REQUIRE(cache.find(U"a") != nullptr);
+	cache.insert(U"d", 4, 10U);
+
+	REQUIRE(cache.contains(U"a"));
+	REQUIRE_FALSE(cache.contains(U"b"));
+	REQUIRE(cache.contains(U"c"));
+	REQUIRE(cache.contains(U"d"));
+	REQUIRE(cache.totalCost() == 30U);
+}
+
+TEST_CASE("LruCache evicts entries over the count limit", "[LruCache]")
+{
+	LruCache<String, int32> cache{ 1000U, 2U };
+	cache.insert(U"a", 1, 0U);
+	cache.insert(U"b", 2, 0U);
+	cache.insert(U"c", 3, 0U);
+
+	REQUIRE(cache.size() == 2U);
+	REQUIRE_FALSE(cache.contains(U"a"));
+}
+
+TEST_CASE("LruCache replaces existing entries and keeps oversized ones", "[LruCache]")
+{
+	LruCache<String, int32> cache{ 30U, 100U };
+	cache.insert(U"a", 1, 10U);
+	cache.insert(U"a", 2, 20U);
+	REQUIRE(cache.size() == 1U);
+	REQUIRE(cache.totalCost() == 20U);
+	REQUIRE(*cache.find(U"a") == 2);
+
+	// 単体で上限を超える要素は他の要素を全て破棄して保持する
+	cache.insert(U"big", 3, 50U);
+	REQUIRE(cache.size() == 1U);
+	REQUIRE(*cache.find(U"big") == 3);
+
+	cache.clear();
+	REQUIRE(cache.size() == 0U);
+	REQUIRE(cache.totalCost() == 0U);
+	REQUIRE(cache.find(U"big") == nullptr);
+}
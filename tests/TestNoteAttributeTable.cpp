@@ -0,0 +1,123 @@
+﻿#include <catch2/catch.hpp>
+#include "MusicGame/NoteAttributeTable.hpp"
+#include "MusicGame/Graphics/Highway/Note/NoteGraphicsUtils.hpp"
+
+using namespace MusicGame;
+
+namespace
+{
+	kson::ChartData CreateChartDataForNoteAttributeTable()
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 120.0;
+		chartData.beat.bpm[1920] = 180.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+		chartData.beat.timeSig[2] = kson::TimeSig{ 3, 4 };
+		chartData.beat.scrollSpeed[0] = kson::GraphPoint{ 1.0 };
+		chartData.beat.scrollSpeed[960] = kson::GraphPoint{ kson::GraphValue{ 1.0, -0.5 } };
+		chartData.beat.scrollSpeed[2400] = kson::GraphPoint{ 2.0 };
+
+		for (kson::Pulse y = 0; y < 3840; y += 80)
+		{
+			chartData.note.bt[0].emplace(y, kson::Interval{ 0 });
+		}
+		chartData.note.bt[1].emplace(240, kson::Interval{ 720 });
+		chartData.note.fx[0].emplace(0, kson::Interval{ 0 });
+		chartData.note.fx[0].emplace(480, kson::Interval{ 0 });
+		chartData.note.fx[0].emplace(960, kson::Interval{ 480 });
+		chartData.note.fx[1].emplace(480, kson::Interval{ 0 });
+
+		// FX-Lの480とFX-Rの480にのみキー音を指定(FX-Lのロングノーツの始点は対象外)
+		chartData.audio.keySound.fx.chipEvent["clap"][0].emplace(480, kson::KeySoundInvokeFX{});
+		chartData.audio.keySound.fx.chipEvent["snare"][1].emplace(480, kson::KeySoundInvokeFX{});
+		chartData.audio.keySound.fx.chipEvent["snare"][0].emplace(960, kson::KeySoundInvokeFX{});
+		return chartData;
+	}
+}
+
+TEST_CASE("NoteAttributeTable follows lane order", "[NoteAttributeTable]")
+{
+	const kson::ChartData chartData = CreateChartDataForNoteAttributeTable();
+	const auto timingCache = kson::CreateTimingCache(chartData.beat);
+	const NoteAttributeTable table(chartData, timingCache, NoteSkinType::kNote);
+
+	for (std::size_t laneIdx = 0; laneIdx < kson::kNumBTLanesSZ; ++laneIdx)
+	{
+		const auto& lane = chartData.note.bt[laneIdx];
+		const ButtonNoteAttributeLane& attributes = table.btLane(laneIdx);
+		REQUIRE(attributes.size() == lane.size());
+
+		std::size_t noteIdx = 0;
+		for (const auto& [y, note] : lane)
+		{
+			const ButtonNoteAttribute& attribute = attributes[noteIdx];
+			REQUIRE(attribute.start.pulse == y);
+			REQUIRE(attribute.end.pulse == y + note.length);
+			REQUIRE(attribute.start.sec == kson::PulseToSec(y, chartData.beat, timingCache));
+			REQUIRE(attribute.end.sec == kson::PulseToSec(y + note.length, chartData.beat, timingCache));
+			REQUIRE(attribute.isChip() == (note.length == 0));
+			REQUIRE(attribute.chipColorIndex == (note.length == 0 ? Graphics::NoteGraphicsUtils::CalcChipNoteColorIndex(y, chartData.beat, NoteSkinType::kNote) : 0));
+			REQUIRE_FALSE(attribute.hasKeySound);
+			REQUIRE(FindButtonNoteAttributeIdx(attributes, y) == noteIdx);
+			++noteIdx;
+		}
+	}
+
+	REQUIRE_FALSE(FindButtonNoteAttributeIdx(table.btLane(0), 1).has_value());
+	REQUIRE_FALSE(FindButtonNoteAttributeIdx(table.btLane(2), 0).has_value());
+}
+
+TEST_CASE("NoteAttributeTable key sound flags", "[NoteAttributeTable]")
+{
+	const kson::ChartData chartData = CreateChartDataForNoteAttributeTable();
+	const auto timingCache = kson::CreateTimingCache(chartData.beat);
+	const NoteAttributeTable table(chartData, timingCache, NoteSkinType::kDefault);
+
+	const ButtonNoteAttributeLane& fxL = table.fxLane(0);
+	REQUIRE(fxL.size() == 3U);
+	REQUIRE_FALSE(fxL[0].hasKeySound);
+	REQUIRE(fxL[1].hasKeySound);
+	REQUIRE_FALSE(fxL[2].hasKeySound);
+
+	const ButtonNoteAttributeLane& fxR = table.fxLane(1);
+	REQUIRE(fxR.size() == 1U);
+	REQUIRE(fxR[0].hasKeySound);
+
+	// FXノーツには色を付けない
+	REQUIRE(fxL[1].chipColorIndex == 0);
+}
+
+TEST_CASE("HighwayScroll position from precomputed PulsePosition", "[NoteAttributeTable][HighwayScroll]")
+{
+	const kson::ChartData chartData = CreateChartDataForNoteAttributeTable();
+	const auto timingCache = kson::CreateTimingCache(chartData.beat);
+	const NoteAttributeTable table(chartData, timingCache, NoteSkinType::kDefault);
+
+	for (const auto hispeedType : { Scroll::HispeedType::XMod, Scroll::HispeedType::OMod, Scroll::HispeedType::CMod })
+	{
+		Scroll::HighwayScroll highwayScroll(chartData);
+		Scroll::HispeedSetting hispeedSetting;
+		hispeedSetting.type = hispeedType;
+		hispeedSetting.value = hispeedType == Scroll::HispeedType::XMod ? 10 : 600;
+		highwayScroll.update(hispeedSetting, 120.0);
+
+		GameStatus gameStatus;
+		const Scroll::HighwayScrollContext highwayScrollContext(&highwayScroll, &chartData.beat, &timingCache, &gameStatus);
+
+		for (double currentPulseDouble = -960.0; currentPulseDouble < 4800.0; currentPulseDouble += 111.5)
+		{
+			gameStatus.currentPulseDouble = currentPulseDouble;
+			gameStatus.currentPulse = static_cast<kson::Pulse>(currentPulseDouble);
+			gameStatus.currentTimeSec = kson::PulseDoubleToSec(currentPulseDouble, chartData.beat, timingCache);
+
+			for (const ButtonNoteAttribute& attribute : table.btLane(0))
+			{
+				REQUIRE(highwayScrollContext.getPositionY(attribute.start) == highwayScrollContext.getPositionY(attribute.start.pulse));
+			}
+			for (const ButtonNoteAttribute& attribute : table.btLane(1))
+			{
+				REQUIRE(highwayScrollContext.getPositionY(attribute.end) == highwayScrollContext.getPositionY(attribute.end.pulse));
+			}
+		}
+	}
+}
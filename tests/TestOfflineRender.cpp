@@ -0,0 +1,114 @@
+﻿#include <catch2/catch.hpp>
+#include "ksmaudio/ksmaudio.hpp"
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t kSampleRate = 44100U;
+	constexpr std::size_t kNumChannels = 2U;
+	constexpr std::size_t kNumFrames = kSampleRate * 2U;
+
+	std::string TempFilePath(const std::string& fileName)
+	{
+		return (std::filesystem::temp_directory_path() / fileName).string();
+	}
+
+	std::vector<char> ReadAllBytes(const std::string& filePath)
+	{
+		std::ifstream ifs(filePath, std::ios::in | std::ios::binary);
+		return std::vector<char>(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	}
+
+	void WriteSourceWavFile(const std::string& filePath)
+	{
+		std::vector<float> data(kNumFrames * kNumChannels);
+		for (std::size_t i = 0U; i < kNumFrames; ++i)
+		{
+			const float t = static_cast<float>(i) / kSampleRate;
+			data[i * 2U] = 0.3f * std::sin(t * 440.0f * 6.2831853f) + 0.2f * std::sin(t * 5000.0f * 6.2831853f);
+			data[i * 2U + 1U] = 0.3f * std::sin(t * 660.0f * 6.2831853f) + 0.2f * std::sin(t * 7000.0f * 6.2831853f);
+		}
+
+		ksmaudio::WavFileWriter writer(filePath, kSampleRate, kNumChannels, ksmaudio::WavSampleFormat::kFloat32);
+		writer.write(data.data(), kNumFrames);
+		writer.close();
+	}
+
+	std::optional<std::size_t> RenderWithLowPassFilter(const std::string& sourceFilePath, const std::string& outputFilePath)
+	{
+		ksmaudio::StreamWithEffects stream(sourceFilePath, 1.0, false, false, 1.0, true);
+		ksmaudio::AudioEffect::AudioEffectBus* pBus = stream.emplaceAudioEffectBusLaser();
+		pBus->emplaceAudioEffect<ksmaudio::LowPassFilter>("lpf");
+
+		ksmaudio::OfflineRenderOptions options;
+		options.format = ksmaudio::WavSampleFormat::kFloat32;
+		return ksmaudio::RenderToWavFile(stream, outputFilePath, options, [pBus](ksmaudio::SecondsF blockStartSec)
+		{
+			// 再生位置に応じてレーザーの値を動かす
+			ksmaudio::AudioEffect::Status status;
+			status.sec = static_cast<float>(blockStartSec.count());
+			status.v = std::abs(std::sin(status.sec * 3.0f));
+			pBus->updateByLaser(status, 0U);
+		});
+	}
+}
+
+TEST_CASE("Offline rendering of decode-only streams", "[ksmaudio][OfflineRender]")
+{
+	ksmaudio::InitNoSound();
+
+	const std::string sourceFilePath = TempFilePath("ksm_offline_render_source.wav");
+	WriteSourceWavFile(sourceFilePath);
+
+	SECTION("Rendering without audio effects reproduces the source")
+	{
+		const std::string outputFilePath = TempFilePath("ksm_offline_render_dry.wav");
+		const ksmaudio::Stream stream(sourceFilePath, 1.0, false, false, false, 1.0, true);
+		REQUIRE(stream.latency().count() == 0.0);
+
+		ksmaudio::OfflineRenderOptions options;
+		options.format = ksmaudio::WavSampleFormat::kFloat32;
+		options.blockFrames = 1000U;
+		const auto numFrames = ksmaudio::RenderToWavFile(stream, outputFilePath, options);
+		REQUIRE(numFrames == kNumFrames);
+		REQUIRE(ReadAllBytes(outputFilePath) == ReadAllBytes(sourceFilePath));
+
+		std::filesystem::remove(outputFilePath);
+	}
+
+	SECTION("Rendering with audio effects is deterministic")
+	{
+		const std::string outputFilePath1 = TempFilePath("ksm_offline_render_wet1.wav");
+		const std::string outputFilePath2 = TempFilePath("ksm_offline_render_wet2.wav");
+		REQUIRE(RenderWithLowPassFilter(sourceFilePath, outputFilePath1) == kNumFrames);
+		REQUIRE(RenderWithLowPassFilter(sourceFilePath, outputFilePath2) == kNumFrames);
+
+		const auto bytes1 = ReadAllBytes(outputFilePath1);
+		REQUIRE(bytes1 == ReadAllBytes(outputFilePath2));
+		REQUIRE(bytes1 != ReadAllBytes(sourceFilePath));
+
+		std::filesystem::remove(outputFilePath1);
+		std::filesystem::remove(outputFilePath2);
+	}
+
+	SECTION("Rendering stops at maxDuration")
+	{
+		const std::string outputFilePath = TempFilePath("ksm_offline_render_short.wav");
+		const ksmaudio::Stream stream(sourceFilePath, 1.0, false, false, false, 1.0, true);
+
+		ksmaudio::OfflineRenderOptions options;
+		options.maxDuration = ksmaudio::Duration{ 0.5 };
+		const auto numFrames = ksmaudio::RenderToWavFile(stream, outputFilePath, options);
+		REQUIRE(numFrames == kSampleRate / 2U);
+		REQUIRE(ReadAllBytes(outputFilePath).size() == 44U + kSampleRate / 2U * kNumChannels * sizeof(std::int16_t));
+
+		std::filesystem::remove(outputFilePath);
+	}
+
+	std::filesystem::remove(sourceFilePath);
+	ksmaudio::Terminate();
+}
@@ -0,0 +1,51 @@
+﻿#include <catch2/catch.hpp>
+#include "Common/PersistenceQueue.hpp"
+
+TEST_CASE("PersistenceQueue coalesces pending writes with the same key", "[PersistenceQueue]")
+{
+	std::promise<void> releaseFirstWrite;
+	std::shared_future<void> releaseFirstWriteFuture = releaseFirstWrite.get_future().share();
+	std::atomic<int32> firstKeyValue = 0;
+	std::atomic<int32> numSecondKeyWrites = 0;
+	std::atomic<int32> secondKeyValue = 0;
+
+	PersistenceQueue persistenceQueue;
+
+	// 1つ目の書き込みの実行中に、別のキーへの書き込みを投入する
+	const auto firstFuture = persistenceQueue.enqueue(U"first", [&] { releaseFirstWriteFuture.wait(); firstKeyValue = 1; return true; });
+	const auto secondFutureA = persistenceQueue.enqueue(U"second", [&] { ++numSecondKeyWrites; secondKeyValue = 1; return true; });
+	const auto secondFutureB = persistenceQueue.enqueue(U"second", [&] { ++numSecondKeyWrites; secondKeyValue = 2; return true; });
+	releaseFirstWrite.set_value();
+
+	REQUIRE(firstFuture.get());
+	REQUIRE(secondFutureA.get());
+	REQUIRE(secondFutureB.get());
+
+	// 実行前の書き込みは後から投入した内容のみが実行される
+	REQUIRE(firstKeyValue == 1);
+	REQUIRE(numSecondKeyWrites == 1);
+	REQUIRE(secondKeyValue == 2);
+}
+
+TEST_CASE("PersistenceQueue completes all writes on flush and destruction", "[PersistenceQueue]")
+{
+	std::atomic<int32> counter = 0;
+	std::shared_future<bool> failedFuture;
+	{
+		PersistenceQueue persistenceQueue;
+		for (int32 i = 0; i < 10; ++i)
+		{
+			persistenceQueue.enqueue(U"key{}"_fmt(i), [&counter] { ++counter; return true; });
+		}
+		persistenceQueue.flush();
+		REQUIRE(counter.load() == 10);
+
+		failedFuture = persistenceQueue.enqueue(U"failed", [] { return false; });
+		for (int32 i = 0; i < 10; ++i)
+		{
+			persistenceQueue.enqueue(U"key{}"_fmt(i), [&counter] { ++counter; return true; });
+		}
+	}
+	REQUIRE(counter.load() == 20);
+	REQUIRE_FALSE(failedFuture.get());
+}
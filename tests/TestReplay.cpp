@@ -0,0 +1,266 @@
+﻿#include <catch2/catch.hpp>
+#include <bit>
+#include "MusicGame/GameStatusTimer.hpp"
+#include "MusicGame/NoteAttributeTable.hpp"
+#include "MusicGame/Judgment/JudgmentMain.hpp"
+#include "MusicGame/Replay/ReplayIO.hpp"
+#include "MusicGame/Replay/ReplaySimulator.hpp"
+
+using namespace MusicGame;
+using namespace MusicGame::Replay;
+
+namespace
+{
+	kson::ChartData CreateChartDataForReplay()
+	{
+		kson::ChartData chartData;
+		chartData.beat.bpm[0] = 150.0;
+		chartData.beat.bpm[7680] = 210.0;
+		chartData.beat.timeSig[0] = kson::TimeSig{ 4, 4 };
+
+		for (kson::Pulse y = 1920; y < 15360; y += 240)
+		{
+			chartData.note.bt[(y / 240) % 4].emplace(y, kson::Interval{ 0 });
+		}
+		chartData.note.fx[0].emplace(3840, kson::Interval{ 1920 });
+		chartData.note.fx[1].emplace(9600, kson::Interval{ 0 });
+
+		kson::LaserSection laserSection;
+		laserSection.v.emplace(0, kson::GraphPoint{ 0.0 });
+		laserSection.v.emplace(960, kson::GraphPoint{ 1.0 });
+		laserSection.v.emplace(1440, kson::GraphPoint{ kson::GraphValue{ 0.0, 0.5 } });
+		laserSection.v.emplace(1920, kson::GraphPoint{ 0.5 });
+		chartData.note.laser[0].emplace(5760, laserSection);
+		return chartData;
+	}
+
+	PlayOption CreatePlayOptionForReplay()
+	{
+		PlayOption playOption;
+		playOption.gaugeType = GaugeType::kHardGauge;
+		playOption.inputDelayMs = 7;
+		playOption.laserInputDelayMs = 3;
+		playOption.visualOffsetMs = -2;
+		playOption.fastSlowMode = FastSlowMode::kShow;
+		return playOption;
+	}
+
+	// プレイヤーの入力を模した入力を生成する(わざと遅れ・取りこぼしを含める)
+	Judgment::JudgmentInput ScriptedInput(const kson::ChartData& chartData, const kson::TimingCache& timingCache, double currentTimeSec, double prevTimeSec)
+	{
+		Judgment::JudgmentInput input;
+
+		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumBTLanesSZ; ++laneIdx)
+		{
+			for (const auto& [y, note] : chartData.note.bt[laneIdx])
+			{
+				if ((y / 240) % 7 == 3)
+				{
+					// 一部のノーツは見逃す
+					continue;
+				}
+				const double hitSec = kson::PulseToSec(y, chartData.beat, timingCache) + ((y / 240) % 5) * 0.013 - 0.02;
+				if (prevTimeSec < hitSec && hitSec <= currentTimeSec)
+				{
+					input.buttons[laneIdx].down = true;
+					input.buttons[laneIdx].pressed = true;
+				}
+			}
+		}
+
+		for (std::size_t laneIdx = 0U; laneIdx < kson::kNumFXLanesSZ; ++laneIdx)
+		{
+			for (const auto& [y, note] : chartData.note.fx[laneIdx])
+			{
+				const double beginSec = kson::PulseToSec(y, chartData.beat, timingCache) - 0.03;
+				const double endSec = kson::PulseToSec(y + note.length, chartData.beat, timingCache) - 0.25;
+				Judgment::ButtonInput& button = input.buttons[kson::kNumBTLanesSZ + laneIdx];
+				button.pressed = beginSec <= currentTimeSec && currentTimeSec < std::max(endSec, beginSec + 0.05);
+				button.down = button.pressed && prevTimeSec < beginSec;
+				button.up = !button.pressed && beginSec <= prevTimeSec && prevTimeSec < std::max(endSec, beginSec + 0.05);
+			}
+		}
+
+		// 左LASERは右方向に一定速度で動かす(-0.0も含める)
+		input.laserDeltaCursorX[0] = std::fmod(currentTimeSec, 1.0) < 0.5 ? (currentTimeSec - prevTimeSec) * 1.2 : -0.0;
+
+		return input;
+	}
+
+	// GameMain::updateStatus()と同じ順序で判定を更新しながらリプレイを記録する
+	PlayResult RecordPlay(const kson::ChartData& chartData, const PlayOption& playOption, double frameRate, Optional<double> lockForExitTimeSec, ReplayData* pReplayData)
+	{
+		const kson::TimingCache timingCache = kson::CreateTimingCache(chartData.beat);
+		const NoteAttributeTable noteAttributeTable(chartData, timingCache, playOption.noteSkin);
+		GameStatusTimer gameStatusTimer(timingCache, playOption);
+		Judgment::JudgmentMain judgmentMain(chartData, timingCache, noteAttributeTable, playOption, none, playOption.gameMode);
+		GameStatus gameStatus;
+		ViewStatus viewStatus;
+
+		pReplayData->playOption = playOption;
+		pReplayData->frames.clear();
+
+		double prevTimeSec = -1.0;
+		const int32 maxFrames = static_cast<int32>(frameRate * 60);
+		for (int32 frameIdx = 0; frameIdx < maxFrames; ++frameIdx)
+		{
+			// フレーム間隔を揺らす
+			const double currentTimeSec = -1.0 + frameIdx / frameRate + (frameIdx % 3) * 0.0007;
+			gameStatusTimer.update(currentTimeSec, gameStatus);
+
+			const Judgment::JudgmentInput input = ScriptedInput(chartData, timingCache, currentTimeSec, prevTimeSec);
+			judgmentMain.update(chartData, input, gameStatus, viewStatus);
+			pReplayData->frames.push_back(ReplayFrame{ .currentTimeSec = currentTimeSec, .input = input });
+			judgmentMain.updatePlayFinishStatus(chartData, timingCache, gameStatus, viewStatus);
+
+			if (lockForExitTimeSec.has_value() && currentTimeSec >= *lockForExitTimeSec)
+			{
+				judgmentMain.lockForExit();
+				pReplayData->frames.back().isLockedForExit = true;
+				break;
+			}
+
+			if (gameStatus.playFinishStatus.has_value())
+			{
+				break;
+			}
+
+			prevTimeSec = currentTimeSec;
+		}
+
+		const IsHardFailedYN isHardFailed{ gameStatus.playFinishStatus.has_value() && gameStatus.playFinishStatus->isHardFailed };
+		return judgmentMain.playResult(chartData, timingCache, gameStatus.currentTimeSec, isHardFailed);
+	}
+
+	void RequireSamePlayResult(const PlayResult& a, const PlayResult& b)
+	{
+		REQUIRE(a.score == b.score);
+		REQUIRE(a.maxCombo == b.maxCombo);
+		REQUIRE(a.finalCourseCombo == b.finalCourseCombo);
+		REQUIRE(a.totalCombo == b.totalCombo);
+		REQUIRE(a.comboStats.critical == b.comboStats.critical);
+		REQUIRE(a.comboStats.nearFast == b.comboStats.nearFast);
+		REQUIRE(a.comboStats.nearSlow == b.comboStats.nearSlow);
+		REQUIRE(a.comboStats.error == b.comboStats.error);
+		REQUIRE(std::bit_cast<uint64>(a.comboStats.totalDeviationSec) == std::bit_cast<uint64>(b.comboStats.totalDeviationSec));
+		REQUIRE(a.comboStats.deviationCount == b.comboStats.deviationCount);
+		REQUIRE(std::bit_cast<uint64>(a.gaugePercentage) == std::bit_cast<uint64>(b.gaugePercentage));
+		REQUIRE(std::bit_cast<uint64>(a.gaugePercentageForGrade) == std::bit_cast<uint64>(b.gaugePercentageForGrade));
+		REQUIRE(a.gaugeValue == b.gaugeValue);
+		REQUIRE(std::bit_cast<uint64>(a.chartTimeProgress) == std::bit_cast<uint64>(b.chartTimeProgress));
+		REQUIRE(a.isHardFailed == b.isHardFailed);
+		REQUIRE(a.playOption.gaugeType == b.playOption.gaugeType);
+		REQUIRE(a.playOption.inputDelayMs == b.playOption.inputDelayMs);
+	}
+}
+
+TEST_CASE("Replay serialization round trip", "[Replay]")
+{
+	ReplayData replayData;
+	replayData.chartFileHash = 0x0123456789ABCDEFULL;
+	replayData.playOption = CreatePlayOptionForReplay();
+	replayData.playOption.turnMode = TurnMode::kRandom;
+	replayData.playOption.playbackSpeed = 1.25;
+	replayData.playOption.laserJudgmentPlayMode = JudgmentPlayMode::kAuto;
+	replayData.playOption.availableHispeedTypes = { Scroll::HispeedType::XMod, Scroll::HispeedType::CMod };
+	replayData.playOption.hispeedSetting = Scroll::HispeedSetting{ .type = Scroll::HispeedType::CMod, .value = 725 };
+	replayData.courseContinuation = CourseContinuation{ .gaugeValue = 4321, .combo = 99, .isNoError = false };
+
+	for (int32 i = 0; i < 300; ++i)
+	{
+		ReplayFrame frame;
+		frame.currentTimeSec = -1.0 + i / 61.7;
+		for (std::size_t buttonIdx = 0U; buttonIdx < Judgment::kNumJudgmentButtons; ++buttonIdx)
+		{
+			frame.input.buttons[buttonIdx].pressed = (i + buttonIdx) % 3 == 0;
+			frame.input.buttons[buttonIdx].down = (i + buttonIdx) % 5 == 0;
+			frame.input.buttons[buttonIdx].up = (i + buttonIdx) % 7 == 0;
+			if (frame.input.buttons[buttonIdx].down && i % 50 == 0)
+			{
+				frame.input.buttons[buttonIdx].downTimeOffsetSec = -0.0013 * static_cast<double>(buttonIdx + 1U);
+			}
+		}
+		frame.input.laserDeltaCursorX[0] = i % 4 == 0 ? 0.0 : i * 0.001;
+		frame.input.laserDeltaCursorX[1] = i % 2 == 0 ? -0.0 : -i * 0.002;
+		frame.isLockedForExit = i == 299;
+		replayData.frames.push_back(frame);
+	}
+
+	const std::string buffer = Serialize(replayData);
+	const Optional<ReplayData> loaded = Deserialize(buffer.data(), buffer.size());
+	REQUIRE(loaded.has_value());
+	REQUIRE(loaded->chartFileHash == replayData.chartFileHash);
+	REQUIRE(loaded->playOption.turnMode == TurnMode::kRandom);
+	REQUIRE(loaded->playOption.playbackSpeed == 1.25);
+	REQUIRE(loaded->playOption.gaugeType == GaugeType::kHardGauge);
+	REQUIRE(loaded->playOption.laserJudgmentPlayMode == JudgmentPlayMode::kAuto);
+	REQUIRE(loaded->playOption.inputDelayMs == 7);
+	REQUIRE(loaded->playOption.visualOffsetMs == -2);
+	REQUIRE(loaded->playOption.fastSlowMode == FastSlowMode::kShow);
+	REQUIRE(loaded->playOption.availableHispeedTypes == replayData.playOption.availableHispeedTypes);
+	REQUIRE(loaded->playOption.hispeedSetting.type == Scroll::HispeedType::CMod);
+	REQUIRE(loaded->playOption.hispeedSetting.value == 725);
+	REQUIRE(loaded->courseContinuation.has_value());
+	REQUIRE(loaded->courseContinuation->gaugeValue == 4321);
+	REQUIRE(loaded->courseContinuation->combo == 99);
+	REQUIRE_FALSE(loaded->courseContinuation->isNoError);
+	REQUIRE(loaded->frames == replayData.frames);
+
+	// -0.0と0.0はビット列で区別して保存される
+	REQUIRE(std::signbit(loaded->frames[0].input.laserDeltaCursorX[1]));
+	REQUIRE_FALSE(std::signbit(loaded->frames[0].input.laserDeltaCursorX[0]));
+
+	// LASERの移動量が0のフレームは時間・フラグ・ボタン分のみ
+	REQUIRE(buffer.size() < replayData.frames.size() * 28U);
+}
+
+TEST_CASE("Replay rejects broken data", "[Replay]")
+{
+	ReplayData replayData;
+	replayData.frames.resize(10);
+	const std::string buffer = Serialize(replayData);
+
+	SECTION("Truncated") {
+		REQUIRE_FALSE(Deserialize(buffer.data(), buffer.size() - 1).has_value());
+		REQUIRE_FALSE(Deserialize(buffer.data(), 4).has_value());
+	}
+
+	SECTION("Wrong magic") {
+		std::string broken = buffer;
+		broken[0] = 'X';
+		REQUIRE_FALSE(Deserialize(broken.data(), broken.size()).has_value());
+	}
+
+	SECTION("Empty") {
+		REQUIRE_FALSE(Deserialize(buffer.data(), 0).has_value());
+	}
+}
+
+TEST_CASE("Replay reproduces PlayResult bit-for-bit", "[Replay]")
+{
+	const kson::ChartData chartData = CreateChartDataForReplay();
+	const PlayOption playOption = CreatePlayOptionForReplay();
+
+	for (const double frameRate : { 30.0, 60.0, 144.0, 240.0 })
+	{
+		for (const Optional<double> lockForExitTimeSec : { Optional<double>{ none }, Optional<double>{ 9.0 } })
+		{
+			ReplayData replayData;
+			const PlayResult recordedResult = RecordPlay(chartData, playOption, frameRate, lockForExitTimeSec, &replayData);
+			REQUIRE(recordedResult.comboStats.totalJudgedCombo() > 0);
+
+			const std::string buffer = Serialize(replayData);
+			const Optional<ReplayData> loaded = Deserialize(buffer.data(), buffer.size());
+			REQUIRE(loaded.has_value());
+
+			const PlayResult replayedResult = SimulateJudgment(chartData, *loaded);
+			RequireSamePlayResult(recordedResult, replayedResult);
+
+			// 途中で抜けた場合は残りのノーツがERRORになる
+			if (lockForExitTimeSec.has_value())
+			{
+				REQUIRE(replayedResult.comboStats.totalJudgedCombo() == replayedResult.totalCombo);
+			}
+		}
+	}
+}
@@ -0,0 +1,160 @@
+﻿#include <catch2/catch.hpp>
+#include "ksmaudio/ksmaudio.hpp"
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+	constexpr std::size_t kSampleRate = 44100U;
+	constexpr std::size_t kNumChannels = 2U;
+	constexpr std::size_t kNumFrames = kSampleRate;
+	constexpr float kBGMValue = 0.25f;
+
+	std::string TempFilePath(const std::string& fileName)
+	{
+		return (std::filesystem::temp_directory_path() / fileName).string();
+	}
+
+	void WriteWavFile(const std::string& filePath, std::size_t numChannels, const std::vector<float>& data)
+	{
+		ksmaudio::WavFileWriter writer(filePath, kSampleRate, numChannels, ksmaudio::WavSampleFormat::kFloat32);
+		writer.write(data.data(), data.size() / numChannels);
+		writer.close();
+	}
+
+	// 効果音: 各サンプルが区別できるモノラルのランプ波形
+	std::vector<float> CreateSEData()
+	{
+		std::vector<float> data(100U);
+		for (std::size_t i = 0U; i < data.size(); ++i)
+		{
+			data[i] = static_cast<float>(i + 1U) / 128.0f;
+		}
+		return data;
+	}
+
+	std::vector<float> RenderAll(const ksmaudio::Stream& stream, std::size_t blockFrames)
+	{
+		std::vector<float> result(kNumFrames * kNumChannels);
+		std::size_t totalFrames = 0U;
+		while (totalFrames < kNumFrames)
+		{
+			const std::size_t numFrames = stream.render(result.data() + totalFrames * kNumChannels, std::min(blockFrames, kNumFrames - totalFrames));
+			if (numFrames == 0U)
+			{
+				break;
+			}
+			totalFrames += numFrames;
+		}
+		result.resize(totalFrames * kNumChannels);
+		return result;
+	}
+
+	// BGMの値を差し引いて効果音のみを取り出す(左チャンネル)
+	std::vector<float> ExtractSE(const std::vector<float>& rendered, float bgmValue)
+	{
+		std::vector<float> result(rendered.size() / kNumChannels);
+		for (std::size_t i = 0U; i < result.size(); ++i)
+		{
+			REQUIRE(rendered[i * kNumChannels] == rendered[i * kNumChannels + 1U]);
+			result[i] = rendered[i * kNumChannels] - bgmValue;
+		}
+		return result;
+	}
+
+	std::vector<float> ExpectedSE(std::initializer_list<std::pair<std::size_t, float>> starts, std::size_t cutFrameIdx = SIZE_MAX)
+	{
+		const std::vector<float> seData = CreateSEData();
+		std::vector<float> result(kNumFrames, 0.0f);
+		for (const auto& [startFrameIdx, volume] : starts)
+		{
+			for (std::size_t i = 0U; i < seData.size() && startFrameIdx + i < std::min(cutFrameIdx, kNumFrames); ++i)
+			{
+				result[startFrameIdx + i] += seData[i] * volume;
+			}
+			cutFrameIdx = SIZE_MAX;
+		}
+		return result;
+	}
+}
+
+TEST_CASE("Scheduled samples start at the exact frame of decode-only streams", "[ksmaudio][ScheduledSampleMixer]")
+{
+	ksmaudio::InitNoSound(kSampleRate);
+
+	const std::string bgmFilePath = TempFilePath("ksm_scheduled_sample_bgm.wav");
+	const std::string seFilePath = TempFilePath("ksm_scheduled_sample_se.wav");
+	WriteWavFile(bgmFilePath, kNumChannels, std::vector<float>(kNumFrames * kNumChannels, kBGMValue));
+	WriteWavFile(seFilePath, 1U, CreateSEData());
+
+	{
+		const ksmaudio::Sample se(seFilePath);
+		REQUIRE(se.pcm() != nullptr);
+		REQUIRE(se.pcm()->numFrames() == 100U);
+
+		SECTION("Start frames do not depend on the block size")
+		{
+			for (const std::size_t blockFrames : { 64U, 500U, 512U, 4096U })
+			{
+				INFO("blockFrames: " << blockFrames);
+
+				ksmaudio::Stream stream(bgmFilePath, 1.0, false, false, false, 1.0, true);
+				stream.enableScheduledSampleMixer();
+				REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 1000.0 / kSampleRate }, 1.0));
+				REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 511.0 / kSampleRate }, 0.5));
+				REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 20000.0 / kSampleRate }, 1.0));
+
+				const std::vector<float> rendered = RenderAll(stream, blockFrames);
+				REQUIRE(rendered.size() == kNumFrames * kNumChannels);
+				REQUIRE(ExtractSE(rendered, kBGMValue) == ExpectedSE({ { 511U, 0.5f }, { 1000U, 1.0f }, { 20000U, 1.0f } }));
+			}
+		}
+
+		SECTION("Stream volume and mute are not applied to scheduled samples")
+		{
+			ksmaudio::Stream stream(bgmFilePath, 0.5, false, false, false, 1.0, true);
+			stream.enableScheduledSampleMixer();
+			REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 300.0 / kSampleRate }, 1.0));
+			REQUIRE(ExtractSE(RenderAll(stream, 512U), kBGMValue * 0.5f) == ExpectedSE({ { 300U, 1.0f } }));
+
+			stream.seekPosSec(ksmaudio::SecondsF{ 0.0 });
+			stream.setMuted(true);
+			REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 300.0 / kSampleRate }, 1.0));
+			REQUIRE(ExtractSE(RenderAll(stream, 512U), 0.0f) == ExpectedSE({ { 300U, 1.0f } }));
+		}
+
+		SECTION("Seeking skips samples scheduled before the new position")
+		{
+			ksmaudio::Stream stream(bgmFilePath, 1.0, false, false, false, 1.0, true);
+			stream.enableScheduledSampleMixer();
+			REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 1000.0 / kSampleRate }, 1.0));
+			REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 30000.0 / kSampleRate }, 1.0));
+			stream.seekPosSec(ksmaudio::SecondsF{ 20000.0 / kSampleRate });
+
+			std::vector<float> rendered = RenderAll(stream, 512U);
+			REQUIRE(rendered.size() == (kNumFrames - 20000U) * kNumChannels);
+			rendered.insert(rendered.begin(), 20000U * kNumChannels, kBGMValue);
+			REQUIRE(ExtractSE(rendered, kBGMValue) == ExpectedSE({ { 30000U, 1.0f } }));
+		}
+
+		SECTION("Max polyphony stops the oldest voice at the start of the new one")
+		{
+			ksmaudio::Stream stream(bgmFilePath, 1.0, false, false, false, 1.0, true);
+			stream.enableScheduledSampleMixer();
+			REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 500.0 / kSampleRate }, 1.0));
+			REQUIRE(stream.scheduleSample(se, ksmaudio::SecondsF{ 530.0 / kSampleRate }, 1.0));
+			REQUIRE(ExtractSE(RenderAll(stream, 512U), kBGMValue) == ExpectedSE({ { 500U, 1.0f }, { 530U, 1.0f } }, 530U));
+		}
+
+		SECTION("Streams without the mixer reject scheduled samples")
+		{
+			const ksmaudio::Stream stream(bgmFilePath, 1.0, false, false, false, 1.0, true);
+			REQUIRE_FALSE(stream.hasScheduledSampleMixer());
+			REQUIRE_FALSE(stream.scheduleSample(se, ksmaudio::SecondsF{ 0.0 }, 1.0));
+		}
+	}
+
+	std::filesystem::remove(bgmFilePath);
+	std::filesystem::remove(seFilePath);
+	ksmaudio::Terminate();
+}
@@ -0,0 +1,177 @@
+﻿#include <catch2/catch.hpp>
+#include "HighScore/ScoreDatabase.hpp"
+
+namespace
+{
+	FilePath PrepareDirectory(StringView name)
+	{
+		const FilePath directoryPath = FileSystem::PathAppend(FileSystem::TemporaryDirectoryPath(), name);
+		FileSystem::Remove(directoryPath);
+		FileSystem::CreateDirectories(directoryPath);
+		return directoryPath;
+	}
+
+	KscValue MakeKscValue(int32 score, int32 playCount)
+	{
+		return KscValue{
+			.score = score,
+			.achievement = Achievement::kCleared,
+			.grade = Grade::kA,
+			.percent = 80,
+			.maxCombo = 100,
+			.playCount = playCount,
+			.clearCount = playCount,
+		};
+	}
+}
+
+TEST_CASE("ScoreDatabase restores committed scores after reopening", "[ScoreDatabase]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_score_database_reopen");
+	const ScoreDatabase::OwnerKey ownerKey = ScoreDatabase::ChartOwnerKey(U"folder/chart_ex");
+	const KscKey condition{ .gaugeType = GaugeType::kHardGauge };
+
+	{
+		ScoreDatabase database{ directoryPath };
+		REQUIRE(database.commit(ownerKey, condition, MakeKscValue(9000000, 1)));
+		REQUIRE(database.commit(ownerKey, condition, MakeKscValue(9500000, 2)));
+		REQUIRE(database.read(ownerKey, condition).hardGauge.score == 9500000);
+	}
+
+	ScoreDatabase database{ directoryPath };
+	const HighScoreInfo highScoreInfo = database.read(ownerKey, condition);
+	REQUIRE(highScoreInfo.hardGauge.score == 9500000);
+	REQUIRE(highScoreInfo.hardGauge.playCount == 2);
+	REQUIRE(highScoreInfo.normalGauge.playCount == 0);
+
+	// 他の譜面・条件には影響しない
+	REQUIRE(database.read(ScoreDatabase::ChartOwnerKey(U"folder/chart_in"), condition).hardGauge.score == 0);
+	REQUIRE(database.read(ScoreDatabase::CourseOwnerKey(U"folder/chart_ex"), condition).hardGauge.score == 0);
+	REQUIRE(database.read(ownerKey, KscKey{ .turnMode = TurnMode::kMirror }).hardGauge.score == 0);
+
+	FileSystem::Remove(directoryPath);
+}
+
+TEST_CASE("ScoreDatabase reflects staged scores before they are flushed", "[ScoreDatabase]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_score_database_staged");
+	const ScoreDatabase::OwnerKey ownerKey = ScoreDatabase::ChartOwnerKey(U"chart");
+	const KscKey condition{};
+
+	{
+		ScoreDatabase database{ directoryPath };
+		database.stage(ownerKey, condition, MakeKscValue(7000000, 1));
+		database.stage(ownerKey, condition, MakeKscValue(7500000, 2));
+		REQUIRE(database.read(ownerKey, condition).normalGauge.score == 7500000);
+
+		// 未追記のレコードはファイルに存在しない
+		REQUIRE(ScoreDatabase{ directoryPath }.read(ownerKey, condition).normalGauge.score == 0);
+
+		REQUIRE(database.flushStaged());
+		REQUIRE(database.flushStaged());
+	}
+
+	REQUIRE(ScoreDatabase{ directoryPath }.read(ownerKey, condition).normalGauge.playCount == 2);
+
+	FileSystem::Remove(directoryPath);
+}
+
+TEST_CASE("ScoreDatabase discards a truncated log record", "[ScoreDatabase]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_score_database_truncated");
+	const ScoreDatabase::OwnerKey ownerKey = ScoreDatabase::ChartOwnerKey(U"chart");
+	const KscKey condition{};
+	const FilePath logFilePath = FileSystem::PathAppend(directoryPath, ScoreDatabase::kLogFilename);
+
+	{
+		ScoreDatabase database{ directoryPath };
+		REQUIRE(database.commit(ownerKey, condition, MakeKscValue(8000000, 1)));
+	}
+	const int64 validLogSize = FileSystem::FileSize(logFilePath);
+	{
+		// 2つ目のレコードの追記中に電源が落ちた状態を再現
+		ScoreDatabase database{ directoryPath };
+		REQUIRE(database.commit(ownerKey, condition, MakeKscValue(8800000, 2)));
+	}
+	const Blob logContent{ logFilePath };
+	REQUIRE(logContent.size() > 10U);
+	{
+		BinaryWriter writer{ logFilePath };
+		writer.write(logContent.data(), logContent.size() - 10);
+	}
+
+	ScoreDatabase database{ directoryPath };
+	REQUIRE(database.read(ownerKey, condition).normalGauge.score == 8000000);
+
+	// 開いた時点でスナップショットへ統合され、ログは空になる
+	REQUIRE(FileSystem::FileSize(logFilePath) < validLogSize);
+	REQUIRE(database.commit(ownerKey, condition, MakeKscValue(8900000, 2)));
+	REQUIRE(ScoreDatabase{ directoryPath }.read(ownerKey, condition).normalGauge.score == 8900000);
+
+	FileSystem::Remove(directoryPath);
+}
+
+TEST_CASE("ScoreDatabase compacts the log into the snapshot", "[ScoreDatabase]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_score_database_compaction");
+	const KscKey condition{};
+
+	{
+		ScoreDatabase database{ directoryPath };
+		for (int32 i = 0; i < ScoreDatabase::kCompactionThreshold; ++i)
+		{
+			REQUIRE(database.commit(ScoreDatabase::ChartOwnerKey(U"chart{}"_fmt(i)), condition, MakeKscValue(i, 1)));
+		}
+	}
+
+	// ログにはヘッダのみが残る
+	REQUIRE(FileSystem::FileSize(FileSystem::PathAppend(directoryPath, ScoreDatabase::kLogFilename)) == 12);
+
+	ScoreDatabase database{ directoryPath };
+	for (int32 i = 0; i < ScoreDatabase::kCompactionThreshold; ++i)
+	{
+		REQUIRE(database.read(ScoreDatabase::ChartOwnerKey(U"chart{}"_fmt(i)), condition).normalGauge.score == i);
+	}
+
+	FileSystem::Remove(directoryPath);
+}
+
+TEST_CASE("ScoreDatabase imports ksc files", "[ScoreDatabase]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_score_database_import");
+	FileSystem::CreateDirectories(FileSystem::PathAppend(directoryPath, U"folder"));
+	{
+		TextWriter writer{ FileSystem::PathAppend(directoryPath, U"folder/chart_ex.ksc"), TextEncoding::UTF8_NO_BOM };
+		writer.write(U"normal,normal,normal,on,on,on={}\n"_fmt(MakeKscValue(9100000, 3).toString()));
+		writer.write(U"hard,normal,normal,on,on,on={}\n"_fmt(MakeKscValue(9200000, 4).toString()));
+		writer.write(U"easy,mirror,x09,on,on,on={}\n"_fmt(MakeKscValue(9300000, 5).toString()));
+	}
+
+	{
+		ScoreDatabase database{ directoryPath };
+		REQUIRE(database.importKscDirectory(directoryPath, false) == 1);
+		REQUIRE(database.compact());
+	}
+
+	ScoreDatabase database{ directoryPath };
+	HashTable<String, HighScoreInfo> highScoreInfoMap;
+	database.readAll(ScoreDatabase::ChartOwnerKey(U"folder/chart_ex"), &highScoreInfoMap);
+	REQUIRE(highScoreInfoMap.size() == 2U);
+	REQUIRE(highScoreInfoMap[U"normal,normal,on,on,on"].normalGauge.score == 9100000);
+	REQUIRE(highScoreInfoMap[U"normal,normal,on,on,on"].hardGauge.playCount == 4);
+	REQUIRE(highScoreInfoMap[U"mirror,x09,on,on,on"].easyGauge.score == 9300000);
+
+	FileSystem::Remove(directoryPath);
+}
+
+TEST_CASE("ScoreDatabase uses the same gauge type strings as KscKey", "[ScoreDatabase]")
+{
+	for (int32 i = 0; i < kNumGaugeTypes; ++i)
+	{
+		const GaugeType gaugeType = static_cast<GaugeType>(i);
+		const KscKey kscKey{ .gaugeType = gaugeType };
+		REQUIRE(kscKey.toString().starts_with(KscKey::GaugeTypeStr(gaugeType)));
+		REQUIRE(KscKey::ParseGaugeType(KscKey::GaugeTypeStr(gaugeType)) == gaugeType);
+	}
+	REQUIRE_FALSE(KscKey::ParseGaugeType(U"unknown").has_value());
+}
@@ -0,0 +1,146 @@
+﻿#include <catch2/catch.hpp>
+#include <filesystem>
+#include "SongLibrary/SongLibraryIndex.hpp"
+
+namespace
+{
+	FilePath PrepareDirectory(StringView name)
+	{
+		const FilePath directoryPath = FileSystem::PathAppend(FileSystem::TemporaryDirectoryPath(), name);
+		FileSystem::Remove(directoryPath);
+		FileSystem::CreateDirectories(directoryPath);
+		return directoryPath;
+	}
+
+	// タイトルは同じ長さにしておき、書き換えてもファイルサイズが変わらないようにする
+	void WriteChartFile(FilePathView filePath, StringView title)
+	{
+		TextWriter writer(filePath, TextEncoding::UTF8_WITH_BOM);
+		writer.writeln(U"title={}"_fmt(title));
+		writer.writeln(U"artist=test");
+		writer.writeln(U"difficulty=extended");
+		writer.writeln(U"level=12");
+		writer.writeln(U"t=120");
+		writer.writeln(U"m=bgm.ogg");
+		writer.writeln(U"o=0");
+		writer.writeln(U"po=1000");
+		writer.writeln(U"plength=15000");
+		writer.writeln(U"ver=167");
+		writer.writeln(U"--");
+		writer.writeln(U"1000|00|--");
+		writer.writeln(U"--");
+	}
+
+	// 更新日時・サイズを変えずに譜面の内容を書き換える
+	// (インデックスが使用された場合は書き換え前の内容が返る)
+	void RewriteChartFileKeepingStamp(FilePathView filePath, StringView title)
+	{
+		const std::filesystem::path fsPath{ filePath.toWstr() };
+		const auto writeTime = std::filesystem::last_write_time(fsPath);
+		WriteChartFile(filePath, title);
+		std::filesystem::last_write_time(fsPath, writeTime);
+	}
+
+	SongLibraryIndex::ChartEntry GetChartEntry(FilePathView directoryPath, FilePathView chartFilePath)
+	{
+		const KscIO::KscPathContext kscPathContext{
+			.songsDirectoryPath = FilePath{ directoryPath },
+			.currentPlayer = U"ksm_test_song_library_index",
+		};
+		return SongLibraryIndex::GetChartEntry(chartFilePath, kscPathContext);
+	}
+
+	Blob ReadIndexFile(FilePathView indexFilePath)
+	{
+		return Blob{ indexFilePath };
+	}
+
+	void WriteIndexFile(FilePathView indexFilePath, const void* data, std::size_t size)
+	{
+		BinaryWriter writer{ indexFilePath };
+		writer.write(data, static_cast<int64>(size));
+	}
+}
+
+TEST_CASE("SongLibraryIndex restores chart metadata after saving and reloading", "[SongLibraryIndex]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_song_library_index_roundtrip");
+	const FilePath chartFilePath = FileSystem::PathAppend(directoryPath, U"chart.ksh");
+	const FilePath indexFilePath = FileSystem::PathAppend(directoryPath, U"songlibrary.idx");
+
+	SongLibraryIndex::Load(indexFilePath);
+	WriteChartFile(chartFilePath, U"Index AAAA");
+	REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index AAAA");
+	REQUIRE(SongLibraryIndex::Save(indexFilePath));
+	REQUIRE(FileSystem::IsFile(indexFilePath));
+	REQUIRE_FALSE(FileSystem::IsFile(indexFilePath + U".tmp"));
+
+	RewriteChartFileKeepingStamp(chartFilePath, U"Index BBBB");
+	SongLibraryIndex::Load(indexFilePath);
+
+	const SongLibraryIndex::ChartEntry chartEntry = GetChartEntry(directoryPath, chartFilePath);
+	const kson::MetaChartData& chartData = chartEntry.chartData;
+	REQUIRE(chartData.meta.title == "Index AAAA");
+	REQUIRE(chartData.meta.artist == "test");
+	REQUIRE(chartData.meta.difficulty.idx == 2);
+	REQUIRE(chartData.meta.level == 12);
+	REQUIRE(chartData.meta.dispBPM == "120");
+	REQUIRE(chartData.audio.bgm.filename == "bgm.ogg");
+	REQUIRE(chartData.audio.bgm.preview.offset == 1000);
+	REQUIRE(chartData.audio.bgm.preview.duration == 15000);
+
+	// 譜面ファイルのサイズが変化した場合は読み込み直す
+	WriteChartFile(chartFilePath, U"Index CCCCC");
+	REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index CCCCC");
+
+	FileSystem::Remove(directoryPath);
+}
+
+TEST_CASE("SongLibraryIndex discards truncated or outdated index files", "[SongLibraryIndex]")
+{
+	const FilePath directoryPath = PrepareDirectory(U"ksm_test_song_library_index_invalid");
+	const FilePath chartFilePath = FileSystem::PathAppend(directoryPath, U"chart.ksh");
+	const FilePath indexFilePath = FileSystem::PathAppend(directoryPath, U"songlibrary.idx");
+
+	SongLibraryIndex::Load(indexFilePath);
+	WriteChartFile(chartFilePath, U"Index AAAA");
+	REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index AAAA");
+	REQUIRE(SongLibraryIndex::Save(indexFilePath));
+	const Blob savedIndex = ReadIndexFile(indexFilePath);
+	REQUIRE(savedIndex.size() > 16U);
+
+	RewriteChartFileKeepingStamp(chartFilePath, U"Index BBBB");
+
+	SECTION("Truncated index")
+	{
+		WriteIndexFile(indexFilePath, savedIndex.data(), savedIndex.size() - 8U);
+		SongLibraryIndex::Load(indexFilePath);
+		REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index BBBB");
+	}
+
+	SECTION("Index with a different format version")
+	{
+		// マジックナンバー(8バイト)の直後がフォーマットバージョン
+		Array<Byte> data(savedIndex.begin(), savedIndex.end());
+		data[8] = static_cast<Byte>(static_cast<uint8>(data[8]) + 1U);
+		WriteIndexFile(indexFilePath, data.data(), data.size());
+		SongLibraryIndex::Load(indexFilePath);
+		REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index BBBB");
+	}
+
+	SECTION("Index with a different magic number")
+	{
+		Array<Byte> data(savedIndex.begin(), savedIndex.end());
+		data[0] = Byte{ 'X' };
+		WriteIndexFile(indexFilePath, data.data(), data.size());
+		SongLibraryIndex::Load(indexFilePath);
+		REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index BBBB");
+	}
+
+	// 破棄したインデックスは次回の保存で作り直される
+	REQUIRE(SongLibraryIndex::Save(indexFilePath));
+	SongLibraryIndex::Load(indexFilePath);
+	REQUIRE(GetChartEntry(directoryPath, chartFilePath).chartData.meta.title == "Index BBBB");
+
+	FileSystem::Remove(directoryPath);
+}
@@ -0,0 +1,105 @@
+﻿#include <catch2/catch.hpp>
+#include "SongLibrary/SongPreviewClipCache.hpp"
+#include "ksmaudio/ksmaudio.hpp"
+
+namespace
+{
+	constexpr std::size_t kSampleRate = 44100U;
+	constexpr std::size_t kNumChannels = 2U;
+
+	// WAVファイルのヘッダサイズ(ksmaudio::WavFileWriterが書き出すRIFF/fmt/dataチャンクのヘッダ)
+	constexpr int64 kWavHeaderSize = 44;
+
+	FilePath TempFilePath(StringView fileName)
+	{
+		return FileSystem::PathAppend(FileSystem::TemporaryDirectoryPath(), fileName);
+	}
+
+	void WriteSourceWavFile(FilePathView filePath, std::size_t numFrames)
+	{
+		std::vector<float> data(numFrames * kNumChannels);
+		for (std::size_t i = 0U; i < numFrames; ++i)
+		{
+			const float t = static_cast<float>(i) / kSampleRate;
+			data[i * 2U] = 0.3f * std::sin(t * 440.0f * 6.2831853f);
+			data[i * 2U + 1U] = 0.3f * std::sin(t * 660.0f * 6.2831853f);
+		}
+
+		ksmaudio::WavFileWriter writer(Unicode::ToUTF8(filePath), kSampleRate, kNumChannels, ksmaudio::WavSampleFormat::kFloat32);
+		writer.write(data.data(), numFrames);
+		writer.close();
+	}
+
+	int64 NumClipFrames(FilePathView clipFilePath)
+	{
+		// プレビュー区間の音声ファイルは16bit PCMで保存される
+		return (FileSystem::FileSize(clipFilePath) - kWavHeaderSize) / static_cast<int64>(kNumChannels * sizeof(int16));
+	}
+}
+
+TEST_CASE("SongPreviewClipCache stores the whole preview duration", "[SongPreviewClipCache]")
+{
+	ksmaudio::InitNoSound();
+
+	const FilePath sourceFilePath = TempFilePath(U"ksm_test_song_preview_clip_cache_length.wav");
+	WriteSourceWavFile(sourceFilePath, kSampleRate * 3U);
+
+	// 1.4秒はdouble上で44100を掛けると61739.99...となり、切り捨てると1フレーム短くなる
+	const SecondsF offset{ 0.5 };
+	const SecondsF duration{ 1400 / 1000.0 };
+	REQUIRE(SongPreviewClipCache::Create(sourceFilePath, offset, duration));
+
+	const Optional<FilePath> clipFilePath = SongPreviewClipCache::Find(sourceFilePath, offset, duration);
+	REQUIRE(clipFilePath.has_value());
+	REQUIRE(NumClipFrames(*clipFilePath) == 61740);
+
+	SongPreviewClipCache::Remove(*clipFilePath);
+	REQUIRE_FALSE(SongPreviewClipCache::Find(sourceFilePath, offset, duration).has_value());
+
+	SECTION("Clips overlapping the end of the song are shorter than the preview duration")
+	{
+		const SecondsF lateOffset{ 2.5 };
+		REQUIRE(SongPreviewClipCache::Create(sourceFilePath, lateOffset, duration));
+
+		const Optional<FilePath> lateClipFilePath = SongPreviewClipCache::Find(sourceFilePath, lateOffset, duration);
+		REQUIRE(lateClipFilePath.has_value());
+		REQUIRE(NumClipFrames(*lateClipFilePath) == static_cast<int64>(kSampleRate / 2U));
+
+		SongPreviewClipCache::Remove(*lateClipFilePath);
+	}
+
+	FileSystem::Remove(sourceFilePath);
+	ksmaudio::Terminate();
+}
+
+TEST_CASE("SongPreviewClipCache invalidates clips when the source file changes", "[SongPreviewClipCache]")
+{
+	ksmaudio::InitNoSound();
+
+	const FilePath sourceFilePath = TempFilePath(U"ksm_test_song_preview_clip_cache_stamp.wav");
+	WriteSourceWavFile(sourceFilePath, kSampleRate * 3U);
+
+	const SecondsF offset{ 0.5 };
+	const SecondsF duration{ 1.0 };
+	REQUIRE(SongPreviewClipCache::Create(sourceFilePath, offset, duration));
+	const Optional<FilePath> clipFilePath = SongPreviewClipCache::Find(sourceFilePath, offset, duration);
+	REQUIRE(clipFilePath.has_value());
+
+	// プレビュー区間が異なれば別のキャッシュとして扱う
+	REQUIRE_FALSE(SongPreviewClipCache::Find(sourceFilePath, offset, SecondsF{ 2.0 }).has_value());
+	REQUIRE_FALSE(SongPreviewClipCache::Find(sourceFilePath, SecondsF{ 1.0 }, duration).has_value());
+
+	// 元の音声ファイルが差し替えられた(サイズが変化した)場合は古いキャッシュを使わない
+	WriteSourceWavFile(sourceFilePath, kSampleRate * 4U);
+	REQUIRE_FALSE(SongPreviewClipCache::Find(sourceFilePath, offset, duration).has_value());
+
+	REQUIRE(SongPreviewClipCache::Create(sourceFilePath, offset, duration));
+	const Optional<FilePath> newClipFilePath = SongPreviewClipCache::Find(sourceFilePath, offset, duration);
+	REQUIRE(newClipFilePath.has_value());
+	REQUIRE(*newClipFilePath != *clipFilePath);
+
+	SongPreviewClipCache::Remove(*clipFilePath);
+	SongPreviewClipCache::Remove(*newClipFilePath);
+	FileSystem::Remove(sourceFilePath);
+	ksmaudio::Terminate();
+}
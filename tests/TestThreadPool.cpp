@@ -0,0 +1,56 @@
+﻿#include <catch2/catch.hpp>
+#include "Common/ThreadPool.hpp"
+#include "Common/CancellationToken.hpp"
+
+TEST_CASE("ThreadPool runs all submitted tasks before destruction", "[ThreadPool]")
+{
+	std::atomic<int32> counter = 0;
+	{
+		ThreadPool threadPool{ 4 };
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			threadPool.submit([&counter] { ++counter; });
+		}
+	}
+	REQUIRE(counter.load() == 1000);
+}
+
+TEST_CASE("ThreadPool runs tasks submitted from worker threads", "[ThreadPool]")
+{
+	std::atomic<int32> counter = 0;
+	{
+		ThreadPool threadPool{ 2 };
+		for (int32 i = 0; i < 10; ++i)
+		{
+			threadPool.submit([&threadPool, &counter]
+			{
+				for (int32 j = 0; j < 10; ++j)
+				{
+					threadPool.submit([&counter] { ++counter; });
+				}
+			});
+		}
+	}
+	REQUIRE(counter.load() == 100);
+}
+
+TEST_CASE("ThreadPool keeps running after a task throws", "[ThreadPool]")
+{
+	std::atomic<int32> counter = 0;
+	{
+		ThreadPool threadPool{ 1 };
+		threadPool.submit([] { throw Error{ U"test" }; });
+		threadPool.submit([&counter] { ++counter; });
+	}
+	REQUIRE(counter.load() == 1);
+}
+
+TEST_CASE("CancellationToken copies share state", "[CancellationToken]")
+{
+	CancellationToken token;
+	const CancellationToken copiedToken = token;
+	REQUIRE(!copiedToken.isCancelled());
+
+	token.cancel();
+	REQUIRE(copiedToken.isCancelled());
+}